@@ -25,12 +25,54 @@
 
 #include "loggerwithfile.h"
 #include "mainbench.h"
+#include "benchallocations.h"
 #include "dsp/dsptypes.h"
 
 #ifndef _WIN32
 
 #include <signal.h>
 #include <unistd.h>
+#include <cstdlib>
+#include <new>
+
+// Count heap allocations for the benchmarks. On Windows each DLL has its own
+// allocator so this would only see the executable allocations: not done there.
+void* operator new(std::size_t size)
+{
+    BenchAllocations::count(size);
+    void *p = std::malloc(size == 0 ? 1 : size);
+
+    if (!p) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
 
 void handler(int sig) {
     fprintf(stderr, "quit the application by signal(%d).\n", sig);
@@ -68,6 +110,7 @@ static int runQtApplication(int argc, char* argv[], qtwebapp::LoggerWithFile *lo
     int catchSignals[] = {SIGQUIT, SIGINT, SIGTERM, SIGHUP};
     std::vector<int> vsig(catchSignals, catchSignals + sizeof(catchSignals) / sizeof(int));
     catchUnixSignals(vsig);
+    BenchAllocations::setEnabled(true);
 #endif
 
     ParserBench parser;
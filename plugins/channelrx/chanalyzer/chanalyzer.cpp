@@ -157,6 +157,11 @@ void ChannelAnalyzer::stop()
 	m_thread.wait();
 }
 
+SampleSinkFifo *ChannelAnalyzer::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool ChannelAnalyzer::handleMessage(const Message& cmd)
 {
     if (MsgConfigureChannelAnalyzer::match(cmd))
@@ -105,6 +105,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
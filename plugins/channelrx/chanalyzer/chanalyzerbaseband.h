@@ -73,6 +73,7 @@ public:
     Real getPllDeltaPhase() const { return m_sink.getPllDeltaPhase(); }
     Real getPllPhase() const { return m_sink.getPllPhase(); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -35,6 +35,7 @@
 #include "SWGADSBDemodSettings.h"
 #include "SWGChannelReport.h"
 #include "SWGADSBDemodReport.h"
+#include "SWGADSBDemodAircraftState.h"
 #include "SWGTargetAzimuthElevation.h"
 
 #include "dsp/dspengine.h"
@@ -110,6 +111,13 @@ ADSBDemod::~ADSBDemod()
     delete m_thread;
 }
 
+void ADSBDemod::setMessageQueueToGUI(MessageQueue* queue)
+{
+    ChannelAPI::setMessageQueueToGUI(queue);
+    m_basebandSink->setMessageQueueToGUI(queue);
+    m_worker->setMessageQueueToGUI(queue); // aircraft state
+}
+
 void ADSBDemod::setDeviceAPI(DeviceAPI *deviceAPI)
 {
     if (deviceAPI != m_deviceAPI)
@@ -160,6 +168,11 @@ void ADSBDemod::stop()
     m_thread->wait();
 }
 
+SampleSinkFifo *ADSBDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool ADSBDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureADSBDemod::match(cmd))
@@ -636,6 +649,47 @@ void ADSBDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& respons
         response.getAdsbDemodReport()->setTargetElevation(m_targetElevation);
         response.getAdsbDemodReport()->setTargetRange(m_targetRange);
     }
+
+    QList<ADSBAircraftState> aircraftStates;
+    m_worker->getAircraftStates(aircraftStates);
+    response.getAdsbDemodReport()->setAircraftCount(aircraftStates.size());
+    QList<SWGSDRangel::SWGADSBDemodAircraftState*> *swgAircraftStates = response.getAdsbDemodReport()->getAircraft();
+
+    for (const auto& state : aircraftStates)
+    {
+        SWGSDRangel::SWGADSBDemodAircraftState *swgState = new SWGSDRangel::SWGADSBDemodAircraftState();
+        swgState->setIcao(new QString(QString("%1").arg(state.m_icao, 6, 16, QLatin1Char('0'))));
+        swgState->setCallsign(new QString(state.m_callsign));
+        swgState->setEmitterCategory(new QString(state.m_emitterCategory));
+        swgState->setStatus(new QString(state.m_status));
+
+        if (state.m_squawkValid) {
+            swgState->setSquawk(state.m_squawk);
+        }
+        if (state.m_positionValid)
+        {
+            swgState->setLatitude(state.m_latitude);
+            swgState->setLongitude(state.m_longitude);
+        }
+        if (state.m_altitudeValid) {
+            swgState->setAltitude(state.m_altitude);
+        }
+        if (state.m_headingValid) {
+            swgState->setHeading(state.m_heading);
+        }
+        if (state.m_groundspeedValid) {
+            swgState->setGroundspeed(state.m_groundspeed);
+        }
+        if (state.m_verticalRateValid) {
+            swgState->setVerticalRate(state.m_verticalRate);
+        }
+
+        swgState->setOnSurface(state.m_onSurface ? 1 : 0);
+        swgState->setFrameCount(state.m_frameCount);
+        swgState->setCorrelation(CalcDb::dbPower(state.m_correlation));
+        swgState->setDateTime(new QString(state.m_time.toString(Qt::ISODateWithMs)));
+        swgAircraftStates->append(swgState);
+    }
 }
 
 void ADSBDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const ADSBDemodSettings& settings, bool force)
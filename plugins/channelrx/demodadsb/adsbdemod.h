@@ -94,6 +94,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -122,10 +124,7 @@ public:
             SWGSDRangel::SWGChannelSettings& response);
 
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_basebandSink->getMagSqLevels(avg, peak, nbSamples); }
-    void setMessageQueueToGUI(MessageQueue* queue) override {
-        ChannelAPI::setMessageQueueToGUI(queue);
-        m_basebandSink->setMessageQueueToGUI(queue);
-    }
+    void setMessageQueueToGUI(MessageQueue* queue) override;
 
     void setTarget(const QString& name, float targetAzimuth, float targetElevation, float targetRange);
     void clearTarget() { m_targetAzElValid = false; }
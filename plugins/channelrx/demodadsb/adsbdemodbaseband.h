@@ -70,6 +70,7 @@ public:
     void setMessageQueueToWorker(MessageQueue *messageQueue) { m_sink.setMessageQueueToWorker(messageQueue); }
     void setBasebandSampleRate(int sampleRate);
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -62,65 +62,9 @@
 #include "adsbdemoddisplaydialog.h"
 #include "adsbdemodnotificationdialog.h"
 #include "adsb.h"
+#include "adsbdemodstateengine.h"
 #include "adsbosmtemplateserver.h"
 
-const char ADSBDemodGUI::m_idMap[] = "#ABCDEFGHIJKLMNOPQRSTUVWXYZ##### ############-##0123456789######";
-
-const QString ADSBDemodGUI::m_categorySetA[] = {
-    QStringLiteral("None"),
-    QStringLiteral("Light"),
-    QStringLiteral("Small"),
-    QStringLiteral("Large"),
-    QStringLiteral("High vortex"),
-    QStringLiteral("Heavy"),
-    QStringLiteral("High performance"),
-    QStringLiteral("Rotorcraft")
-};
-
-const QString ADSBDemodGUI::m_categorySetB[] = {
-    QStringLiteral("None"),
-    QStringLiteral("Glider/sailplane"),
-    QStringLiteral("Lighter-than-air"),
-    QStringLiteral("Parachutist"),
-    QStringLiteral("Ultralight"),
-    QStringLiteral("Reserved"),
-    QStringLiteral("UAV"),
-    QStringLiteral("Space vehicle")
-};
-
-const QString ADSBDemodGUI::m_categorySetC[] = {
-    QStringLiteral("None"),
-    QStringLiteral("Emergency vehicle"),
-    QStringLiteral("Service vehicle"),
-    QStringLiteral("Ground obstruction"),
-    QStringLiteral("Cluster obstacle"),
-    QStringLiteral("Line obstacle"),
-    QStringLiteral("Reserved"),
-    QStringLiteral("Reserved")
-};
-
-const QString ADSBDemodGUI::m_emergencyStatus[] = {
-    QStringLiteral("No emergency"),
-    QStringLiteral("General emergency"),
-    QStringLiteral("Lifeguard/Medical"),
-    QStringLiteral("Minimum fuel"),
-    QStringLiteral("No communications"),
-    QStringLiteral("Unlawful interference"),
-    QStringLiteral("Downed aircraft"),
-    QStringLiteral("Reserved")
-};
-
-const QString ADSBDemodGUI::m_flightStatuses[] = {
-    QStringLiteral("Airbourne"),
-    QStringLiteral("On-ground"),
-    QStringLiteral("Alert, airboune"),
-    QStringLiteral("Alert, on-ground"),
-    QStringLiteral("Alert, SPI"),
-    QStringLiteral("SPI"),
-    QStringLiteral("Reserved"),
-    QStringLiteral("Not assigned")
-};
-
 const QString ADSBDemodGUI::m_hazardSeverity[] = {
     "NIL", "Light", "Moderate", "Severe"
 };
@@ -168,46 +112,6 @@ bool ADSBDemodGUI::deserialize(const QByteArray& data)
     }
 }
 
-// Longitude zone (returns value in range [1,59]
-static int cprNL(double lat)
-{
-    if (lat == 0.0)
-    {
-        return 59;
-    }
-    else if ((lat == 87.0) || (lat == -87.0))
-    {
-        return 2;
-    }
-    else if ((lat > 87.0) || (lat < -87.0))
-    {
-        return 1;
-    }
-    else
-    {
-        double nz = 15.0;
-        double n = 1 - std::cos(M_PI / (2.0 * nz));
-        double d = std::cos(std::fabs(lat) * M_PI/180.0);
-        return std::floor((M_PI * 2.0) / std::acos(1.0 - (n/(d*d))));
-    }
-}
-
-static int cprN(double lat, int odd)
-{
-    int nl = cprNL(lat) - odd;
-    if (nl > 1) {
-        return nl;
-    } else {
-        return 1;
-    }
-}
-
-// Can't use std::fmod, as that works differently for negative numbers (See C.2.6.2)
-static Real modulus(double x, double y)
-{
-    return x - y * std::floor(x/y);
-}
-
 QString Aircraft::getImage() const
 {
     if (m_emitterCategory.length() > 0)
@@ -763,29 +667,6 @@ void ADSBDemodGUI::updatePosition(Aircraft *aircraft)
     }
 }
 
-// Called when we have lat & long from local decode and we need to check if it is in a valid range (<180nm/333km)
-// or 1/4 of that for surface positions
-bool ADSBDemodGUI::updateLocalPosition(Aircraft *aircraft, double latitude, double longitude, bool surfacePosition)
-{
-    // Calculate range to aircraft from station
-    m_azEl.setTarget(latitude, longitude, Units::feetToMetres(aircraft->m_altitude));
-    m_azEl.calculate();
-
-    // Don't use the full 333km, as there may be some error in station position
-    if (m_azEl.getDistance() < (surfacePosition ? 80000 : 320000))
-    {
-        aircraft->m_latitude = latitude;
-        aircraft->m_longitude = longitude;
-        updatePosition(aircraft);
-        return true;
-    }
-    else
-    {
-        //qDebug() << "Local position out of range - calculated distance: " << m_azEl.getDistance();
-        return false;
-    }
-}
-
 void ADSBDemodGUI::sendToMap(Aircraft *aircraft, QList<SWGSDRangel::SWGMapAnimation *> *animations)
 {
     // Send to Map feature
@@ -1067,610 +948,227 @@ bool ADSBDemodGUI::calcAirTemp(Aircraft *aircraft)
     }
 }
 
-void ADSBDemodGUI::handleADSB(
-    const QByteArray data,
-    const QDateTime dateTime,
-    float correlation,
-    float correlationOnes,
-    unsigned crc,
-    bool updateModel)
+// Update GUI aircraft from state decoded by the worker's state engine
+void ADSBDemodGUI::updateAircraft(const ADSBAircraftState& state, bool updateModel)
 {
     bool newAircraft = false;
     bool updatedCallsign = false;
     bool resetAnimation = false;
 
-    int df = (data[0] >> 3) & ADS_B_DF_MASK; // Downlink format
-    int ca = data[0] & 0x7; // Capability
-    unsigned icao;
-    Aircraft *aircraft;
+    Aircraft *aircraft = getAircraft(state.m_icao, newAircraft);
 
-    if ((df == 4) || (df == 5) || (df == 20) || (df == 21))
-    {
-        // Extract ICAO from parity
-        int bytes = data.length();
-        unsigned parity = (data[bytes-3] << 16) | (data[bytes-2] << 8) | data[bytes-1];
-        icao = (parity ^ crc) & 0xffffff;
-        if (m_aircraft.contains(icao))
-        {
-            //qDebug() << "Mode-S from known aircraft - DF " << df << " ICAO " << Qt::hex << icao;
-            aircraft = getAircraft(icao, newAircraft);
-        }
-        else
-        {
-            // Ignore if not from a known aircraft, as its likely not to be a valid packet
-            //qDebug() << "Skiping Mode-S from unknown aircraft - DF " << df << " ICAO " << Qt::hex << icao;
-            return;
-        }
-    }
-    else
-    {
-        icao = ((data[1] & 0xff) << 16) | ((data[2] & 0xff) << 8) | (data[3] & 0xff); // ICAO aircraft address
-        aircraft = getAircraft(icao, newAircraft);
-    }
-    int tc = (data[4] >> 3) & 0x1f; // Type code
-
-    aircraft->m_time = dateTime;
-    QTime time = dateTime.time();
+    aircraft->m_time = state.m_time;
+    QTime time = state.m_time.time();
     aircraft->m_timeItem->setText(QString("%1:%2:%3").arg(time.hour(), 2, 10, QLatin1Char('0')).arg(time.minute(), 2, 10, QLatin1Char('0')).arg(time.second(), 2, 10, QLatin1Char('0')));
-    aircraft->m_adsbFrameCount++;
+    aircraft->m_adsbFrameCount = state.m_frameCount;
     aircraft->m_adsbFrameCountItem->setData(Qt::DisplayRole, aircraft->m_adsbFrameCount);
-    if (df == 18)
+    if (state.m_tisBFrameCount > 0)
     {
-        aircraft->m_tisBFrameCount++;
+        aircraft->m_tisBFrameCount = state.m_tisBFrameCount;
         aircraft->m_tisBItem->setData(Qt::DisplayRole, aircraft->m_tisBFrameCount);
     }
 
-    if (correlation < aircraft->m_minCorrelation)
-        aircraft->m_minCorrelation = correlation;
-    if (correlation > aircraft->m_maxCorrelation)
-        aircraft->m_maxCorrelation = correlation;
-    m_correlationAvg(correlation);
-    aircraft->m_correlationAvg(correlation);
-    aircraft->m_correlation = aircraft->m_correlationAvg.instantAverage();
+    aircraft->m_minCorrelation = state.m_minCorrelation;
+    aircraft->m_maxCorrelation = state.m_maxCorrelation;
+    aircraft->m_correlation = state.m_correlation;
     aircraft->m_correlationItem->setText(QString("%1/%2/%3")
         .arg(CalcDb::dbPower(aircraft->m_minCorrelation), 3, 'f', 1)
         .arg(CalcDb::dbPower(aircraft->m_correlation), 3, 'f', 1)
         .arg(CalcDb::dbPower(aircraft->m_maxCorrelation), 3, 'f', 1));
-    m_correlationOnesAvg(correlationOnes);
     aircraft->m_rssiItem->setText(QString("%1")
-        .arg(CalcDb::dbPower(m_correlationOnesAvg.instantAverage()), 3, 'f', 1));
+        .arg(CalcDb::dbPower(state.m_rssi), 3, 'f', 1));
 
-    // ADS-B, non-transponder ADS-B or TIS-B rebroadcast of ADS-B (ADS-R)
-    if ((df == 17) || ((df == 18) && (ca != 4)))
+    if (!state.m_emitterCategory.isEmpty() && (aircraft->m_emitterCategory != state.m_emitterCategory))
     {
+        aircraft->m_emitterCategory = state.m_emitterCategory;
+        aircraft->m_emitterCategoryItem->setText(aircraft->m_emitterCategory);
 
-        if ((tc >= 1) && ((tc <= 4)))
+        // Select 3D model based on category, if we don't already have one based on ICAO
+        if (aircraft->m_aircraft3DModel.isEmpty())
         {
-            // Aircraft identification - BDS 0,8
-            int ec = data[4] & 0x7;   // Emitter category
-
-            QString prevEmitterCategory = aircraft->m_emitterCategory;
-            if (tc == 4) {
-                aircraft->m_emitterCategory = m_categorySetA[ec];
-            } else if (tc == 3) {
-                aircraft->m_emitterCategory = m_categorySetB[ec];
-            } else if (tc == 2) {
-                aircraft->m_emitterCategory = m_categorySetC[ec];
-            } else {
-                aircraft->m_emitterCategory = QStringLiteral("Reserved");
-            }
-            aircraft->m_emitterCategoryItem->setText(aircraft->m_emitterCategory);
-
-            // Flight/callsign - Extract 8 6-bit characters from 6 8-bit bytes, MSB first
-            unsigned char c[8];
-            char callsign[9];
-            c[0] = (data[5] >> 2) & 0x3f; // 6
-            c[1] = ((data[5] & 0x3) << 4) | ((data[6] & 0xf0) >> 4);  // 2+4
-            c[2] = ((data[6] & 0xf) << 2) | ((data[7] & 0xc0) >> 6);  // 4+2
-            c[3] = (data[7] & 0x3f); // 6
-            c[4] = (data[8] >> 2) & 0x3f;
-            c[5] = ((data[8] & 0x3) << 4) | ((data[9] & 0xf0) >> 4);
-            c[6] = ((data[9] & 0xf) << 2) | ((data[10] & 0xc0) >> 6);
-            c[7] = (data[10] & 0x3f);
-            // Map to ASCII
-            for (int i = 0; i < 8; i++)
-                callsign[i] = m_idMap[c[i]];
-            callsign[8] = '\0';
-            QString callsignTrimmed = QString(callsign).trimmed();
-
-            updatedCallsign = aircraft->m_callsign != callsignTrimmed;
-            if (updatedCallsign)
-            {
-                aircraft->m_callsign = callsignTrimmed;
-                aircraft->m_callsignItem->setText(aircraft->m_callsign);
-                callsignToFlight(aircraft);
-            }
-
-            // Select 3D model based on category, if we don't already have one based on ICAO
-            if (   aircraft->m_aircraft3DModel.isEmpty()
-                && (   aircraft->m_aircraftCat3DModel.isEmpty()
-                    || (prevEmitterCategory != aircraft->m_emitterCategory)
-                   )
-               )
-            {
-                get3DModelBasedOnCategory(aircraft);
-                // As we're changing the model, we need to reset animations to
-                // ensure gear/flaps are in correct position on new model
-                resetAnimation = true;
-            }
+            get3DModelBasedOnCategory(aircraft);
+            // As we're changing the model, we need to reset animations to
+            // ensure gear/flaps are in correct position on new model
+            resetAnimation = true;
         }
-        else if (((tc >= 5) && (tc <= 18)) || ((tc >= 20) && (tc <= 22)))
-        {
-            bool wasOnSurface = aircraft->m_onSurface;
-            aircraft->m_onSurface = (tc >= 5) && (tc <= 8);
-
-            if (wasOnSurface != aircraft->m_onSurface)
-            {
-                // Can't mix CPR values used on surface and those that are airbourne
-                aircraft->m_cprValid[0] = false;
-                aircraft->m_cprValid[1] = false;
-            }
-
-            if (aircraft->m_onSurface)
-            {
-                // Surface position - BDS 0,6
-
-                // There are a few airports that are below 0 MSL
-                // https://en.wikipedia.org/wiki/List_of_lowest_airports
-                // So we set altitude to a negative value here, which should
-                // then get clipped to actual terrain elevation in 3D map
-                aircraft->m_altitudeValid = true;
-                aircraft->m_altitude = -200;
-                aircraft->m_altitudeItem->setData(Qt::DisplayRole, "Surface");
-
-                int movement = ((data[4] & 0x7) << 4) | ((data[5] >> 4) & 0xf);
-                if (movement == 0)
-                {
-                    // No information available
-                    aircraft->m_groundspeedValid = false;
-                    aircraft->m_groundspeedItem->setData(Qt::DisplayRole, "");
-                }
-                else if (movement == 1)
-                {
-                    // Aircraft stopped
-                    aircraft->m_groundspeedValid = true;
-                    aircraft->m_groundspeedItem->setData(Qt::DisplayRole, 0);
-                    aircraft->m_groundspeed = 0.0;
-                }
-                else if ((movement >= 2) && (movement <= 123))
-                {
-                    float base, step; // In knts
-                    int adjust;
-                    if ((movement >= 2) && (movement <= 8))
-                    {
-                        base = 0.125f;
-                        step = 0.125f;
-                        adjust = 2;
-                    }
-                    else if ((movement >= 9) && (movement <= 12))
-                    {
-                        base = 1.0f;
-                        step = 0.25f;
-                        adjust = 9;
-                    }
-                    else if ((movement >= 13) && (movement <= 38))
-                    {
-                        base = 2.0f;
-                        step = 0.5f;
-                        adjust = 13;
-                    }
-                    else if ((movement >= 39) && (movement <= 93))
-                    {
-                        base = 15.0f;
-                        step = 1.0f;
-                        adjust = 39;
-                    }
-                    else if ((movement >= 94) && (movement <= 108))
-                    {
-                        base = 70.0f;
-                        step = 2.0f;
-                        adjust = 94;
-                    }
-                    else
-                    {
-                        base = 100.0f;
-                        step = 5.0f;
-                        adjust = 109;
-                    }
-                    aircraft->m_groundspeed = base + (movement - adjust) * step;
-                    aircraft->m_groundspeedValid = true;
-                    aircraft->m_groundspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_groundspeed) : (int)std::round(aircraft->m_groundspeed));
-                }
-                else if (movement == 124)
-                {
-                    aircraft->m_groundspeedValid = true;
-                    aircraft->m_groundspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? 324 : 175); // Actually greater than this
-                }
+    }
 
-                int groundTrackStatus = (data[5] >> 3) & 1;
-                int groundTrackValue = ((data[5] & 0x7) << 4) | ((data[6] >> 4) & 0xf);
-                if (groundTrackStatus)
-                {
-                    aircraft->m_heading = groundTrackValue * 360.0/128.0;
-                    aircraft->m_headingValid = true;
-                    aircraft->m_headingItem->setData(Qt::DisplayRole, std::round(aircraft->m_heading));
-                }
-            }
-            else if (((tc >= 9) && (tc <= 18)) || ((tc >= 20) && (tc <= 22)))
-            {
-                // Airbourne position (9-18 baro, 20-22 GNSS)
-                int alt = ((data[5] & 0xff) << 4) | ((data[6] >> 4) & 0xf); // Altitude
-                int q = (alt & 0x10) != 0;
-                int n = ((alt >> 1) & 0x7f0) | (alt & 0xf);  // Remove Q-bit
-                int alt_ft;
-                if (q == 1)
-                {
-                    alt_ft = n * ((alt & 0x10) ? 25 : 100) - 1000;
-                }
-                else
-                {
-                    alt_ft = gillhamToFeet(n);
-                }
+    if (!state.m_callsign.isEmpty() && (aircraft->m_callsign != state.m_callsign))
+    {
+        aircraft->m_callsign = state.m_callsign;
+        aircraft->m_callsignItem->setText(aircraft->m_callsign);
+        callsignToFlight(aircraft);
+        updatedCallsign = true;
+    }
 
-                aircraft->m_altitude = alt_ft;
-                aircraft->m_altitudeValid = alt != 0;
-                aircraft->m_altitudeGNSS = ((tc >= 20) && (tc <= 22));
-                // setData rather than setText so it sorts numerically
-                aircraft->m_altitudeItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::feetToIntegerMetres(aircraft->m_altitude) : aircraft->m_altitude);
+    if (state.m_altitudeValid)
+    {
+        aircraft->m_altitude = state.m_altitude;
+        aircraft->m_altitudeValid = true;
+        aircraft->m_altitudeGNSS = state.m_altitudeGNSS;
+        // setData rather than setText so it sorts numerically
+        if (state.m_onSurface) {
+            aircraft->m_altitudeItem->setData(Qt::DisplayRole, "Surface");
+        } else {
+            aircraft->m_altitudeItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::feetToIntegerMetres(aircraft->m_altitude) : aircraft->m_altitude);
+        }
+    }
+    aircraft->m_onSurface = state.m_onSurface;
 
-                // Assume runway elevation is at first reported airboune altitude
-                if (wasOnSurface)
-                {
-                    aircraft->m_runwayAltitude = aircraft->m_altitude;
-                    aircraft->m_runwayAltitudeValid = true;
-                }
-            }
+    if (state.m_runwayAltitudeValid)
+    {
+        aircraft->m_runwayAltitude = state.m_runwayAltitude;
+        aircraft->m_runwayAltitudeValid = true;
+    }
 
-            int f = (data[6] >> 2) & 1; // CPR odd/even frame - should alternate every 0.2s
-            int lat_cpr = ((data[6] & 3) << 15) | ((data[7] & 0xff) << 7) | ((data[8] >> 1) & 0x7f);
-            int lon_cpr = ((data[8] & 1) << 16) | ((data[9] & 0xff) << 8) | (data[10] & 0xff);
-
-            aircraft->m_cprValid[f] = true;
-            aircraft->m_cprLat[f] = lat_cpr/131072.0f;
-            aircraft->m_cprLong[f] = lon_cpr/131072.0f;
-            aircraft->m_cprTime[f] = dateTime;
-
-            // CPR decoding
-            // Refer to Technical Provisions  for Mode S Services and Extended Squitter - Appendix C2.6
-            // See also: https://mode-s.org/decode/adsb/airborne-position.html
-            // For global decoding, we need both odd and even frames
-            // We also need to check that both frames aren't greater than 10s apart in time (C.2.6.7), otherwise position may be out by ~10deg
-            // I've reduced this to 8.5s, as problems have been seen where times are just 9s apart. This may be because
-            // our timestamps aren't accurate, as the times are generated when packets are decoded on buffered data.
-            // We could compare global + local methods to see if the positions are sensible
-            if (aircraft->m_cprValid[0] && aircraft->m_cprValid[1]
-               && (std::abs(aircraft->m_cprTime[0].toMSecsSinceEpoch() - aircraft->m_cprTime[1].toMSecsSinceEpoch()) <= 8500)
-               && !aircraft->m_onSurface)
-            {
-                // Global decode using odd and even frames (C.2.6)
-
-                // Calculate latitude
-                const double dLatEven = 360.0/60.0;
-                const double dLatOdd = 360.0/59.0;
-                double latEven, latOdd;
-                double latitude, longitude;
-                int ni, m;
-
-                int j = std::floor(59.0f*aircraft->m_cprLat[0] - 60.0f*aircraft->m_cprLat[1] + 0.5);
-                latEven = dLatEven * (modulus(j, 60) + aircraft->m_cprLat[0]);
-                // Southern hemisphere is in range 270-360, so adjust to -90-0
-                if (latEven >= 270.0f)
-                    latEven -= 360.0f;
-                latOdd = dLatOdd * (modulus(j, 59) + aircraft->m_cprLat[1]);
-                if (latOdd >= 270.0f)
-                    latOdd -= 360.0f;
-                if (aircraft->m_cprTime[0] >= aircraft->m_cprTime[1])
-                    latitude = latEven;
-                else
-                    latitude = latOdd;
-                if ((latitude <= 90.0) && (latitude >= -90.0))
-                {
-                    // Check if both frames in same latitude zone
-                    int latEvenNL = cprNL(latEven);
-                    int latOddNL = cprNL(latOdd);
-                    if (latEvenNL == latOddNL)
-                    {
-                        // Calculate longitude
-                        if (!f)
-                        {
-                            ni = cprN(latEven, 0);
-                            m = std::floor(aircraft->m_cprLong[0] * (latEvenNL - 1) - aircraft->m_cprLong[1] * latEvenNL + 0.5f);
-                            longitude = (360.0f/ni) * (modulus(m, ni) + aircraft->m_cprLong[0]);
-                        }
-                        else
-                        {
-                            ni = cprN(latOdd, 1);
-                            m = std::floor(aircraft->m_cprLong[0] * (latOddNL - 1) - aircraft->m_cprLong[1] * latOddNL + 0.5f);
-                            longitude = (360.0f/ni) * (modulus(m, ni) + aircraft->m_cprLong[1]);
-                        }
-                        if (longitude > 180.0f)
-                            longitude -= 360.0f;
-                        aircraft->m_latitude = latitude;
-                        aircraft->m_latitudeItem->setData(Qt::DisplayRole, aircraft->m_latitude);
-                        aircraft->m_longitude = longitude;
-                        aircraft->m_longitudeItem->setData(Qt::DisplayRole, aircraft->m_longitude);
-                        aircraft->m_positionDateTime = dateTime;
-                        QGeoCoordinate coord(aircraft->m_latitude, aircraft->m_longitude, aircraft->m_altitude);
-                        aircraft->m_coordinates.push_back(QVariant::fromValue(coord));
-                        updatePosition(aircraft);
-                    }
-                }
-                else
-                {
-                    qDebug() << "ADSBDemodGUI::handleADSB: Invalid latitude " << latitude << " for " << QString("%1").arg(aircraft->m_icaoHex)
-                        << " m_cprLat[0] " << aircraft->m_cprLat[0]
-                        << " m_cprLat[1] " << aircraft->m_cprLat[1];
-                    aircraft->m_cprValid[0] = false;
-                    aircraft->m_cprValid[1] = false;
-                }
-            }
-            else
-            {
-                // Local decode using a single aircraft position + location of receiver
-                // Only valid if airbourne within 180nm/333km (C.2.6.4) or 45nm for surface
-
-                // Caclulate latitude
-                const double maxDeg = aircraft->m_onSurface ? 90.0 : 360.0;
-                const double dLatEven = maxDeg/60.0;
-                const double dLatOdd = maxDeg/59.0;
-                double dLat = f ? dLatOdd : dLatEven;
-                double latitude, longitude;
-
-                int j = std::floor(m_azEl.getLocationSpherical().m_latitude/dLat) + std::floor(modulus(m_azEl.getLocationSpherical().m_latitude, dLat)/dLat - aircraft->m_cprLat[f] + 0.5);
-                latitude = dLat * (j + aircraft->m_cprLat[f]);
-
-                // Caclulate longitude
-                double dLong;
-                int latNL = cprNL(latitude);
-                if (f == 0)
-                {
-                    if (latNL > 0)
-                        dLong = maxDeg / latNL;
-                    else
-                        dLong = maxDeg;
-                }
-                else
-                {
-                    if ((latNL - 1) > 0)
-                        dLong = maxDeg / (latNL - 1);
-                    else
-                        dLong = maxDeg;
-                }
-                int m = std::floor(m_azEl.getLocationSpherical().m_longitude/dLong) + std::floor(modulus(m_azEl.getLocationSpherical().m_longitude, dLong)/dLong - aircraft->m_cprLong[f] + 0.5);
-                longitude =  dLong * (m + aircraft->m_cprLong[f]);
+    if (state.m_groundspeedValid)
+    {
+        aircraft->m_groundspeed = state.m_groundspeed;
+        aircraft->m_groundspeedValid = true;
+        aircraft->m_groundspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_groundspeed) : aircraft->m_groundspeed);
+    }
 
-                if (updateLocalPosition(aircraft, latitude, longitude, aircraft->m_onSurface))
-                {
-                    aircraft->m_latitude = latitude;
-                    aircraft->m_latitudeItem->setData(Qt::DisplayRole, aircraft->m_latitude);
-                    aircraft->m_longitude = longitude;
-                    aircraft->m_longitudeItem->setData(Qt::DisplayRole, aircraft->m_longitude);
-                    aircraft->m_positionDateTime = dateTime;
-                    QGeoCoordinate coord(aircraft->m_latitude, aircraft->m_longitude, aircraft->m_altitude);
-                    aircraft->m_coordinates.push_back(QVariant::fromValue(coord));
-                }
-            }
+    if (state.m_verticalRateValid)
+    {
+        aircraft->m_verticalRate = state.m_verticalRate;
+        aircraft->m_verticalRateValid = true;
+        if (m_settings.m_siUnits) {
+            aircraft->m_verticalRateItem->setData(Qt::DisplayRole, Units::feetPerMinToIntegerMetresPerSecond(aircraft->m_verticalRate));
+        } else {
+            aircraft->m_verticalRateItem->setData(Qt::DisplayRole, aircraft->m_verticalRate);
         }
-        else if (tc == 19)
-        {
-            // Airbourne velocity - BDS 0,9
-            int st = data[4] & 0x7;   // Subtype
-            if ((st == 1) || (st == 2))
-            {
-                // Ground speed
-                int s_ew = (data[5] >> 2) & 1; // East-west velocity sign
-                int v_ew = ((data[5] & 0x3) << 8) | (data[6] & 0xff); // East-west velocity
-                int s_ns = (data[7] >> 7) & 1; // North-south velocity sign
-                int v_ns = ((data[7] & 0x7f) << 3) | ((data[8] >> 5) & 0x7); // North-south velocity
-
-                int v_we;
-                int v_sn;
-                float v;
-                float h;
-
-                if (s_ew) {
-                    v_we = -1 * (v_ew - 1);
-                } else {
-                    v_we = v_ew - 1;
-                }
-                if (s_ns) {
-                    v_sn = -1 * (v_ns - 1);
-                } else {
-                    v_sn = v_ns - 1;
-                }
-                v = std::round(std::sqrt(v_we*v_we + v_sn*v_sn));
-                h = std::atan2(v_we, v_sn) * 360.0/(2.0*M_PI);
-                if (h < 0.0) {
-                    h += 360.0;
-                }
+    }
 
-                aircraft->m_heading = h; // This is actually track, rather than heading
-                aircraft->m_headingValid = true;
-                aircraft->m_headingDateTime = dateTime;
-                aircraft->m_groundspeed = v;
-                aircraft->m_groundspeedValid = true;
-                aircraft->m_headingItem->setData(Qt::DisplayRole, std::round(aircraft->m_heading));
-                aircraft->m_groundspeedItem->setData(Qt::DisplayRole,m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_groundspeed) : aircraft->m_groundspeed);
-                aircraft->m_orientationDateTime = dateTime;
-            }
-            else
-            {
-                // Airspeed (only likely to get this if an aircraft is unable to determine it's position)
-                int s_hdg = (data[5] >> 2) & 1; // Heading status
-                int hdg =  ((data[5] & 0x3) << 8) | (data[6] & 0xff); // Heading
-                if (s_hdg)
-                {
-                    aircraft->m_heading = hdg/1024.0f*360.0f;
-                    aircraft->m_headingValid = true;
-                    aircraft->m_headingDateTime = dateTime;
-                    aircraft->m_headingItem->setData(Qt::DisplayRole, std::round(aircraft->m_heading));
-                    aircraft->m_orientationDateTime = dateTime;
-                }
+    if (state.m_trueAirspeedValid)
+    {
+        aircraft->m_trueAirspeed = state.m_trueAirspeed;
+        aircraft->m_trueAirspeedValid = true;
+        aircraft->m_trueAirspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_trueAirspeed) : aircraft->m_trueAirspeed);
+    }
 
-                int as_t = (data[7] >> 7) & 1; // Airspeed type
-                int as = ((data[7] & 0x7f) << 3) | ((data[8] >> 5) & 0x7); // Airspeed
+    if (state.m_indicatedAirspeedValid)
+    {
+        aircraft->m_indicatedAirspeed = state.m_indicatedAirspeed;
+        aircraft->m_indicatedAirspeedValid = true;
+        aircraft->m_indicatedAirspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_indicatedAirspeed) : aircraft->m_indicatedAirspeed);
+    }
 
-                if (as_t == 1)
-                {
-                    aircraft->m_trueAirspeed = as;
-                    aircraft->m_trueAirspeedValid = true;
-                    aircraft->m_trueAirspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_trueAirspeed) : aircraft->m_trueAirspeed);
-                }
-                else
-                {
-                    aircraft->m_indicatedAirspeed = as;
-                    aircraft->m_indicatedAirspeedValid = true;
-                    aircraft->m_indicatedAirspeedItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::knotsToIntegerKPH(aircraft->m_indicatedAirspeed) : aircraft->m_indicatedAirspeed);
-                }
-            }
-            //int vr_source = (data[8] >> 4) & 1; // Source of vertical rate GNSS=0 Baro=1
-            int s_vr = (data[8] >> 3) & 1; // Vertical rate sign
-            int vr = ((data[8] & 0x7) << 6) | ((data[9] >> 2) & 0x3f); // Vertical rate
-            aircraft->m_verticalRate = (vr-1)*64*(s_vr?-1:1);
-            aircraft->m_verticalRateValid = true;
-            if (m_settings.m_siUnits)
-                aircraft->m_verticalRateItem->setData(Qt::DisplayRole, Units::feetPerMinToIntegerMetresPerSecond(aircraft->m_verticalRate));
-            else
-                aircraft->m_verticalRateItem->setData(Qt::DisplayRole, aircraft->m_verticalRate);
-        }
-        else if (tc == 28)
-        {
-            // Aircraft status - BDS 6,1
-            int st = data[4] & 0x7;   // Subtype
-            if (st == 1)
-            {
-                int es = (data[5] >> 5) & 0x7; // Emergency state
-                int modeA =  ((data[5] << 8) & 0x1f00) | (data[6] & 0xff); // Mode-A code (squawk)
-                aircraft->m_status = m_emergencyStatus[es];
-                aircraft->m_statusItem->setText(aircraft->m_status);
-                aircraft->m_squawk = squawkDecode(modeA);
-                if (modeA & 0x40)
-                    aircraft->m_squawkItem->setText(QString("%1 IDENT").arg(aircraft->m_squawk, 4, 10, QLatin1Char('0')));
-                else
-                    aircraft->m_squawkItem->setText(QString("%1").arg(aircraft->m_squawk, 4, 10, QLatin1Char('0')));
-            }
-            else if (st == 2)
-            {
-                // TCAS/ACAS RA Broadcast
-            }
+    if (state.m_selAltitudeValid)
+    {
+        aircraft->m_selAltitude = state.m_selAltitude;
+        aircraft->m_selAltitudeValid = true;
+        if (m_settings.m_siUnits) {
+            aircraft->m_selAltitudeItem->setData(Qt::DisplayRole, Units::feetToIntegerMetres(aircraft->m_selAltitude));
+        } else {
+            aircraft->m_selAltitudeItem->setData(Qt::DisplayRole, roundTo50Feet(aircraft->m_selAltitude));
         }
-        else if (tc == 29)
-        {
-            // Target state and status
-            //bool selAltitudeType = (data[5] >> 7) & 0x1;
-            int selAltitudeFix = ((data[5] & 0x7f) << 4) | ((data[6] >> 4) & 0xf);
-            if (selAltitudeFix != 0)
-            {
-                int selAltitude = (selAltitudeFix - 1) * 32; // Ft
-                aircraft->m_selAltitude = selAltitude;
-                aircraft->m_selAltitudeValid = true;
-                if (m_settings.m_siUnits) {
-                    aircraft->m_selAltitudeItem->setData(Qt::DisplayRole, Units::feetToIntegerMetres(aircraft->m_selAltitude));
-                } else {
-                    aircraft->m_selAltitudeItem->setData(Qt::DisplayRole, roundTo50Feet(aircraft->m_selAltitude));
-                }
-            }
-            int baroFix = ((data[6] & 0xf) << 5) | ((data[7] >> 3) & 0x1f);
-            if (baroFix != 0)
-            {
-                float baro = (baroFix - 1) * 0.8f + 800.0f; // mb
-                aircraft->m_baro = baro;
-                aircraft->m_baroValid = true;
-                aircraft->m_baroItem->setData(Qt::DisplayRole, std::round(aircraft->m_baro));
-            }
-            bool selHeadingValid = (data[7] >> 2) & 0x1;
-            if (selHeadingValid)
-            {
-                int selHeadingFix = ((data[7] & 0x3) << 7) | ((data[8] >> 1) & 0x7f);
-                selHeadingFix = (selHeadingFix << 23) >> 23;
-                float selHeading = selHeadingFix * 180.0f / 256.0f;
-                if (selHeading < 0.0f) {
-                    selHeading += 360.0f;
-                }
-                aircraft->m_selHeading = selHeading;
-                aircraft->m_selHeadingValid = true;
-                aircraft->m_selHeadingItem->setData(Qt::DisplayRole, std::round(aircraft->m_selHeading));
-            }
-
-            bool modeValid = (data[9] >> 1) & 0x1;
-            if (modeValid)
-            {
-                bool autoPilot = data[9] & 0x1;
-                bool vnavMode = (data[10] >> 7) & 0x1;
-                bool altHoldMode = (data[10] >> 6) & 0x1;
-                bool approachMode = (data[10] >> 4) & 0x1;
-                bool lnavMode = (data[10] >> 2) & 0x1;
-
-                aircraft->m_apItem->setText(autoPilot ? QChar(0x2713) : QChar(0x2717)); // Tick or cross
+    }
 
-                QString vMode = "";
-                if (vnavMode) {
-                    vMode = vMode + "VNAV ";
-                }
-                if (altHoldMode) {
-                    vMode = vMode + "HOLD ";
-                }
-                if (approachMode) {
-                    vMode = vMode + "APP ";
-                }
-                vMode = vMode.trimmed();
-                aircraft->m_vModeItem->setText(vMode);
+    if (state.m_baroValid)
+    {
+        aircraft->m_baro = state.m_baro;
+        aircraft->m_baroValid = true;
+        aircraft->m_baroItem->setData(Qt::DisplayRole, aircraft->m_baro);
+    }
 
-                QString lMode = "";
-                if (lnavMode) {
-                    lMode = lMode + "LNAV ";
-                }
-                if (approachMode) {
-                    lMode = lMode + "APP ";
-                }
-                lMode = lMode.trimmed();
-                aircraft->m_lModeItem->setText(lMode);
-            }
+    if (state.m_selHeadingValid)
+    {
+        aircraft->m_selHeading = state.m_selHeading;
+        aircraft->m_selHeadingValid = true;
+        aircraft->m_selHeadingItem->setData(Qt::DisplayRole, aircraft->m_selHeading);
+    }
 
-        }
-        else if (tc == 31)
+    if (state.m_headingValid)
+    {
+        aircraft->m_heading = state.m_heading; // This may be track, rather than heading
+        aircraft->m_headingValid = true;
+        aircraft->m_headingItem->setData(Qt::DisplayRole, std::round(aircraft->m_heading));
+        if (state.m_headingDateTime.isValid() && (state.m_headingDateTime > aircraft->m_headingDateTime))
         {
-            // Aircraft operation status
+            aircraft->m_headingDateTime = state.m_headingDateTime;
+            aircraft->m_orientationDateTime = state.m_headingDateTime;
         }
+    }
 
-        // Update aircraft in map
-        if (aircraft->m_positionValid)
-        {
-            // Check to see if we need to start any animations
-            QList<SWGSDRangel::SWGMapAnimation *> *animations = animate(dateTime, aircraft);
-
-            // Update map displayed in channel
-            if (updateModel) {
-                m_aircraftModel.aircraftUpdated(aircraft);
-            }
+    if (state.m_modesValid)
+    {
+        aircraft->m_apItem->setText(state.m_autopilot ? QChar(0x2713) : QChar(0x2717)); // Tick or cross
 
-            // Send to Map feature
-            sendToMap(aircraft, animations);
+        QString vMode = "";
+        if (state.m_vnavMode) {
+            vMode = vMode + "VNAV ";
+        }
+        if (state.m_altHoldMode) {
+            vMode = vMode + "HOLD ";
+        }
+        if (state.m_approachMode) {
+            vMode = vMode + "APP ";
+        }
+        vMode = vMode.trimmed();
+        aircraft->m_vModeItem->setText(vMode);
 
-            if (resetAnimation)
-            {
-                // Wait until after model has changed before reseting
-                // otherwise animation might play on old model
-                aircraft->m_gearDown = false;
-                aircraft->m_flaps = 0.0;
-                aircraft->m_engineStarted = false;
-                aircraft->m_rotorStarted = false;
-            }
+        QString lMode = "";
+        if (state.m_lnavMode) {
+            lMode = lMode + "LNAV ";
         }
+        if (state.m_approachMode) {
+            lMode = lMode + "APP ";
+        }
+        lMode = lMode.trimmed();
+        aircraft->m_lModeItem->setText(lMode);
     }
-    else if (df == 18)
+
+    if (!state.m_status.isEmpty())
     {
-        // TIS-B that doesn't match ADS-B formats, such as TIS-B management
-        qDebug() << "TIS B message cf=" << ca << " icao: " << QString::number(icao, 16);
+        aircraft->m_status = state.m_status;
+        aircraft->m_statusItem->setText(aircraft->m_status);
     }
-    else if ((df == 4) || (df == 5))
+
+    if (state.m_squawkValid)
     {
-        decodeModeS(data, df, aircraft);
+        aircraft->m_squawk = state.m_squawk;
+        if (state.m_squawkIdent) {
+            aircraft->m_squawkItem->setText(QString("%1 IDENT").arg(aircraft->m_squawk, 4, 10, QLatin1Char('0')));
+        } else {
+            aircraft->m_squawkItem->setText(QString("%1").arg(aircraft->m_squawk, 4, 10, QLatin1Char('0')));
+        }
     }
-    else if ((df == 20) || (df == 21))
+
+    if (state.m_positionValid && (state.m_positionDateTime > aircraft->m_positionDateTime))
     {
-        decodeModeS(data, df, aircraft);
-        decodeCommB(data, dateTime, df, aircraft, updatedCallsign);
+        aircraft->m_latitude = state.m_latitude;
+        aircraft->m_latitudeItem->setData(Qt::DisplayRole, aircraft->m_latitude);
+        aircraft->m_longitude = state.m_longitude;
+        aircraft->m_longitudeItem->setData(Qt::DisplayRole, aircraft->m_longitude);
+        aircraft->m_positionDateTime = state.m_positionDateTime;
+        updatePosition(aircraft);
+        QGeoCoordinate coord(aircraft->m_latitude, aircraft->m_longitude, aircraft->m_altitude);
+        aircraft->m_coordinates.push_back(QVariant::fromValue(coord));
+    }
+
+    // Update aircraft in map
+    if (aircraft->m_positionValid)
+    {
+        // Check to see if we need to start any animations
+        QList<SWGSDRangel::SWGMapAnimation *> *animations = animate(state.m_time, aircraft);
+
+        // Update map displayed in channel
+        if (updateModel) {
+            m_aircraftModel.queueAircraftUpdate(aircraft);
+        }
+
+        // Send to Map feature
+        sendToMap(aircraft, animations);
+
+        if (resetAnimation)
+        {
+            // Wait until after model has changed before reseting
+            // otherwise animation might play on old model
+            aircraft->m_gearDown = false;
+            aircraft->m_flaps = 0.0;
+            aircraft->m_engineStarted = false;
+            aircraft->m_rotorStarted = false;
+        }
     }
 
     // Check to see if we need to emit a notification about this aircraft
@@ -1682,79 +1180,36 @@ void ADSBDemodGUI::handleADSB(
     }
 }
 
-void ADSBDemodGUI::decodeModeS(const QByteArray data, int df, Aircraft *aircraft)
+// Comm-B replies carry data that is only presented in the GUI (BDS registers)
+void ADSBDemodGUI::handleCommB(const QByteArray data, const QDateTime dateTime, unsigned crc)
 {
-    bool wasOnSurface = aircraft->m_onSurface;
-    bool takenOff = false;
+    int df = (data[0] >> 3) & ADS_B_DF_MASK; // Downlink format
 
-    int flightStatus = data[0] & 0x7;
-    if ((flightStatus == 0) || (flightStatus == 2))
-    {
-        takenOff = wasOnSurface;
-        aircraft->m_onSurface = false;
-    }
-    else if ((flightStatus == 1) || (flightStatus == 3))
-    {
-        aircraft->m_onSurface = true;
-    }
-    if (wasOnSurface != aircraft->m_onSurface)
-    {
-        // Can't mix CPR values used on surface and those that are airbourne
-        aircraft->m_cprValid[0] = false;
-        aircraft->m_cprValid[1] = false;
+    if ((df != 20) && (df != 21)) {
+        return;
     }
-    //qDebug() << "Flight Status " << m_flightStatuses[flightStatus];
 
-    int altitude = 0;   // Altitude in feet
+    // Extract ICAO from parity
+    int bytes = data.length();
+    unsigned parity = ((data[bytes-3] & 0xff) << 16) | ((data[bytes-2] & 0xff) << 8) | (data[bytes-1] & 0xff);
+    unsigned icao = (parity ^ crc) & 0xffffff;
 
-    if ((df == 4) || (df == 20))
-    {
-        int altitudeCode = ((data[2] & 0x1f) << 8) | (data[3] & 0xff);
-        if (altitudeCode & 0x40) // M bit indicates metres
-        {
-            int altitudeMetres = ((altitudeCode & 0x1f80) >> 1) | (altitudeCode & 0x3f);
-            altitude = Units::metresToFeet(altitudeMetres);
-        }
-        else
-        {
-            // Remove M and Q bits
-            int altitudeFix = ((altitudeCode & 0x1f80) >> 2) | ((altitudeCode & 0x20) >> 1) | (altitudeCode & 0xf);
+    // Ignore if not from a known aircraft, as its likely not to be a valid packet
+    if (!m_aircraft.contains(icao)) {
+        return;
+    }
 
-            // Convert to feet
-            if (altitudeCode & 0x10) {
-                altitude = altitudeFix * 25 - 1000;
-            } else {
-                altitude = gillhamToFeet(altitudeFix);
-            }
-        }
+    Aircraft *aircraft = m_aircraft.value(icao);
+    bool updatedCallsign = false;
 
-        aircraft->m_altitude = altitude;
-        aircraft->m_altitudeValid = true;
-        aircraft->m_altitudeGNSS = false;
-        aircraft->m_altitudeItem->setData(Qt::DisplayRole, m_settings.m_siUnits ? Units::feetToIntegerMetres(aircraft->m_altitude) : aircraft->m_altitude);
+    decodeCommB(data, dateTime, df, aircraft, updatedCallsign);
 
-         // Assume runway elevation is at first reported airboune altitude
-        if (takenOff)
-        {
-            aircraft->m_runwayAltitude = aircraft->m_altitude;
-            aircraft->m_runwayAltitudeValid = true;
-        }
-    }
-    else if ((df == 5) || (df == 21))
-    {
-        // Squawk ident code
-        int identCode = ((data[2] & 0x1f) << 8) | (data[3] & 0xff);
-        int squawk = squawkDecode(identCode);
+    // Check to see if we need to emit a notification about this aircraft
+    checkDynamicNotification(aircraft);
 
-        if (squawk != aircraft->m_squawk)
-        {
-            aircraft->m_squawk = squawk;
-            if (identCode & 0x40) {
-                aircraft->m_squawkItem->setText(QString("%1 IDENT").arg(aircraft->m_squawk, 4, 10, QLatin1Char('0')));
-            } else {
-                aircraft->m_squawkItem->setText(QString("%1").arg(aircraft->m_squawk, 4, 10, QLatin1Char('0')));
-            }
-        }
+    // Update text below photo if it's likely to have changed
+    if ((aircraft == m_highlightAircraft) && updatedCallsign) {
+        updatePhotoText(aircraft);
     }
 }
 
@@ -1910,7 +1365,7 @@ void ADSBDemodGUI::decodeCommB(const QByteArray data, const QDateTime dateTime,
         c[7] = (data[10] & 0x3f);
         // Map to ASCII
         for (int i = 0; i < 8; i++) {
-            callsign[i] = m_idMap[c[i]];
+            callsign[i] = ADSBDemodStateEngine::m_idMap[c[i]];
         }
         callsign[8] = '\0';
         QString callsignTrimmed = QString(callsign).trimmed();
@@ -1930,7 +1385,7 @@ void ADSBDemodGUI::decodeCommB(const QByteArray data, const QDateTime dateTime,
         c[6] = ((data[8] & 0x7) << 3) | ((data[9] >> 5) & 0x7);
         // Map to ASCII
         for (int i = 0; i < 7; i++) {
-            aircraftRegistration[i] = m_idMap[c[i]];
+            aircraftRegistration[i] = ADSBDemodStateEngine::m_idMap[c[i]];
         }
         aircraftRegistration[7] = '\0';
         QString aircraftRegistrationString = QString(aircraftRegistration).trimmed();
@@ -1943,7 +1398,7 @@ void ADSBDemodGUI::decodeCommB(const QByteArray data, const QDateTime dateTime,
         c[1] = data[10] & 0x3f;
         // Map to ASCII
         for (int i = 0; i < 2; i++) {
-            airlineRegistration[i] = m_idMap[c[i]];
+            airlineRegistration[i] = ADSBDemodStateEngine::m_idMap[c[i]];
         }
         airlineRegistration[2] = '\0';
         QString airlineRegistrationString = QString(airlineRegistration).trimmed();
@@ -2003,7 +1458,7 @@ void ADSBDemodGUI::decodeCommB(const QByteArray data, const QDateTime dateTime,
         c[8] = ((data[10] >> 1) & 0x3f);
         // Map to ASCII
         for (int i = 0; i < 9; i++) {
-            waypoint[i] = m_idMap[c[i]];
+            waypoint[i] = ADSBDemodStateEngine::m_idMap[c[i]];
         }
         waypoint[9] = '\0';
         QString waypointString = QString(waypoint).trimmed();
@@ -3183,16 +2638,21 @@ bool ADSBDemodGUI::handleMessage(const Message& message)
         updateAbsoluteCenterFrequency();
         return true;
     }
+    else if (ADSBDemodReport::MsgAircraftStates::match(message))
+    {
+        ADSBDemodReport::MsgAircraftStates& report = (ADSBDemodReport::MsgAircraftStates&) message;
+        m_correlationAvg = report.getCorrelationAverage();
+
+        for (const auto& state : report.getStates()) {
+            updateAircraft(state, true);
+        }
+
+        return true;
+    }
     else if (ADSBDemodReport::MsgReportADSB::match(message))
     {
         ADSBDemodReport::MsgReportADSB& report = (ADSBDemodReport::MsgReportADSB&) message;
-        handleADSB(
-            report.getData(),
-            report.getDateTime(),
-            report.getPreambleCorrelation(),
-            report.getCorrelationOnes(),
-            report.getCRC(),
-            true);
+        handleCommB(report.getData(), report.getDateTime(), report.getCRC());
         return true;
     }
     else if (ADSBDemodReport::MsgReportDemodStats::match(message))
@@ -3201,7 +2661,7 @@ bool ADSBDemodGUI::handleMessage(const Message& message)
         if (m_settings.m_displayDemodStats)
         {
             ADSBDemodStats stats = report.getDemodStats();
-            ui->stats->setText(QString("ADS-B: %1 Mode-S: %2 Matches: %3 CRC: %4 Type: %5 Avg Corr: %6 Demod Time: %7 Feed Time: %8").arg(stats.m_adsbFrames).arg(stats.m_modesFrames).arg(stats.m_correlatorMatches).arg(stats.m_crcFails).arg(stats.m_typeFails).arg(CalcDb::dbPower(m_correlationAvg.instantAverage()), 1, 'f', 1).arg(stats.m_demodTime, 1, 'f', 3).arg(stats.m_feedTime, 1, 'f', 3));
+            ui->stats->setText(QString("ADS-B: %1 Mode-S: %2 Matches: %3 CRC: %4 Type: %5 Avg Corr: %6 Demod Time: %7 Feed Time: %8 Demod Rate: %9 MS/s Headroom: %10").arg(stats.m_adsbFrames).arg(stats.m_modesFrames).arg(stats.m_correlatorMatches).arg(stats.m_crcFails).arg(stats.m_typeFails).arg(CalcDb::dbPower(m_correlationAvg), 1, 'f', 1).arg(stats.m_demodTime, 1, 'f', 3).arg(stats.m_feedTime, 1, 'f', 3).arg(stats.m_demodRate / 1e6, 1, 'f', 1).arg(stats.m_headroom, 1, 'f', 1));
         }
         return true;
     }
@@ -4744,6 +4204,7 @@ ADSBDemodGUI::ADSBDemodGUI(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, Baseb
     m_airportModel(this),
     m_airspaceModel(this),
     m_trackAircraft(nullptr),
+    m_correlationAvg(0.0f),
     m_highlightAircraft(nullptr),
     m_progressDialog(nullptr)
 {
@@ -5106,6 +4567,7 @@ void ADSBDemodGUI::tick()
         ui->channelPower->setText(tr("%1 dB").arg(powDbAvg, 0, 'f', 1));
     }
 
+    m_aircraftModel.flushUpdates();
     m_tickCount++;
 
     // Tick is called 20x a second - lets check this every 10 seconds
@@ -5390,6 +4852,12 @@ void ADSBDemodGUI::on_logOpen_clicked()
                     bool cancelled = false;
                     QStringList cols;
                     crcadsb crc;
+                    ADSBDemodStateEngine stateEngine;
+                    stateEngine.setStationPosition(
+                        m_azEl.getLocationSpherical().m_latitude,
+                        m_azEl.getLocationSpherical().m_longitude,
+                        m_azEl.getLocationSpherical().m_altitude
+                    );
                     while (!cancelled && CSV::readRow(in, &cols))
                     {
                         if (cols.size() > maxCol)
@@ -5401,14 +4869,21 @@ void ADSBDemodGUI::on_logOpen_clicked()
                             if ((df == 4) || (df == 5) || (df == 17) || (df == 18) || (df == 20) || (df == 21))
                             {
                                 int crcCalc = 0;
-                                if ((df == 4) || (df == 5) || (df == 20) || (df == 21))  // handleADSB requires calculated CRC for Mode-S frames
+                                if ((df == 4) || (df == 5) || (df == 20) || (df == 21))  // State engine requires calculated CRC for Mode-S frames
                                 {
                                     crc.init();
                                     crc.calculate((const uint8_t *)bytes.data(), bytes.size()-3);
                                     crcCalc = crc.get();
                                 }
                                 //qDebug() << "bytes.szie " << bytes.size() << " crc " << Qt::hex <<  crcCalc;
-                                handleADSB(bytes, dateTime, correlation, correlation, crcCalc, false);
+                                const ADSBAircraftState *state = stateEngine.handleFrame(bytes, dateTime, correlation, correlation, crcCalc);
+                                if (state)
+                                {
+                                    updateAircraft(*state, false);
+                                    if ((df == 20) || (df == 21)) {
+                                        handleCommB(bytes, dateTime, crcCalc);
+                                    }
+                                }
                                 if ((count > 0) && (count % 10000 == 0))
                                 {
                                     dialog.setText(QString("Reading ADS-B data\n%1 (Skipped %2)").arg(count).arg(countOtherDF));
@@ -5486,53 +4961,6 @@ void ADSBDemodGUI::downloadNavAidsFinished()
     }
 }
 
-int ADSBDemodGUI::squawkDecode(int modeA) const
-{
-    int a, b, c, d;
-    c = ((modeA >> 12) & 1) | ((modeA >> (10-1)) & 0x2) | ((modeA >> (8-2)) & 0x4);
-    a = ((modeA >> 11) & 1) | ((modeA >> (9-1)) & 0x2) | ((modeA >> (7-2)) & 0x4);
-    b = ((modeA >> 5) & 1) | ((modeA >> (3-1)) & 0x2) | ((modeA << (1)) & 0x4);
-    d = ((modeA >> 4) & 1) | ((modeA >> (2-1)) & 0x2) | ((modeA << (2)) & 0x4);
-    return a*1000 + b*100 + c*10 + d;
-}
-
-// https://en.wikipedia.org/wiki/Gillham_code
-int ADSBDemodGUI::gillhamToFeet(int n) const
-{
-    int c1 = (n >> 10) & 1;
-    int a1 = (n >> 9) & 1;
-    int c2 = (n >> 8) & 1;
-    int a2 = (n >> 7) & 1;
-    int c4 = (n >> 6) & 1;
-    int a4 = (n >> 5) & 1;
-    int b1 = (n >> 4) & 1;
-    int b2 = (n >> 3) & 1;
-    int d2 = (n >> 2) & 1;
-    int b4 = (n >> 1) & 1;
-    int d4 = n & 1;
-
-    int n500 = grayToBinary((d2 << 7) | (d4 << 6) | (a1 << 5) | (a2 << 4) | (a4 << 3) | (b1 << 2) | (b2 << 1) | b4, 4);
-    int n100 = grayToBinary((c1 << 2) | (c2 << 1) | c4, 3) - 1;
-
-    if (n100 == 6) {
-        n100 = 4;
-    }
-    if (n500 %2 != 0) {
-        n100 = 4 - n100;
-    }
-
-    return -1200 + n500*500 + n100*100;
-}
-
-int ADSBDemodGUI::grayToBinary(int gray, int bits) const
-{
-    int binary = 0;
-    for (int i = bits - 1; i >= 0; i--) {
-        binary = binary | ((((1 << (i+1)) & binary) >> 1) ^ ((1 << i) & gray));
-    }
-    return binary;
-}
-
 void ADSBDemodGUI::redrawMap()
 {
     // An awful workaround for https://bugreports.qt.io/browse/QTBUG-100333
@@ -5678,8 +5106,6 @@ void ADSBDemodGUI::handleImportReply(QNetworkReply* reply)
                                 aircraft->m_longitudeItem->setData(Qt::DisplayRole, aircraft->m_longitude);
                                 aircraft->m_latitudeItem->setData(Qt::DisplayRole, aircraft->m_latitude);
                                 updatePosition(aircraft);
-                                aircraft->m_cprValid[0] = false;
-                                aircraft->m_cprValid[1] = false;
                             }
                             if (!state[7].isNull())
                             {
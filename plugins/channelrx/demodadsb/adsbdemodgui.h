@@ -24,6 +24,8 @@
 #include <QGeoCoordinate>
 #include <QDateTime>
 #include <QAbstractListModel>
+#include <QHash>
+#include <QSet>
 #include <QProgressDialog>
 #include <QTextToSpeech>
 #include <QRandomGenerator>
@@ -58,6 +60,7 @@ class WebAPIAdapterInterface;
 class HttpDownloadManager;
 class ADSBDemodGUI;
 class ADSBOSMTemplateServer;
+struct ADSBAircraftState;
 
 namespace Ui {
     class ADSBDemodGUI;
@@ -133,18 +136,11 @@ struct Aircraft {
     bool m_machValid;
     bool m_bdsCapabilitiesValid;
 
-    // State for calculating position using two CPR frames
-    bool m_cprValid[2];
-    Real m_cprLat[2];
-    Real m_cprLong[2];
-    QDateTime m_cprTime[2];
-
     int m_adsbFrameCount;       // Number of ADS-B frames for this aircraft
     int m_tisBFrameCount;
     float m_minCorrelation;
     float m_maxCorrelation;
     float m_correlation;
-    MovingAverageUtil<float, double, 100> m_correlationAvg;
 
     bool m_isTarget;            // Are we targetting this aircraft (sending az/el to rotator)
     bool m_isHighlighted;       // Are we highlighting this aircraft in the table and map
@@ -289,9 +285,6 @@ struct Aircraft {
         m_rollEst(0.0),
         m_notified(false)
     {
-        for (int i = 0; i < 2; i++) {
-            m_cprValid[i] = false;
-        }
         for (int i = 0; i < 16; i++) {
             for (int j = 0; j < 16; j++) {
                 m_bdsCapabilities[i][j] = false;
@@ -387,6 +380,7 @@ public:
 
     Q_INVOKABLE void addAircraft(Aircraft *aircraft) {
         beginInsertRows(QModelIndex(), rowCount(), rowCount());
+        m_rows.insert(aircraft, m_aircrafts.count());
         m_aircrafts.append(aircraft);
         endInsertRows();
     }
@@ -407,12 +401,29 @@ public:
     }
 
     void aircraftUpdated(Aircraft *aircraft) {
-        int row = m_aircrafts.indexOf(aircraft);
-        if (row >= 0)
+        QHash<Aircraft *, int>::const_iterator it = m_rows.constFind(aircraft);
+        if (it != m_rows.constEnd())
         {
-            QModelIndex idx = index(row);
+            QModelIndex idx = index(it.value());
+            emit dataChanged(idx, idx);
+        }
+    }
+
+    // Frames can arrive thousands of times a second, so the view is only told
+    // about the aircraft they updated when flushUpdates() is called from the GUI tick
+    void queueAircraftUpdate(Aircraft *aircraft) {
+        if (m_rows.contains(aircraft)) {
+            m_updated.insert(aircraft);
+        }
+    }
+
+    void flushUpdates() {
+        for (auto aircraft : m_updated)
+        {
+            QModelIndex idx = index(m_rows.value(aircraft));
             emit dataChanged(idx, idx);
         }
+        m_updated.clear();
     }
 
     void allAircraftUpdated() {
@@ -429,11 +440,17 @@ public:
     }
 
     void removeAircraft(Aircraft *aircraft) {
-        int row = m_aircrafts.indexOf(aircraft);
-        if (row >= 0)
+        QHash<Aircraft *, int>::iterator it = m_rows.find(aircraft);
+        if (it != m_rows.end())
         {
+            int row = it.value();
             beginRemoveRows(QModelIndex(), row, row);
             m_aircrafts.removeAt(row);
+            m_rows.erase(it);
+            m_updated.remove(aircraft);
+            for (int i = row; i < m_aircrafts.count(); i++) {
+                m_rows[m_aircrafts[i]] = i;
+            }
             endRemoveRows();
         }
     }
@@ -468,6 +485,8 @@ public:
 
 private:
     QList<Aircraft *> m_aircrafts;
+    QHash<Aircraft *, int> m_rows;  // Row of each aircraft in m_aircrafts
+    QSet<Aircraft *> m_updated;     // Aircraft updated since last flushUpdates()
     bool m_flightPaths;
     bool m_allFlightPaths;
 };
@@ -905,8 +924,7 @@ private:
 
     AzEl m_azEl;                        // Position of station
     Aircraft *m_trackAircraft;          // Aircraft we want to track in Channel Report
-    MovingAverageUtil<float, double, 10> m_correlationAvg;
-    MovingAverageUtil<float, double, 10> m_correlationOnesAvg;
+    float m_correlationAvg;             // Average preamble correlation from the worker
     Aircraft *m_highlightAircraft;      // Aircraft we want to highlight, when selected in table
 
     float m_currentAirportRange;        // Current settings, so we only update if changed
@@ -936,12 +954,6 @@ private:
     QTimer m_redrawMapTimer;
     QNetworkAccessManager *m_networkManager;
 
-    static const char m_idMap[];
-    static const QString m_categorySetA[];
-    static const QString m_categorySetB[];
-    static const QString m_categorySetC[];
-    static const QString m_emergencyStatus[];
-    static const QString m_flightStatuses[];
     static const QString m_hazardSeverity[];
     static const QString m_fomSources[];
 
@@ -956,20 +968,13 @@ private:
     void updateAbsoluteCenterFrequency();
 
     void updatePosition(Aircraft *aircraft);
-    bool updateLocalPosition(Aircraft *aircraft, double latitude, double longitude, bool surfacePosition);
     void sendToMap(Aircraft *aircraft, QList<SWGSDRangel::SWGMapAnimation *> *animations);
     Aircraft *getAircraft(int icao, bool &newAircraft);
     void callsignToFlight(Aircraft *aircraft);
     int roundTo50Feet(int alt);
     bool calcAirTemp(Aircraft *aircraft);
-    void handleADSB(
-        const QByteArray data,
-        const QDateTime dateTime,
-        float correlation,
-        float correlationOnes,
-        unsigned crc,
-        bool updateModel);
-    void decodeModeS(const QByteArray data, int df, Aircraft *aircraft);
+    void updateAircraft(const ADSBAircraftState& state, bool updateModel);
+    void handleCommB(const QByteArray data, const QDateTime dateTime, unsigned crc);
     void decodeCommB(const QByteArray data, const QDateTime dateTime, int df, Aircraft *aircraft, bool &updatedCallsign);
     QList<SWGSDRangel::SWGMapAnimation *> *animate(QDateTime dateTime, Aircraft *aircraft);
     SWGSDRangel::SWGMapAnimation *gearAnimation(QDateTime startDateTime, bool up);
@@ -1009,9 +1014,6 @@ private:
     void updatePhotoText(Aircraft *aircraft);
     void updatePhotoFlightInformation(Aircraft *aircraft);
     void findOnChannelMap(Aircraft *aircraft);
-    int squawkDecode(int code) const;
-    int gillhamToFeet(int n) const;
-    int grayToBinary(int gray, int bits) const;
     void redrawMap();
     void applyImportSettings();
 
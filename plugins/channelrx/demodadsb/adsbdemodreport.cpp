@@ -20,3 +20,6 @@
 
 MESSAGE_CLASS_DEFINITION(ADSBDemodReport::MsgReportADSB, Message)
 MESSAGE_CLASS_DEFINITION(ADSBDemodReport::MsgReportDemodStats, Message)
+MESSAGE_CLASS_DEFINITION(ADSBDemodReport::MsgAircraftStates, Message)
+MESSAGE_POOL_DEFINITION(ADSBDemodReport::MsgReportADSB)
+MESSAGE_POOL_DEFINITION(ADSBDemodReport::MsgReportDemodStats)
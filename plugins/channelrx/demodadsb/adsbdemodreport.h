@@ -22,10 +22,13 @@
 #include <QObject>
 #include <QByteArray>
 #include <QDateTime>
+#include <QList>
 
 #include "dsp/dsptypes.h"
 #include "util/message.h"
+#include "util/messagepool.h"
 #include "adsbdemodstats.h"
+#include "adsbdemodstateengine.h"
 
 class ADSBDemodReport : public QObject
 {
@@ -33,6 +36,7 @@ class ADSBDemodReport : public QObject
 public:
     class MsgReportADSB : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_POOL_DECLARATION
 
     public:
         QByteArray getData() const { return m_data; }
@@ -78,6 +82,7 @@ public:
 
     class MsgReportDemodStats : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_POOL_DECLARATION
 
     public:
         ADSBDemodStats getDemodStats() const { return m_demodStats; }
@@ -97,6 +102,31 @@ public:
         }
     };
 
+    // Aircraft updated since the previous report
+    class MsgAircraftStates : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const QList<ADSBAircraftState>& getStates() const { return m_states; }
+        float getCorrelationAverage() const { return m_correlationAverage; }
+
+        static MsgAircraftStates* create(const QList<ADSBAircraftState>& states, float correlationAverage)
+        {
+            return new MsgAircraftStates(states, correlationAverage);
+        }
+
+    private:
+        QList<ADSBAircraftState> m_states;
+        float m_correlationAverage;
+
+        MsgAircraftStates(const QList<ADSBAircraftState>& states, float correlationAverage) :
+            Message(),
+            m_states(states),
+            m_correlationAverage(correlationAverage)
+        {
+        }
+    };
+
 public:
     ADSBDemodReport() {}
     ~ADSBDemodReport() {}
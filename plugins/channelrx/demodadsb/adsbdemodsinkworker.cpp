@@ -18,6 +18,8 @@
 #define BOOST_CHRONO_HEADER_ONLY
 #include <boost/chrono/chrono.hpp>
 
+#include <algorithm>
+
 #include <QDebug>
 
 #include "util/stepfunctions.h"
@@ -25,6 +27,7 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "device/deviceapi.h"
+#include "util/workerpool.h"
 
 #include "adsbdemodreport.h"
 #include "adsbdemodsink.h"
@@ -51,6 +54,12 @@ void ADSBDemodSinkWorker::run()
     int samplesPerBit = m_settings.m_samplesPerBit;
     int samplesPerFrame = samplesPerBit*(ADS_B_PREAMBLE_BITS+ADS_B_ES_BITS);
     int samplesPerChip = samplesPerBit/ADS_B_CHIPS_PER_BIT;
+    double sampleRate = ADS_B_BITS_PER_SECOND * (double) samplesPerBit;
+
+    m_chipSums.resize(m_sink->m_bufferSize);
+    m_correlationOnes.resize(m_sink->m_bufferSize);
+    m_correlationZeros.resize(m_sink->m_bufferSize);
+    m_crcs.resize(WorkerPool::instance().getNbThreads() + 1);
 
     qDebug() << "ADSBDemodSinkWorker:: running with"
          << " samplesPerFrame: " << samplesPerFrame
@@ -58,298 +67,354 @@ void ADSBDemodSinkWorker::run()
          << " samplesPerBit: " << samplesPerBit
          << " correlateFullPreamble: " << m_settings.m_correlateFullPreamble
          << " correlationScale: " << m_correlationScale
-         << " correlationThreshold: " << m_settings.m_correlationThreshold;
+         << " correlationThreshold: " << m_settings.m_correlationThreshold
+         << " demodulation jobs: " << m_crcs.size();
 
     int readIdx = m_sink->m_samplesPerFrame - 1;
 
     while (true)
     {
-        int startIdx = readIdx;
-
-        // Correlate received signal with expected preamble
-        // chip+ indexes are 0, 2, 7, 9
-        // correlating over first 6 bits gives a reduction in per-sample
-        // processing, but more than doubles the number of false matches
-        Real preambleCorrelationOnes = 0.0;
-        Real preambleCorrelationZeros = 0.0;
-        if (m_settings.m_correlateFullPreamble)
+        // Last index at which a whole frame is in the buffer
+        int endIdx = m_sink->m_bufferSize - samplesPerFrame;
+
+        if (readIdx <= endIdx)
         {
-            for (int i = 0; i < samplesPerChip; i++)
-            {
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  0*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  1*samplesPerChip + i];
+            correlate(readBuffer, readIdx, endIdx, samplesPerChip);
+            demodulateCandidates(samplesPerBit, samplesPerChip);
+            m_demodStats.m_samples += endIdx + 1 - readIdx;
+            readIdx = validateCandidates(readBuffer, readIdx, samplesPerFrame, samplesPerChip);
+        }
 
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  2*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  3*samplesPerChip + i];
+        if (readIdx <= endIdx) {
+            readIdx = endIdx + 1;
+        }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  4*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  5*samplesPerChip + i];
+        int nextBuffer = readBuffer+1;
+        if (nextBuffer >= m_sink->m_buffers)
+            nextBuffer = 0;
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  6*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  7*samplesPerChip + i];
+        // Update amount of time spent processing (don't include time spend in acquire)
+        boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - startPoint;
+        m_demodStats.m_demodTime += sec.count();
+        m_demodStats.m_feedTime = m_sink->m_feedTime;
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  8*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  9*samplesPerChip + i];
+        if (m_demodStats.m_demodTime > 0.0)
+        {
+            m_demodStats.m_demodRate = m_demodStats.m_samples / m_demodStats.m_demodTime;
+            m_demodStats.m_headroom = m_demodStats.m_demodRate / sampleRate;
+        }
+
+        // Send stats to GUI
+        if (m_sink->getMessageQueueToGUI())
+        {
+            ADSBDemodReport::MsgReportDemodStats *msg = ADSBDemodReport::MsgReportDemodStats::create(m_demodStats);
+            m_sink->getMessageQueueToGUI()->push(msg);
+        }
+
+        if (!isInterruptionRequested())
+        {
+            // Get next buffer
+            m_sink->m_bufferRead[nextBuffer].acquire();
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 10*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 11*samplesPerChip + i];
+            // Check for updated settings
+            handleInputMessages();
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 12*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 13*samplesPerChip + i];
+            // Resume timing how long we are processing
+            startPoint = boost::chrono::steady_clock::now();
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 14*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 15*samplesPerChip + i];
+            int samplesRemaining = m_sink->m_bufferSize - readIdx;
+            if (samplesRemaining > 0)
+            {
+                // Copy remaining samples, to start of next buffer
+                memcpy(&m_sink->m_sampleBuffer[nextBuffer][samplesPerFrame - 1 - samplesRemaining], &m_sink->m_sampleBuffer[readBuffer][readIdx], samplesRemaining*sizeof(Real));
+                readIdx = samplesPerFrame - 1 - samplesRemaining;
+            }
+            else
+            {
+                readIdx = samplesPerFrame - 1;
             }
+
+            m_sink->m_bufferWrite[readBuffer].release();
+
+            readBuffer = nextBuffer;
         }
         else
         {
-            for (int i = 0; i < samplesPerChip; i++)
-            {
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  0*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  1*samplesPerChip + i];
-
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  2*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  3*samplesPerChip + i];
+            // Use a break to avoid testing a condition in the main loop
+            break;
+        }
+    }
+}
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  4*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  5*samplesPerChip + i];
+// Correlate received signal with expected preamble at every index from startIdx to endIdx
+// and save the matches in m_candidates
+void ADSBDemodSinkWorker::correlate(int readBuffer, int startIdx, int endIdx, int samplesPerChip)
+{
+    const Real *samples = m_sink->m_sampleBuffer[readBuffer];
+    Real *chipSums = m_chipSums.data();
+    Real *ones = m_correlationOnes.data();
+    Real *zeros = m_correlationZeros.data();
+    int chipSumsEnd = m_sink->m_bufferSize - samplesPerChip + 1;
+    int k = samplesPerChip;
+
+    // Sum over each chip is computed once per buffer and shared by the preamble correlation at
+    // every index and by the bit decisions. Inner loops are over sample positions with no
+    // dependency between iterations so that they are vectorized
+    std::fill(chipSums + startIdx, chipSums + chipSumsEnd, 0.0f);
+
+    for (int i = 0; i < samplesPerChip; i++)
+    {
+        for (int idx = startIdx; idx < chipSumsEnd; idx++) {
+            chipSums[idx] += samples[idx + i];
+        }
+    }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  6*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  7*samplesPerChip + i];
+    // chip+ indexes are 0, 2, 7, 9
+    // correlating over first 6 bits gives a reduction in per-sample
+    // processing, but more than doubles the number of false matches
+    for (int idx = startIdx; idx <= endIdx; idx++)
+    {
+        ones[idx] = chipSums[idx] + chipSums[idx + 2*k] + chipSums[idx + 7*k] + chipSums[idx + 9*k];
+        zeros[idx] = chipSums[idx + k] + chipSums[idx + 3*k] + chipSums[idx + 4*k] + chipSums[idx + 5*k]
+            + chipSums[idx + 6*k] + chipSums[idx + 8*k] + chipSums[idx + 10*k] + chipSums[idx + 11*k];
+    }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  8*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  9*samplesPerChip + i];
+    if (m_settings.m_correlateFullPreamble)
+    {
+        for (int idx = startIdx; idx <= endIdx; idx++) {
+            zeros[idx] += chipSums[idx + 12*k] + chipSums[idx + 13*k] + chipSums[idx + 14*k] + chipSums[idx + 15*k];
+        }
+    }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 10*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 11*samplesPerChip + i];
-            }
+    // Use the ratio of ones power over zeros power, as we don't care how powerful the signal
+    // is, just whether there is a good correlation with the preamble. The absolute value varies
+    // too much with different radios, AGC settings and and the noise floor is not constant
+    // (E.g: it's quite possible to receive multiple frames simultaneously, so we don't
+    // want a maximum threshold for the zeros, as a weaker signal may transmit 1s in
+    // a stronger signals 0 chip position. Similarly a strong signal in an adjacent
+    // channel may casue AGC to reduce gain, reducing the ampltiude of an otherwise
+    // strong signal, as well as the noise floor)
+    // The threshold accounts for the different number of zeros and ones in the preamble
+    // If the sum of ones is exactly 0, it's probably no signal
+    m_candidates.clear();
+
+    for (int idx = startIdx; idx <= endIdx; idx++)
+    {
+        if ((ones[idx] > m_correlationThresholdLinear * zeros[idx]) && (ones[idx] != 0.0f))
+        {
+            Candidate candidate;
+            candidate.m_idx = idx;
+            candidate.m_correlation = ones[idx] / zeros[idx]; // without one/zero ratio correction
+            candidate.m_correlationOnes = ones[idx];
+            m_candidates.push_back(candidate);
         }
+    }
+}
 
-        // Use the ratio of ones power over zeros power, as we don't care how powerful the signal
-        // is, just whether there is a good correlation with the preamble. The absolute value varies
-        // too much with different radios, AGC settings and and the noise floor is not constant
-        // (E.g: it's quite possible to receive multiple frames simultaneously, so we don't
-        // want a maximum threshold for the zeros, as a weaker signal may transmit 1s in
-        // a stronger signals 0 chip position. Similarly a strong signal in an adjacent
-        // channel may casue AGC to reduce gain, reducing the ampltiude of an otherwise
-        // strong signal, as well as the noise floor)
-        // The threshold accounts for the different number of zeros and ones in the preamble
-        // If the sum of ones is exactly 0, it's probably no signal
+// Candidates are independent so they are demodulated and CRC checked in parallel in the worker pool.
+// What depends on previous frames is done in validateCandidates()
+void ADSBDemodSinkWorker::demodulateCandidates(int samplesPerBit, int samplesPerChip)
+{
+    WorkerPool& pool = WorkerPool::instance();
+    int nbCandidates = m_candidates.size();
+    int nbJobs = (nbCandidates + m_minCandidatesPerJob - 1) / m_minCandidatesPerJob;
+    nbJobs = std::min(nbJobs, (int) m_crcs.size());
 
-        Real preambleCorrelation = preambleCorrelationOnes/preambleCorrelationZeros; // without one/zero ratio correction
+    if (nbJobs <= 1)
+    {
+        demodulate(0, nbCandidates, m_crcs[0], samplesPerBit, samplesPerChip);
+        return;
+    }
 
-        if ((preambleCorrelation > m_correlationThresholdLinear) && (preambleCorrelationOnes != 0.0f))
-        {
-            int firstIdx = startIdx;
+    int candidatesPerJob = (nbCandidates + nbJobs - 1) / nbJobs;
+    std::vector<WorkerPool::Ticket> tickets;
 
-            m_demodStats.m_correlatorMatches++;
-            // Skip over preamble
-            startIdx += samplesPerBit*ADS_B_PREAMBLE_BITS;
+    // First range is demodulated in this thread while the pool does the others
+    for (int job = 1; job < nbJobs; job++)
+    {
+        int first = job * candidatesPerJob;
+        int last = std::min(nbCandidates, first + candidatesPerJob);
+        crcadsb *crc = &m_crcs[job];
+        tickets.push_back(pool.submit([this, first, last, crc, samplesPerBit, samplesPerChip](){
+            demodulate(first, last, *crc, samplesPerBit, samplesPerChip);
+        }));
+    }
 
-            // Demodulate waveform to bytes
-            unsigned char data[ADS_B_ES_BYTES];
-            int byteIdx = 0;
-            int currentBit;
-            unsigned char currentByte = 0;
-            int df;
+    demodulate(0, candidatesPerJob, m_crcs[0], samplesPerBit, samplesPerChip);
 
-            for (int bit = 0; bit < ADS_B_ES_BITS; bit++)
-            {
-                // PPM (Pulse position modulation) - Each bit spreads to two chips, 1->10, 0->01
-                // Determine if bit is 1 or 0, by seeing which chip has largest combined energy over the sampling period
-                Real oneSum = 0.0f;
-                Real zeroSum = 0.0f;
-                for (int i = 0; i < samplesPerChip; i++)
-                {
-                    oneSum += m_sink->m_sampleBuffer[readBuffer][startIdx+i];
-                    zeroSum += m_sink->m_sampleBuffer[readBuffer][startIdx+samplesPerChip+i];
-                }
-                currentBit = oneSum > zeroSum;
-                startIdx += samplesPerBit;
-                // Convert bit to bytes - MSB first
-                currentByte |= currentBit << (7-(bit & 0x7));
-                if ((bit & 0x7) == 0x7)
-                {
-                    data[byteIdx++] = currentByte;
-                    currentByte = 0;
-                    // Don't try to demodulate any further, if this isn't an ADS-B frame
-                    // to help reduce processing overhead
-                    if (!m_settings.m_demodModeS && (bit == 7))
-                    {
-                        df = ((data[0] >> 3) & ADS_B_DF_MASK);
-                        if ((df != 17) && (df != 18))
-                            break;
-                    }
-                }
-            }
+    for (const auto& ticket : tickets) {
+        pool.wait(ticket);
+    }
+}
 
-            // Is ADS-B?
-            df = ((data[0] >> 3) & ADS_B_DF_MASK);
-            if ((df == 17) || (df == 18))
-            {
-                m_crc.init();
-                unsigned int parity = (data[11] << 16) | (data[12] << 8) | data[13]; // Parity / CRC
+void ADSBDemodSinkWorker::demodulate(int first, int last, crcadsb& crc, int samplesPerBit, int samplesPerChip)
+{
+    const Real *chipSums = m_chipSums.data();
 
-                m_crc.calculate(data, ADS_B_ES_BYTES-3);
-                if (parity == m_crc.get())
-                {
-                    // Got a valid frame
-                    m_demodStats.m_adsbFrames++;
-                    // Get 24-bit ICAO and save in hash of ICAOs that have been seen
-                    unsigned icao = ((data[1] & 0xff) << 16) | ((data[2] & 0xff) << 8) | (data[3] & 0xff);
-                    m_icaos.insert(icao, true);
-                    // Don't try to re-demodulate the same frame
-                    // We could possibly allow a partial overlap here
-                    readIdx += (ADS_B_ES_BITS+ADS_B_PREAMBLE_BITS)*ADS_B_CHIPS_PER_BIT*samplesPerChip - 1;
-                    // Pass to GUI
-                    if (m_sink->getMessageQueueToGUI())
-                    {
-                        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                            QByteArray((char*)data, sizeof(data)),
-                            preambleCorrelation * m_correlationScale,
-                            preambleCorrelationOnes / samplesPerChip,
-                            rxDateTime(firstIdx, readBuffer),
-                            m_crc.get());
-                        m_sink->getMessageQueueToGUI()->push(msg);
-                    }
-                    // Pass to worker to feed to other servers
-                    if (m_sink->getMessageQueueToWorker())
-                    {
-                        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                            QByteArray((char*)data, sizeof(data)),
-                            preambleCorrelation * m_correlationScale,
-                            preambleCorrelationOnes / samplesPerChip,
-                            rxDateTime(firstIdx, readBuffer),
-                            m_crc.get());
-                        m_sink->getMessageQueueToWorker()->push(msg);
-                    }
-                }
-                else
-                    m_demodStats.m_crcFails++;
-            }
-            else if (m_settings.m_demodModeS)
+    for (int c = first; c < last; c++)
+    {
+        Candidate& candidate = m_candidates[c];
+        unsigned char *data = candidate.m_data;
+        // Skip over preamble
+        int startIdx = candidate.m_idx + samplesPerBit*ADS_B_PREAMBLE_BITS;
+        int byteIdx = 0;
+        int currentBit;
+        unsigned char currentByte = 0;
+        int df;
+
+        memset(data, 0, ADS_B_ES_BYTES);
+
+        // Demodulate waveform to bytes
+        for (int bit = 0; bit < ADS_B_ES_BITS; bit++)
+        {
+            // PPM (Pulse position modulation) - Each bit spreads to two chips, 1->10, 0->01
+            // Determine if bit is 1 or 0, by seeing which chip has largest combined energy over the sampling period
+            currentBit = chipSums[startIdx] > chipSums[startIdx + samplesPerChip];
+            startIdx += samplesPerBit;
+            // Convert bit to bytes - MSB first
+            currentByte |= currentBit << (7-(bit & 0x7));
+            if ((bit & 0x7) == 0x7)
             {
-                int bytes;
-
-                // Determine number of bytes in frame depending on downlink format
-                if ((df == 0) || (df == 4) || (df == 5) || (df == 11)) {
-                    bytes = 56/8;
-                } else if ((df == 16) || (df == 20) || (df == 21) || (df >= 24)) {
-                    bytes = 112/8;
-                } else {
-                    bytes = 0;
-                }
-                if (bytes > 0)
+                data[byteIdx++] = currentByte;
+                currentByte = 0;
+                // Don't try to demodulate any further, if this isn't an ADS-B frame
+                // to help reduce processing overhead
+                if (!m_settings.m_demodModeS && (bit == 7))
                 {
-                    // Extract received parity
-                    int parity = (data[bytes-3] << 16) | (data[bytes-2] << 8) | data[bytes-1];
-                    // Calculate CRC on received frame
-                    m_crc.init();
-                    m_crc.calculate(data, bytes-3);
-                    int crc = m_crc.get();
-                    // DF4 / DF5 / DF20 / DF21 have ICAO address XORed in to parity.
-                    // Extract ICAO from parity and see if it matches an aircraft we've already
-                    // received an ADS-B frame from
-                    if ((df == 4) || (df == 5) || (df == 20) || (df == 21))
-                    {
-                        unsigned icao = (parity ^ crc) & 0xffffff;
-                        if (m_icaos.contains(icao)) {
-                            crc ^= icao;
-                        }
-                    }
-                    // For DF11, the last 7 bits may have an address/interogration indentifier (II)
-                    // XORed in, so we ignore those bits
-                    if ((parity == crc) || ((df == 11) && ((parity & 0xffff80) == (crc & 0xffff80))))
-                    {
-                        m_demodStats.m_modesFrames++;
-                        // Pass to GUI (only pass formats it can decode)
-                        if (m_sink->getMessageQueueToGUI() && ((df == 4) || (df == 5) || (df == 20) || (df == 21)))
-                        {
-                            ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                                QByteArray((char*)data, sizeof(data)),
-                                preambleCorrelation * m_correlationScale,
-                                preambleCorrelationOnes / samplesPerChip,
-                                rxDateTime(firstIdx, readBuffer),
-                                m_crc.get());
-                            m_sink->getMessageQueueToGUI()->push(msg);
-                        }
-                        // Pass to worker to feed to other servers
-                        if (m_sink->getMessageQueueToWorker())
-                        {
-                            ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                                QByteArray((char*)data, sizeof(data)),
-                                preambleCorrelation * m_correlationScale,
-                                preambleCorrelationOnes / samplesPerChip,
-                                rxDateTime(firstIdx, readBuffer),
-                                m_crc.get());
-                            m_sink->getMessageQueueToWorker()->push(msg);
-                        }
-                    }
-                    else
-                    {
-                        m_demodStats.m_crcFails++;
-                    }
+                    df = ((data[0] >> 3) & ADS_B_DF_MASK);
+                    if ((df != 17) && (df != 18))
+                        break;
                 }
-                else
-                    m_demodStats.m_typeFails++;
             }
-            else
-                m_demodStats.m_typeFails++;
         }
-        readIdx++;
-        if (readIdx > m_sink->m_bufferSize - samplesPerFrame)
-        {
-            int nextBuffer = readBuffer+1;
-            if (nextBuffer >= m_sink->m_buffers)
-                nextBuffer = 0;
 
-            // Update amount of time spent processing (don't include time spend in acquire)
-            boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - startPoint;
-            m_demodStats.m_demodTime += sec.count();
-            m_demodStats.m_feedTime = m_sink->m_feedTime;
+        df = ((data[0] >> 3) & ADS_B_DF_MASK);
+        candidate.m_df = df;
+
+        // Determine number of bytes in frame depending on downlink format
+        if ((df == 17) || (df == 18)) {
+            candidate.m_bytes = ADS_B_ES_BYTES;
+        } else if (!m_settings.m_demodModeS) {
+            candidate.m_bytes = 0;
+        } else if ((df == 0) || (df == 4) || (df == 5) || (df == 11)) {
+            candidate.m_bytes = 56/8;
+        } else if ((df == 16) || (df == 20) || (df == 21) || (df >= 24)) {
+            candidate.m_bytes = 112/8;
+        } else {
+            candidate.m_bytes = 0;
+        }
 
-            // Send stats to GUI
-            if (m_sink->getMessageQueueToGUI())
-            {
-                ADSBDemodReport::MsgReportDemodStats *msg = ADSBDemodReport::MsgReportDemodStats::create(m_demodStats);
-                m_sink->getMessageQueueToGUI()->push(msg);
-            }
+        if (candidate.m_bytes > 0)
+        {
+            int bytes = candidate.m_bytes;
+            // Extract received parity and calculate CRC on received frame
+            candidate.m_parity = (data[bytes-3] << 16) | (data[bytes-2] << 8) | data[bytes-1];
+            crc.init();
+            crc.calculate(data, bytes-3);
+            candidate.m_crc = crc.get();
+        }
+    }
+}
 
-            if (!isInterruptionRequested())
-            {
-                // Get next buffer
-                m_sink->m_bufferRead[nextBuffer].acquire();
+// Accept candidates in buffer order. Returns the index following the last sample processed
+int ADSBDemodSinkWorker::validateCandidates(int readBuffer, int readIdx, int samplesPerFrame, int samplesPerChip)
+{
+    int nextIdx = readIdx;
 
-                // Check for updated settings
-                handleInputMessages();
+    for (const auto& candidate : m_candidates)
+    {
+        // Don't try to re-demodulate the same frame
+        // We could possibly allow a partial overlap here
+        if (candidate.m_idx < nextIdx) {
+            continue;
+        }
 
-                // Resume timing how long we are processing
-                startPoint = boost::chrono::steady_clock::now();
+        m_demodStats.m_correlatorMatches++;
+        int df = candidate.m_df;
 
-                int samplesRemaining = m_sink->m_bufferSize - readIdx;
-                if (samplesRemaining > 0)
-                {
-                    // Copy remaining samples, to start of next buffer
-                    memcpy(&m_sink->m_sampleBuffer[nextBuffer][samplesPerFrame - 1 - samplesRemaining], &m_sink->m_sampleBuffer[readBuffer][readIdx], samplesRemaining*sizeof(Real));
-                    readIdx = samplesPerFrame - 1 - samplesRemaining;
-                }
-                else
-                {
-                    readIdx = samplesPerFrame - 1;
+        // Is ADS-B?
+        if ((df == 17) || (df == 18))
+        {
+            if (candidate.m_parity == candidate.m_crc)
+            {
+                // Got a valid frame
+                m_demodStats.m_adsbFrames++;
+                // Get 24-bit ICAO and save in hash of ICAOs that have been seen
+                unsigned icao = ((candidate.m_data[1] & 0xff) << 16) | ((candidate.m_data[2] & 0xff) << 8) | (candidate.m_data[3] & 0xff);
+                m_icaos.insert(icao, true);
+                nextIdx = candidate.m_idx + samplesPerFrame;
+                reportFrame(candidate, readBuffer, samplesPerChip, false); // decoded by the worker state engine
+            }
+            else
+            {
+                m_demodStats.m_crcFails++;
+            }
+        }
+        else if (m_settings.m_demodModeS && (candidate.m_bytes > 0))
+        {
+            unsigned parity = candidate.m_parity;
+            unsigned crc = candidate.m_crc;
+            // DF4 / DF5 / DF20 / DF21 have ICAO address XORed in to parity.
+            // Extract ICAO from parity and see if it matches an aircraft we've already
+            // received an ADS-B frame from
+            if ((df == 4) || (df == 5) || (df == 20) || (df == 21))
+            {
+                unsigned icao = (parity ^ crc) & 0xffffff;
+                if (m_icaos.contains(icao)) {
+                    crc ^= icao;
                 }
-
-                m_sink->m_bufferWrite[readBuffer].release();
-
-                readBuffer = nextBuffer;
+            }
+            // For DF11, the last 7 bits may have an address/interogration indentifier (II)
+            // XORed in, so we ignore those bits
+            if ((parity == crc) || ((df == 11) && ((parity & 0xffff80) == (crc & 0xffff80))))
+            {
+                m_demodStats.m_modesFrames++;
+                // Pass to GUI only Comm-B replies. Other formats are decoded by the worker state engine
+                reportFrame(candidate, readBuffer, samplesPerChip, (df == 20) || (df == 21));
             }
             else
             {
-                // Use a break to avoid testing a condition in the main loop
-                break;
+                m_demodStats.m_crcFails++;
             }
         }
+        else
+        {
+            m_demodStats.m_typeFails++;
+        }
+    }
+
+    return nextIdx;
+}
+
+void ADSBDemodSinkWorker::reportFrame(const Candidate& candidate, int readBuffer, int samplesPerChip, bool toGUI)
+{
+    QByteArray data((const char*) candidate.m_data, sizeof(candidate.m_data));
+    QDateTime dateTime = rxDateTime(candidate.m_idx, readBuffer);
+
+    // Pass to GUI
+    if (toGUI && m_sink->getMessageQueueToGUI())
+    {
+        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
+            data,
+            candidate.m_correlation * m_correlationScale,
+            candidate.m_correlationOnes / samplesPerChip,
+            dateTime,
+            candidate.m_crc);
+        m_sink->getMessageQueueToGUI()->push(msg);
+    }
+    // Pass to worker to feed to other servers
+    if (m_sink->getMessageQueueToWorker())
+    {
+        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
+            data,
+            candidate.m_correlation * m_correlationScale,
+            candidate.m_correlationOnes / samplesPerChip,
+            dateTime,
+            candidate.m_crc);
+        m_sink->getMessageQueueToWorker()->push(msg);
     }
 }
+
 void ADSBDemodSinkWorker::handleInputMessages()
 {
     Message* message;
@@ -18,6 +18,8 @@
 #ifndef INCLUDE_ADSBDEMODSINKWORKER_H
 #define INCLUDE_ADSBDEMODSINKWORKER_H
 
+#include <vector>
+
 #include <QObject>
 #include <QThread>
 
@@ -25,6 +27,7 @@
 #include "util/crc.h"
 #include "util/messagequeue.h"
 #include "adsbdemodstats.h"
+#include "adsb.h"
 
 class ADSBDemodSink;
 struct ADSBDemodSettings;
@@ -60,14 +63,28 @@ public:
     ADSBDemodSinkWorker(ADSBDemodSink *sink) :
         m_sink(sink),
         m_demodStats(),
-        m_correlationThresholdLinear(0.02f),
-        m_crc()
+        m_correlationThresholdLinear(0.02f)
     {
     }
     void run() override;
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
 
 private:
+    // Preamble correlator match waiting to be demodulated and checked
+    struct Candidate
+    {
+        int m_idx;                              //!< Index of first preamble sample in the buffer
+        Real m_correlation;                     //!< Ones over zeros ratio
+        Real m_correlationOnes;
+        unsigned char m_data[ADS_B_ES_BYTES];
+        int m_df;                               //!< Downlink format
+        int m_bytes;                            //!< Frame length from DF or 0 if it can't be checked
+        unsigned m_parity;                      //!< Received parity
+        unsigned m_crc;                         //!< CRC calculated on the received frame
+    };
+
+    static const int m_minCandidatesPerJob = 16;
+
     void handleInputMessages();
     MessageQueue m_inputMessageQueue;
     ADSBDemodSettings m_settings;
@@ -75,10 +92,19 @@ private:
     ADSBDemodStats m_demodStats;
     Real m_correlationThresholdLinear;
     Real m_correlationScale;
-    crcadsb m_crc;                      //!< Have as member to avoid recomputing LUT
+    std::vector<crcadsb> m_crcs;        //!< One per demodulation job. Have as member to avoid recomputing LUT
     QHash<int, bool> m_icaos;           //!< ICAO addresses that have been received
+    std::vector<Real> m_chipSums;       //!< Sum of samplesPerChip samples starting at each index
+    std::vector<Real> m_correlationOnes;
+    std::vector<Real> m_correlationZeros;
+    std::vector<Candidate> m_candidates;
 
     QDateTime rxDateTime(int firstIdx, int readBuffer) const;
+    void correlate(int readBuffer, int startIdx, int endIdx, int samplesPerChip);
+    void demodulateCandidates(int samplesPerBit, int samplesPerChip);
+    void demodulate(int first, int last, crcadsb& crc, int samplesPerBit, int samplesPerChip);
+    int validateCandidates(int readBuffer, int readIdx, int samplesPerFrame, int samplesPerChip);
+    void reportFrame(const Candidate& candidate, int readBuffer, int samplesPerChip, bool toGUI);
 
 };
 
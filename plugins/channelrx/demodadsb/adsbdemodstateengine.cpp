@@ -0,0 +1,723 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include "util/units.h"
+
+#include "adsbdemodstateengine.h"
+#include "adsb.h"
+
+const char ADSBDemodStateEngine::m_idMap[] = "#ABCDEFGHIJKLMNOPQRSTUVWXYZ##### ############-##0123456789######";
+
+const QString ADSBDemodStateEngine::m_categorySetA[] = {
+    QStringLiteral("None"),
+    QStringLiteral("Light"),
+    QStringLiteral("Small"),
+    QStringLiteral("Large"),
+    QStringLiteral("High vortex"),
+    QStringLiteral("Heavy"),
+    QStringLiteral("High performance"),
+    QStringLiteral("Rotorcraft")
+};
+
+const QString ADSBDemodStateEngine::m_categorySetB[] = {
+    QStringLiteral("None"),
+    QStringLiteral("Glider/sailplane"),
+    QStringLiteral("Lighter-than-air"),
+    QStringLiteral("Parachutist"),
+    QStringLiteral("Ultralight"),
+    QStringLiteral("Reserved"),
+    QStringLiteral("UAV"),
+    QStringLiteral("Space vehicle")
+};
+
+const QString ADSBDemodStateEngine::m_categorySetC[] = {
+    QStringLiteral("None"),
+    QStringLiteral("Emergency vehicle"),
+    QStringLiteral("Service vehicle"),
+    QStringLiteral("Ground obstruction"),
+    QStringLiteral("Cluster obstacle"),
+    QStringLiteral("Line obstacle"),
+    QStringLiteral("Reserved"),
+    QStringLiteral("Reserved")
+};
+
+const QString ADSBDemodStateEngine::m_emergencyStatus[] = {
+    QStringLiteral("No emergency"),
+    QStringLiteral("General emergency"),
+    QStringLiteral("Lifeguard/Medical"),
+    QStringLiteral("Minimum fuel"),
+    QStringLiteral("No communications"),
+    QStringLiteral("Unlawful interference"),
+    QStringLiteral("Downed aircraft"),
+    QStringLiteral("Reserved")
+};
+
+ADSBDemodStateEngine::ADSBDemodStateEngine()
+{
+}
+
+ADSBDemodStateEngine::~ADSBDemodStateEngine()
+{
+    clear();
+}
+
+void ADSBDemodStateEngine::setStationPosition(float latitude, float longitude, float altitude)
+{
+    m_azEl.setLocation(latitude, longitude, altitude);
+}
+
+void ADSBDemodStateEngine::clear()
+{
+    qDeleteAll(m_aircraft);
+    m_aircraft.clear();
+}
+
+ADSBAircraftState *ADSBDemodStateEngine::getOrCreateAircraft(int icao)
+{
+    QHash<int, ADSBAircraftState*>::iterator it = m_aircraft.find(icao);
+
+    if (it != m_aircraft.end()) {
+        return it.value();
+    }
+
+    ADSBAircraftState *aircraft = new ADSBAircraftState();
+    aircraft->m_icao = icao;
+    m_aircraft.insert(icao, aircraft);
+    return aircraft;
+}
+
+int ADSBDemodStateEngine::removeStale(const QDateTime& now, int timeoutSecs)
+{
+    qint64 nowSecs = now.toSecsSinceEpoch();
+    int removed = 0;
+    QHash<int, ADSBAircraftState*>::iterator it = m_aircraft.begin();
+
+    while (it != m_aircraft.end())
+    {
+        if (nowSecs - it.value()->m_time.toSecsSinceEpoch() >= timeoutSecs)
+        {
+            delete it.value();
+            it = m_aircraft.erase(it);
+            removed++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return removed;
+}
+
+const ADSBAircraftState *ADSBDemodStateEngine::handleFrame(const QByteArray& data, const QDateTime& dateTime, float correlation, float correlationOnes, unsigned crc)
+{
+    if (data.size() < ADS_B_ES_BYTES) {
+        return nullptr;
+    }
+
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    int df = (bytes[0] >> 3) & ADS_B_DF_MASK; // Downlink format
+    int ca = bytes[0] & 0x7; // Capability
+    ADSBAircraftState *aircraft;
+
+    if ((df == 4) || (df == 5) || (df == 20) || (df == 21))
+    {
+        // ICAO is XORed in to parity. Only accept frames from aircraft we've had ADS-B from
+        // as otherwise there is no way to tell if the frame is valid
+        int length = ((df == 4) || (df == 5)) ? 56/8 : 112/8;
+        unsigned parity = (bytes[length-3] << 16) | (bytes[length-2] << 8) | bytes[length-1];
+        int icao = (parity ^ crc) & 0xffffff;
+        QHash<int, ADSBAircraftState*>::iterator it = m_aircraft.find(icao);
+
+        if (it == m_aircraft.end()) {
+            return nullptr;
+        }
+
+        aircraft = it.value();
+    }
+    else if ((df == 17) || (df == 18))
+    {
+        int icao = (bytes[1] << 16) | (bytes[2] << 8) | bytes[3]; // ICAO aircraft address
+        aircraft = getOrCreateAircraft(icao);
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    aircraft->m_time = dateTime;
+    aircraft->m_frameCount++;
+
+    if (df == 18) {
+        aircraft->m_tisBFrameCount++;
+    }
+
+    aircraft->m_minCorrelation = std::min(aircraft->m_minCorrelation, correlation);
+    aircraft->m_maxCorrelation = std::max(aircraft->m_maxCorrelation, correlation);
+    aircraft->m_correlationAvg(correlation);
+    aircraft->m_correlation = aircraft->m_correlationAvg.instantAverage();
+    aircraft->m_rssiAvg(correlationOnes);
+    aircraft->m_rssi = aircraft->m_rssiAvg.instantAverage();
+    m_correlationAvg(correlation);
+
+    // ADS-B, non-transponder ADS-B or TIS-B rebroadcast of ADS-B (ADS-R)
+    if ((df == 17) || ((df == 18) && (ca != 4)))
+    {
+        int tc = (bytes[4] >> 3) & 0x1f; // Type code
+
+        if ((tc >= 1) && (tc <= 4)) {
+            decodeIdentification(data, tc, aircraft);
+        } else if (((tc >= 5) && (tc <= 18)) || ((tc >= 20) && (tc <= 22))) {
+            decodePosition(data, dateTime, tc, aircraft);
+        } else if (tc == 19) {
+            decodeVelocity(data, dateTime, aircraft);
+        } else if (tc == 28) {
+            decodeStatus(data, aircraft);
+        } else if (tc == 29) {
+            decodeTargetState(data, aircraft);
+        }
+    }
+    else if ((df == 4) || (df == 5) || (df == 20) || (df == 21))
+    {
+        decodeModeS(data, df, aircraft);
+    }
+
+    return aircraft;
+}
+
+// Aircraft identification - BDS 0,8
+void ADSBDemodStateEngine::decodeIdentification(const QByteArray& data, int tc, ADSBAircraftState *aircraft)
+{
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    int ec = bytes[4] & 0x7; // Emitter category
+
+    if (tc == 4) {
+        aircraft->m_emitterCategory = m_categorySetA[ec];
+    } else if (tc == 3) {
+        aircraft->m_emitterCategory = m_categorySetB[ec];
+    } else if (tc == 2) {
+        aircraft->m_emitterCategory = m_categorySetC[ec];
+    } else {
+        aircraft->m_emitterCategory = QStringLiteral("Reserved");
+    }
+
+    // Flight/callsign - Extract 8 6-bit characters from 6 8-bit bytes, MSB first
+    unsigned char c[8];
+    char callsign[9];
+    c[0] = (bytes[5] >> 2) & 0x3f; // 6
+    c[1] = ((bytes[5] & 0x3) << 4) | ((bytes[6] & 0xf0) >> 4);  // 2+4
+    c[2] = ((bytes[6] & 0xf) << 2) | ((bytes[7] & 0xc0) >> 6);  // 4+2
+    c[3] = (bytes[7] & 0x3f); // 6
+    c[4] = (bytes[8] >> 2) & 0x3f;
+    c[5] = ((bytes[8] & 0x3) << 4) | ((bytes[9] & 0xf0) >> 4);
+    c[6] = ((bytes[9] & 0xf) << 2) | ((bytes[10] & 0xc0) >> 6);
+    c[7] = (bytes[10] & 0x3f);
+
+    for (int i = 0; i < 8; i++) {
+        callsign[i] = m_idMap[c[i]];
+    }
+
+    callsign[8] = '\0';
+    aircraft->m_callsign = QString(callsign).trimmed();
+}
+
+// Surface position - BDS 0,6 or airbourne position - BDS 0,5
+void ADSBDemodStateEngine::decodePosition(const QByteArray& data, const QDateTime& dateTime, int tc, ADSBAircraftState *aircraft)
+{
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    bool wasOnSurface = aircraft->m_onSurface;
+    aircraft->m_onSurface = (tc >= 5) && (tc <= 8);
+
+    if (wasOnSurface != aircraft->m_onSurface)
+    {
+        // Can't mix CPR values used on surface and those that are airbourne
+        aircraft->m_cprValid[0] = false;
+        aircraft->m_cprValid[1] = false;
+    }
+
+    if (aircraft->m_onSurface)
+    {
+        // There are a few airports that are below 0 MSL
+        // https://en.wikipedia.org/wiki/List_of_lowest_airports
+        // So we set altitude to a negative value here, which should
+        // then get clipped to actual terrain elevation in 3D map
+        aircraft->m_altitude = -200;
+        aircraft->m_altitudeValid = true;
+        aircraft->m_altitudeGNSS = false;
+
+        int movement = ((bytes[4] & 0x7) << 4) | ((bytes[5] >> 4) & 0xf);
+
+        if (movement == 0)
+        {
+            // No information available
+            aircraft->m_groundspeedValid = false;
+        }
+        else if (movement == 1)
+        {
+            // Aircraft stopped
+            aircraft->m_groundspeed = 0;
+            aircraft->m_groundspeedValid = true;
+        }
+        else if (movement <= 123)
+        {
+            float base, step; // In knts
+            int adjust;
+
+            if (movement <= 8)
+            {
+                base = 0.125f;
+                step = 0.125f;
+                adjust = 2;
+            }
+            else if (movement <= 12)
+            {
+                base = 1.0f;
+                step = 0.25f;
+                adjust = 9;
+            }
+            else if (movement <= 38)
+            {
+                base = 2.0f;
+                step = 0.5f;
+                adjust = 13;
+            }
+            else if (movement <= 93)
+            {
+                base = 15.0f;
+                step = 1.0f;
+                adjust = 39;
+            }
+            else if (movement <= 108)
+            {
+                base = 70.0f;
+                step = 2.0f;
+                adjust = 94;
+            }
+            else
+            {
+                base = 100.0f;
+                step = 5.0f;
+                adjust = 109;
+            }
+
+            aircraft->m_groundspeed = std::round(base + (movement - adjust) * step);
+            aircraft->m_groundspeedValid = true;
+        }
+        else if (movement == 124)
+        {
+            aircraft->m_groundspeed = 175; // Actually greater than this
+            aircraft->m_groundspeedValid = true;
+        }
+
+        int groundTrackStatus = (bytes[5] >> 3) & 1;
+        int groundTrackValue = ((bytes[5] & 0x7) << 4) | ((bytes[6] >> 4) & 0xf);
+
+        if (groundTrackStatus)
+        {
+            aircraft->m_heading = groundTrackValue * 360.0/128.0;
+            aircraft->m_headingValid = true;
+        }
+    }
+    else
+    {
+        // Airbourne position (9-18 baro, 20-22 GNSS)
+        int alt = (bytes[5] << 4) | ((bytes[6] >> 4) & 0xf); // Altitude
+        int q = (alt & 0x10) != 0;
+        int n = ((alt >> 1) & 0x7f0) | (alt & 0xf);  // Remove Q-bit
+
+        aircraft->m_altitude = (q == 1) ? n * 25 - 1000 : gillhamToFeet(n);
+        aircraft->m_altitudeValid = alt != 0;
+        aircraft->m_altitudeGNSS = (tc >= 20) && (tc <= 22);
+
+        // Assume runway elevation is at first reported airbourne altitude
+        if (wasOnSurface)
+        {
+            aircraft->m_runwayAltitude = aircraft->m_altitude;
+            aircraft->m_runwayAltitudeValid = true;
+        }
+    }
+
+    int f = (bytes[6] >> 2) & 1; // CPR odd/even frame - should alternate every 0.2s
+    int latCPR = ((bytes[6] & 3) << 15) | (bytes[7] << 7) | ((bytes[8] >> 1) & 0x7f);
+    int lonCPR = ((bytes[8] & 1) << 16) | (bytes[9] << 8) | bytes[10];
+
+    aircraft->m_cprValid[f] = true;
+    aircraft->m_cprLat[f] = latCPR/131072.0f;
+    aircraft->m_cprLong[f] = lonCPR/131072.0f;
+    aircraft->m_cprTime[f] = dateTime;
+
+    // Global decode needs both odd and even frames not too far apart in time (C.2.6.7), otherwise position may be out by ~10deg
+    // This is reduced to 8.5s, as problems have been seen where times are just 9s apart. This may be because
+    // timestamps aren't accurate, as they are generated when frames are decoded on buffered data
+    if (aircraft->m_cprValid[0] && aircraft->m_cprValid[1]
+       && (std::abs(aircraft->m_cprTime[0].toMSecsSinceEpoch() - aircraft->m_cprTime[1].toMSecsSinceEpoch()) <= 8500)
+       && !aircraft->m_onSurface)
+    {
+        const double dLatEven = 360.0/60.0;
+        const double dLatOdd = 360.0/59.0;
+        double latEven, latOdd;
+        double latitude, longitude;
+        int ni, m;
+
+        int j = std::floor(59.0f*aircraft->m_cprLat[0] - 60.0f*aircraft->m_cprLat[1] + 0.5);
+        latEven = dLatEven * (modulus(j, 60) + aircraft->m_cprLat[0]);
+        // Southern hemisphere is in range 270-360, so adjust to -90-0
+        if (latEven >= 270.0f) {
+            latEven -= 360.0f;
+        }
+        latOdd = dLatOdd * (modulus(j, 59) + aircraft->m_cprLat[1]);
+        if (latOdd >= 270.0f) {
+            latOdd -= 360.0f;
+        }
+        latitude = aircraft->m_cprTime[0] >= aircraft->m_cprTime[1] ? latEven : latOdd;
+
+        if ((latitude <= 90.0) && (latitude >= -90.0))
+        {
+            // Both frames must be in same latitude zone
+            int latEvenNL = cprNL(latEven);
+            int latOddNL = cprNL(latOdd);
+
+            if (latEvenNL == latOddNL)
+            {
+                if (!f)
+                {
+                    ni = cprN(latEven, 0);
+                    m = std::floor(aircraft->m_cprLong[0] * (latEvenNL - 1) - aircraft->m_cprLong[1] * latEvenNL + 0.5f);
+                    longitude = (360.0f/ni) * (modulus(m, ni) + aircraft->m_cprLong[0]);
+                }
+                else
+                {
+                    ni = cprN(latOdd, 1);
+                    m = std::floor(aircraft->m_cprLong[0] * (latOddNL - 1) - aircraft->m_cprLong[1] * latOddNL + 0.5f);
+                    longitude = (360.0f/ni) * (modulus(m, ni) + aircraft->m_cprLong[1]);
+                }
+                if (longitude > 180.0f) {
+                    longitude -= 360.0f;
+                }
+
+                aircraft->m_latitude = latitude;
+                aircraft->m_longitude = longitude;
+                aircraft->m_positionValid = true;
+                aircraft->m_positionDateTime = dateTime;
+            }
+        }
+        else
+        {
+            aircraft->m_cprValid[0] = false;
+            aircraft->m_cprValid[1] = false;
+        }
+    }
+    else
+    {
+        // Local decode using a single frame and location of receiver
+        // Only valid if airbourne within 180nm/333km (C.2.6.4) or 45nm for surface
+        const double maxDeg = aircraft->m_onSurface ? 90.0 : 360.0;
+        double dLat = f ? maxDeg/59.0 : maxDeg/60.0;
+        double stationLatitude = m_azEl.getLocationSpherical().m_latitude;
+        double stationLongitude = m_azEl.getLocationSpherical().m_longitude;
+
+        int j = std::floor(stationLatitude/dLat) + std::floor(modulus(stationLatitude, dLat)/dLat - aircraft->m_cprLat[f] + 0.5);
+        double latitude = dLat * (j + aircraft->m_cprLat[f]);
+
+        double dLong;
+        int latNL = cprNL(latitude) - f;
+        dLong = latNL > 0 ? maxDeg / latNL : maxDeg;
+        int m = std::floor(stationLongitude/dLong) + std::floor(modulus(stationLongitude, dLong)/dLong - aircraft->m_cprLong[f] + 0.5);
+        double longitude = dLong * (m + aircraft->m_cprLong[f]);
+
+        // Don't use the full 333km, as there may be some error in station position
+        m_azEl.setTarget(latitude, longitude, Units::feetToMetres(aircraft->m_altitude));
+        m_azEl.calculate();
+
+        if (m_azEl.getDistance() < (aircraft->m_onSurface ? 80000 : 320000))
+        {
+            aircraft->m_latitude = latitude;
+            aircraft->m_longitude = longitude;
+            aircraft->m_positionValid = true;
+            aircraft->m_positionDateTime = dateTime;
+        }
+    }
+}
+
+// Airbourne velocity - BDS 0,9
+void ADSBDemodStateEngine::decodeVelocity(const QByteArray& data, const QDateTime& dateTime, ADSBAircraftState *aircraft)
+{
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    int st = bytes[4] & 0x7; // Subtype
+
+    if ((st == 1) || (st == 2))
+    {
+        // Ground speed
+        int sEW = (bytes[5] >> 2) & 1; // East-west velocity sign
+        int vEW = ((bytes[5] & 0x3) << 8) | bytes[6]; // East-west velocity
+        int sNS = (bytes[7] >> 7) & 1; // North-south velocity sign
+        int vNS = ((bytes[7] & 0x7f) << 3) | ((bytes[8] >> 5) & 0x7); // North-south velocity
+        int vWE = sEW ? -(vEW - 1) : vEW - 1;
+        int vSN = sNS ? -(vNS - 1) : vNS - 1;
+        float h = std::atan2(vWE, vSN) * 360.0/(2.0*M_PI);
+
+        aircraft->m_heading = h < 0.0f ? h + 360.0f : h; // This is actually track, rather than heading
+        aircraft->m_headingValid = true;
+        aircraft->m_headingDateTime = dateTime;
+        aircraft->m_groundspeed = std::round(std::sqrt(vWE*vWE + vSN*vSN));
+        aircraft->m_groundspeedValid = true;
+    }
+    else
+    {
+        // Airspeed (only likely to get this if an aircraft is unable to determine it's position)
+        int sHdg = (bytes[5] >> 2) & 1; // Heading status
+        int hdg = ((bytes[5] & 0x3) << 8) | bytes[6]; // Heading
+
+        if (sHdg)
+        {
+            aircraft->m_heading = hdg/1024.0f*360.0f;
+            aircraft->m_headingValid = true;
+            aircraft->m_headingDateTime = dateTime;
+        }
+
+        int asT = (bytes[7] >> 7) & 1; // Airspeed type
+        int as = ((bytes[7] & 0x7f) << 3) | ((bytes[8] >> 5) & 0x7); // Airspeed
+
+        if (asT == 1)
+        {
+            aircraft->m_trueAirspeed = as;
+            aircraft->m_trueAirspeedValid = true;
+        }
+        else
+        {
+            aircraft->m_indicatedAirspeed = as;
+            aircraft->m_indicatedAirspeedValid = true;
+        }
+    }
+
+    int sVR = (bytes[8] >> 3) & 1; // Vertical rate sign
+    int vr = ((bytes[8] & 0x7) << 6) | ((bytes[9] >> 2) & 0x3f); // Vertical rate
+    aircraft->m_verticalRate = (vr-1)*64*(sVR?-1:1);
+    aircraft->m_verticalRateValid = true;
+}
+
+// Aircraft status - BDS 6,1
+void ADSBDemodStateEngine::decodeStatus(const QByteArray& data, ADSBAircraftState *aircraft)
+{
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    int st = bytes[4] & 0x7; // Subtype
+
+    if (st == 1)
+    {
+        int es = (bytes[5] >> 5) & 0x7; // Emergency state
+        int modeA = ((bytes[5] << 8) & 0x1f00) | bytes[6]; // Mode-A code (squawk)
+        aircraft->m_status = m_emergencyStatus[es];
+        aircraft->m_squawk = squawkDecode(modeA);
+        aircraft->m_squawkIdent = (modeA & 0x40) != 0;
+        aircraft->m_squawkValid = true;
+    }
+}
+
+// Target state and status - BDS 6,2
+void ADSBDemodStateEngine::decodeTargetState(const QByteArray& data, ADSBAircraftState *aircraft)
+{
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    int selAltitudeFix = ((bytes[5] & 0x7f) << 4) | ((bytes[6] >> 4) & 0xf);
+
+    if (selAltitudeFix != 0)
+    {
+        aircraft->m_selAltitude = (selAltitudeFix - 1) * 32; // Ft
+        aircraft->m_selAltitudeValid = true;
+    }
+
+    int baroFix = ((bytes[6] & 0xf) << 5) | ((bytes[7] >> 3) & 0x1f);
+
+    if (baroFix != 0)
+    {
+        aircraft->m_baro = std::round((baroFix - 1) * 0.8f + 800.0f); // mb
+        aircraft->m_baroValid = true;
+    }
+
+    bool selHeadingValid = (bytes[7] >> 2) & 0x1;
+
+    if (selHeadingValid)
+    {
+        int selHeadingFix = ((bytes[7] & 0x3) << 7) | ((bytes[8] >> 1) & 0x7f);
+        selHeadingFix = (selHeadingFix << 23) >> 23;
+        float selHeading = selHeadingFix * 180.0f / 256.0f;
+        aircraft->m_selHeading = std::round(selHeading < 0.0f ? selHeading + 360.0f : selHeading);
+        aircraft->m_selHeadingValid = true;
+    }
+
+    bool modesValid = (bytes[9] >> 1) & 0x1;
+
+    if (modesValid)
+    {
+        aircraft->m_autopilot = bytes[9] & 0x1;
+        aircraft->m_vnavMode = (bytes[10] >> 7) & 0x1;
+        aircraft->m_altHoldMode = (bytes[10] >> 6) & 0x1;
+        aircraft->m_approachMode = (bytes[10] >> 4) & 0x1;
+        aircraft->m_lnavMode = (bytes[10] >> 2) & 0x1;
+        aircraft->m_modesValid = true;
+    }
+}
+
+// Altitude or squawk from Mode-S surveillance replies
+void ADSBDemodStateEngine::decodeModeS(const QByteArray& data, int df, ADSBAircraftState *aircraft)
+{
+    const unsigned char *bytes = (const unsigned char *) data.constData();
+    bool wasOnSurface = aircraft->m_onSurface;
+    int flightStatus = bytes[0] & 0x7;
+
+    bool takenOff = false;
+
+    if ((flightStatus == 0) || (flightStatus == 2))
+    {
+        takenOff = wasOnSurface;
+        aircraft->m_onSurface = false;
+    }
+    else if ((flightStatus == 1) || (flightStatus == 3))
+    {
+        aircraft->m_onSurface = true;
+    }
+
+    if (wasOnSurface != aircraft->m_onSurface)
+    {
+        // Can't mix CPR values used on surface and those that are airbourne
+        aircraft->m_cprValid[0] = false;
+        aircraft->m_cprValid[1] = false;
+    }
+
+    int code = ((bytes[2] & 0x1f) << 8) | bytes[3];
+
+    if ((df == 4) || (df == 20))
+    {
+        if (code & 0x40) // M bit indicates metres
+        {
+            int altitudeMetres = ((code & 0x1f80) >> 1) | (code & 0x3f);
+            aircraft->m_altitude = Units::metresToFeet(altitudeMetres);
+        }
+        else
+        {
+            // Remove M and Q bits
+            int altitudeFix = ((code & 0x1f80) >> 2) | ((code & 0x20) >> 1) | (code & 0xf);
+            aircraft->m_altitude = (code & 0x10) ? altitudeFix * 25 - 1000 : gillhamToFeet(altitudeFix);
+        }
+
+        aircraft->m_altitudeValid = true;
+        aircraft->m_altitudeGNSS = false;
+
+        // Assume runway elevation is at first reported airbourne altitude
+        if (takenOff)
+        {
+            aircraft->m_runwayAltitude = aircraft->m_altitude;
+            aircraft->m_runwayAltitudeValid = true;
+        }
+    }
+    else
+    {
+        aircraft->m_squawk = squawkDecode(code);
+        aircraft->m_squawkIdent = (code & 0x40) != 0;
+        aircraft->m_squawkValid = true;
+    }
+}
+
+// Longitude zone (returns value in range [1,59]
+int ADSBDemodStateEngine::cprNL(double lat)
+{
+    if (lat == 0.0)
+    {
+        return 59;
+    }
+    else if ((lat == 87.0) || (lat == -87.0))
+    {
+        return 2;
+    }
+    else if ((lat > 87.0) || (lat < -87.0))
+    {
+        return 1;
+    }
+    else
+    {
+        double nz = 15.0;
+        double n = 1 - std::cos(M_PI / (2.0 * nz));
+        double d = std::cos(std::fabs(lat) * M_PI/180.0);
+        return std::floor((M_PI * 2.0) / std::acos(1.0 - (n/(d*d))));
+    }
+}
+
+int ADSBDemodStateEngine::cprN(double lat, int odd)
+{
+    int nl = cprNL(lat) - odd;
+
+    if (nl > 1) {
+        return nl;
+    } else {
+        return 1;
+    }
+}
+
+// Can't use std::fmod, as that works differently for negative numbers (See C.2.6.2)
+Real ADSBDemodStateEngine::modulus(double x, double y)
+{
+    return x - y * std::floor(x/y);
+}
+
+int ADSBDemodStateEngine::squawkDecode(int modeA)
+{
+    int a, b, c, d;
+    c = ((modeA >> 12) & 1) | ((modeA >> (10-1)) & 0x2) | ((modeA >> (8-2)) & 0x4);
+    a = ((modeA >> 11) & 1) | ((modeA >> (9-1)) & 0x2) | ((modeA >> (7-2)) & 0x4);
+    b = ((modeA >> 5) & 1) | ((modeA >> (3-1)) & 0x2) | ((modeA << (1)) & 0x4);
+    d = ((modeA >> 4) & 1) | ((modeA >> (2-1)) & 0x2) | ((modeA << (2)) & 0x4);
+    return a*1000 + b*100 + c*10 + d;
+}
+
+// https://en.wikipedia.org/wiki/Gillham_code
+int ADSBDemodStateEngine::gillhamToFeet(int n)
+{
+    int c1 = (n >> 10) & 1;
+    int a1 = (n >> 9) & 1;
+    int c2 = (n >> 8) & 1;
+    int a2 = (n >> 7) & 1;
+    int c4 = (n >> 6) & 1;
+    int a4 = (n >> 5) & 1;
+    int b1 = (n >> 4) & 1;
+    int b2 = (n >> 3) & 1;
+    int d2 = (n >> 2) & 1;
+    int b4 = (n >> 1) & 1;
+    int d4 = n & 1;
+
+    int n500 = grayToBinary((d2 << 7) | (d4 << 6) | (a1 << 5) | (a2 << 4) | (a4 << 3) | (b1 << 2) | (b2 << 1) | b4, 4);
+    int n100 = grayToBinary((c1 << 2) | (c2 << 1) | c4, 3) - 1;
+
+    if (n100 == 6) {
+        n100 = 4;
+    }
+    if (n500 %2 != 0) {
+        n100 = 4 - n100;
+    }
+
+    return -1200 + n500*500 + n100*100;
+}
+
+int ADSBDemodStateEngine::grayToBinary(int gray, int bits)
+{
+    int binary = 0;
+    for (int i = bits - 1; i >= 0; i--) {
+        binary = binary | ((((1 << (i+1)) & binary) >> 1) ^ ((1 << i) & gray));
+    }
+    return binary;
+}
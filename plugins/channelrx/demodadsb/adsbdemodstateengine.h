@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_ADSBDEMODSTATEENGINE_H
+#define INCLUDE_ADSBDEMODSTATEENGINE_H
+
+#include <cmath>
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "util/azel.h"
+#include "util/movingaverage.h"
+
+// State of an aircraft decoded from ADS-B and Mode-S frames, independent of any GUI
+struct ADSBAircraftState
+{
+    int m_icao;                 // 24-bit ICAO aircraft address
+    QString m_callsign;         // Flight callsign
+    QString m_emitterCategory;  // Aircraft type
+    QString m_status;           // Aircraft status
+    int m_squawk;               // Mode-A code
+    bool m_squawkIdent;         // IDENT set with the Mode-A code
+    float m_latitude;           // Latitude in decimal degrees
+    float m_longitude;          // Longitude in decimal degrees
+    int m_altitude;             // Altitude in feet
+    bool m_altitudeGNSS;        // Altitude is GNSS HAE rather than barometric
+    bool m_onSurface;           // Indicates if on surface or airbourne
+    float m_heading;            // Heading or track in degrees
+    int m_groundspeed;          // In knots
+    int m_verticalRate;         // Vertical climb rate in ft/min
+    int m_trueAirspeed;         // In knots
+    int m_indicatedAirspeed;    // In knots
+    int m_selAltitude;          // Selected altitude in MCP/FCU or FMS in feet
+    int m_selHeading;           // Selected heading in MCP/FCU in degrees
+    int m_baro;                 // Aircraft baro setting in mb
+    bool m_autopilot;           // Autopilot engaged
+    bool m_vnavMode;            // Vertical and lateral modes
+    bool m_altHoldMode;
+    bool m_approachMode;
+    bool m_lnavMode;
+    float m_runwayAltitude;     // First airbourne altitude after being on the surface, in feet
+    int m_frameCount;           // Number of frames for this aircraft
+    int m_tisBFrameCount;       // Number of TIS-B frames for this aircraft
+    float m_correlation;        // Average preamble correlation
+    float m_minCorrelation;
+    float m_maxCorrelation;
+    float m_rssi;               // Average correlation of the ones
+    QDateTime m_time;           // When last updated
+    QDateTime m_positionDateTime;
+    QDateTime m_headingDateTime;
+
+    bool m_squawkValid;         // Indicates if we have valid data for the above fields
+    bool m_positionValid;
+    bool m_altitudeValid;
+    bool m_headingValid;
+    bool m_groundspeedValid;
+    bool m_verticalRateValid;
+    bool m_trueAirspeedValid;
+    bool m_indicatedAirspeedValid;
+    bool m_selAltitudeValid;
+    bool m_selHeadingValid;
+    bool m_baroValid;
+    bool m_modesValid;
+    bool m_runwayAltitudeValid;
+
+    MovingAverageUtil<float, double, 100> m_correlationAvg;
+    MovingAverageUtil<float, double, 10> m_rssiAvg;
+
+    // State for calculating position using two CPR frames
+    bool m_cprValid[2];
+    Real m_cprLat[2];
+    Real m_cprLong[2];
+    QDateTime m_cprTime[2];
+
+    ADSBAircraftState() :
+        m_icao(0),
+        m_squawk(0),
+        m_squawkIdent(false),
+        m_latitude(0.0f),
+        m_longitude(0.0f),
+        m_altitude(0),
+        m_altitudeGNSS(false),
+        m_onSurface(false),
+        m_heading(0.0f),
+        m_groundspeed(0),
+        m_verticalRate(0),
+        m_trueAirspeed(0),
+        m_indicatedAirspeed(0),
+        m_selAltitude(0),
+        m_selHeading(0),
+        m_baro(0),
+        m_autopilot(false),
+        m_vnavMode(false),
+        m_altHoldMode(false),
+        m_approachMode(false),
+        m_lnavMode(false),
+        m_runwayAltitude(0.0f),
+        m_frameCount(0),
+        m_tisBFrameCount(0),
+        m_correlation(0.0f),
+        m_minCorrelation(INFINITY),
+        m_maxCorrelation(-INFINITY),
+        m_rssi(0.0f),
+        m_squawkValid(false),
+        m_positionValid(false),
+        m_altitudeValid(false),
+        m_headingValid(false),
+        m_groundspeedValid(false),
+        m_verticalRateValid(false),
+        m_trueAirspeedValid(false),
+        m_indicatedAirspeedValid(false),
+        m_selAltitudeValid(false),
+        m_selHeadingValid(false),
+        m_baroValid(false),
+        m_modesValid(false),
+        m_runwayAltitudeValid(false)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            m_cprValid[i] = false;
+            m_cprLat[i] = 0.0f;
+            m_cprLong[i] = 0.0f;
+        }
+    }
+};
+
+// Decodes ADS-B and Mode-S frames into a table of aircraft hashed on ICAO address
+// This has no GUI dependencies so that aircraft are tracked in sdrangelsrv too
+class ADSBDemodStateEngine
+{
+public:
+    ADSBDemodStateEngine();
+    ~ADSBDemodStateEngine();
+
+    void setStationPosition(float latitude, float longitude, float altitude);
+    // Returns the aircraft updated by the frame or nullptr. crc is as calculated by the demodulator
+    const ADSBAircraftState *handleFrame(const QByteArray& data, const QDateTime& dateTime, float correlation, float correlationOnes, unsigned crc);
+    // Remove aircraft not heard for timeoutSecs. Returns the number of aircraft removed
+    int removeStale(const QDateTime& now, int timeoutSecs);
+    void clear();
+
+    int getNbAircraft() const { return m_aircraft.size(); }
+    const ADSBAircraftState *getAircraft(int icao) const { return m_aircraft.value(icao, nullptr); }
+    const QHash<int, ADSBAircraftState*>& getAllAircraft() const { return m_aircraft; }
+    float getCorrelationAverage() const { return m_correlationAvg.instantAverage(); } // Over all aircraft
+
+    static int cprNL(double lat);
+    static int cprN(double lat, int odd);
+    static Real modulus(double x, double y);
+    static int squawkDecode(int modeA);
+    static int gillhamToFeet(int n);
+    static int grayToBinary(int gray, int bits);
+
+    static const char m_idMap[];
+    static const QString m_categorySetA[];
+    static const QString m_categorySetB[];
+    static const QString m_categorySetC[];
+    static const QString m_emergencyStatus[];
+
+private:
+    QHash<int, ADSBAircraftState*> m_aircraft; // Hashed on ICAO
+    AzEl m_azEl;                               // Station position for local CPR decode
+    MovingAverageUtil<float, double, 10> m_correlationAvg;
+
+    ADSBAircraftState *getOrCreateAircraft(int icao);
+    void decodeIdentification(const QByteArray& data, int tc, ADSBAircraftState *aircraft);
+    void decodePosition(const QByteArray& data, const QDateTime& dateTime, int tc, ADSBAircraftState *aircraft);
+    void decodeVelocity(const QByteArray& data, const QDateTime& dateTime, ADSBAircraftState *aircraft);
+    void decodeStatus(const QByteArray& data, ADSBAircraftState *aircraft);
+    void decodeTargetState(const QByteArray& data, ADSBAircraftState *aircraft);
+    void decodeModeS(const QByteArray& data, int df, ADSBAircraftState *aircraft);
+};
+
+#endif // INCLUDE_ADSBDEMODSTATEENGINE_H
@@ -29,6 +29,9 @@ struct ADSBDemodStats {
     qint64 m_typeFails;         //!< How many frames we've demoded with unknown type (DF) so we can't check CRC
     double m_demodTime;         //!< How long we've spent in run()
     double m_feedTime;          //!< How long we've spent in feed()
+    qint64 m_samples;           //!< Number of sample positions correlated
+    double m_demodRate;         //!< Samples per second run() can process
+    double m_headroom;          //!< Ratio of m_demodRate to the channel sample rate. Below 1 samples are dropped
 
     ADSBDemodStats() :
     m_correlatorMatches(0),
@@ -37,7 +40,10 @@ struct ADSBDemodStats {
     m_crcFails(0),
     m_typeFails(0),
     m_demodTime(0.0),
-    m_feedTime(0.0)
+    m_feedTime(0.0),
+    m_samples(0),
+    m_demodRate(0.0),
+    m_headroom(0.0)
     {
     }
 
@@ -23,6 +23,9 @@
 #include <QEventLoop>
 #include <QTimer>
 
+#include "settings/mainsettings.h"
+#include "maincore.h"
+
 #include "adsbdemodworker.h"
 #include "adsbdemodreport.h"
 
@@ -80,9 +83,13 @@ void ADSBBeastServer::discardClient()
 }
 
 ADSBDemodWorker::ADSBDemodWorker() :
-    m_running(false)
+    m_running(false),
+    m_messageQueueToGUI(nullptr)
 {
     connect(&m_heartbeatTimer, SIGNAL(timeout()), this, SLOT(heartbeat()));
+    connect(&m_removeTimer, &QTimer::timeout, this, &ADSBDemodWorker::removeStaleAircraft);
+    connect(&m_guiUpdateTimer, &QTimer::timeout, this, &ADSBDemodWorker::sendAircraftStates);
+    connect(&MainCore::instance()->getSettings(), &MainSettings::preferenceChanged, this, &ADSBDemodWorker::preferenceChanged);
     connect(&m_socket, SIGNAL(readyRead()),this, SLOT(recv()));
     connect(&m_socket, SIGNAL(connected()), this, SLOT(connected()));
     connect(&m_socket, SIGNAL(disconnected()), this, SLOT(disconnected()));
@@ -93,6 +100,9 @@ ADSBDemodWorker::ADSBDemodWorker() :
 #endif
     m_startTime = QDateTime::currentDateTime().toMSecsSinceEpoch();
     m_heartbeatTimer.start(60*1000);
+    m_removeTimer.start(10*1000);
+    m_guiUpdateTimer.start(200); // Aircraft updates are batched to the GUI
+    preferenceChanged(Preferences::Latitude);
 }
 
 ADSBDemodWorker::~ADSBDemodWorker()
@@ -104,6 +114,14 @@ void ADSBDemodWorker::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
+    m_stateEngine.clear();
+    m_updatedAircraft.clear();
+}
+
+void ADSBDemodWorker::setMessageQueueToGUI(MessageQueue *messageQueue)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_messageQueueToGUI = messageQueue;
 }
 
 bool ADSBDemodWorker::startWork()
@@ -157,6 +175,19 @@ bool ADSBDemodWorker::handleMessage(const Message& message)
     {
         ADSBDemodReport::MsgReportADSB& report = (ADSBDemodReport::MsgReportADSB&) message;
         handleADSB(report.getData(), report.getDateTime(), report.getPreambleCorrelation());
+        QMutexLocker mutexLocker(&m_mutex);
+        const ADSBAircraftState *aircraft = m_stateEngine.handleFrame(
+            report.getData(),
+            report.getDateTime(),
+            report.getPreambleCorrelation(),
+            report.getCorrelationOnes(),
+            report.getCRC()
+        );
+
+        if (aircraft) {
+            m_updatedAircraft.insert(aircraft->m_icao);
+        }
+
         return true;
     }
     else
@@ -365,3 +396,62 @@ void ADSBDemodWorker::heartbeat()
         }
     }
 }
+
+// Remove aircraft that haven't been heard of for a while as probably out of range
+void ADSBDemodWorker::removeStaleAircraft()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_stateEngine.removeStale(QDateTime::currentDateTime(), m_settings.m_removeTimeout);
+}
+
+// Send the state of the aircraft updated since the last call to the GUI
+void ADSBDemodWorker::sendAircraftStates()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_messageQueueToGUI || m_updatedAircraft.isEmpty()) {
+        return;
+    }
+
+    QList<ADSBAircraftState> states;
+    states.reserve(m_updatedAircraft.size());
+
+    for (int icao : m_updatedAircraft)
+    {
+        const ADSBAircraftState *aircraft = m_stateEngine.getAircraft(icao);
+
+        if (aircraft) { // may have been removed since
+            states.append(*aircraft);
+        }
+    }
+
+    m_updatedAircraft.clear();
+    m_messageQueueToGUI->push(ADSBDemodReport::MsgAircraftStates::create(states, m_stateEngine.getCorrelationAverage()));
+}
+
+void ADSBDemodWorker::preferenceChanged(int elementType)
+{
+    Preferences::ElementType pref = (Preferences::ElementType) elementType;
+
+    if ((pref == Preferences::Latitude) || (pref == Preferences::Longitude) || (pref == Preferences::Altitude))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_stateEngine.setStationPosition(
+            MainCore::instance()->getSettings().getLatitude(),
+            MainCore::instance()->getSettings().getLongitude(),
+            MainCore::instance()->getSettings().getAltitude()
+        );
+    }
+}
+
+void ADSBDemodWorker::getAircraftStates(QList<ADSBAircraftState>& states)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    const QHash<int, ADSBAircraftState*>& aircraft = m_stateEngine.getAllAircraft();
+    states.clear();
+    states.reserve(aircraft.size());
+
+    for (const auto state : aircraft) {
+        states.append(*state);
+    }
+}
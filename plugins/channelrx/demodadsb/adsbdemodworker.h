@@ -25,11 +25,13 @@
 #include <QTcpSocket>
 #include <QFile>
 #include <QTextStream>
+#include <QSet>
 
 #include "util/message.h"
 #include "util/messagequeue.h"
 
 #include "adsbdemodsettings.h"
+#include "adsbdemodstateengine.h"
 
 // Beast binary server for sending ADS-B data to OpenSky Network (and others)
 class ADSBBeastServer : public QTcpServer
@@ -86,6 +88,8 @@ public:
     void stopWork();
     bool isRunning() const { return m_running; }
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+    void setMessageQueueToGUI(MessageQueue *messageQueue);
+    void getAircraftStates(QList<ADSBAircraftState>& states); //!< Copy of the aircraft table for the API
 
 private:
 
@@ -99,6 +103,11 @@ private:
     QTextStream m_logStream;
     qint64 m_startTime;
     ADSBBeastServer m_beastServer;
+    ADSBDemodStateEngine m_stateEngine;
+    QTimer m_removeTimer;
+    MessageQueue *m_messageQueueToGUI;
+    QSet<int> m_updatedAircraft;        //!< ICAO of aircraft updated since the last report to the GUI
+    QTimer m_guiUpdateTimer;
 
     bool handleMessage(const Message& cmd);
     void applySettings(const ADSBDemodSettings& settings, bool force = false);
@@ -113,6 +122,9 @@ private slots:
     void errorOccurred(QAbstractSocket::SocketError socketError);
     void recv();
     void heartbeat();
+    void removeStaleAircraft();
+    void sendAircraftStates();
+    void preferenceChanged(int elementType);
 };
 
 #endif // INCLUDE_ADSBDEMODWORKER_H
@@ -42,6 +42,7 @@
 
 MESSAGE_CLASS_DEFINITION(AISDemod::MsgConfigureAISDemod, Message)
 MESSAGE_CLASS_DEFINITION(AISDemod::MsgMessage, Message)
+MESSAGE_POOL_DEFINITION(AISDemod::MsgMessage)
 
 const char * const AISDemod::m_channelIdURI = "sdrangel.channel.aisdemod";
 const char * const AISDemod::m_channelId = "AISDemod";
@@ -144,6 +145,11 @@ void AISDemod::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *AISDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool AISDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureAISDemod::match(cmd))
@@ -31,6 +31,7 @@
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelapi.h"
 #include "util/message.h"
+#include "util/messagepool.h"
 
 #include "aisdemodbaseband.h"
 #include "aisdemodsettings.h"
@@ -68,6 +69,7 @@ public:
 
     class MsgMessage : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_POOL_DECLARATION
 
     public:
         QByteArray getMessage() const { return m_message; }
@@ -123,6 +125,8 @@ public:
         return 0;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -52,18 +52,23 @@ AMDemod::AMDemod(DeviceAPI *deviceAPI) :
         ChannelAPI(m_channelIdURI, ChannelAPI::StreamSingleSink),
         m_deviceAPI(deviceAPI),
         m_basebandSampleRate(0),
+        m_sharedFifo(false),
         m_lastTs(0)
 {
     setObjectName(m_channelId);
 
     m_basebandSink = new AMDemodBaseband();
     m_basebandSink->setChannel(this);
-    m_basebandSink->moveToThread(&m_thread);
+
+    if (!DSPEngine::instance()->getDSPScheduler()) { // else baseband is run by the DSP scheduler workers
+        m_basebandSink->moveToThread(&m_thread);
+    }
 
 	applySettings(m_settings, true);
 
     m_deviceAPI->addChannelSink(this);
     m_deviceAPI->addChannelSinkAPI(this);
+    updateSharedFifo();
 
     m_networkManager = new QNetworkAccessManager();
     QObject::connect(
@@ -85,6 +90,12 @@ AMDemod::AMDemod(DeviceAPI *deviceAPI) :
         this,
         &AMDemod::handleIndexInDeviceSetChanged
     );
+    QObject::connect(
+        m_deviceAPI,
+        &DeviceAPI::sharedBasebandFifoChanged,
+        this,
+        &AMDemod::updateSharedFifo
+    );
 }
 
 AMDemod::~AMDemod()
@@ -120,9 +131,28 @@ void AMDemod::setDeviceAPI(DeviceAPI *deviceAPI)
     {
         m_deviceAPI->removeChannelSinkAPI(this);
         m_deviceAPI->removeChannelSink(this);
+        QObject::disconnect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &AMDemod::updateSharedFifo
+        );
         m_deviceAPI = deviceAPI;
         m_deviceAPI->addChannelSink(this);
         m_deviceAPI->addChannelSinkAPI(this);
+        QObject::connect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &AMDemod::updateSharedFifo
+        );
+        m_sharedFifo = false;
+
+        if (m_basebandSink->isRunning()) {
+            m_basebandSink->setSharedFifo(nullptr);
+        }
+
+        updateSharedFifo();
     }
 }
 
@@ -143,7 +173,14 @@ void AMDemod::start()
 
     m_basebandSink->reset();
     m_basebandSink->startWork();
-    m_thread.start();
+
+    if (m_sharedFifo) {
+        m_basebandSink->setSharedFifo(m_deviceAPI->getBasebandFifo());
+    }
+
+    if (!DSPEngine::instance()->getDSPScheduler()) {
+        m_thread.start();
+    }
 
     DSPSignalNotification *dspMsg = new DSPSignalNotification(m_basebandSampleRate, m_centerFrequency);
     m_basebandSink->getInputMessageQueue()->push(dspMsg);
@@ -160,6 +197,39 @@ void AMDemod::stop()
 	m_thread.wait();
 }
 
+bool AMDemod::getInputFifoStats(InputFifoStats& stats)
+{
+    if (m_basebandSink->isRunning() && m_sharedFifo) {
+        return m_basebandSink->getSharedFifoStats(stats.m_size, stats.m_fill, stats.m_overflowCount, stats.m_droppedSamples, stats.m_readPosition);
+    }
+
+    return ChannelAPI::getInputFifoStats(stats);
+}
+
+SampleSinkFifo *AMDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
+void AMDemod::updateSharedFifo()
+{
+    // Read the baseband in place from the device shared FIFO when enabled
+    SampleSinkMultiReaderFifo *basebandFifo = m_deviceAPI->getBasebandFifo();
+    bool sharedFifo = basebandFifo != nullptr;
+
+    if (sharedFifo == m_sharedFifo) {
+        return;
+    }
+
+    if (m_basebandSink->isRunning() && !m_basebandSink->setSharedFifo(sharedFifo ? basebandFifo : nullptr)) {
+        return; // keep being fed by the device engine
+    }
+
+    qDebug("AMDemod::updateSharedFifo: %s", sharedFifo ? "shared" : "own");
+    m_sharedFifo = sharedFifo;
+    m_deviceAPI->setChannelSinkSharedFifo(this, sharedFifo);
+}
+
 bool AMDemod::handleMessage(const Message& cmd)
 {
 	if (MsgConfigureAMDemod::match(cmd))
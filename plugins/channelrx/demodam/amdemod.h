@@ -93,6 +93,9 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+    virtual bool getInputFifoStats(InputFifoStats& stats);
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -142,6 +145,7 @@ private:
     AMDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
     qint64 m_centerFrequency;
+    bool m_sharedFifo;        //!< baseband is read from the device shared FIFO
 
     static const int m_udpBlockSize;
 
@@ -151,6 +155,7 @@ private:
 
 	virtual bool handleMessage(const Message& cmd);
     void applySettings(const AMDemodSettings& settings, bool force = false);
+    void updateSharedFifo();
     void sendSampleRateToDemodAnalyzer();
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const AMDemodSettings& settings, bool force);
@@ -26,6 +26,8 @@
 MESSAGE_CLASS_DEFINITION(AMDemodBaseband::MsgConfigureAMDemodBaseband, Message)
 
 AMDemodBaseband::AMDemodBaseband() :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReader(-1),
     m_running(false)
 {
     qDebug("AMDemodBaseband::AMDemodBaseband");
@@ -33,6 +35,12 @@ AMDemodBaseband::AMDemodBaseband() :
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
 
+    DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+    if (dspScheduler) { // messages are handled by the DSP scheduler workers instead of this object thread
+        m_messageTask = dspScheduler->createTask([this]() { handleInputMessages(); });
+    }
+
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
     m_channelSampleRate = 0;
@@ -40,6 +48,11 @@ AMDemodBaseband::AMDemodBaseband() :
 
 AMDemodBaseband::~AMDemodBaseband()
 {
+    if (m_messageTask) { // not under m_mutex as the handler takes it
+        m_messageTask->disable();
+    }
+
+    setSharedFifo(nullptr);
     m_inputMessageQueue.clear();
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
     delete m_channelizer;
@@ -56,21 +69,58 @@ void AMDemodBaseband::reset()
 void AMDemodBaseband::startWork()
 {
     QMutexLocker mutexLocker(&m_mutex);
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        this,
-        &AMDemodBaseband::handleData,
-        Qt::QueuedConnection
-    );
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+    if (dspScheduler) // data is handled by the DSP scheduler workers instead of this object thread
+    {
+        m_dataTask = dspScheduler->createTask([this]() { handleData(); });
+        m_sampleFifo.setTask(m_dataTask);
+    }
+    else
+    {
+        QObject::connect(
+            &m_sampleFifo,
+            &SampleSinkFifo::dataReady,
+            this,
+            &AMDemodBaseband::handleData,
+            Qt::QueuedConnection
+        );
+    }
+
+    if (m_messageTask) {
+        connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(scheduleInputMessages()), Qt::DirectConnection);
+    } else {
+        connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    }
+
     m_running = true;
 }
 
 void AMDemodBaseband::stopWork()
 {
+    if (m_dataTask) // before taking m_mutex as a running handleData() holds it
+    {
+        m_sampleFifo.setTask(nullptr);
+        m_dataTask->disable();
+        m_dataTask.reset();
+    }
+
+    setSharedFifo(nullptr); // shared FIFO data is not handled past this point
+
+    if (m_sharedDataTask)
+    {
+        m_sharedDataTask->disable();
+        m_sharedDataTask.reset();
+    }
+
     QMutexLocker mutexLocker(&m_mutex);
-    disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+
+    if (m_messageTask) {
+        disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(scheduleInputMessages()));
+    } else {
+        disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    }
+
     QObject::disconnect(
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
@@ -117,6 +167,38 @@ void AMDemodBaseband::handleData()
     }
 }
 
+void AMDemodBaseband::handleSharedFifoData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReader) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+        SampleVector::const_iterator part1begin;
+        SampleVector::const_iterator part1end;
+        SampleVector::const_iterator part2begin;
+        SampleVector::const_iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReader, m_sharedFifo->fill(m_sharedFifoReader), &part1begin, &part1end, &part2begin, &part2end);
+
+        // data is read in place from the device baseband. The writer does not overwrite it until committed
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+        if (part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+        if (m_sharedFifo->readCommit(m_sharedFifoReader, (unsigned int) count) == 0) {
+            break; // nothing was read
+        }
+    }
+}
+
 void AMDemodBaseband::handleInputMessages()
 {
 	Message* message;
@@ -129,6 +211,11 @@ void AMDemodBaseband::handleInputMessages()
 	}
 }
 
+void AMDemodBaseband::scheduleInputMessages()
+{
+    m_messageTask->schedule();
+}
+
 bool AMDemodBaseband::handleMessage(const Message& cmd)
 {
     if (MsgConfigureAMDemodBaseband::match(cmd))
@@ -211,3 +298,77 @@ void AMDemodBaseband::setBasebandSampleRate(int sampleRate)
     m_channelizer->setBasebandSampleRate(sampleRate);
     m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
 }
+
+bool AMDemodBaseband::getSharedFifoStats(unsigned int& size, unsigned int& fill, quint64& overflowCount, quint64& droppedSamples, quint64& readPosition)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return false;
+    }
+
+    size = m_sharedFifo->size();
+    fill = m_sharedFifo->fill(m_sharedFifoReader);
+    overflowCount = m_sharedFifo->getOverflowCount(m_sharedFifoReader);
+    droppedSamples = m_sharedFifo->getDroppedCount(m_sharedFifoReader);
+    readPosition = m_sharedFifo->getReadPosition(m_sharedFifoReader);
+
+    return true;
+}
+
+bool AMDemodBaseband::setSharedFifo(SampleSinkMultiReaderFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (sharedFifo == m_sharedFifo) {
+        return true;
+    }
+
+    if (m_sharedFifo)
+    {
+        QObject::disconnect(
+            m_sharedFifo,
+            &SampleSinkMultiReaderFifo::dataReady,
+            this,
+            &AMDemodBaseband::handleSharedFifoData
+        );
+        m_sharedFifo->removeReader(m_sharedFifoReader);
+        m_sharedFifoReader = -1;
+    }
+
+    m_sharedFifo = sharedFifo;
+
+    if (m_sharedFifo)
+    {
+        m_sharedFifoReader = m_sharedFifo->addReader();
+
+        if (m_sharedFifoReader < 0)
+        {
+            m_sharedFifo = nullptr; // no more readers allowed: stay on own FIFO
+            return false;
+        }
+
+        DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+        if (dspScheduler)
+        {
+            if (!m_sharedDataTask) {
+                m_sharedDataTask = dspScheduler->createTask([this]() { handleSharedFifoData(); });
+            }
+
+            m_sharedFifo->setReaderTask(m_sharedFifoReader, m_sharedDataTask);
+        }
+        else
+        {
+            QObject::connect(
+                m_sharedFifo,
+                &SampleSinkMultiReaderFifo::dataReady,
+                this,
+                &AMDemodBaseband::handleSharedFifoData,
+                Qt::QueuedConnection
+            );
+        }
+    }
+
+    return true;
+}
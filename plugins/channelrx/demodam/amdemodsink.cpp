@@ -71,33 +71,32 @@ AMDemodSink::~AMDemodSink()
 
 void AMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	Complex ci;
+    unsigned int nbSamples = end - begin;
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
-	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+    if (m_mixBuffer.size() < nbSamples) {
+        m_mixBuffer.resize(nbSamples);
+    }
 
-		if (m_interpolatorDistance < 1.0f) // interpolate
-		{
-		    while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
-		}
-		else // decimate
-		{
-	        if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
-	        {
-	            processOneSample(ci);
-	            m_interpolatorDistanceRemain += m_interpolatorDistance;
-	        }
-		}
-	}
+    m_nco.mix(begin, end, m_mixBuffer.data());
+    m_channelBuffer.clear();
+
+    if (m_interpolatorDistance < 1.0f) { // interpolate
+        m_interpolator.interpolate(&m_interpolatorDistanceRemain, m_interpolatorDistance, m_mixBuffer.data(), nbSamples, m_channelBuffer);
+    } else { // decimate
+        m_interpolator.decimate(&m_interpolatorDistanceRemain, m_interpolatorDistance, m_mixBuffer.data(), nbSamples, m_channelBuffer);
+    }
+
+    feedBlock(m_channelBuffer.begin(), m_channelBuffer.end());
+}
+
+void AMDemodSink::feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end)
+{
+    for (ComplexVector::const_iterator it = begin; it != end; ++it) {
+        processOneSample(*it);
+    }
 }
 
-void AMDemodSink::processOneSample(Complex &ci)
+void AMDemodSink::processOneSample(const Complex &ci)
 {
     Real re = ci.real() / SDR_RX_SCALEF;
     Real im = ci.imag() / SDR_RX_SCALEF;
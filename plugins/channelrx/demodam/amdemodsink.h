@@ -41,6 +41,7 @@ public:
 	~AMDemodSink();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	virtual void feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end);
 
 	void applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force = false);
     void applySettings(const AMDemodSettings& settings, bool force = false);
@@ -99,6 +100,8 @@ private:
 	Interpolator m_interpolator;
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
+	ComplexVector m_mixBuffer;     //!< baseband shifted to zero frequency
+	ComplexVector m_channelBuffer; //!< samples at channel processing rate
 
 	Real m_squelchLevel;
 	int m_squelchCount;
@@ -128,7 +131,7 @@ private:
     QVector<qint16> m_demodBuffer;
     int m_demodBufferFill;
 
-    void processOneSample(Complex &ci);
+    void processOneSample(const Complex &ci);
 };
 
 #endif // INCLUDE_AMDEMODSINK_H
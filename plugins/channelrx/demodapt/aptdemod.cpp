@@ -176,6 +176,11 @@ void APTDemod::stop()
     stopBasebandSink();
 }
 
+SampleSinkFifo *APTDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 void APTDemod::stopBasebandSink()
 {
     qDebug("APTDemod::stop");
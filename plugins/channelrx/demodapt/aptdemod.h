@@ -228,6 +228,8 @@ public:
         return 0;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -73,6 +73,7 @@ public:
     double getMagSq() const { return m_sink.getMagSq(); }
     bool isRunning() const { return m_running; }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
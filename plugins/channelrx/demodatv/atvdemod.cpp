@@ -117,6 +117,11 @@ void ATVDemod::stop()
 	m_thread.wait();
 }
 
+SampleSinkFifo *ATVDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 void ATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool firstOfBurst)
 {
     (void) firstOfBurst;
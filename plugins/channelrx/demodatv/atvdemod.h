@@ -92,6 +92,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
 	ScopeVis *getScopeSink() { return m_basebandSink->getScopeSink(); }
     void setTVScreen(TVScreenAnalog *tvScreen) { m_basebandSink->setTVScreen(tvScreen); }; //!< set by the GUI
     double getMagSq() const { return m_basebandSink->getMagSq(); } //!< Beware this is scaled to 2^30
@@ -73,6 +73,7 @@ public:
     void setBasebandSampleRate(int sampleRate); //!< To be used when supporting thread is stopped
     bool isRunning() const { return m_running; }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -145,6 +145,11 @@ void BFMDemod::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *BFMDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool BFMDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureBFMDemod::match(cmd))
@@ -101,6 +101,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
 	double getMagSq() const { return m_basebandSink->getMagSq(); }
 
 	bool getPilotLock() const { return m_basebandSink->getPilotLock(); }
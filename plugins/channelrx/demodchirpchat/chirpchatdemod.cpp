@@ -31,6 +31,7 @@
 #include "SWGWorkspaceInfo.h"
 #include "SWGChannelReport.h"
 #include "SWGChirpChatDemodReport.h"
+#include "SWGChirpChatDemodExtraChannel.h"
 
 #include "dsp/dspcommands.h"
 #include "device/deviceapi.h"
@@ -144,6 +145,11 @@ void ChirpChatDemod::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *ChirpChatDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool ChirpChatDemod::handleMessage(const Message& cmd)
 {
 	if (MsgConfigureChirpChatDemod::match(cmd))
@@ -162,6 +168,11 @@ bool ChirpChatDemod::handleMessage(const Message& cmd)
         m_lastMsgSignalDb = msg.getSingalDb();
         m_lastMsgNoiseDb = msg.getNoiseDb();
         m_lastMsgSyncWord = msg.getSyncWord();
+        // Symbols may come from one of the extra channels
+        bool mainChannel = (msg.getSpreadFactor() == m_settings.m_spreadFactor)
+            && (msg.getDeBits() == m_settings.m_deBits)
+            && (msg.getBandwidthIndex() == m_settings.m_bandwidthIndex);
+        m_decoder.setNbSymbolBits(msg.getSpreadFactor(), msg.getDeBits());
 
         if (m_settings.m_codingScheme == ChirpChatDemodSettings::CodingLoRa)
         {
@@ -196,6 +207,7 @@ bool ChirpChatDemod::handleMessage(const Message& cmd)
                 msgToGUI->setSyncWord(m_lastMsgSyncWord);
                 msgToGUI->setSignalDb(m_lastMsgSignalDb);
                 msgToGUI->setNoiseDb(m_lastMsgNoiseDb);
+                msgToGUI->setChannel(msg.getBandwidthIndex(), msg.getSpreadFactor());
                 msgToGUI->setPacketSize(m_lastMsgPacketLength);
                 msgToGUI->setNbParityBits(m_lastMsgNbParityBits);
                 msgToGUI->setHasCRC(m_lastMsgHasCRC);
@@ -251,7 +263,7 @@ bool ChirpChatDemod::handleMessage(const Message& cmd)
                 }
             }
 
-            if (m_settings.m_autoNbSymbolsMax)
+            if (m_settings.m_autoNbSymbolsMax && mainChannel)
             {
                 ChirpChatDemodSettings settings = m_settings;
                 settings.m_nbSymbolsMax = m_lastMsgNbSymbols;
@@ -283,6 +295,7 @@ bool ChirpChatDemod::handleMessage(const Message& cmd)
                 msgToGUI->setSyncWord(m_lastMsgSyncWord);
                 msgToGUI->setSignalDb(m_lastMsgSignalDb);
                 msgToGUI->setNoiseDb(m_lastMsgNoiseDb);
+                msgToGUI->setChannel(msg.getBandwidthIndex(), msg.getSpreadFactor());
                 getMessageQueueToGUI()->push(msgToGUI);
             }
         }
@@ -462,6 +475,10 @@ void ChirpChatDemod::applySettings(const ChirpChatDemodSettings& settings, bool
         m_udpSink.setPort(settings.m_udpPort);
     }
 
+    if ((settings.m_extraChannels != m_settings.m_extraChannels) || force) {
+        reverseAPIKeys.append("extraChannels");
+    }
+
     if (m_settings.m_streamIndex != settings.m_streamIndex)
     {
         if (m_deviceAPI->getSampleMIMO()) // change of stream is possible for MIMO devices only
@@ -605,6 +622,33 @@ void ChirpChatDemod::webapiUpdateChannelSettings(
         uint16_t port = response.getChirpChatDemodSettings()->getUdpPort();
         settings.m_udpPort = port < 1024 ? 1024 : port;
     }
+    if (channelSettingsKeys.contains("extraChannels"))
+    {
+        settings.m_extraChannels.clear();
+        QList<SWGSDRangel::SWGChirpChatDemodExtraChannel*> *extraChannels = response.getChirpChatDemodSettings()->getExtraChannels();
+
+        if (extraChannels)
+        {
+            for (const auto swgExtraChannel : *extraChannels)
+            {
+                if (settings.m_extraChannels.size() >= ChirpChatDemodSettings::maxExtraChannels) {
+                    break;
+                }
+
+                ChirpChatDemodExtraChannel extraChannel;
+                extraChannel.m_bandwidthIndex = swgExtraChannel->getBandwidthIndex();
+                extraChannel.m_spreadFactor = swgExtraChannel->getSpreadFactor();
+                extraChannel.m_deBits = swgExtraChannel->getDeBits();
+
+                if (ChirpChatDemodSettings::isValidExtraChannel(extraChannel)) {
+                    settings.m_extraChannels.append(extraChannel);
+                } else {
+                    qWarning("ChirpChatDemod::webapiUpdateChannelSettings: ignoring invalid extra channel BW index: %d SF: %d DE: %d",
+                        extraChannel.m_bandwidthIndex, extraChannel.m_spreadFactor, extraChannel.m_deBits);
+                }
+            }
+        }
+    }
     if (channelSettingsKeys.contains("rgbColor")) {
         settings.m_rgbColor = response.getChirpChatDemodSettings()->getRgbColor();
     }
@@ -651,6 +695,23 @@ int ChirpChatDemod::webapiReportGet(
     return 200;
 }
 
+// Convert the extra channels list to Swagger
+QList<SWGSDRangel::SWGChirpChatDemodExtraChannel*> *ChirpChatDemod::webapiFormatExtraChannels(const ChirpChatDemodSettings& settings)
+{
+    QList<SWGSDRangel::SWGChirpChatDemodExtraChannel*> *extraChannels = new QList<SWGSDRangel::SWGChirpChatDemodExtraChannel*>();
+
+    for (const auto& extraChannel : settings.m_extraChannels)
+    {
+        SWGSDRangel::SWGChirpChatDemodExtraChannel *swgExtraChannel = new SWGSDRangel::SWGChirpChatDemodExtraChannel();
+        swgExtraChannel->setBandwidthIndex(extraChannel.m_bandwidthIndex);
+        swgExtraChannel->setSpreadFactor(extraChannel.m_spreadFactor);
+        swgExtraChannel->setDeBits(extraChannel.m_deBits);
+        extraChannels->append(swgExtraChannel);
+    }
+
+    return extraChannels;
+}
+
 void ChirpChatDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const ChirpChatDemodSettings& settings)
 {
     response.getChirpChatDemodSettings()->setInputFrequencyOffset(settings.m_inputFrequencyOffset);
@@ -676,6 +737,7 @@ void ChirpChatDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings
     }
 
     response.getChirpChatDemodSettings()->setUdpPort(settings.m_udpPort);
+    response.getChirpChatDemodSettings()->setExtraChannels(webapiFormatExtraChannels(settings));
     response.getChirpChatDemodSettings()->setRgbColor(settings.m_rgbColor);
 
     if (response.getChirpChatDemodSettings()->getTitle()) {
@@ -886,6 +948,9 @@ void ChirpChatDemod::webapiFormatChannelSettings(
     if (channelSettingsKeys.contains("updPort") || force) {
         swgChirpChatDemodSettings->setUdpPort(settings.m_udpPort);
     }
+    if (channelSettingsKeys.contains("extraChannels") || force) {
+        swgChirpChatDemodSettings->setExtraChannels(webapiFormatExtraChannels(settings));
+    }
     if (channelSettingsKeys.contains("rgbColor") || force) {
         swgChirpChatDemodSettings->setRgbColor(settings.m_rgbColor);
     }
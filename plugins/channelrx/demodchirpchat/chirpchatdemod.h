@@ -39,6 +39,10 @@ class DeviceAPI;
 class QThread;
 class ObjectPipe;
 
+namespace SWGSDRangel {
+    class SWGChirpChatDemodExtraChannel;
+}
+
 class ChirpChatDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureChirpChatDemod : public Message {
@@ -72,6 +76,8 @@ public:
         unsigned int getSyncWord() const { return m_syncWord; }
         float getSingalDb() const { return m_signalDb; }
         float getNoiseDb() const { return m_noiseDb; }
+        int getBandwidthIndex() const { return m_bandwidthIndex; }
+        int getSpreadFactor() const { return m_spreadFactor; }
         unsigned int getPacketSize() const { return m_packetSize; }
         unsigned int getNbParityBits() const { return m_nbParityBits; }
         unsigned int getNbSymbols() const { return m_nbSymbols; }
@@ -95,6 +101,10 @@ public:
         void setNoiseDb(float db) {
             m_noiseDb = db;
         }
+        void setChannel(int bandwidthIndex, int spreadFactor) {
+            m_bandwidthIndex = bandwidthIndex;
+            m_spreadFactor = spreadFactor;
+        }
         void setPacketSize(unsigned int packetSize) {
             m_packetSize = packetSize;
         }
@@ -131,6 +141,8 @@ public:
         unsigned int m_syncWord;
         float m_signalDb;
         float m_noiseDb;
+        int m_bandwidthIndex;
+        int m_spreadFactor;
         unsigned int m_packetSize;
         unsigned int m_nbParityBits;
         unsigned int m_nbSymbols;
@@ -148,6 +160,8 @@ public:
             m_syncWord(0),
             m_signalDb(0.0),
             m_noiseDb(0.0),
+            m_bandwidthIndex(0),
+            m_spreadFactor(0),
             m_packetSize(0),
             m_nbParityBits(0),
             m_nbSymbols(0),
@@ -169,6 +183,8 @@ public:
         unsigned int getSyncWord() const { return m_syncWord; }
         float getSingalDb() const { return m_signalDb; }
         float getNoiseDb() const { return m_noiseDb; }
+        int getBandwidthIndex() const { return m_bandwidthIndex; }
+        int getSpreadFactor() const { return m_spreadFactor; }
 
         static MsgReportDecodeString* create(const QString& str)
         {
@@ -183,19 +199,27 @@ public:
         void setNoiseDb(float db) {
             m_noiseDb = db;
         }
+        void setChannel(int bandwidthIndex, int spreadFactor) {
+            m_bandwidthIndex = bandwidthIndex;
+            m_spreadFactor = spreadFactor;
+        }
 
     private:
         QString m_str;
         unsigned int m_syncWord;
         float m_signalDb;
         float m_noiseDb;
+        int m_bandwidthIndex;
+        int m_spreadFactor;
 
         MsgReportDecodeString(const QString& str) :
             Message(),
             m_str(str),
             m_syncWord(0),
             m_signalDb(0.0),
-            m_noiseDb(0.0)
+            m_noiseDb(0.0),
+            m_bandwidthIndex(0),
+            m_spreadFactor(0)
         { }
     };
 
@@ -232,6 +256,8 @@ public:
         return 0;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
                 SWGSDRangel::SWGChannelSettings& response,
                 QString& errorMessage);
@@ -259,6 +285,9 @@ public:
             const QStringList& channelSettingsKeys,
             SWGSDRangel::SWGChannelSettings& response);
 
+    static QList<SWGSDRangel::SWGChirpChatDemodExtraChannel*> *webapiFormatExtraChannels(
+            const ChirpChatDemodSettings& settings);
+
     bool getDemodActive() const;
     double getCurrentNoiseLevel() const;
     double getTotalPower() const;
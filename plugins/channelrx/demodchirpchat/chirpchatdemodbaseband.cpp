@@ -25,10 +25,12 @@
 
 MESSAGE_CLASS_DEFINITION(ChirpChatDemodBaseband::MsgConfigureChirpChatDemodBaseband, Message)
 
-ChirpChatDemodBaseband::ChirpChatDemodBaseband()
+ChirpChatDemodBaseband::ChirpChatDemodBaseband() :
+    m_channelSinks(this),
+    m_decoderMessageQueue(nullptr)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
-    m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer = new DownChannelizer(&m_channelSinks);
 
     qDebug("ChirpChatDemodBaseband::ChirpChatDemodBaseband");
     QObject::connect(
@@ -45,6 +47,10 @@ ChirpChatDemodBaseband::ChirpChatDemodBaseband()
 ChirpChatDemodBaseband::~ChirpChatDemodBaseband()
 {
     delete m_channelizer;
+
+    for (auto sink : m_extraSinks) {
+        delete sink;
+    }
 }
 
 void ChirpChatDemodBaseband::reset()
@@ -116,11 +122,7 @@ bool ChirpChatDemodBaseband::handleMessage(const Message& cmd)
         qDebug() << "ChirpChatDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
         m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
         m_channelizer->setBasebandSampleRate(notif.getSampleRate());
-        m_sink.applyChannelSettings(
-            m_channelizer->getChannelSampleRate(),
-            ChirpChatDemodSettings::bandwidths[m_settings.m_bandwidthIndex],
-            m_channelizer->getChannelFrequencyOffset()
-        );
+        applyChannelSettings(m_settings);
 
 		return true;
     }
@@ -132,25 +134,119 @@ bool ChirpChatDemodBaseband::handleMessage(const Message& cmd)
 
 void ChirpChatDemodBaseband::applySettings(const ChirpChatDemodSettings& settings, bool force)
 {
+    bool extraChannelsChanged = (settings.m_extraChannels != m_settings.m_extraChannels) || force;
+
+    if (extraChannelsChanged) {
+        createExtraSinks(settings);
+    }
+
+    // All channels are demodulated from the samples of the channel with the largest bandwidth
     if ((settings.m_bandwidthIndex != m_settings.m_bandwidthIndex)
-     || (settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset) || force)
+     || (settings.getChannelBandwidthIndex() != m_settings.getChannelBandwidthIndex())
+     || (settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset)
+     || extraChannelsChanged || force)
     {
         m_channelizer->setChannelization(
-            ChirpChatDemodSettings::bandwidths[settings.m_bandwidthIndex]*ChirpChatDemodSettings::oversampling,
+            ChirpChatDemodSettings::bandwidths[settings.getChannelBandwidthIndex()]*ChirpChatDemodSettings::oversampling,
             settings.m_inputFrequencyOffset
         );
-        m_sink.applyChannelSettings(
-            m_channelizer->getChannelSampleRate(),
-            ChirpChatDemodSettings::bandwidths[settings.m_bandwidthIndex],
-            m_channelizer->getChannelFrequencyOffset()
-        );
+        applyChannelSettings(settings, extraChannelsChanged);
     }
 
     m_sink.applySettings(settings, force);
 
+    for (unsigned int i = 0; i < m_extraSinks.size(); i++) {
+        m_extraSinks[i]->applySettings(getExtraChannelSettings(settings, i), extraChannelsChanged);
+    }
+
     m_settings = settings;
 }
 
+void ChirpChatDemodBaseband::applyChannelSettings(const ChirpChatDemodSettings& settings, bool forceExtra)
+{
+    m_sink.applyChannelSettings(
+        m_channelizer->getChannelSampleRate(),
+        ChirpChatDemodSettings::bandwidths[settings.m_bandwidthIndex],
+        m_channelizer->getChannelFrequencyOffset()
+    );
+
+    for (unsigned int i = 0; i < m_extraSinks.size(); i++)
+    {
+        m_extraSinks[i]->applyChannelSettings(
+            m_channelizer->getChannelSampleRate(),
+            ChirpChatDemodSettings::bandwidths[settings.m_extraChannels[i].m_bandwidthIndex],
+            m_channelizer->getChannelFrequencyOffset(),
+            forceExtra
+        );
+    }
+}
+
+void ChirpChatDemodBaseband::createExtraSinks(const ChirpChatDemodSettings& settings)
+{
+    for (auto sink : m_extraSinks) {
+        delete sink;
+    }
+
+    m_extraSinks.clear();
+
+    for (int i = 0; i < settings.m_extraChannels.size(); i++)
+    {
+        // Only the main channel feeds the spectrum
+        ChirpChatDemodSink *sink = new ChirpChatDemodSink();
+        sink->setDecoderMessageQueue(m_decoderMessageQueue);
+        m_extraSinks.push_back(sink);
+    }
+
+    qDebug() << "ChirpChatDemodBaseband::createExtraSinks:" << m_extraSinks.size() << "extra channels";
+}
+
+ChirpChatDemodSettings ChirpChatDemodBaseband::getExtraChannelSettings(const ChirpChatDemodSettings& settings, int extraChannelIndex)
+{
+    const ChirpChatDemodExtraChannel& extraChannel = settings.m_extraChannels[extraChannelIndex];
+    ChirpChatDemodSettings extraSettings = settings;
+    extraSettings.m_bandwidthIndex = extraChannel.m_bandwidthIndex;
+    extraSettings.m_spreadFactor = extraChannel.m_spreadFactor;
+    extraSettings.m_deBits = extraChannel.m_deBits;
+    extraSettings.m_extraChannels.clear();
+    return extraSettings;
+}
+
+void ChirpChatDemodBaseband::setDecoderMessageQueue(MessageQueue *messageQueue)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_decoderMessageQueue = messageQueue;
+    m_sink.setDecoderMessageQueue(messageQueue);
+
+    for (auto sink : m_extraSinks) {
+        sink->setDecoderMessageQueue(messageQueue);
+    }
+}
+
+bool ChirpChatDemodBaseband::getDemodActive() const
+{
+    if (m_sink.getDemodActive()) {
+        return true;
+    }
+
+    for (auto sink : m_extraSinks)
+    {
+        if (sink->getDemodActive()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ChirpChatDemodBaseband::ChannelSinks::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    m_baseband->m_sink.feed(begin, end);
+
+    for (auto sink : m_baseband->m_extraSinks) {
+        sink->feed(begin, end);
+    }
+}
+
 int ChirpChatDemodBaseband::getChannelSampleRate() const
 {
     return m_channelizer->getChannelSampleRate();
@@ -160,9 +256,5 @@ int ChirpChatDemodBaseband::getChannelSampleRate() const
 void ChirpChatDemodBaseband::setBasebandSampleRate(int sampleRate)
 {
     m_channelizer->setBasebandSampleRate(sampleRate);
-    m_sink.applyChannelSettings(
-        m_channelizer->getChannelSampleRate(),
-        ChirpChatDemodSettings::bandwidths[m_settings.m_bandwidthIndex],
-        m_channelizer->getChannelFrequencyOffset()
-    );
+    applyChannelSettings(m_settings);
 }
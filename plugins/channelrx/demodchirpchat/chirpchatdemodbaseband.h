@@ -18,6 +18,8 @@
 #ifndef INCLUDE_CHIRPCHATDEMODBASEBAND_H
 #define INCLUDE_CHIRPCHATDEMODBASEBAND_H
 
+#include <vector>
+
 #include <QObject>
 #include <QRecursiveMutex>
 
@@ -62,24 +64,41 @@ public:
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
-    bool getDemodActive() const { return m_sink.getDemodActive(); }
+    bool getDemodActive() const;
     double getCurrentNoiseLevel() const { return m_sink.getCurrentNoiseLevel(); }
     double getTotalPower() const { return m_sink.getTotalPower(); }
     void setBasebandSampleRate(int sampleRate);
-    void setDecoderMessageQueue(MessageQueue *messageQueue) { m_sink.setDecoderMessageQueue(messageQueue); }
+    void setDecoderMessageQueue(MessageQueue *messageQueue);
     void setSpectrumSink(BasebandSampleSink* spectrumSink) { m_sink.setSpectrumSink(spectrumSink); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
+    // Feeds the channel samples to the main and extra channel sinks
+    class ChannelSinks : public ChannelSampleSink
+    {
+    public:
+        ChannelSinks(ChirpChatDemodBaseband *baseband) : m_baseband(baseband) {}
+        virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    private:
+        ChirpChatDemodBaseband *m_baseband;
+    };
+
     SampleSinkFifo m_sampleFifo;
     DownChannelizer *m_channelizer;
+    ChannelSinks m_channelSinks;
     ChirpChatDemodSink m_sink;
+    std::vector<ChirpChatDemodSink*> m_extraSinks; //!< One per extra spread factor and bandwidth
+    MessageQueue *m_decoderMessageQueue;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     ChirpChatDemodSettings m_settings;
     QRecursiveMutex m_mutex;
 
     bool handleMessage(const Message& cmd);
     void applySettings(const ChirpChatDemodSettings& settings, bool force = false);
+    void applyChannelSettings(const ChirpChatDemodSettings& settings, bool forceExtra = false); //!< forceExtra when extra sinks are new
+    void createExtraSinks(const ChirpChatDemodSettings& settings);
+    static ChirpChatDemodSettings getExtraChannelSettings(const ChirpChatDemodSettings& settings, int extraChannelIndex);
 
 private slots:
     void handleInputMessages();
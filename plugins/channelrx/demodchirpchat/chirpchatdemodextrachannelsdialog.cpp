@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QComboBox>
+#include <QSpinBox>
+
+#include "chirpchatdemodextrachannelsdialog.h"
+
+ChirpChatDemodExtraChannelsDialog::ChirpChatDemodExtraChannelsDialog(
+        ChirpChatDemodSettings *settings,
+        int maxBandwidthIndex,
+        QWidget* parent) :
+    QDialog(parent),
+    ui(new Ui::ChirpChatDemodExtraChannelsDialog),
+    m_settings(settings),
+    m_maxBandwidthIndex(maxBandwidthIndex)
+{
+    ui->setupUi(this);
+
+    resizeTable();
+
+    for (const auto& extraChannel : m_settings->m_extraChannels) {
+        addRow(extraChannel);
+    }
+
+    updateButtons();
+}
+
+ChirpChatDemodExtraChannelsDialog::~ChirpChatDemodExtraChannelsDialog()
+{
+    delete ui;
+}
+
+void ChirpChatDemodExtraChannelsDialog::accept()
+{
+    m_settings->m_extraChannels.clear();
+
+    for (int i = 0; i < ui->table->rowCount(); i++)
+    {
+        ChirpChatDemodExtraChannel extraChannel;
+        extraChannel.m_bandwidthIndex = ((QComboBox *) ui->table->cellWidget(i, EXTRA_CHANNEL_COL_BW))->currentIndex();
+        extraChannel.m_spreadFactor = ((QSpinBox *) ui->table->cellWidget(i, EXTRA_CHANNEL_COL_SF))->value();
+        extraChannel.m_deBits = ((QSpinBox *) ui->table->cellWidget(i, EXTRA_CHANNEL_COL_DE))->value();
+        m_settings->m_extraChannels.append(extraChannel);
+    }
+
+    QDialog::accept();
+}
+
+void ChirpChatDemodExtraChannelsDialog::resizeTable()
+{
+    ChirpChatDemodExtraChannel dummy;
+    dummy.m_bandwidthIndex = m_maxBandwidthIndex;
+    dummy.m_spreadFactor = 12;
+    addRow(dummy);
+    ui->table->resizeColumnsToContents();
+    ui->table->removeRow(0);
+}
+
+void ChirpChatDemodExtraChannelsDialog::updateButtons()
+{
+    ui->add->setEnabled(ui->table->rowCount() < ChirpChatDemodSettings::maxExtraChannels);
+    ui->remove->setEnabled(ui->table->rowCount() > 0);
+}
+
+void ChirpChatDemodExtraChannelsDialog::on_add_clicked()
+{
+    ChirpChatDemodExtraChannel extraChannel;
+    extraChannel.m_bandwidthIndex = m_settings->m_bandwidthIndex;
+    extraChannel.m_spreadFactor = m_settings->m_spreadFactor < 12 ? m_settings->m_spreadFactor + 1 : 7;
+    addRow(extraChannel);
+    updateButtons();
+}
+
+// Remove selected row
+void ChirpChatDemodExtraChannelsDialog::on_remove_clicked()
+{
+    // Selection mode is single, so only a single row should be returned
+    QModelIndexList indexList = ui->table->selectionModel()->selectedRows();
+
+    if (!indexList.isEmpty())
+    {
+        int row = indexList.at(0).row();
+        ui->table->removeRow(row);
+    }
+
+    updateButtons();
+}
+
+void ChirpChatDemodExtraChannelsDialog::addRow(const ChirpChatDemodExtraChannel& extraChannel)
+{
+    QComboBox *bandwidth = new QComboBox();
+
+    for (int i = 0; i <= m_maxBandwidthIndex; i++) {
+        bandwidth->addItem(tr("%1 Hz").arg(ChirpChatDemodSettings::bandwidths[i]));
+    }
+
+    bandwidth->setCurrentIndex(std::min(extraChannel.m_bandwidthIndex, m_maxBandwidthIndex));
+
+    QSpinBox *spreadFactor = new QSpinBox();
+    spreadFactor->setRange(7, 12);
+    spreadFactor->setValue(extraChannel.m_spreadFactor);
+
+    QSpinBox *deBits = new QSpinBox();
+    deBits->setRange(0, 4);
+    deBits->setValue(extraChannel.m_deBits);
+
+    int row = ui->table->rowCount();
+    ui->table->setRowCount(row + 1);
+    ui->table->setCellWidget(row, EXTRA_CHANNEL_COL_BW, bandwidth);
+    ui->table->setCellWidget(row, EXTRA_CHANNEL_COL_SF, spreadFactor);
+    ui->table->setCellWidget(row, EXTRA_CHANNEL_COL_DE, deBits);
+}
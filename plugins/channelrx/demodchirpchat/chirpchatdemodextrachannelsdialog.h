@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_CHIRPCHATDEMODEXTRACHANNELSDIALOG_H
+#define INCLUDE_CHIRPCHATDEMODEXTRACHANNELSDIALOG_H
+
+#include "ui_chirpchatdemodextrachannelsdialog.h"
+#include "chirpchatdemodsettings.h"
+
+class ChirpChatDemodExtraChannelsDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    explicit ChirpChatDemodExtraChannelsDialog(ChirpChatDemodSettings* settings, int maxBandwidthIndex, QWidget* parent = nullptr);
+    ~ChirpChatDemodExtraChannelsDialog();
+
+private:
+    void resizeTable();
+    void updateButtons();
+
+private slots:
+    void accept();
+    void on_add_clicked();
+    void on_remove_clicked();
+    void addRow(const ChirpChatDemodExtraChannel& extraChannel);
+
+private:
+    Ui::ChirpChatDemodExtraChannelsDialog* ui;
+    ChirpChatDemodSettings *m_settings;
+    int m_maxBandwidthIndex;
+
+    enum ExtraChannelCol {
+        EXTRA_CHANNEL_COL_BW,
+        EXTRA_CHANNEL_COL_SF,
+        EXTRA_CHANNEL_COL_DE
+    };
+};
+
+#endif // INCLUDE_CHIRPCHATDEMODEXTRACHANNELSDIALOG_H
@@ -35,6 +35,7 @@
 
 #include "chirpchatdemod.h"
 #include "chirpchatdemodgui.h"
+#include "chirpchatdemodextrachannelsdialog.h"
 
 ChirpChatDemodGUI* ChirpChatDemodGUI::create(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, BasebandSampleSink *rxChannel)
 {
@@ -324,6 +325,16 @@ void ChirpChatDemodGUI::on_udpPort_editingFinished()
     applySettings();
 }
 
+void ChirpChatDemodGUI::on_extraChannels_clicked(bool checked)
+{
+    (void) checked;
+    ChirpChatDemodExtraChannelsDialog dialog(&m_settings, ui->BW->maximum(), this);
+
+    if (dialog.exec() == QDialog::Accepted) {
+        applySettings();
+    }
+}
+
 void ChirpChatDemodGUI::onWidgetRolled(QWidget* widget, bool rollDown)
 {
     (void) widget;
@@ -640,6 +651,7 @@ void ChirpChatDemodGUI::showLoRaMessage(const Message& message)
             .arg(msg.getSingalDb() - msg.getNoiseDb(), 0, 'f', 1)
             .arg(getParityStr(msg.getHeaderParityStatus()))
             .arg(msg.getHeaderCRCStatus() ? "ok" : "err");
+        loRaStatus += getChannelStr(msg.getBandwidthIndex(), msg.getSpreadFactor());
 
         displayStatus(loRaStatus);
         displayLoRaStatus(msg.getHeaderParityStatus(), msg.getHeaderCRCStatus(), (int) ParityUndefined, true);
@@ -656,6 +668,7 @@ void ChirpChatDemodGUI::showLoRaMessage(const Message& message)
             .arg(msg.getHeaderCRCStatus() ? "ok" : "err")
             .arg(getParityStr(msg.getPayloadParityStatus()))
             .arg(msg.getPayloadCRCStatus() ? "ok" : "err");
+        loRaHeader += getChannelStr(msg.getBandwidthIndex(), msg.getSpreadFactor());
 
         displayStatus(loRaHeader);
         displayBytes(bytes);
@@ -687,6 +700,7 @@ void ChirpChatDemodGUI::showTextMessage(const Message& message)
         .arg(dateStr)
         .arg(msg.getSingalDb(), 0, 'f', 1)
         .arg(msg.getSingalDb() - msg.getNoiseDb(), 0, 'f', 1);
+    status += getChannelStr(msg.getBandwidthIndex(), msg.getSpreadFactor());
 
     displayStatus(status);
     displayText(msg.getString());
@@ -763,6 +777,16 @@ QString ChirpChatDemodGUI::getParityStr(int parityStatus)
     }
 }
 
+// Identify the decoding channel when extra channels are decoded
+QString ChirpChatDemodGUI::getChannelStr(int bandwidthIndex, int spreadFactor)
+{
+    if (m_settings.m_extraChannels.isEmpty() || (bandwidthIndex < 0) || (bandwidthIndex >= ChirpChatDemodSettings::nbBandwidths)) {
+        return "";
+    }
+
+    return tr(" SF:%1 BW:%2").arg(spreadFactor).arg(ChirpChatDemodSettings::bandwidths[bandwidthIndex]);
+}
+
 void ChirpChatDemodGUI::tick()
 {
     if (m_tickCount < 10)
@@ -805,6 +829,7 @@ void ChirpChatDemodGUI::makeUIConnections()
     QObject::connect(ui->udpSend, &QCheckBox::stateChanged, this, &ChirpChatDemodGUI::on_udpSend_stateChanged);
     QObject::connect(ui->udpAddress, &QLineEdit::editingFinished, this, &ChirpChatDemodGUI::on_udpAddress_editingFinished);
     QObject::connect(ui->udpPort, &QLineEdit::editingFinished, this, &ChirpChatDemodGUI::on_udpPort_editingFinished);
+    QObject::connect(ui->extraChannels, &QPushButton::clicked, this, &ChirpChatDemodGUI::on_extraChannels_clicked);
 }
 
 void ChirpChatDemodGUI::updateAbsoluteCenterFrequency()
@@ -79,6 +79,7 @@ private slots:
 	void on_udpSend_stateChanged(int state);
 	void on_udpAddress_editingFinished();
 	void on_udpPort_editingFinished();
+    void on_extraChannels_clicked(bool checked);
 	void onWidgetRolled(QWidget* widget, bool rollDown);
 	void onMenuDialogCalled(const QPoint& p);
     void channelMarkerHighlightedByCursor();
@@ -124,6 +125,7 @@ private:
 	void displayStatus(const QString& status);
     void displayLoRaStatus(int headerParityStatus, bool headerCRCStatus, int payloadParityStatus, bool payloadCRCStatus);
 	QString getParityStr(int parityStatus);
+    QString getChannelStr(int bandwidthIndex, int spreadFactor);
     void resetLoRaStatus();
 	bool handleMessage(const Message& message);
     void makeUIConnections();
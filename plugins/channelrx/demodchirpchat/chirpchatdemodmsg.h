@@ -31,6 +31,9 @@ namespace ChirpChatDemodMsg
         unsigned int getSyncWord() const { return m_syncWord; }
         float getSingalDb() const { return m_signalDb; }
         float getNoiseDb() const { return m_noiseDb; }
+        int getBandwidthIndex() const { return m_bandwidthIndex; }
+        int getSpreadFactor() const { return m_spreadFactor; }
+        int getDeBits() const { return m_deBits; }
 
         void pushBackSymbol(unsigned short symbol) {
             m_symbols.push_back(symbol);
@@ -47,6 +50,11 @@ namespace ChirpChatDemodMsg
         void setNoiseDb(float db) {
             m_noiseDb = db;
         }
+        void setChannel(int bandwidthIndex, int spreadFactor, int deBits) { //!< Channel the symbols were demodulated from
+            m_bandwidthIndex = bandwidthIndex;
+            m_spreadFactor = spreadFactor;
+            m_deBits = deBits;
+        }
 
         static MsgDecodeSymbols* create() {
             return new MsgDecodeSymbols();
@@ -60,18 +68,27 @@ namespace ChirpChatDemodMsg
         unsigned int m_syncWord;
         float m_signalDb;
         float m_noiseDb;
+        int m_bandwidthIndex;
+        int m_spreadFactor;
+        int m_deBits;
 
         MsgDecodeSymbols() : //!< create an empty message
             Message(),
             m_syncWord(0),
             m_signalDb(0.0),
-            m_noiseDb(0.0)
+            m_noiseDb(0.0),
+            m_bandwidthIndex(0),
+            m_spreadFactor(0),
+            m_deBits(0)
         {}
         MsgDecodeSymbols(const std::vector<unsigned short> symbols) : //!< create a message with symbols copy
             Message(),
             m_syncWord(0),
             m_signalDb(0.0),
-            m_noiseDb(0.0)
+            m_noiseDb(0.0),
+            m_bandwidthIndex(0),
+            m_spreadFactor(0),
+            m_deBits(0)
         { m_symbols = symbols; }
     };
 }
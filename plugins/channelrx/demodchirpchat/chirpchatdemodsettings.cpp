@@ -15,7 +15,10 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <QColor>
+#include <QDataStream>
 
 #include "dsp/dspengine.h"
 #include "util/simpleserializer.h"
@@ -68,6 +71,7 @@ void ChirpChatDemodSettings::resetToDefaults()
     m_bandwidthIndex = 5;
     m_spreadFactor = 7;
     m_deBits = 0;
+    m_extraChannels.clear();
     m_codingScheme = CodingLoRa;
     m_decodeActive = true;
     m_fftWindow = FFTWindow::Rectangle;
@@ -137,6 +141,7 @@ QByteArray ChirpChatDemodSettings::serialize() const
     s.writeS32(30, m_workspaceIndex);
     s.writeBlob(31, m_geometryBytes);
     s.writeBool(32, m_hidden);
+    s.writeBlob(33, serializeExtraChannels(m_extraChannels));
 
     return s.final();
 }
@@ -221,6 +226,8 @@ bool ChirpChatDemodSettings::deserialize(const QByteArray& data)
         d.readS32(30, &m_workspaceIndex, 0);
         d.readBlob(31, &m_geometryBytes);
         d.readBool(32, &m_hidden, false);
+        d.readBlob(33, &bytetmp);
+        deserializeExtraChannels(bytetmp, m_extraChannels);
 
         return true;
     }
@@ -246,3 +253,67 @@ bool ChirpChatDemodSettings::hasSyncWord() const
 {
     return m_codingScheme == CodingLoRa;
 }
+
+int ChirpChatDemodSettings::getChannelBandwidthIndex() const
+{
+    int bandwidthIndex = m_bandwidthIndex;
+
+    for (const auto& extraChannel : m_extraChannels) {
+        bandwidthIndex = std::max(bandwidthIndex, extraChannel.m_bandwidthIndex);
+    }
+
+    return bandwidthIndex;
+}
+
+bool ChirpChatDemodSettings::isValidExtraChannel(const ChirpChatDemodExtraChannel& extraChannel)
+{
+    return (extraChannel.m_bandwidthIndex >= 0)
+        && (extraChannel.m_bandwidthIndex < nbBandwidths)
+        && (extraChannel.m_spreadFactor >= 7)
+        && (extraChannel.m_spreadFactor <= 12)
+        && (extraChannel.m_deBits >= 0)
+        && (extraChannel.m_deBits <= extraChannel.m_spreadFactor);
+}
+
+QDataStream& operator<<(QDataStream& out, const ChirpChatDemodExtraChannel& extraChannel)
+{
+    out << extraChannel.m_bandwidthIndex;
+    out << extraChannel.m_spreadFactor;
+    out << extraChannel.m_deBits;
+    return out;
+}
+
+QDataStream& operator>>(QDataStream& in, ChirpChatDemodExtraChannel& extraChannel)
+{
+    in >> extraChannel.m_bandwidthIndex;
+    in >> extraChannel.m_spreadFactor;
+    in >> extraChannel.m_deBits;
+    return in;
+}
+
+QByteArray ChirpChatDemodSettings::serializeExtraChannels(const QList<ChirpChatDemodExtraChannel>& extraChannels) const
+{
+    QByteArray data;
+    QDataStream *stream = new QDataStream(&data, QIODevice::WriteOnly);
+    (*stream) << extraChannels;
+    delete stream;
+    return data;
+}
+
+void ChirpChatDemodSettings::deserializeExtraChannels(const QByteArray& data, QList<ChirpChatDemodExtraChannel>& extraChannels)
+{
+    QDataStream *stream = new QDataStream(data);
+    (*stream) >> extraChannels;
+    delete stream;
+
+    for (int i = extraChannels.size() - 1; i >= 0; i--)
+    {
+        if (!isValidExtraChannel(extraChannels[i])) {
+            extraChannels.removeAt(i);
+        }
+    }
+
+    while (extraChannels.size() > maxExtraChannels) {
+        extraChannels.removeLast();
+    }
+}
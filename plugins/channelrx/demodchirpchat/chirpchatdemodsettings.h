@@ -20,6 +20,7 @@
 #define PLUGINS_CHANNELRX_DEMODCHIRPCHAT_CHIRPCHATDEMODSETTINGS_H_
 
 #include <QByteArray>
+#include <QList>
 #include <QString>
 
 #include <stdint.h>
@@ -28,6 +29,27 @@
 
 class Serializable;
 
+//!< Additional spread factor and bandwidth decoded from the same channel samples
+struct ChirpChatDemodExtraChannel
+{
+    int m_bandwidthIndex;
+    int m_spreadFactor;
+    int m_deBits;
+
+    ChirpChatDemodExtraChannel() :
+        m_bandwidthIndex(5),
+        m_spreadFactor(8),
+        m_deBits(0)
+    {}
+
+    bool operator==(const ChirpChatDemodExtraChannel& other) const
+    {
+        return (m_bandwidthIndex == other.m_bandwidthIndex)
+            && (m_spreadFactor == other.m_spreadFactor)
+            && (m_deBits == other.m_deBits);
+    }
+};
+
 struct ChirpChatDemodSettings
 {
     enum CodingScheme
@@ -41,6 +63,7 @@ struct ChirpChatDemodSettings
     int m_bandwidthIndex;
     int m_spreadFactor;
     int m_deBits;            //!< Low data rate optmize (DE) bits
+    QList<ChirpChatDemodExtraChannel> m_extraChannels; //!< Decoded in parallel with the main spread factor and bandwidth
     FFTWindow::Function m_fftWindow;
     CodingScheme m_codingScheme;
     bool m_decodeActive;
@@ -74,6 +97,7 @@ struct ChirpChatDemodSettings
     static const int bandwidths[];
     static const int nbBandwidths;
     static const int oversampling;
+    static const int maxExtraChannels = 8;
 
     ChirpChatDemodSettings();
     void resetToDefaults();
@@ -82,8 +106,12 @@ struct ChirpChatDemodSettings
     void setSpectrumGUI(Serializable *spectrumGUI) { m_spectrumGUI = spectrumGUI; }
     unsigned int getNbSFDFourths() const; //!< Get the number of SFD period fourths (depends on coding scheme)
     bool hasSyncWord() const;             //!< Only LoRa has a syncword (for the moment)
+    int getChannelBandwidthIndex() const; //!< Largest bandwidth of main and extra channels
+    static bool isValidExtraChannel(const ChirpChatDemodExtraChannel& extraChannel); //!< Bandwidth, SF and DE within range
     QByteArray serialize() const;
     bool deserialize(const QByteArray& data);
+    QByteArray serializeExtraChannels(const QList<ChirpChatDemodExtraChannel>& extraChannels) const;
+    void deserializeExtraChannels(const QByteArray& data, QList<ChirpChatDemodExtraChannel>& extraChannels);
 };
 
 
@@ -37,6 +37,7 @@ ChirpChatDemodSink::ChirpChatDemodSink() :
     m_downChirps(nullptr),
     m_upChirps(nullptr),
     m_spectrumLine(nullptr),
+    m_preambleSamples(nullptr),
     m_spectrumSink(nullptr),
     m_spectrumBuffer(nullptr)
 {
@@ -70,6 +71,7 @@ ChirpChatDemodSink::~ChirpChatDemodSink()
     delete[] m_upChirps;
     delete[] m_spectrumBuffer;
     delete[] m_spectrumLine;
+    delete[] m_preambleSamples;
 }
 
 void ChirpChatDemodSink::initSF(unsigned int sf, unsigned int deBits, FFTWindow::Function fftWindow)
@@ -86,6 +88,9 @@ void ChirpChatDemodSink::initSF(unsigned int sf, unsigned int deBits, FFTWindow:
     if (m_spectrumLine) {
         delete[] m_spectrumLine;
     }
+    if (m_preambleSamples) {
+        delete[] m_preambleSamples;
+    }
 
     FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
 
@@ -111,6 +116,8 @@ void ChirpChatDemodSink::initSF(unsigned int sf, unsigned int deBits, FFTWindow:
     m_upChirps = new Complex[2*m_nbSymbols];
     m_spectrumBuffer = new Complex[m_nbSymbols];
     m_spectrumLine = new Complex[m_nbSymbols];
+    m_preambleSamples = new Complex[2*m_nbSymbols];
+    std::fill(m_preambleSamples, m_preambleSamples+2*m_nbSymbols, Complex{0.0, 0.0});
     std::fill(m_spectrumLine, m_spectrumLine+m_nbSymbols, Complex(std::polar(1e-6*SDR_RX_SCALED, 0.0)));
 
     float halfAngle = M_PI;
@@ -158,74 +165,31 @@ void ChirpChatDemodSink::processSample(const Complex& ci)
     }
     else if (m_state == ChirpChatStateDetectPreamble) // look for preamble
     {
-        m_fft->in()[m_fftCounter++] = ci * m_downChirps[m_chirp]; // de-chirp the up ramp
+        m_preambleSamples[m_fftLength + m_fftCounter++] = ci;
 
         if (m_fftCounter == m_fftLength)
         {
-            m_fftWindow.apply(m_fft->in());
-            std::fill(m_fft->in()+m_fftLength, m_fft->in()+m_interpolatedFFTLength, Complex{0.0, 0.0});
-            m_fft->transform();
-            m_fftCounter = 0;
-            double magsq, magsqTotal;
-
-            unsigned int imax = argmax(
-                m_fft->out(),
-                m_fftInterpolation,
-                m_fftLength,
-                magsq,
-                magsqTotal,
-                m_spectrumBuffer,
-                m_fftInterpolation
-            ) / m_fftInterpolation;
-
-            if (m_magsqQueue.size() > m_settings.m_preambleChirps) {
-                m_magsqQueue.pop();
-            }
-
-            m_magsqTotalAvg(magsqTotal);
-            m_magsqQueue.push(magsq);
-            m_argMaxHistory[m_argMaxHistoryCounter++] = imax;
+            unsigned int imax, delay;
+            double magsq;
 
-            if (m_argMaxHistoryCounter == m_requiredPreambleChirps)
+            if (searchPreamble(imax, magsq, delay))
             {
-                m_argMaxHistoryCounter = 0;
-                bool preambleFound = true;
-
-                for (unsigned int i = 1; i < m_requiredPreambleChirps; i++)
-                {
-                    int delta = m_argMaxHistory[i] - m_argMaxHistory[i-1];
-                    // qDebug("ChirpChatDemodSink::processSample: search: delta: %d / %d", delta, m_deLength);
-
-                    if ((delta < -m_preambleTolerance) || (delta > m_preambleTolerance))
-                    {
-                        preambleFound = false;
-                        break;
-                    }
-
-                    // if (m_argMaxHistory[0] != m_argMaxHistory[i])
-                    // {
-                    //     preambleFound = false;
-                    //     break;
-                    // }
+                if (m_spectrumSink) {
+                    m_spectrumSink->feed(m_spectrumBuffer, m_nbSymbols);
                 }
 
-                if ((preambleFound) && (magsq > 1e-9))
-                {
-                    if (m_spectrumSink) {
-                        m_spectrumSink->feed(m_spectrumBuffer, m_nbSymbols);
-                    }
-
-                    qDebug("ChirpChatDemodSink::processSample: preamble found: %u|%f", m_argMaxHistory[0], magsq);
-                    m_chirp = m_argMaxHistory[0];
-                    m_fftCounter = m_chirp;
-                    m_chirp0 = 0;
-                    m_chirpCount = 0;
-                    m_state = ChirpChatStatePreambleResyc;
-                }
-                else
-                {
-                    m_magsqOffAvg(m_magsqQueue.front());
-                }
+                qDebug("ChirpChatDemodSink::processSample: preamble found: %u|%f delay: %u", imax, magsq, delay);
+                // The symbol period where the preamble was found ended delay samples ago
+                m_chirp = (imax + delay) % m_nbSymbols;
+                m_fftCounter = m_chirp;
+                m_chirp0 = 0;
+                m_chirpCount = 0;
+                m_state = ChirpChatStatePreambleResyc;
+            }
+            else
+            {
+                std::copy(m_preambleSamples + m_fftLength, m_preambleSamples + 2*m_fftLength, m_preambleSamples);
+                m_fftCounter = 0;
             }
         }
     }
@@ -366,6 +330,7 @@ void ChirpChatDemodSink::processSample(const Complex& ci)
                 m_magsqMax = 0.0;
                 m_decodeMsg = ChirpChatDemodMsg::MsgDecodeSymbols::create();
                 m_decodeMsg->setSyncWord(m_syncWord);
+                m_decodeMsg->setChannel(m_settings.m_bandwidthIndex, m_settings.m_spreadFactor, m_settings.m_deBits);
                 m_state = ChirpChatStateReadPayload;
             }
         }
@@ -463,7 +428,103 @@ void ChirpChatDemodSink::reset()
     m_chirp0 = 0;
     m_fftCounter = 0;
     m_argMaxHistoryCounter = 0;
+    m_argMaxHistoryIndex = 0;
     m_sfdSkipCounter = 0;
+    std::fill(m_preambleSamples, m_preambleSamples+m_fftLength, Complex{0.0, 0.0});
+}
+
+// Dechirp the symbol periods ending at each of the overlap offsets in the last symbol period
+// in one batch. This way one of them is always within a fraction of a symbol of the chirp
+// boundaries. Returns true if the argmax of consecutive symbols at one of the offsets is stable
+// in which case the strongest is returned with the number of samples since its period ended.
+bool ChirpChatDemodSink::searchPreamble(unsigned int& imax, double& magsq, unsigned int& delay)
+{
+    unsigned int hop = m_fftLength / m_preambleOverlaps;
+    int found = -1;
+    magsq = 0.0;
+    imax = 0;
+
+    m_argMaxHistoryIndex = (m_argMaxHistoryIndex + 1) % m_requiredPreambleChirps;
+
+    if (m_argMaxHistoryCounter < m_requiredPreambleChirps) {
+        m_argMaxHistoryCounter++;
+    }
+
+    for (unsigned int k = 0; k < m_preambleOverlaps; k++)
+    {
+        const Complex *samples = m_preambleSamples + (k+1)*hop;
+        bool aligned = k == m_preambleOverlaps - 1; // last symbol period as without overlaps
+        Complex *fftIn = m_fft->in();
+
+        for (unsigned int i = 0; i < m_fftLength; i++) {
+            fftIn[i] = samples[i] * m_downChirps[i]; // de-chirp the up ramp
+        }
+
+        m_fftWindow.apply(fftIn);
+        std::fill(fftIn+m_fftLength, fftIn+m_interpolatedFFTLength, Complex{0.0, 0.0});
+        m_fft->transform();
+        double magsqK, magsqTotal;
+
+        unsigned int imaxK = argmax(
+            m_fft->out(),
+            m_fftInterpolation,
+            m_fftLength,
+            magsqK,
+            magsqTotal,
+            aligned ? m_spectrumBuffer : nullptr,
+            m_fftInterpolation
+        ) / m_fftInterpolation;
+
+        if (aligned)
+        {
+            if (m_magsqQueue.size() > m_settings.m_preambleChirps) {
+                m_magsqQueue.pop();
+            }
+
+            m_magsqTotalAvg(magsqTotal);
+            m_magsqQueue.push(magsqK);
+        }
+
+        m_argMaxHistory[k][m_argMaxHistoryIndex] = imaxK;
+
+        if ((m_argMaxHistoryCounter == m_requiredPreambleChirps) && (magsqK > 1e-9) && (magsqK > magsq) && isPreambleStable(k))
+        {
+            found = k;
+            imax = imaxK;
+            magsq = magsqK;
+        }
+    }
+
+    if (found < 0)
+    {
+        // Noise average is fed once per group of required chirps as without overlapping search
+        if ((m_argMaxHistoryCounter == m_requiredPreambleChirps) && (m_argMaxHistoryIndex == 0)) {
+            m_magsqOffAvg(m_magsqQueue.front());
+        }
+
+        return false;
+    }
+
+    delay = m_fftLength - (found+1)*hop;
+    return true;
+}
+
+bool ChirpChatDemodSink::isPreambleStable(unsigned int offsetIndex)
+{
+    const unsigned int *history = m_argMaxHistory[offsetIndex];
+
+    for (unsigned int i = 1; i < m_requiredPreambleChirps; i++)
+    {
+        unsigned int current = history[(m_argMaxHistoryIndex + 1 + i) % m_requiredPreambleChirps];
+        unsigned int previous = history[(m_argMaxHistoryIndex + i) % m_requiredPreambleChirps];
+        int delta = toSigned((current + m_nbSymbols - previous) % m_nbSymbols, m_nbSymbols); // bins wrap around
+
+        if ((delta < -m_preambleTolerance) || (delta > m_preambleTolerance)) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 unsigned int ChirpChatDemodSink::argmax(
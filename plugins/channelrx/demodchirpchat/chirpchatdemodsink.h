@@ -78,6 +78,7 @@ private:
     static const unsigned int m_requiredPreambleChirps = 4; //!< Number of chirps required to estimate preamble
     static const unsigned int m_maxSFDSearchChirps = 8;     //!< Maximum number of chirps when looking for SFD after preamble detection
     static const unsigned int m_fftInterpolation = 2;       //!< FFT interpolation factor (usually a power of 2)
+    static const unsigned int m_preambleOverlaps = 4;       //!< Number of overlapping FFTs per symbol period when looking for preamble
 
     FFTEngine *m_fft;
     FFTEngine *m_fftSFD;
@@ -88,8 +89,10 @@ private:
     Complex *m_upChirps;
     Complex *m_spectrumLine;
     unsigned int m_fftCounter;
-    int m_argMaxHistory[m_requiredPreambleChirps];
-    unsigned int m_argMaxHistoryCounter;
+    Complex *m_preambleSamples;        //!< Previous and current symbol periods when looking for preamble
+    unsigned int m_argMaxHistory[m_preambleOverlaps][m_requiredPreambleChirps]; //!< Sliding argmax history per symbol offset
+    unsigned int m_argMaxHistoryCounter; //!< Number of symbol periods in history
+    unsigned int m_argMaxHistoryIndex;   //!< Index of the last symbol period in history
     unsigned int m_preambleHistory[m_maxSFDSearchChirps];
     unsigned int m_syncWord;
     double m_magsqMax;
@@ -117,6 +120,8 @@ private:
     int m_preambleTolerance;               //!< Number of FFT bins to collate when looking for preamble
 
     void processSample(const Complex& ci);
+    bool searchPreamble(unsigned int& imax, double& magsq, unsigned int& delay);
+    bool isPreambleStable(unsigned int offsetIndex);
     void initSF(unsigned int sf, unsigned int deBits, FFTWindow::Function fftWindow); //!< Init tables, FFTs, depending on spread factor
     void reset();
     unsigned int argmax(
@@ -155,6 +155,11 @@ void DABDemod::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *DABDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool DABDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureDABDemod::match(cmd))
@@ -131,6 +131,11 @@ void DATVDemod::stop()
 	m_thread.wait();
 }
 
+SampleSinkFifo *DATVDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool DATVDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureDATVDemod::match(cmd))
@@ -217,6 +222,9 @@ void DATVDemod::applySettings(const DATVDemodSettings& settings, bool force)
     if (settings.m_maxBitflips != m_settings.m_maxBitflips) {
         reverseAPIKeys.append("maxBitflips");
     }
+    if (settings.m_pipelined != m_settings.m_pipelined) {
+        reverseAPIKeys.append("pipelined");
+    }
     if (settings.m_audioMute != m_settings.m_audioMute) {
         reverseAPIKeys.append("audioMute");
     }
@@ -392,6 +400,9 @@ void DATVDemod::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("maxBitflips")) {
         settings.m_maxBitflips = response.getDatvDemodSettings()->getMaxBitflips();
     }
+    if (channelSettingsKeys.contains("pipelined")) {
+        settings.m_pipelined = response.getDatvDemodSettings()->getPipelined() == 1;
+    }
     if (channelSettingsKeys.contains("audioMute")) {
         settings.m_audioMute = response.getDatvDemodSettings()->getAudioMute() == 1;
     }
@@ -494,6 +505,7 @@ void DATVDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& res
 
     response.getDatvDemodSettings()->setSoftLdpcMaxTrials(settings.m_softLDPCMaxTrials);
     response.getDatvDemodSettings()->setMaxBitflips(settings.m_maxBitflips);
+    response.getDatvDemodSettings()->setPipelined(settings.m_pipelined ? 1 : 0);
     response.getDatvDemodSettings()->setAudioMute(settings.m_audioMute ? 1 : 0);
 
     if (response.getDatvDemodSettings()->getAudioDeviceName()) {
@@ -655,6 +667,9 @@ void DATVDemod::webapiFormatChannelSettings(
     if (channelSettingsKeys.contains("maxBitflips") || force) {
         swgDATVDemodSettings->setMaxBitflips(settings.m_maxBitflips);
     }
+    if (channelSettingsKeys.contains("pipelined") || force) {
+        swgDATVDemodSettings->setPipelined(settings.m_pipelined ? 1 : 0);
+    }
     if (channelSettingsKeys.contains("audioMute") || force) {
         swgDATVDemodSettings->setAudioMute(settings.m_audioMute ? 1 : 0);
     }
@@ -92,6 +92,7 @@ public:
     bool isCstlnSetByModcod() const { return m_sink->isCstlnSetByModcod(); }
     bool isRunning() const { return m_running; }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
     void setAudioFifoLabel(const QString& label) { m_sink->setAudioFifoLabel(label); }
 
 private:
@@ -102,6 +102,24 @@ bool DATVDemodGUI::handleMessage(const Message& message)
         displaySystemConfiguration();
         return true;
     }
+    else if (DATVDemodReport::MsgReportLDPCStats::match(message))
+    {
+        DATVDemodReport::MsgReportLDPCStats& report = (DATVDemodReport::MsgReportLDPCStats&) message;
+        QString toolTip = tr("Soft LDPC decoder (LDPC tool)\n%1 threads").arg(report.getNbThreads());
+
+        for (const auto& stats : report.getStats())
+        {
+            toolTip += tr("\nMODCOD %1%2: %3 frames %4 frames/s/thread %5% unconverged")
+                .arg(stats.m_modcod)
+                .arg(stats.m_shortFrames ? " short" : "")
+                .arg(stats.m_frames)
+                .arg(stats.getFrameRate(), 0, 'f', 1)
+                .arg(stats.m_frames > 0 ? (100.0 * stats.m_unconverged) / stats.m_frames : 0.0, 0, 'f', 1);
+        }
+
+        ui->softLDPC->setToolTip(toolTip);
+        return true;
+    }
     else if (DATVDemod::MsgConfigureDATVDemod::match(message))
     {
         DATVDemod::MsgConfigureDATVDemod& cfg = (DATVDemod::MsgConfigureDATVDemod&) message;
@@ -408,6 +426,7 @@ void DATVDemodGUI::displaySettings()
     ui->udpTSAddress->setText(m_settings.m_udpTSAddress);
     ui->udpTSPort->setText(tr("%1").arg(m_settings.m_udpTSPort));
     ui->playerEnable->setChecked(m_settings.m_playerEnable);
+    ui->pipelined->setChecked(m_settings.m_pipelined);
 
     if (m_settings.m_playerEnable)
     {
@@ -712,6 +731,12 @@ void DATVDemodGUI::on_maxBitflips_valueChanged(int value)
     applySettings();
 }
 
+void DATVDemodGUI::on_pipelined_clicked()
+{
+    m_settings.m_pipelined = ui->pipelined->isChecked();
+    applySettings();
+}
+
 void DATVDemodGUI::on_chkViterbi_clicked()
 {
     m_settings.m_viterbi = ui->chkViterbi->isChecked();
@@ -962,6 +987,7 @@ void DATVDemodGUI::makeUIConnections()
     QObject::connect(ui->udpTSAddress, &QLineEdit::editingFinished, this, &DATVDemodGUI::on_udpTSAddress_editingFinished);
     QObject::connect(ui->udpTSPort, &QLineEdit::editingFinished, this, &DATVDemodGUI::on_udpTSPort_editingFinished);
     QObject::connect(ui->playerEnable, &QCheckBox::clicked, this, &DATVDemodGUI::on_playerEnable_clicked);
+    QObject::connect(ui->pipelined, &QCheckBox::clicked, this, &DATVDemodGUI::on_pipelined_clicked);
 }
 
 void DATVDemodGUI::updateAbsoluteCenterFrequency()
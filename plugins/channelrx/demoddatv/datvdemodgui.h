@@ -108,6 +108,7 @@ private slots:
     void on_udpTSAddress_editingFinished();
     void on_udpTSPort_editingFinished();
     void on_playerEnable_clicked();
+    void on_pipelined_clicked();
 
 private:
     Ui::DATVDemodGUI* ui;
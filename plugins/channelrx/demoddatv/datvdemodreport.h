@@ -18,9 +18,12 @@
 #ifndef INCLUDE_DATVDEMODREPORT_H
 #define INCLUDE_DATVDEMODREPORT_H
 
+#include <QList>
+
 #include "util/message.h"
 
 #include "datvdemodsettings.h"
+#include "ldpctool/ldpcdecoderpool.h"
 
 class DATVDemodReport
 {
@@ -53,6 +56,29 @@ public:
             m_codeRate(codeRate)
         { }
     };
+
+    class MsgReportLDPCStats : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const QList<LDPCModcodStats>& getStats() const { return m_stats; }
+        int getNbThreads() const { return m_nbThreads; }
+
+        static MsgReportLDPCStats* create(const QList<LDPCModcodStats>& stats, int nbThreads)
+        {
+            return new MsgReportLDPCStats(stats, nbThreads);
+        }
+
+    private:
+        QList<LDPCModcodStats> m_stats; //!< Per MODCOD and frame size
+        int m_nbThreads;
+
+        MsgReportLDPCStats(const QList<LDPCModcodStats>& stats, int nbThreads) :
+            Message(),
+            m_stats(stats),
+            m_nbThreads(nbThreads)
+        { }
+    };
 };
 
 #endif // INCLUDE_DATVDEMODREPORT_H
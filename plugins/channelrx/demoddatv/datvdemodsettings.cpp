@@ -53,6 +53,7 @@ void DATVDemodSettings::resetToDefaults()
     m_softLDPCToolPath = DEFAULT_LDPCTOOLPATH;
     m_softLDPCMaxTrials = 8;
     m_maxBitflips = 0;
+    m_pipelined = false;
     m_symbolRate = 250000;
     m_notchFilters = 0;
     m_allowDrift = false;
@@ -130,6 +131,7 @@ QByteArray DATVDemodSettings::serialize() const
     s.writeS32(38, m_workspaceIndex);
     s.writeBlob(39, m_geometryBytes);
     s.writeBool(40, m_hidden);
+    s.writeBool(41, m_pipelined);
 
     return s.final();
 }
@@ -228,6 +230,7 @@ bool DATVDemodSettings::deserialize(const QByteArray& data)
         d.readS32(38, &m_workspaceIndex, 0);
         d.readBlob(39, &m_geometryBytes);
         d.readBool(40, &m_hidden, false);
+        d.readBool(41, &m_pipelined, false);
 
         validateSystemConfiguration();
 
@@ -257,6 +260,7 @@ void DATVDemodSettings::debug(const QString& msg) const
         << " m_softLDPCMaxTrials: " << m_softLDPCMaxTrials
         << " m_softLDPCToolPath: " << m_softLDPCToolPath
         << " m_maxBitflips: " << m_maxBitflips
+        << " m_pipelined: " << m_pipelined
         << " m_modulation: " << m_modulation
         << " m_standard: " << m_standard
         << " m_notchFilters: " << m_notchFilters
@@ -285,6 +289,7 @@ bool DATVDemodSettings::isDifferent(const DATVDemodSettings& other)
         || (m_softLDPCMaxTrials != other.m_softLDPCMaxTrials)
         || (m_softLDPCToolPath != other.m_softLDPCToolPath)
         || (m_maxBitflips != other.m_maxBitflips)
+        || (m_pipelined != other.m_pipelined)
         || (m_modulation != other.m_modulation)
         || (m_notchFilters != other.m_notchFilters)
         || (m_symbolRate != other.m_symbolRate)
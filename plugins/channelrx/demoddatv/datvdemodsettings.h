@@ -84,6 +84,7 @@ struct DATVDemodSettings
     QString m_softLDPCToolPath;
     int m_softLDPCMaxTrials;
     int m_maxBitflips;
+    bool m_pipelined;     //!< Run decoding in its own thread
     bool m_audioMute;
     QString m_audioDeviceName;
     int m_symbolRate;
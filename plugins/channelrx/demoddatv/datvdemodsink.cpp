@@ -23,6 +23,7 @@
 #include <QObject>
 #include <QFileInfo>
 #include <QMutexLocker>
+#include <QThread>
 
 #include "audio/audiooutputdevice.h"
 #include "dsp/dspengine.h"
@@ -780,6 +781,13 @@ void DATVDemodSink::InitDATVFramework()
 
     // DECONVOLUTION AND SYNCHRONIZATION
 
+    // Pipelined: decoding runs in its own thread from here
+    leansdr::pipebuf<leansdr::eucl_ss> *p_decsymbols = p_symbols;
+
+    if (m_settings.m_pipelined) {
+        p_decsymbols = m_objScheduler->bridge(*p_symbols, 1, "PSK soft-symbols decoder", BUF_SYMBOLS);
+    }
+
     p_bytes = new leansdr::pipebuf<leansdr::u8>(m_objScheduler, "bytes", BUF_BYTES);
 
     r_deconv = nullptr;
@@ -793,7 +801,7 @@ void DATVDemodSink::InitDATVFramework()
         }
 
         //To uncomment -> Linking Problem : undefined symbol: _ZN7leansdr21viterbi_dec_interfaceIhhiiE6updateEPiS2_
-        r = new leansdr::viterbi_sync(m_objScheduler, (*p_symbols), (*p_bytes), m_objDemodulator->cstln, m_objCfg.fec);
+        r = new leansdr::viterbi_sync(m_objScheduler, (*p_decsymbols), (*p_bytes), m_objDemodulator->cstln, m_objCfg.fec);
 
         if (m_objCfg.fastlock) {
             r->resync_period = 1;
@@ -801,7 +809,7 @@ void DATVDemodSink::InitDATVFramework()
     }
     else
     {
-        r_deconv = make_deconvol_sync_simple(m_objScheduler, (*p_symbols), (*p_bytes), m_objCfg.fec);
+        r_deconv = make_deconvol_sync_simple(m_objScheduler, (*p_decsymbols), (*p_bytes), m_objCfg.fec);
         r_deconv->fastlock = m_objCfg.fastlock;
     }
 
@@ -844,12 +852,20 @@ void DATVDemodSink::InitDATVFramework()
     r_derand = new leansdr::derandomizer(m_objScheduler, *p_rtspackets, *p_tspackets);
 
     // OUTPUT
+    // Pipelined: video player and UDP output run back in this thread
+    leansdr::pipebuf<leansdr::tspacket> *p_outpackets = p_tspackets;
+
+    if (m_settings.m_pipelined) {
+        p_outpackets = m_objScheduler->bridge(*p_tspackets, 0, "TS packets output", BUF_PACKETS);
+    }
+
     if (m_settings.m_playerEnable) {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, m_videoStream, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_outpackets, m_videoStream, &m_udpStream);
     } else {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, nullptr, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_outpackets, nullptr, &m_udpStream);
     }
 
+    m_objScheduler->start();
     m_blnDVBInitialized = true;
 }
 
@@ -1082,6 +1098,13 @@ void DATVDemodSink::InitDATVS2Framework()
     r_merMeter = new leansdr::datvmeter(m_objScheduler, *p_mer);
     r_cnrMeter = new leansdr::datvmeter(m_objScheduler, *p_cnr);
 
+    // Pipelined: decoding runs in its own thread from here
+    leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *p_decslots = (leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2;
+
+    if (m_settings.m_pipelined) {
+        p_decslots = m_objScheduler->bridge(*p_decslots, 1, "PL slots decoder", BUF_SLOTS);
+    }
+
     // Bit-flipping mode.
     // Deinterleave into hard bits.
 
@@ -1115,7 +1138,7 @@ void DATVDemodSink::InitDATVS2Framework()
         p_fecframes = new leansdr::pipebuf<leansdr::fecframe<leansdr::llr_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
         p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss, leansdr::llr_sb>(
             m_objScheduler,
-            *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
+            *p_decslots,
             *(leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > * ) p_fecframes
         );
         r_fecdecsoft = new leansdr::s2_fecdec_soft<leansdr::llr_t,leansdr::llr_sb>(
@@ -1135,7 +1158,7 @@ void DATVDemodSink::InitDATVS2Framework()
         p_fecframes = new leansdr::pipebuf<leansdr::fecframe<leansdr::llr_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
         p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss, leansdr::llr_sb>(
             m_objScheduler,
-            *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
+            *p_decslots,
             *(leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > *) p_fecframes
         );
         // Decode FEC-protected frames into plain BB frames.
@@ -1148,7 +1171,8 @@ void DATVDemodSink::InitDATVS2Framework()
             p_verrcount)
         ;
         leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb> *fecdec = (leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb> *) r_fecdechelper;
-        const int nhelpers = 6;
+        // Leave a core for the rest of the demodulator
+        const int nhelpers = std::max(1, QThread::idealThreadCount() - 1);
         fecdec->nhelpers = nhelpers;
         fecdec->must_buffer = false;
         fecdec->max_trials = m_settings.m_softLDPCMaxTrials;
@@ -1161,7 +1185,7 @@ void DATVDemodSink::InitDATVS2Framework()
         p_fecframes = new leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
         p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss,leansdr::hard_sb>(
             m_objScheduler,
-            *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
+            *p_decslots,
             *(leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > * ) p_fecframes
         );
         r_fecdec =  new leansdr::s2_fecdec<bool, leansdr::hard_sb>(
@@ -1186,12 +1210,20 @@ void DATVDemodSink::InitDATVS2Framework()
 */
 
     // OUTPUT
+    // Pipelined: video player and UDP output run back in this thread
+    leansdr::pipebuf<leansdr::tspacket> *p_outpackets = p_tspackets;
+
+    if (m_settings.m_pipelined) {
+        p_outpackets = m_objScheduler->bridge(*p_tspackets, 0, "TS packets output", BUF_S2PACKETS);
+    }
+
     if (m_settings.m_playerEnable) {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, m_videoStream, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_outpackets, m_videoStream, &m_udpStream);
     } else {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, nullptr, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_outpackets, nullptr, &m_udpStream);
     }
 
+    m_objScheduler->start();
     m_blnDVBInitialized = true;
 }
 
@@ -1328,6 +1360,7 @@ void DATVDemodSink::feed(const SampleVector::const_iterator& begin, const Sample
                 if ((m_lngReadIQ + 1) >= lngWritable)
                 {
                     m_objScheduler->step();
+                    reportLDPCStats();
 
                     m_lngReadIQ = 0;
                     delete p_rawiq_writer;
@@ -1338,6 +1371,29 @@ void DATVDemodSink::feed(const SampleVector::const_iterator& begin, const Sample
     } // Samples for loop
 }
 
+void DATVDemodSink::reportLDPCStats()
+{
+#if !defined(USE_LDPC_TOOL) || defined(_MSC_VER)
+    if (!r_fecdechelper || !getMessageQueueToGUI()) {
+        return;
+    }
+
+    if (m_ldpcStatsTimer.isValid() && (m_ldpcStatsTimer.elapsed() < 1000)) {
+        return;
+    }
+
+    m_ldpcStatsTimer.start();
+    leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb> *fecdec = (leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb> *) r_fecdechelper;
+    QList<LDPCModcodStats> stats;
+    int nbThreads;
+    fecdec->getLDPCStats(stats, nbThreads);
+
+    if (nbThreads > 0) {
+        getMessageQueueToGUI()->push(DATVDemodReport::MsgReportLDPCStats::create(stats, nbThreads));
+    }
+#endif
+}
+
 void DATVDemodSink::applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force)
 {
     qDebug() << "DATVDemodSink::applyChannelSettings:"
@@ -19,6 +19,7 @@
 #define INCLUDE_DATVDEMODSINK_H
 
 #include <QRecursiveMutex>
+#include <QElapsedTimer>
 
 //LeanSDR
 #include "leansdr/framework.h"
@@ -180,6 +181,7 @@ private:
     void ResetDATVFrameworkPointers();
     void InitDATVFramework();
     void InitDATVS2Framework();
+    void reportLDPCStats();
 
     static int getLeanDVBCodeRateFromDATV(DATVDemodSettings::DATVCodeRate datvCodeRate);
     static int getLeanDVBModulationFromDATV(DATVDemodSettings::DATVModulation datvModulation);
@@ -345,6 +347,7 @@ private:
     MovingAverageUtil<double, double, 32> m_objMagSqAverage;
 
     MessageQueue *m_messageQueueToGUI;
+    QElapsedTimer m_ldpcStatsTimer;
     QRecursiveMutex m_mutex;
 
     static const unsigned int m_rfFilterFftLength;
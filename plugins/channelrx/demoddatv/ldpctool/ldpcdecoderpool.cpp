@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Jon Beniston, M7RCE                                        //
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <chrono>
+#include <cstring>
+
+#include <QDebug>
+
+#include "testbench.h"
+#include "algorithms.h"
+#include "ldpc.h"
+#include "layered_decoder.h"
+#include "ldpcdecoderpool.h"
+
+// LDPC decoder for one MODCOD and frame size. It is used by one thread at a time
+struct LDPCDecoderPool::Decoder
+{
+    typedef ldpctool::NormalUpdate<ldpctool::simd_type> update_type;
+    typedef ldpctool::MinSumCAlgorithm<ldpctool::simd_type, update_type, ldpctool::FACTOR> algorithm_type;
+
+    int m_key;
+    int m_codeLen;
+    int m_dataLen;
+    void *m_alignedBuffer;
+    ldpctool::simd_type *m_simd;
+    ldpctool::LDPCDecoder<ldpctool::simd_type, algorithm_type> m_decode;
+
+    Decoder(int key, ldpctool::LDPCInterface *ldpc) :
+        m_key(key),
+        m_codeLen(ldpc->code_len()),
+        m_dataLen(ldpc->data_len())
+    {
+        m_decode.init(ldpc);
+        m_alignedBuffer = ldpctool::LDPCUtil::aligned_malloc(sizeof(ldpctool::simd_type), sizeof(ldpctool::simd_type) * m_codeLen);
+        m_simd = reinterpret_cast<ldpctool::simd_type *>(m_alignedBuffer);
+    }
+
+    ~Decoder()
+    {
+        ldpctool::LDPCUtil::aligned_free(m_alignedBuffer);
+    }
+};
+
+LDPCDecoderPool::LDPCDecoderPool(int nbThreads, int maxTrials) :
+    m_nbThreads(nbThreads),
+    m_maxTrials(maxTrials),
+    m_maxBatches(2*nbThreads + 1),
+    m_pool(nbThreads),
+    m_readIndex(0)
+{
+    // Expect LLR values in int8_t format.
+    if (sizeof(ldpctool::code_type) != 1) {
+        qCritical() << "LDPCDecoderPool::LDPCDecoderPool: Unsupported code_type";
+    }
+
+    qDebug() << "LDPCDecoderPool::LDPCDecoderPool: threads:" << nbThreads << "SIMD width:" << getSIMDWidth();
+}
+
+LDPCDecoderPool::~LDPCDecoderPool()
+{
+    for (const auto& batch : m_batches) {
+        m_pool.wait(batch->m_ticket);
+    }
+
+    for (auto& decoders : m_decoders)
+    {
+        for (auto decoder : decoders) {
+            delete decoder;
+        }
+    }
+}
+
+int LDPCDecoderPool::getSIMDWidth()
+{
+    return ldpctool::SIMD_WIDTH;
+}
+
+void LDPCDecoderPool::push(int modcod, bool shortFrames, const char *llr, int size)
+{
+    if (m_pending && ((m_pending->m_modcod != modcod) || (m_pending->m_shortFrames != shortFrames) || (m_pending->m_frameSize != size))) {
+        flush();
+    }
+
+    if (!m_pending)
+    {
+        m_pending.reset(new Batch());
+        m_pending->m_modcod = modcod;
+        m_pending->m_shortFrames = shortFrames;
+        m_pending->m_frameSize = size;
+        m_pending->m_nbFrames = 0;
+        m_pending->m_frames.resize(ldpctool::SIMD_WIDTH * size);
+    }
+
+    std::copy(llr, llr + size, m_pending->m_frames.begin() + m_pending->m_nbFrames * size);
+    m_pending->m_nbFrames++;
+
+    if (m_pending->m_nbFrames == ldpctool::SIMD_WIDTH) {
+        flush();
+    }
+}
+
+void LDPCDecoderPool::flush()
+{
+    if (!m_pending) {
+        return;
+    }
+
+    Batch *batch = m_pending.get();
+    m_batches.push_back(std::move(m_pending));
+    batch->m_ticket = m_pool.submit([this, batch](){
+        decode(batch);
+    });
+}
+
+bool LDPCDecoderPool::dataAvailable() const
+{
+    return !m_batches.empty() && m_batches.front()->m_ticket->isDone();
+}
+
+const char *LDPCDecoderPool::data() const
+{
+    const Batch *batch = m_batches.front().get();
+    return batch->m_frames.data() + m_readIndex * batch->m_frameSize;
+}
+
+void LDPCDecoderPool::pop()
+{
+    m_readIndex++;
+
+    if (m_readIndex >= m_batches.front()->m_nbFrames)
+    {
+        m_batches.pop_front();
+        m_readIndex = 0;
+    }
+}
+
+void LDPCDecoderPool::getStats(QList<LDPCModcodStats>& stats)
+{
+    QMutexLocker mutexLocker(&m_statsMutex);
+    stats = m_stats.values();
+}
+
+// Runs in a pool thread
+void LDPCDecoderPool::decode(Batch *batch)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Decoder *decoder = acquireDecoder(batch->m_modcod, batch->m_shortFrames);
+    int unconverged = 0;
+
+    if (decoder && (decoder->m_codeLen == batch->m_frameSize))
+    {
+        ldpctool::code_type *code = reinterpret_cast<ldpctool::code_type *>(batch->m_frames.data());
+        int codeLen = decoder->m_codeLen;
+        int blocks = batch->m_nbFrames;
+
+        // Interleave the frames so that each SIMD lane decodes one of them
+        for (int n = 0; n < blocks; ++n)
+            for (int i = 0; i < codeLen; ++i)
+                reinterpret_cast<ldpctool::code_type *>(decoder->m_simd + i)[n] = code[n * codeLen + i];
+
+        int count = decoder->m_decode(decoder->m_simd, decoder->m_simd + decoder->m_dataLen, m_maxTrials, blocks);
+
+        if (count < 0) {
+            unconverged = blocks;
+        }
+
+        for (int n = 0; n < blocks; ++n)
+            for (int i = 0; i < codeLen; ++i)
+                code[n * codeLen + i] = reinterpret_cast<ldpctool::code_type *>(decoder->m_simd + i)[n];
+    }
+    else if (decoder)
+    {
+        qWarning() << "LDPCDecoderPool::decode: frame size" << batch->m_frameSize << "does not match code length" << decoder->m_codeLen;
+    }
+
+    if (decoder) {
+        releaseDecoder(decoder);
+    }
+
+    std::chrono::duration<double> sec = std::chrono::steady_clock::now() - start;
+    QMutexLocker mutexLocker(&m_statsMutex);
+    LDPCModcodStats& stats = m_stats[key(batch->m_modcod, batch->m_shortFrames)];
+    stats.m_modcod = batch->m_modcod;
+    stats.m_shortFrames = batch->m_shortFrames;
+    stats.m_frames += batch->m_nbFrames;
+    stats.m_unconverged += unconverged;
+    stats.m_decodeTime += sec.count();
+}
+
+LDPCDecoderPool::Decoder *LDPCDecoderPool::acquireDecoder(int modcod, bool shortFrames)
+{
+    int decoderKey = key(modcod, shortFrames);
+
+    {
+        QMutexLocker mutexLocker(&m_decodersMutex);
+        std::vector<Decoder*>& decoders = m_decoders[decoderKey];
+
+        if (!decoders.empty())
+        {
+            Decoder *decoder = decoders.back();
+            decoders.pop_back();
+            return decoder;
+        }
+    }
+
+    // DVB-S2 MODCOD definitions
+    static const char *mc_tabnames[2][32] = { // [shortframes][modcod]
+                                             {// Normal frames
+                                              0, "B1", "B2", "B3", "B4", "B5", "B6", "B7",
+                                              "B8", "B9", "B10", "B11", "B5", "B6", "B7", "B9",
+                                              "B10", "B11", "B6", "B7", "B8", "B9", "B10", "B11",
+                                              "B7", "B8", "B8", "B10", "B11", 0, 0, 0},
+                                             {// Short frames
+                                              0, "C1", "C2", "C3", "C4", "C5", "C6", "C7",
+                                              "C8", "C9", "C10", 0, "C5", "C6", "C7", "C9",
+                                              "C10", 0, "C6", "C7", "C8", "C9", "C10", 0,
+                                              "C7", "C8", "C8", "C10", 0, 0, 0, 0}};
+
+    const char *tabname = ((modcod >= 0) && (modcod < 32)) ? mc_tabnames[shortFrames ? 1 : 0][modcod] : nullptr;
+
+    if (!tabname)
+    {
+        qCritical() << "LDPCDecoderPool::acquireDecoder: unsupported modcod" << modcod;
+        return nullptr;
+    }
+
+    ldpctool::LDPCInterface *ldpc = ldpctool::create_ldpc((char *)"S2", tabname[0], atoi(tabname + 1));
+
+    if (!ldpc)
+    {
+        qCritical() << "LDPCDecoderPool::acquireDecoder: no such table!";
+        return nullptr;
+    }
+
+    // The decoder keeps its own copy of the tables
+    Decoder *decoder = new Decoder(decoderKey, ldpc);
+    delete ldpc;
+    return decoder;
+}
+
+void LDPCDecoderPool::releaseDecoder(Decoder *decoder)
+{
+    QMutexLocker mutexLocker(&m_decodersMutex);
+    m_decoders[decoder->m_key].push_back(decoder);
+}
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Jon Beniston, M7RCE                                        //
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_LDPCDECODERPOOL_H
+#define INCLUDE_LDPCDECODERPOOL_H
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <QHash>
+#include <QList>
+#include <QMutex>
+
+#include "util/workerpool.h"
+
+struct LDPCModcodStats
+{
+    int m_modcod;
+    bool m_shortFrames;
+    qint64 m_frames;        //!< Frames decoded
+    qint64 m_unconverged;   //!< Frames in SIMD batches that did not converge to a code word within max trials
+    double m_decodeTime;    //!< Time spent decoding summed over all threads in seconds
+
+    LDPCModcodStats() :
+        m_modcod(0),
+        m_shortFrames(false),
+        m_frames(0),
+        m_unconverged(0),
+        m_decodeTime(0.0)
+    {}
+
+    //!< Frames per second one thread decodes
+    double getFrameRate() const { return m_decodeTime > 0.0 ? m_frames / m_decodeTime : 0.0; }
+};
+
+// Decodes DVB-S2 LDPC frames in parallel on its own threads.
+// Consecutive frames with the same MODCOD are batched by the SIMD width and the
+// decoded frames are read back in the order they were pushed.
+class LDPCDecoderPool
+{
+public:
+    LDPCDecoderPool(int nbThreads, int maxTrials);
+    ~LDPCDecoderPool();
+
+    static int getSIMDWidth();
+    int getNbThreads() const { return m_nbThreads; }
+
+    //!< size is the frame length in LLR bytes
+    void push(int modcod, bool shortFrames, const char *llr, int size);
+    void flush(); //!< Start decoding the incomplete batch
+    bool busy() const { return (int) m_batches.size() >= m_maxBatches; }
+    bool idle() const { return m_batches.empty(); }
+    bool dataAvailable() const;
+    const char *data() const; //!< Next decoded frame. Only valid if dataAvailable()
+    void pop();
+
+    void getStats(QList<LDPCModcodStats>& stats);
+
+private:
+    struct Decoder;
+
+    struct Batch
+    {
+        int m_modcod;
+        bool m_shortFrames;
+        int m_frameSize;
+        int m_nbFrames;
+        std::vector<char> m_frames;
+        WorkerPool::Ticket m_ticket;
+    };
+
+    int m_nbThreads;
+    int m_maxTrials;
+    int m_maxBatches;                           //!< Decoding or waiting to be read
+    WorkerPool m_pool;
+    std::unique_ptr<Batch> m_pending;           //!< Batch being filled
+    std::deque<std::unique_ptr<Batch>> m_batches;
+    int m_readIndex;                            //!< Next frame to read in the first batch
+    QMutex m_decodersMutex;
+    QHash<int, std::vector<Decoder*>> m_decoders; //!< Idle decoders keyed by MODCOD and frame size
+    QMutex m_statsMutex;
+    QHash<int, LDPCModcodStats> m_stats;
+
+    void decode(Batch *batch);
+    Decoder *acquireDecoder(int modcod, bool shortFrames);
+    void releaseDecoder(Decoder *decoder);
+    static int key(int modcod, bool shortFrames) { return (modcod << 1) | (shortFrames ? 1 : 0); }
+};
+
+#endif // INCLUDE_LDPCDECODERPOOL_H
@@ -44,9 +44,12 @@
 */
 
 #include <stdlib.h>
+#include <atomic>
 #include <deque>
 #include <bitset>
 
+#include <QDebug>
+
 #include "bch.h"
 #include "crc.h"
 #include "dvb.h"
@@ -65,7 +68,7 @@ typedef SSIZE_T ssize_t;
 #include "ldpctool/layered_decoder.h"
 #include "ldpctool/testbench.h"
 #include "ldpctool/algorithms.h"
-#include "ldpctool/ldpcworker.h"
+#include "ldpctool/ldpcdecoderpool.h"
 
 namespace leansdr
 {
@@ -3625,8 +3628,7 @@ struct s2_fecdec_helper : runnable
 template <typename SOFTBIT, typename SOFTBYTE>
 struct s2_fecdec_helper : runnable
 {
-    int batch_size;
-    int nhelpers;
+    int nhelpers;       // Number of decoding threads
     bool must_buffer;
     int max_trials;
 
@@ -3639,218 +3641,90 @@ struct s2_fecdec_helper : runnable
         pipebuf<int> *_errcount = nullptr
     ) :
         runnable(sch, "S2 fecdec io"),
-        batch_size(16),
         nhelpers(1),
         must_buffer(false),
         max_trials(8),
         in(_in),
         out(_out),
         bitcount(opt_writer(_bitcount, 1)),
-        errcount(opt_writer(_errcount, 1))
+        errcount(opt_writer(_errcount, 1)),
+        m_decoderPool(nullptr)
     {
         command = strdup(_command);
-
-        for (int mc = 0; mc < 32; ++mc) {
-            for (int sf = 0; sf < 2; ++sf) {
-                pools[mc][sf].procs = nullptr;
-            }
-        }
     }
 
     ~s2_fecdec_helper()
     {
         free(command);
-        killall(); // also deletes pools[mc][sf].procs if necessary
+        delete m_decoderPool.load();
     }
 
     void run()
     {
-        // Send work until all helpers block.
-        while (in.readable() >= 1 && !jobs.full())
-        {
-            if ((bbframe_q.size() != 0) && (out.writable() >= 1))
-            {
-                bbframe *pout = out.wr();
-                pout->pls = bbframe_q.front().pls;
-                std::copy(bbframe_q.front().bytes, bbframe_q.front().bytes + (58192 / 8), pout->bytes);
-                bbframe_q.pop_front();
-                out.written(1);
-            }
-
-            if ((bitcount_q.size() != 0) && opt_writable(bitcount, 1))
-            {
-                opt_write(bitcount, bitcount_q.front());
-                bitcount_q.pop_front();
-            }
-
-            if ((errcount_q.size() != 0) && opt_writable(errcount, 1))
-            {
-                opt_write(errcount, errcount_q.front());
-                errcount_q.pop_front();
-            }
-
-            if (!jobs.empty() && jobs.peek()->h->b_out) {
-                receive_frame(jobs.get());
-            }
-
-            send_frame(in.rd());
-            in.read(1);
-        }
-    }
-
-  private:
-    struct helper_instance
-    {
-        QThread *m_thread;
-        LDPCWorker *m_worker;
-        int batch_size;
-        int b_in;       // Jobs in input queue
-        int b_out;      // Jobs in output queue
-    };
-    struct pool
-    {
-        helper_instance *procs; // nullptr or [nprocs]
-        int nprocs;
-        int shift;
-    } pools[32][2]; // [modcod][sf]
-    struct helper_job
-    {
-        s2_pls pls;
-        helper_instance *h;
-    };
-
-    simplequeue<helper_job, 1024> jobs;
-
-    // Try to send a frame. Return false if helper was busy.
-    bool send_frame(fecframe<SOFTBYTE> *pin)
-    {
-        pool *p = get_pool(&pin->pls);
+        // Threads are started on first use as parameters are set after construction
+        LDPCDecoderPool *decoderPool = m_decoderPool.load(std::memory_order_acquire);
 
-        for (int j = 0; j < p->nprocs; ++j)
+        if (!decoderPool)
         {
-            int i = (p->shift + j) % p->nprocs;
-            helper_instance *h = &p->procs[i];
-            int iosize = (pin->pls.framebits() / 8) * sizeof(SOFTBYTE);
-
-            if (h->m_worker->busy()) {
-                continue;
-            }
-
-            QByteArray data((char *)pin->bytes, iosize);
-            QMetaObject::invokeMethod(h->m_worker, "process", Qt::QueuedConnection, Q_ARG(QByteArray, data));
-
-            p->shift = i;
-            helper_job *job = jobs.put();
-            job->pls = pin->pls;
-            job->h = h;
-            ++h->b_in;
-
-            if (h->b_in >= h->batch_size)
-            {
-                h->b_in -= h->batch_size;
-                h->b_out += h->batch_size;
-            }
-
-            return true; // done sent to worker
+            qDebug() << "s2_fecdec_helper: Starting" << nhelpers << "LDPC threads";
+            decoderPool = new LDPCDecoderPool(nhelpers, max_trials);
+            m_decoderPool.store(decoderPool, std::memory_order_release);
         }
 
-        fprintf(stderr, "s2_fecdec_helper::send_frame: WARNING: all %d workers were busy: modcod=%d sf=%d)\n",
-            p->nprocs, pin->pls.modcod, pin->pls.sf);
-        return false; // all workers were busy
-    }
-
-    // Return a pool of running helpers for a given modcod.
-    pool *get_pool(const s2_pls *pls)
-    {
-        pool *p = &pools[pls->modcod][pls->sf];
-
-        if (!p->procs)
+        // Output decoded frames in the order they were received
+        while (decoderPool->dataAvailable()
+            && (out.writable() >= 1) && opt_writable(bitcount, 1) && opt_writable(errcount, 1))
         {
-            fprintf(stderr, "s2_fecdec_helper::get_pool: allocate %d workers: modcod=%d sf=%d\n",
-                nhelpers, pls->modcod, pls->sf);
-            p->procs = new helper_instance[nhelpers];
-
-            for (int i = 0; i < nhelpers; ++i) {
-                spawn_helper(&p->procs[i], pls);
-            }
-
-            p->nprocs = nhelpers;
-            p->shift = 0;
+            receive_frame(jobs.front(), decoderPool->data());
+            jobs.pop_front();
+            decoderPool->pop();
         }
 
-        return p;
-    }
-
-    void killall()
-    {
-        qDebug() << "s2_fecdec_helper::killall";
-
-        for (int i = 0; i < 32; i++) // all MODCODs
+        // Send work until all threads are busy
+        while ((in.readable() >= 1) && !decoderPool->busy())
         {
-            for (int j = 0; j < 2; j++) // long and short frames
-            {
-                pool *p = &pools[i][j];
-
-                if (p->procs)
-                {
-                    for (int i = 0; i < p->nprocs; ++i)
-                    {
-                        helper_instance *h = &p->procs[i];
-                        h->m_thread->quit();
-                        h->m_thread->wait();
-                        delete h->m_thread;
-                        h->m_thread = nullptr;
-                        delete h->m_worker;
-                        h->m_worker = nullptr;
-                    }
-
-                    delete p->procs;
-                    p->procs = nullptr;
-                    p->nprocs = 0;
-                }
-            } // long and short frames
-        } // all MODCODs
-    }
+            fecframe<SOFTBYTE> *pin = in.rd();
+            int iosize = (pin->pls.framebits() / 8) * sizeof(SOFTBYTE);
+            decoderPool->push(pin->pls.modcod, pin->pls.sf, (const char *) pin->bytes, iosize);
+            jobs.push_back(pin->pls);
+            in.read(1);
+        }
 
-    // Spawn a helper thread.
-    void spawn_helper(helper_instance *h, const s2_pls *pls)
-    {
-        qDebug() << "s2_fecdec_helper: Spawning LDPC thread: modcod=" << pls->modcod << " sf=" << pls->sf;
-        h->m_thread = new QThread();
-        h->m_worker = new LDPCWorker(pls->modcod, max_trials, batch_size, pls->sf);
-        h->m_worker->moveToThread(h->m_thread);
-        h->batch_size = batch_size;
-        h->b_in = h->b_out = 0;
-        h->m_thread->start();
+        // Don't wait for a full SIMD batch while threads are idle
+        if ((in.readable() == 0) && decoderPool->idle()) {
+            decoderPool->flush();
+        }
     }
 
-    // Receive a finished job.
-    void receive_frame(const helper_job *job)
+    // May be called from another thread than run() when the scheduler is pipelined
+    void getLDPCStats(QList<LDPCModcodStats>& stats, int& nbThreads)
     {
-        // Read corrected frame from helper
-        const s2_pls *pls = &job->pls;
-        int iosize = (pls->framebits() / 8) * sizeof(ldpc_buf[0]);
+        LDPCDecoderPool *decoderPool = m_decoderPool.load(std::memory_order_acquire);
 
-        // Non blocking read - will do the next time if no adata is available
-        if (job->h->m_worker->dataAvailable())
+        if (decoderPool)
         {
-            QByteArray data = job->h->m_worker->data();
-            memcpy(ldpc_buf, data.data(), data.size());
+            decoderPool->getStats(stats);
+            nbThreads = decoderPool->getNbThreads();
         }
         else
         {
-            return;
+            nbThreads = 0;
         }
+    }
+
+  private:
+    // Decode BCH of a frame decoded by LDPC and output it
+    void receive_frame(const s2_pls& pls, const char *data)
+    {
+        int iosize = (pls.framebits() / 8) * sizeof(ldpc_buf[0]);
+        memcpy(ldpc_buf, data, iosize);
 
-        --job->h->b_out;
         // Decode BCH.
-        const modcod_info *mcinfo = check_modcod(job->pls.modcod);
-        const fec_info *fi = &fec_infos[job->pls.sf][mcinfo->rate];
+        const modcod_info *mcinfo = check_modcod(pls.modcod);
+        const fec_info *fi = &fec_infos[pls.sf][mcinfo->rate];
         uint8_t *hardbytes = softbytes_harden(ldpc_buf, fi->kldpc / 8, bch_buf);
         size_t cwbytes = fi->kldpc / 8;
-        //size_t msgbytes = fi->Kbch / 8;
-        //size_t chkbytes = cwbytes - msgbytes;
-        bch_interface *bch = s2bch.bchs[job->pls.sf][mcinfo->rate];
+        bch_interface *bch = s2bch.bchs[pls.sf][mcinfo->rate];
         int ncorr = bch->decode(hardbytes, cwbytes);
 
         if (sch->debug2) {
@@ -3859,25 +3733,16 @@ struct s2_fecdec_helper : runnable
 
         bool corrupted = (ncorr < 0);
         // Report VBER
-        bitcount_q.push_back(fi->Kbch);
-        //opt_write(bitcount, fi->Kbch);
-        errcount_q.push_front((ncorr >= 0) ? ncorr : fi->Kbch);
-        //opt_write(errcount, (ncorr >= 0) ? ncorr : fi->Kbch);
-#if 0
-      // TBD Some decoders want the bad packets.
-	if ( corrupted ) {
-	  fprintf(stderr, "Passing bad frame\n");
-	  corrupted = false;
-	}
-#endif
+        opt_write(bitcount, fi->Kbch);
+        opt_write(errcount, (ncorr >= 0) ? ncorr : fi->Kbch);
+
         if (!corrupted)
         {
             // Descramble and output
-            bbframe_q.emplace_back();
-            //bbframe *pout = out.wr();
-            bbframe_q.back().pls = job->pls;
-            bbscrambling.transform(hardbytes, fi->Kbch / 8, bbframe_q.back().bytes);
-            //out.written(1);
+            bbframe *pout = out.wr();
+            pout->pls = pls;
+            bbscrambling.transform(hardbytes, fi->Kbch / 8, pout->bytes);
+            out.written(1);
         }
 
         if (sch->debug) {
@@ -3892,10 +3757,9 @@ struct s2_fecdec_helper : runnable
     uint8_t bch_buf[64800 / 8]; // Temp storage for hardening before BCH
     s2_bch_engines s2bch;
     s2_bbscrambling bbscrambling;
-    std::deque<bbframe> bbframe_q;
-    std::deque<int> bitcount_q;
-    std::deque<int> errcount_q;
+    std::deque<s2_pls> jobs;    // Frames being decoded
     pipewriter<int> *bitcount, *errcount;
+    std::atomic<LDPCDecoderPool*> m_decoderPool;
 }; // s2_fecdec_helper
 
 #endif // USE_LDPC_TOOL
@@ -1,3 +1,8 @@
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "framework.h"
 
 namespace leansdr
@@ -11,4 +16,122 @@ void fail(const char *s) {
     fprintf(stderr, "** %s\n", s);
 }
 
+struct scheduler_threads
+{
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<unsigned long long> notifications; // per stage
+    std::atomic<bool> stopping;
+};
+
+scheduler::~scheduler()
+{
+    stop();
+
+    for (auto bridge : bridges) {
+        delete bridge;
+    }
+}
+
+void scheduler::start()
+{
+    if (threads || (nstages < 2)) {
+        return;
+    }
+
+    threads = new scheduler_threads();
+    threads->notifications.assign(nstages, 0);
+    threads->stopping = false;
+
+    for (int s = 1; s < nstages; ++s) {
+        threads->threads.emplace_back(&scheduler::stage_loop, this, s);
+    }
+}
+
+void scheduler::stop()
+{
+    if (!threads) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(threads->mutex);
+        threads->stopping = true;
+    }
+
+    threads->cond.notify_all();
+
+    for (auto& thread : threads->threads) {
+        thread.join();
+    }
+
+    delete threads;
+    threads = nullptr;
+}
+
+void scheduler::notify(int s)
+{
+    if (!threads) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(threads->mutex);
+        threads->notifications[s]++;
+    }
+
+    threads->cond.notify_all();
+}
+
+unsigned long long scheduler::notifications(int s)
+{
+    if (!threads) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(threads->mutex);
+    return threads->notifications[s];
+}
+
+bool scheduler::wait(int s, unsigned long long seen, int timeout_ms)
+{
+    if (!threads) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(threads->mutex);
+    threads->cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this, s, seen]() {
+        return threads->stopping || (threads->notifications[s] != seen);
+    });
+
+    return !threads->stopping;
+}
+
+// Run the runnables of a stage until fixpoint then sleep until another stage hands over data
+void scheduler::stage_loop(int s)
+{
+    unsigned long long prev_hash = 0;
+
+    while (!threads->stopping)
+    {
+        unsigned long long seen = notifications(s);
+
+        for (int i = 0; i < nrunnables; ++i)
+        {
+            if (runnable_stages[i] == s) {
+                runnables[i]->run();
+            }
+        }
+
+        unsigned long long h = hash(s);
+
+        if (h == prev_hash) {
+            wait(s, seen, 100);
+        }
+
+        prev_hash = h;
+    }
+}
+
 } // leansdr
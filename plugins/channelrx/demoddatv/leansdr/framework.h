@@ -19,6 +19,8 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include <math.h>
 #include <stdint.h>
@@ -45,6 +47,7 @@ void fail(const char *s);
 // [pipereader] is a client-side hook reading from a [pipebuf].
 // [runnable] is anything that moves data between [pipebufs].
 // [scheduler] is a global context which invokes [runnables] until fixpoint.
+// [pipebridge] connects [runnables] of different stages of a pipelined [scheduler].
 
 static const int MAX_PIPES = 64;
 static const int MAX_RUNNABLES = 64;
@@ -103,14 +106,35 @@ struct window_placement
     int x, y, w, h;
 };
 
+struct pipebridge_common
+{
+    virtual ~pipebridge_common() {
+    }
+};
+
+template <typename T>
+struct pipebuf;
+
+struct scheduler_threads;
+
 struct scheduler
 {
     pipebuf_common *pipes[MAX_PIPES];
+    int pipe_stages[MAX_PIPES];
     int npipes;
     runnable_common *runnables[MAX_RUNNABLES];
+    int runnable_stages[MAX_RUNNABLES];
     int nrunnables;
     window_placement *windows;
     bool verbose, debug, debug2;
+    // Pipelined mode: pipes and runnables added after set_stage(n) belong to stage n.
+    // Once started stage 0 is run by step() and each other stage by its own thread.
+    // A pipe must only be accessed by runnables of its own stage. Use bridge() to
+    // pass data from a stage to another.
+    int stage;
+    int nstages;
+    std::vector<pipebridge_common*> bridges;
+    scheduler_threads *threads;
 
     scheduler() :
         npipes(0),
@@ -118,16 +142,22 @@ struct scheduler
         windows(nullptr),
         verbose(false),
         debug(false),
-        debug2(false)
+        debug2(false),
+        stage(0),
+        nstages(1),
+        threads(nullptr)
     {
     }
 
+    ~scheduler();
+
     void add_pipe(pipebuf_common *p)
     {
         if (npipes == MAX_PIPES) {
             fail("MAX_PIPES");
         }
 
+        pipe_stages[npipes] = stage;
         pipes[npipes++] = p;
     }
 
@@ -137,13 +167,36 @@ struct scheduler
             fail("MAX_RUNNABLES");
         }
 
+        runnable_stages[nrunnables] = stage;
         runnables[nrunnables++] = r;
     }
 
+    void set_stage(int s)
+    {
+        stage = s;
+
+        if (s >= nstages) {
+            nstages = s + 1;
+        }
+    }
+
+    // Return a pipe of stage to_stage that receives what is written to from
+    // in the current stage. The current stage becomes to_stage.
+    template <typename T>
+    pipebuf<T> *bridge(pipebuf<T> &from, int to_stage, const char *name, unsigned long size);
+
+    // Start one thread per stage above 0. Does nothing if not pipelined.
+    void start();
+    // Stop the threads. Any later step() runs all stages.
+    void stop();
+
     void step()
     {
-        for (int i = 0; i < nrunnables; ++i) {
-            runnables[i]->run();
+        for (int i = 0; i < nrunnables; ++i)
+        {
+            if (!threads || (runnable_stages[i] == 0)) {
+                runnables[i]->run();
+            }
         }
     }
 
@@ -154,7 +207,7 @@ struct scheduler
         while (1)
         {
             step();
-            unsigned long long h = hash();
+            unsigned long long h = threads ? hash(0) : hash();
 
             if (h == prev_hash) {
                 break;
@@ -166,6 +219,8 @@ struct scheduler
 
     void shutdown()
     {
+        stop();
+
         for (int i = 0; i < nrunnables; ++i) {
             runnables[i]->shutdown();
         }
@@ -182,6 +237,28 @@ struct scheduler
         return h;
     }
 
+    unsigned long long hash(int s)
+    {
+        unsigned long long h = 0;
+
+        for (int i = 0; i < npipes; ++i)
+        {
+            if (pipe_stages[i] == s) {
+                h += (1 + i) * pipes[i]->hash();
+            }
+        }
+
+        return h;
+    }
+
+    // Wake up stage s
+    void notify(int s);
+    // Number of times stage s was notified
+    unsigned long long notifications(int s);
+    // Wait at most timeout_ms for stage s to be notified past seen.
+    // Returns false if the threads are stopping or not running.
+    bool wait(int s, unsigned long long seen, int timeout_ms);
+
     void dump()
     {
         fprintf(stderr, "\n");
@@ -194,6 +271,9 @@ struct scheduler
         fprintf(stderr, "Total buffer memory: %ld KiB\n",
                 (unsigned long)total_bufs / 1024);
     }
+
+  private:
+    void stage_loop(int s);
 };
 
 struct runnable : runnable_common
@@ -423,6 +503,151 @@ struct pipereader
     }
 };
 
+// [pipebridge] hands items over from a pipe of a stage to a pipe of another
+// stage through a single producer single consumer ring buffer. Only the
+// read and write counts are shared between the two threads.
+
+template <typename T>
+struct pipebridge : pipebridge_common
+{
+    static const int MAX_WAITS = 10; // Of 10 ms when the ring is full
+
+    struct input : runnable
+    {
+        input(scheduler *_sch, pipebuf<T> &_in, pipebridge<T> *_bridge) :
+            runnable(_sch, "bridge input"),
+            in(_in),
+            bridge(_bridge)
+        {
+        }
+
+        void run()
+        {
+            int waits = 0;
+
+            while (in.readable() > 0)
+            {
+                unsigned long long seen = sch->notifications(bridge->from_stage);
+                unsigned long n = bridge->push(in.rd(), in.readable());
+
+                if (n > 0)
+                {
+                    in.read(n);
+                    sch->notify(bridge->to_stage);
+                    continue;
+                }
+
+                // Ring is full: give the next stage some time to catch up but never
+                // block this stage for long or its own input pipes would overflow
+                if ((waits++ == MAX_WAITS) || !sch->wait(bridge->from_stage, seen, 10))
+                {
+                    fprintf(stderr, "pipebridge: %s: next stage too slow: dropped %ld items\n",
+                        bridge->out_buf->name, in.readable());
+                    bridge->dropped += in.readable();
+                    in.read(in.readable());
+                }
+            }
+        }
+
+        pipereader<T> in;
+        pipebridge<T> *bridge;
+    };
+
+    struct output : runnable
+    {
+        output(scheduler *_sch, pipebuf<T> &_out, pipebridge<T> *_bridge) :
+            runnable(_sch, "bridge output"),
+            out(_out),
+            bridge(_bridge)
+        {
+        }
+
+        void run()
+        {
+            unsigned long n = bridge->pop(out.wr(), out.writable());
+
+            if (n > 0)
+            {
+                out.written(n);
+                sch->notify(bridge->from_stage);
+            }
+        }
+
+        pipewriter<T> out;
+        pipebridge<T> *bridge;
+    };
+
+    pipebridge(scheduler *sch, pipebuf<T> &from, int _to_stage, const char *name, unsigned long _size) :
+        from_stage(sch->stage),
+        to_stage(_to_stage),
+        size(_size),
+        ring(new T[_size]),
+        head(0),
+        tail(0),
+        dropped(0)
+    {
+        in = new input(sch, from, this);
+        sch->set_stage(to_stage);
+        out_buf = new pipebuf<T>(sch, name, size);
+        out = new output(sch, *out_buf, this);
+    }
+
+    ~pipebridge()
+    {
+        delete out;
+        delete out_buf;
+        delete in;
+        delete[] ring;
+    }
+
+    // Producer side. Returns the number of items copied.
+    unsigned long push(const T *items, unsigned long n)
+    {
+        unsigned long long h = head.load(std::memory_order_relaxed);
+        unsigned long long t = tail.load(std::memory_order_acquire);
+        n = std::min(n, size - (unsigned long) (h - t));
+        unsigned long start = h % size;
+        unsigned long first = std::min(n, size - start);
+        std::copy(items, items + first, ring + start);
+        std::copy(items + first, items + n, ring);
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+
+    // Consumer side. Returns the number of items copied.
+    unsigned long pop(T *items, unsigned long n)
+    {
+        unsigned long long t = tail.load(std::memory_order_relaxed);
+        unsigned long long h = head.load(std::memory_order_acquire);
+        n = std::min(n, (unsigned long) (h - t));
+        unsigned long start = t % size;
+        unsigned long first = std::min(n, size - start);
+        std::copy(ring + start, ring + start + first, items);
+        std::copy(ring, ring + (n - first), items + first);
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    int from_stage;
+    int to_stage;
+    unsigned long size;
+    T *ring;
+    std::atomic<unsigned long long> head; // Items written to the ring
+    std::atomic<unsigned long long> tail; // Items read from the ring
+    unsigned long long dropped;
+    input *in;
+    pipebuf<T> *out_buf;
+    output *out;
+};
+
+template <typename T>
+pipebuf<T> *scheduler::bridge(pipebuf<T> &from, int to_stage, const char *name, unsigned long size)
+{
+    pipebridge<T> *b = new pipebridge<T>(this, from, to_stage, name, size);
+    bridges.push_back(b);
+    return b->out_buf;
+}
+
 // Math functions for templates
 
 template <typename T>
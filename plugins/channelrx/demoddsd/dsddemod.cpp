@@ -198,6 +198,11 @@ void DSDDemod::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *DSDDemod::getInputSampleFifo()
+{
+    return m_running ? m_basebandSink->getSampleFifo() : nullptr;
+}
+
 bool DSDDemod::handleMessage(const Message& cmd)
 {
 	qDebug() << "DSDDemod::handleMessage";
@@ -75,6 +75,7 @@ public:
     const char *updateAndGetStatusText() { return m_sink.updateAndGetStatusText(); }
     void setChannel(ChannelAPI *channel);
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
     void setAudioFifoLabel(const QString& label) { m_sink.setAudioFifoLabel(label); }
     void setAMBEFeature(Feature *ambeFeature) { m_sink.setAmbeFeature(ambeFeature); }
 
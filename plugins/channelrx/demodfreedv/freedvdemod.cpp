@@ -137,6 +137,11 @@ void FreeDVDemod::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *FreeDVDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool FreeDVDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureFreeDVDemod::match(cmd))
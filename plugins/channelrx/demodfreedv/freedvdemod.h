@@ -107,6 +107,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     int getAudioSampleRate() const { return m_basebandSink->getAudioSampleRate(); }
     uint32_t getModemSampleRate() const { return m_basebandSink->getModemSampleRate(); }
     double getMagSq() const { return m_basebandSink->getMagSq(); }
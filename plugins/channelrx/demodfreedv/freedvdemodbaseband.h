@@ -90,6 +90,7 @@ public:
 	float getFrequencyOffset() const { return m_sink.getFrequencyOffset(); }
 	bool isSync() const { return m_sink.isSync(); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
     void setAudioFifoLabel(const QString& label) { m_sink.setAudioFifoLabel(label); }
 
 signals:
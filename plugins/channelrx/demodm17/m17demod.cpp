@@ -142,6 +142,11 @@ void M17Demod::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *M17Demod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool M17Demod::handleMessage(const Message& cmd)
 {
 	qDebug() << "M17Demod::handleMessage";
@@ -35,6 +35,7 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "dsp/devicesamplemimo.h"
+#include "dsp/polyphasechannelizer.h"
 #include "device/deviceapi.h"
 #include "feature/feature.h"
 #include "settings/serializable.h"
@@ -54,7 +55,10 @@ NFMDemod::NFMDemod(DeviceAPI *devieAPI) :
         ChannelAPI(m_channelIdURI, ChannelAPI::StreamSingleSink),
         m_deviceAPI(devieAPI),
         m_running(false),
-        m_basebandSampleRate(0)
+        m_basebandSampleRate(0),
+        m_nbSubbands(0),
+        m_subbandIndex(-1),
+        m_sharedFifo(false)
 {
     qDebug("NFMDemod::NFMDemod");
 	setObjectName(m_channelId);
@@ -76,6 +80,12 @@ NFMDemod::NFMDemod(DeviceAPI *devieAPI) :
         this,
         &NFMDemod::handleIndexInDeviceSetChanged
     );
+    QObject::connect(
+        m_deviceAPI,
+        &DeviceAPI::sharedBasebandFifoChanged,
+        this,
+        &NFMDemod::updateSharedFifo
+    );
 
     start();
 }
@@ -101,9 +111,32 @@ void NFMDemod::setDeviceAPI(DeviceAPI *deviceAPI)
     {
         m_deviceAPI->removeChannelSinkAPI(this);
         m_deviceAPI->removeChannelSink(this);
+        QObject::disconnect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &NFMDemod::updateSharedFifo
+        );
         m_deviceAPI = deviceAPI;
         m_deviceAPI->addChannelSink(this);
         m_deviceAPI->addChannelSinkAPI(this);
+        QObject::connect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &NFMDemod::updateSharedFifo
+        );
+        m_nbSubbands = 0;
+        m_subbandIndex = -1;
+        m_sharedFifo = false;
+
+        if (m_running)
+        {
+            m_basebandSink->setSharedFifo(nullptr);
+            m_basebandSink->setSubband(0, -1);
+        }
+
+        updateSubband(m_settings);
     }
 }
 
@@ -125,7 +158,6 @@ void NFMDemod::start()
     }
 
     qDebug() << "NFMDemod::start";
-    m_thread = new QThread();
     m_basebandSink = new NFMDemodBaseband();
     m_basebandSink->setFifoLabel(QString("%1 [%2:%3]")
         .arg(m_channelId)
@@ -133,26 +165,45 @@ void NFMDemod::start()
         .arg(getIndexInDeviceSet())
     );
     m_basebandSink->setChannel(this);
-    m_basebandSink->moveToThread(m_thread);
 
-    QObject::connect(
-        m_thread,
-        &QThread::finished,
-        m_basebandSink,
-        &QObject::deleteLater
-    );
-    QObject::connect(
-        m_thread,
-        &QThread::finished,
-        m_thread,
-        &QThread::deleteLater
-    );
+    if (DSPEngine::instance()->getDSPScheduler()) // baseband is run by the DSP scheduler workers
+    {
+        m_thread = nullptr;
+    }
+    else
+    {
+        m_thread = new QThread();
+        m_basebandSink->moveToThread(m_thread);
+
+        QObject::connect(
+            m_thread,
+            &QThread::finished,
+            m_basebandSink,
+            &QObject::deleteLater
+        );
+        QObject::connect(
+            m_thread,
+            &QThread::finished,
+            m_thread,
+            &QThread::deleteLater
+        );
+    }
 
     if (m_basebandSampleRate != 0) {
         m_basebandSink->setBasebandSampleRate(m_basebandSampleRate);
     }
 
-    m_thread->start();
+    if (m_subbandIndex >= 0) {
+        m_basebandSink->setSubband(m_nbSubbands, m_subbandIndex);
+    }
+
+    if (m_sharedFifo) {
+        m_basebandSink->setSharedFifo(m_deviceAPI->getBasebandFifo());
+    }
+
+    if (m_thread) {
+        m_thread->start();
+    }
 
     NFMDemodBaseband::MsgConfigureNFMDemodBaseband *msg = NFMDemodBaseband::MsgConfigureNFMDemodBaseband::create(m_settings, true);
     m_basebandSink->getInputMessageQueue()->push(msg);
@@ -168,8 +219,32 @@ void NFMDemod::stop()
 
     qDebug() << "NFMDemod::stop";
     m_running = false;
-	m_thread->quit();
-	m_thread->wait();
+
+    if (m_thread)
+    {
+        m_thread->quit();
+        m_thread->wait();
+    }
+    else
+    {
+        delete m_basebandSink;
+    }
+}
+
+bool NFMDemod::getInputFifoStats(InputFifoStats& stats)
+{
+    stats.m_subband = m_subbandIndex >= 0;
+
+    if (m_running && m_sharedFifo) {
+        return m_basebandSink->getSharedFifoStats(stats.m_size, stats.m_fill, stats.m_overflowCount, stats.m_droppedSamples, stats.m_readPosition);
+    }
+
+    return ChannelAPI::getInputFifoStats(stats);
+}
+
+SampleSinkFifo *NFMDemod::getInputSampleFifo()
+{
+    return m_running ? m_basebandSink->getSampleFifo() : nullptr;
 }
 
 bool NFMDemod::handleMessage(const Message& cmd)
@@ -193,6 +268,8 @@ bool NFMDemod::handleMessage(const Message& cmd)
             m_basebandSink->getInputMessageQueue()->push(new DSPSignalNotification(notif));
         }
 
+        updateSubband(m_settings);
+
         // Forward to GUI if any
         if (getMessageQueueToGUI()) {
             getMessageQueueToGUI()->push(new DSPSignalNotification(notif));
@@ -213,6 +290,56 @@ bool NFMDemod::handleMessage(const Message& cmd)
 	}
 }
 
+void NFMDemod::updateSubband(const NFMDemodSettings& settings)
+{
+    // Attach to a device polyphase channelizer sub-band when available and when the channel fits in one
+    unsigned int nbSubbands = m_deviceAPI->getPolyphaseSubbands();
+    int subbandIndex = PolyphaseChannelizer::getSubbandIndex(
+        nbSubbands,
+        m_basebandSampleRate,
+        settings.m_inputFrequencyOffset,
+        settings.m_rfBandwidth
+    );
+
+    if (subbandIndex < 0) {
+        nbSubbands = 0;
+    }
+
+    if ((subbandIndex != m_subbandIndex) || (nbSubbands != m_nbSubbands))
+    {
+        qDebug("NFMDemod::updateSubband: sub-band: %d/%u", subbandIndex, nbSubbands);
+        m_nbSubbands = nbSubbands;
+        m_subbandIndex = subbandIndex;
+
+        if (m_running) {
+            m_basebandSink->setSubband(nbSubbands, subbandIndex);
+        }
+
+        m_deviceAPI->setChannelSinkSubband(this, subbandIndex);
+    }
+
+    updateSharedFifo();
+}
+
+void NFMDemod::updateSharedFifo()
+{
+    // Read the baseband in place from the device shared FIFO when enabled unless fed from a sub-band
+    SampleSinkMultiReaderFifo *basebandFifo = m_deviceAPI->getBasebandFifo();
+    bool sharedFifo = (m_subbandIndex < 0) && (basebandFifo != nullptr);
+
+    if (sharedFifo == m_sharedFifo) {
+        return;
+    }
+
+    if (m_running && !m_basebandSink->setSharedFifo(sharedFifo ? basebandFifo : nullptr)) {
+        return; // keep being fed by the device engine
+    }
+
+    qDebug("NFMDemod::updateSharedFifo: %s", sharedFifo ? "shared" : "own");
+    m_sharedFifo = sharedFifo;
+    m_deviceAPI->setChannelSinkSharedFifo(this, sharedFifo);
+}
+
 void NFMDemod::setCenterFrequency(qint64 frequency)
 {
     NFMDemodSettings settings = m_settings;
@@ -314,6 +441,11 @@ void NFMDemod::applySettings(const NFMDemodSettings& settings, bool force)
         reverseAPIKeys.append("streamIndex");
     }
 
+    if ((settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset)
+     || (settings.m_rfBandwidth != m_settings.m_rfBandwidth) || force) {
+        updateSubband(settings);
+    }
+
     if (m_running)
     {
         NFMDemodBaseband::MsgConfigureNFMDemodBaseband *msg = NFMDemodBaseband::MsgConfigureNFMDemodBaseband::create(settings, force);
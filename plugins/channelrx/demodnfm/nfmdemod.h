@@ -93,6 +93,9 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+    virtual bool getInputFifoStats(InputFifoStats& stats);
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -141,6 +144,9 @@ private:
     bool m_running;
 	NFMDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
+    unsigned int m_nbSubbands; //!< device polyphase channelizer sub-bands
+    int m_subbandIndex;        //!< device polyphase channelizer sub-band in use or -1 for baseband
+    bool m_sharedFifo;         //!< baseband is read from the device shared FIFO
 
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
@@ -149,6 +155,8 @@ private:
 
 	virtual bool handleMessage(const Message& cmd);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
+    void updateSubband(const NFMDemodSettings& settings);
+    void updateSharedFifo();
     void sendSampleRateToDemodAnalyzer();
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const NFMDemodSettings& settings, bool force);
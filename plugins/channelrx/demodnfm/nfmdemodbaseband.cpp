@@ -25,34 +25,71 @@
 MESSAGE_CLASS_DEFINITION(NFMDemodBaseband::MsgConfigureNFMDemodBaseband, Message)
 
 NFMDemodBaseband::NFMDemodBaseband() :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReader(-1),
     m_channelizer(&m_sink)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
 
     qDebug("NFMDemodBaseband::NFMDemodBaseband");
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        this,
-        &NFMDemodBaseband::handleData,
-        Qt::QueuedConnection
-    );
+    DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+    if (dspScheduler) // data is handled by the DSP scheduler workers instead of this object thread
+    {
+        m_dataTask = dspScheduler->createTask([this]() { handleData(); });
+        m_sharedDataTask = dspScheduler->createTask([this]() { handleSharedFifoData(); });
+        m_messageTask = dspScheduler->createTask([this]() { handleInputMessages(); });
+        m_sampleFifo.setTask(m_dataTask);
+    }
+    else
+    {
+        QObject::connect(
+            &m_sampleFifo,
+            &SampleSinkFifo::dataReady,
+            this,
+            &NFMDemodBaseband::handleData,
+            Qt::QueuedConnection
+        );
+    }
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
     m_channelSampleRate = 0;
 
-    QObject::connect(
-        &m_inputMessageQueue,
-        &MessageQueue::messageEnqueued,
-        this,
-        &NFMDemodBaseband::handleInputMessages,
-        Qt::QueuedConnection
-    );
+    if (m_messageTask)
+    {
+        QObject::connect(
+            &m_inputMessageQueue,
+            &MessageQueue::messageEnqueued,
+            this,
+            &NFMDemodBaseband::scheduleInputMessages,
+            Qt::DirectConnection
+        );
+    }
+    else
+    {
+        QObject::connect(
+            &m_inputMessageQueue,
+            &MessageQueue::messageEnqueued,
+            this,
+            &NFMDemodBaseband::handleInputMessages,
+            Qt::QueuedConnection
+        );
+    }
 }
 
 NFMDemodBaseband::~NFMDemodBaseband()
 {
+    setSharedFifo(nullptr);
+    m_sampleFifo.setTask(nullptr);
+
+    if (m_dataTask) // not under m_mutex as the handlers take it
+    {
+        m_dataTask->disable();
+        m_sharedDataTask->disable();
+        m_messageTask->disable();
+    }
+
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
 }
 
@@ -100,6 +137,38 @@ void NFMDemodBaseband::handleData()
     }
 }
 
+void NFMDemodBaseband::handleSharedFifoData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReader) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::const_iterator part1begin;
+		SampleVector::const_iterator part1end;
+		SampleVector::const_iterator part2begin;
+		SampleVector::const_iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReader, m_sharedFifo->fill(m_sharedFifoReader), &part1begin, &part1end, &part2begin, &part2end);
+
+        // data is read in place from the device baseband. The writer does not overwrite it until committed
+        if (part1begin != part1end) {
+            m_channelizer.feed(part1begin, part1end);
+        }
+
+		if(part2begin != part2end) {
+            m_channelizer.feed(part2begin, part2end);
+        }
+
+		if (m_sharedFifo->readCommit(m_sharedFifoReader, (unsigned int) count) == 0) {
+            break; // nothing was read
+        }
+    }
+}
+
 void NFMDemodBaseband::handleInputMessages()
 {
 	Message* message;
@@ -112,6 +181,11 @@ void NFMDemodBaseband::handleInputMessages()
 	}
 }
 
+void NFMDemodBaseband::scheduleInputMessages()
+{
+    m_messageTask->schedule();
+}
+
 bool NFMDemodBaseband::handleMessage(const Message& cmd)
 {
     if (MsgConfigureNFMDemodBaseband::match(cmd))
@@ -194,3 +268,85 @@ void NFMDemodBaseband::setBasebandSampleRate(int sampleRate)
     m_channelizer.setBasebandSampleRate(sampleRate);
     m_sink.applyChannelSettings(m_channelizer.getChannelSampleRate(), m_channelizer.getChannelFrequencyOffset());
 }
+
+void NFMDemodBaseband::setSubband(unsigned int nbSubbands, int subbandIndex)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_sampleFifo.reset(); // samples in FIFO are from the previous input
+    m_channelizer.setSubband(nbSubbands, subbandIndex);
+    m_sink.applyChannelSettings(m_channelizer.getChannelSampleRate(), m_channelizer.getChannelFrequencyOffset());
+
+    if (m_channelSampleRate != m_channelizer.getChannelSampleRate())
+    {
+        m_sink.applyAudioSampleRate(m_sink.getAudioSampleRate()); // reapply when channel sample rate changes
+        m_channelSampleRate = m_channelizer.getChannelSampleRate();
+    }
+}
+
+bool NFMDemodBaseband::getSharedFifoStats(unsigned int& size, unsigned int& fill, quint64& overflowCount, quint64& droppedSamples, quint64& readPosition)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return false;
+    }
+
+    size = m_sharedFifo->size();
+    fill = m_sharedFifo->fill(m_sharedFifoReader);
+    overflowCount = m_sharedFifo->getOverflowCount(m_sharedFifoReader);
+    droppedSamples = m_sharedFifo->getDroppedCount(m_sharedFifoReader);
+    readPosition = m_sharedFifo->getReadPosition(m_sharedFifoReader);
+
+    return true;
+}
+
+bool NFMDemodBaseband::setSharedFifo(SampleSinkMultiReaderFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (sharedFifo == m_sharedFifo) {
+        return true;
+    }
+
+    if (m_sharedFifo)
+    {
+        QObject::disconnect(
+            m_sharedFifo,
+            &SampleSinkMultiReaderFifo::dataReady,
+            this,
+            &NFMDemodBaseband::handleSharedFifoData
+        );
+        m_sharedFifo->removeReader(m_sharedFifoReader);
+        m_sharedFifoReader = -1;
+    }
+
+    m_sharedFifo = sharedFifo;
+
+    if (m_sharedFifo)
+    {
+        m_sharedFifoReader = m_sharedFifo->addReader();
+
+        if (m_sharedFifoReader < 0)
+        {
+            m_sharedFifo = nullptr; // no more readers allowed: stay on own FIFO
+            return false;
+        }
+
+        if (m_sharedDataTask)
+        {
+            m_sharedFifo->setReaderTask(m_sharedFifoReader, m_sharedDataTask);
+        }
+        else
+        {
+            QObject::connect(
+                m_sharedFifo,
+                &SampleSinkMultiReaderFifo::dataReady,
+                this,
+                &NFMDemodBaseband::handleSharedFifoData,
+                Qt::QueuedConnection
+            );
+        }
+    }
+
+    return true;
+}
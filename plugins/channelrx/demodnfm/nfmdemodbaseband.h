@@ -22,6 +22,7 @@
 #include <QRecursiveMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkmultireaderfifo.h"
 #include "dsp/downchannelizer.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
@@ -69,25 +70,36 @@ public:
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_sink.setMessageQueueToGUI(messageQueue); }
     int getAudioSampleRate() const { return m_sink.getAudioSampleRate(); }
     void setBasebandSampleRate(int sampleRate);
+    void setSubband(unsigned int nbSubbands, int subbandIndex);
+    bool setSharedFifo(SampleSinkMultiReaderFifo *sharedFifo); //!< Read the baseband from the device shared FIFO (nullptr to use own FIFO). False if no reader slot is left
+    bool getSharedFifoStats(unsigned int& size, unsigned int& fill, quint64& overflowCount, quint64& droppedSamples, quint64& readPosition); //!< Statistics of the shared FIFO reader. False if not reading the shared FIFO
     void setChannel(ChannelAPI *channel);
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
     void setAudioFifoLabel(const QString& label) { m_sink.setAudioFifoLabel(label); }
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkMultiReaderFifo *m_sharedFifo;
+    int m_sharedFifoReader;
     DownChannelizer m_channelizer;
     int m_channelSampleRate;
     NFMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     NFMDemodSettings m_settings;
     QRecursiveMutex m_mutex;
+    DSPScheduler::TaskPtr m_dataTask;       //!< handleData() on the DSP scheduler if enabled
+    DSPScheduler::TaskPtr m_sharedDataTask; //!< handleSharedFifoData() on the DSP scheduler if enabled
+    DSPScheduler::TaskPtr m_messageTask;    //!< handleInputMessages() on the DSP scheduler if enabled
 
     bool handleMessage(const Message& cmd);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
 
 private slots:
     void handleInputMessages();
+    void scheduleInputMessages(); //!< Run handleInputMessages() on the DSP scheduler
     void handleData(); //!< Handle data when samples have to be processed
+    void handleSharedFifoData(); //!< Handle data when samples in the shared FIFO have to be processed
 };
 
 #endif // INCLUDE_NFMDEMODBASEBAND_H
@@ -82,41 +82,44 @@ void NFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
         return;
     }
 
-    for (SampleVector::const_iterator it = begin; it != end; ++it)
-    {
-        Complex c(it->real(), it->imag());
-        c *= m_nco.nextIQ();
+    unsigned int nbSamples = end - begin;
+
+    if (m_mixBuffer.size() < nbSamples) {
+        m_mixBuffer.resize(nbSamples);
+    }
 
-        Complex ci;
+    m_nco.mix(begin, end, m_mixBuffer.data());
+    m_channelBuffer.clear();
+
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
         fftfilt::cmplx *rf;
-        int rf_out = m_rfFilter.runFilt(c, &rf); // filter RF before demod
-        for (int i = 0 ; i < rf_out; i++)
-        {
-            if (m_interpolatorDistance == 1.0f)
-            {
-                processOneSample(rf[i]);
-            }
-            else if (m_interpolatorDistance < 1.0f) // interpolate
-            {
-                while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, rf[i], &ci))
-                {
-                    processOneSample(ci);
-                    m_interpolatorDistanceRemain += m_interpolatorDistance;
-                }
-            }
-            else // decimate
-            {
-                if (m_interpolator.decimate(&m_interpolatorDistanceRemain, rf[i], &ci))
-                {
-                    processOneSample(ci);
-                    m_interpolatorDistanceRemain += m_interpolatorDistance;
-                }
-            }
+        int rf_out = m_rfFilter.runFilt(m_mixBuffer[i], &rf); // filter RF before demod
+
+        if (rf_out == 0) {
+            continue;
+        }
+
+        if (m_interpolatorDistance == 1.0f) {
+            m_channelBuffer.insert(m_channelBuffer.end(), rf, rf + rf_out);
+        } else if (m_interpolatorDistance < 1.0f) { // interpolate
+            m_interpolator.interpolate(&m_interpolatorDistanceRemain, m_interpolatorDistance, rf, rf_out, m_channelBuffer);
+        } else { // decimate
+            m_interpolator.decimate(&m_interpolatorDistanceRemain, m_interpolatorDistance, rf, rf_out, m_channelBuffer);
         }
     }
+
+    feedBlock(m_channelBuffer.begin(), m_channelBuffer.end());
+}
+
+void NFMDemodSink::feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end)
+{
+    for (ComplexVector::const_iterator it = begin; it != end; ++it) {
+        processOneSample(*it);
+    }
 }
 
-void NFMDemodSink::processOneSample(Complex &ci)
+void NFMDemodSink::processOneSample(const Complex &ci)
 {
     qint16 sample = 0;
 
@@ -44,6 +44,7 @@ public:
     NFMDemodSink();
 
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    virtual void feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end);
 
     const Real *getCtcssToneSet(int& nbTones) const {
         nbTones = m_ctcssDetector.getNTones();
@@ -113,6 +114,8 @@ private:
     fftfilt m_rfFilter;
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
+    ComplexVector m_mixBuffer;     //!< baseband shifted to zero frequency
+    ComplexVector m_channelBuffer; //!< samples at channel processing rate
     Lowpass<Real> m_ctcssLowpass;
     Bandpass<Real> m_bandpass;
     Lowpass<Real> m_lowpass;
@@ -156,7 +159,7 @@ private:
         m_dcsCodeSeleted = dcsPositive ? dcsCode : DCSCodes::m_signFlip[dcsCode];
     }
 
-    void processOneSample(Complex &ci);
+    void processOneSample(const Complex &ci);
     MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
 };
 
@@ -51,19 +51,24 @@ const char * const PacketDemod::m_channelId = "PacketDemod";
 PacketDemod::PacketDemod(DeviceAPI *deviceAPI) :
         ChannelAPI(m_channelIdURI, ChannelAPI::StreamSingleSink),
         m_deviceAPI(deviceAPI),
-        m_basebandSampleRate(0)
+        m_basebandSampleRate(0),
+        m_sharedFifo(false)
 {
     setObjectName(m_channelId);
 
     m_basebandSink = new PacketDemodBaseband(this);
     m_basebandSink->setMessageQueueToChannel(getInputMessageQueue());
     m_basebandSink->setChannel(this);
-    m_basebandSink->moveToThread(&m_thread);
+
+    if (!DSPEngine::instance()->getDSPScheduler()) { // else baseband is run by the DSP scheduler workers
+        m_basebandSink->moveToThread(&m_thread);
+    }
 
     applySettings(m_settings, true);
 
     m_deviceAPI->addChannelSink(this);
     m_deviceAPI->addChannelSinkAPI(this);
+    updateSharedFifo();
 
     m_networkManager = new QNetworkAccessManager();
     QObject::connect(
@@ -78,6 +83,12 @@ PacketDemod::PacketDemod(DeviceAPI *deviceAPI) :
         this,
         &PacketDemod::handleIndexInDeviceSetChanged
     );
+    QObject::connect(
+        m_deviceAPI,
+        &DeviceAPI::sharedBasebandFifoChanged,
+        this,
+        &PacketDemod::updateSharedFifo
+    );
 }
 
 PacketDemod::~PacketDemod()
@@ -106,9 +117,28 @@ void PacketDemod::setDeviceAPI(DeviceAPI *deviceAPI)
     {
         m_deviceAPI->removeChannelSinkAPI(this);
         m_deviceAPI->removeChannelSink(this);
+        QObject::disconnect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &PacketDemod::updateSharedFifo
+        );
         m_deviceAPI = deviceAPI;
         m_deviceAPI->addChannelSink(this);
         m_deviceAPI->addChannelSinkAPI(this);
+        QObject::connect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &PacketDemod::updateSharedFifo
+        );
+        m_sharedFifo = false;
+
+        if (m_basebandSink->isRunning()) {
+            m_basebandSink->setSharedFifo(nullptr);
+        }
+
+        updateSharedFifo();
     }
 }
 
@@ -129,7 +159,14 @@ void PacketDemod::start()
 
     m_basebandSink->reset();
     m_basebandSink->startWork();
-    m_thread.start();
+
+    if (m_sharedFifo) {
+        m_basebandSink->setSharedFifo(m_deviceAPI->getBasebandFifo());
+    }
+
+    if (!DSPEngine::instance()->getDSPScheduler()) {
+        m_thread.start();
+    }
 
     DSPSignalNotification *dspMsg = new DSPSignalNotification(m_basebandSampleRate, m_centerFrequency);
     m_basebandSink->getInputMessageQueue()->push(dspMsg);
@@ -146,6 +183,39 @@ void PacketDemod::stop()
     m_thread.wait();
 }
 
+bool PacketDemod::getInputFifoStats(InputFifoStats& stats)
+{
+    if (m_basebandSink->isRunning() && m_sharedFifo) {
+        return m_basebandSink->getSharedFifoStats(stats.m_size, stats.m_fill, stats.m_overflowCount, stats.m_droppedSamples, stats.m_readPosition);
+    }
+
+    return ChannelAPI::getInputFifoStats(stats);
+}
+
+SampleSinkFifo *PacketDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
+void PacketDemod::updateSharedFifo()
+{
+    // Read the baseband in place from the device shared FIFO when enabled
+    SampleSinkMultiReaderFifo *basebandFifo = m_deviceAPI->getBasebandFifo();
+    bool sharedFifo = basebandFifo != nullptr;
+
+    if (sharedFifo == m_sharedFifo) {
+        return;
+    }
+
+    if (m_basebandSink->isRunning() && !m_basebandSink->setSharedFifo(sharedFifo ? basebandFifo : nullptr)) {
+        return; // keep being fed by the device engine
+    }
+
+    qDebug("PacketDemod::updateSharedFifo: %s", sharedFifo ? "shared" : "own");
+    m_sharedFifo = sharedFifo;
+    m_deviceAPI->setChannelSinkSharedFifo(this, sharedFifo);
+}
+
 bool PacketDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigurePacketDemod::match(cmd))
@@ -97,6 +97,9 @@ public:
         return 0;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+    virtual bool getInputFifoStats(InputFifoStats& stats);
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -146,6 +149,7 @@ private:
     PacketDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
     qint64 m_centerFrequency;
+    bool m_sharedFifo;        //!< baseband is read from the device shared FIFO
     QUdpSocket m_udpSocket;
     QFile m_logFile;
     QTextStream m_logStream;
@@ -155,6 +159,7 @@ private:
 
     virtual bool handleMessage(const Message& cmd);
     void applySettings(const PacketDemodSettings& settings, bool force = false);
+    void updateSharedFifo();
     void sendSampleRateToDemodAnalyzer();
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const PacketDemodSettings& settings, bool force);
     void webapiFormatChannelSettings(
@@ -27,6 +27,8 @@
 MESSAGE_CLASS_DEFINITION(PacketDemodBaseband::MsgConfigurePacketDemodBaseband, Message)
 
 PacketDemodBaseband::PacketDemodBaseband(PacketDemod *packetDemod) :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReader(-1),
     m_sink(packetDemod),
     m_running(false)
 {
@@ -34,10 +36,21 @@ PacketDemodBaseband::PacketDemodBaseband(PacketDemod *packetDemod) :
 
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+
+    DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+    if (dspScheduler) { // messages are handled by the DSP scheduler workers instead of this object thread
+        m_messageTask = dspScheduler->createTask([this]() { handleInputMessages(); });
+    }
 }
 
 PacketDemodBaseband::~PacketDemodBaseband()
 {
+    if (m_messageTask) { // not under m_mutex as the handler takes it
+        m_messageTask->disable();
+    }
+
+    setSharedFifo(nullptr);
     m_inputMessageQueue.clear();
 
     delete m_channelizer;
@@ -53,21 +66,58 @@ void PacketDemodBaseband::reset()
 void PacketDemodBaseband::startWork()
 {
     QMutexLocker mutexLocker(&m_mutex);
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        this,
-        &PacketDemodBaseband::handleData,
-        Qt::QueuedConnection
-    );
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+    if (dspScheduler) // data is handled by the DSP scheduler workers instead of this object thread
+    {
+        m_dataTask = dspScheduler->createTask([this]() { handleData(); });
+        m_sampleFifo.setTask(m_dataTask);
+    }
+    else
+    {
+        QObject::connect(
+            &m_sampleFifo,
+            &SampleSinkFifo::dataReady,
+            this,
+            &PacketDemodBaseband::handleData,
+            Qt::QueuedConnection
+        );
+    }
+
+    if (m_messageTask) {
+        connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(scheduleInputMessages()), Qt::DirectConnection);
+    } else {
+        connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    }
+
     m_running = true;
 }
 
 void PacketDemodBaseband::stopWork()
 {
+    if (m_dataTask) // before taking m_mutex as a running handleData() holds it
+    {
+        m_sampleFifo.setTask(nullptr);
+        m_dataTask->disable();
+        m_dataTask.reset();
+    }
+
+    setSharedFifo(nullptr); // shared FIFO data is not handled past this point
+
+    if (m_sharedDataTask)
+    {
+        m_sharedDataTask->disable();
+        m_sharedDataTask.reset();
+    }
+
     QMutexLocker mutexLocker(&m_mutex);
-    disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+
+    if (m_messageTask) {
+        disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(scheduleInputMessages()));
+    } else {
+        disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    }
+
     QObject::disconnect(
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
@@ -114,6 +164,38 @@ void PacketDemodBaseband::handleData()
     }
 }
 
+void PacketDemodBaseband::handleSharedFifoData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReader) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+        SampleVector::const_iterator part1begin;
+        SampleVector::const_iterator part1end;
+        SampleVector::const_iterator part2begin;
+        SampleVector::const_iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReader, m_sharedFifo->fill(m_sharedFifoReader), &part1begin, &part1end, &part2begin, &part2end);
+
+        // data is read in place from the device baseband. The writer does not overwrite it until committed
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+        if (part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+        if (m_sharedFifo->readCommit(m_sharedFifoReader, (unsigned int) count) == 0) {
+            break; // nothing was read
+        }
+    }
+}
+
 void PacketDemodBaseband::handleInputMessages()
 {
     Message* message;
@@ -126,6 +208,11 @@ void PacketDemodBaseband::handleInputMessages()
     }
 }
 
+void PacketDemodBaseband::scheduleInputMessages()
+{
+    m_messageTask->schedule();
+}
+
 bool PacketDemodBaseband::handleMessage(const Message& cmd)
 {
     if (MsgConfigurePacketDemodBaseband::match(cmd))
@@ -177,3 +264,77 @@ void PacketDemodBaseband::setBasebandSampleRate(int sampleRate)
     m_channelizer->setBasebandSampleRate(sampleRate);
     m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
 }
+
+bool PacketDemodBaseband::getSharedFifoStats(unsigned int& size, unsigned int& fill, quint64& overflowCount, quint64& droppedSamples, quint64& readPosition)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return false;
+    }
+
+    size = m_sharedFifo->size();
+    fill = m_sharedFifo->fill(m_sharedFifoReader);
+    overflowCount = m_sharedFifo->getOverflowCount(m_sharedFifoReader);
+    droppedSamples = m_sharedFifo->getDroppedCount(m_sharedFifoReader);
+    readPosition = m_sharedFifo->getReadPosition(m_sharedFifoReader);
+
+    return true;
+}
+
+bool PacketDemodBaseband::setSharedFifo(SampleSinkMultiReaderFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (sharedFifo == m_sharedFifo) {
+        return true;
+    }
+
+    if (m_sharedFifo)
+    {
+        QObject::disconnect(
+            m_sharedFifo,
+            &SampleSinkMultiReaderFifo::dataReady,
+            this,
+            &PacketDemodBaseband::handleSharedFifoData
+        );
+        m_sharedFifo->removeReader(m_sharedFifoReader);
+        m_sharedFifoReader = -1;
+    }
+
+    m_sharedFifo = sharedFifo;
+
+    if (m_sharedFifo)
+    {
+        m_sharedFifoReader = m_sharedFifo->addReader();
+
+        if (m_sharedFifoReader < 0)
+        {
+            m_sharedFifo = nullptr; // no more readers allowed: stay on own FIFO
+            return false;
+        }
+
+        DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+        if (dspScheduler)
+        {
+            if (!m_sharedDataTask) {
+                m_sharedDataTask = dspScheduler->createTask([this]() { handleSharedFifoData(); });
+            }
+
+            m_sharedFifo->setReaderTask(m_sharedFifoReader, m_sharedDataTask);
+        }
+        else
+        {
+            QObject::connect(
+                m_sharedFifo,
+                &SampleSinkMultiReaderFifo::dataReady,
+                this,
+                &PacketDemodBaseband::handleSharedFifoData,
+                Qt::QueuedConnection
+            );
+        }
+    }
+
+    return true;
+}
@@ -23,6 +23,7 @@
 #include <QRecursiveMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkmultireaderfifo.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -73,18 +74,26 @@ public:
     void setBasebandSampleRate(int sampleRate);
     int getChannelSampleRate() const;
     void setChannel(ChannelAPI *channel);
+    bool setSharedFifo(SampleSinkMultiReaderFifo *sharedFifo); //!< Read the baseband from the device shared FIFO (nullptr to use own FIFO). False if no reader slot is left
+    bool getSharedFifoStats(unsigned int& size, unsigned int& fill, quint64& overflowCount, quint64& droppedSamples, quint64& readPosition); //!< Statistics of the shared FIFO reader. False if not reading the shared FIFO
     double getMagSq() const { return m_sink.getMagSq(); }
     bool isRunning() const { return m_running; }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkMultiReaderFifo *m_sharedFifo;
+    int m_sharedFifoReader;
     DownChannelizer *m_channelizer;
     PacketDemodSink m_sink;
     MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     PacketDemodSettings m_settings;
     bool m_running;
     QRecursiveMutex m_mutex;
+    DSPScheduler::TaskPtr m_dataTask;       //!< handleData() on the DSP scheduler if enabled
+    DSPScheduler::TaskPtr m_sharedDataTask; //!< handleSharedFifoData() on the DSP scheduler if enabled
+    DSPScheduler::TaskPtr m_messageTask;    //!< handleInputMessages() on the DSP scheduler if enabled
 
     bool handleMessage(const Message& cmd);
     void calculateOffset(PacketDemodSink *sink);
@@ -92,7 +101,9 @@ private:
 
 private slots:
     void handleInputMessages();
+    void scheduleInputMessages(); //!< Run handleInputMessages() on the DSP scheduler
     void handleData(); //!< Handle data when samples have to be processed
+    void handleSharedFifoData(); //!< Handle data when samples in the shared FIFO have to be processed
 };
 
 #endif // INCLUDE_PACKETDEMODBASEBAND_H
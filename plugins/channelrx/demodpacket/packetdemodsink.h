@@ -46,6 +46,7 @@ public:
     ~PacketDemodSink();
 
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    virtual void feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end);
 
     void applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force = false);
     void applySettings(const PacketDemodSettings& settings, bool force = false);
@@ -94,6 +95,8 @@ private:
     Interpolator m_interpolator;
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
+    ComplexVector m_mixBuffer;     //!< baseband shifted to zero frequency
+    ComplexVector m_channelBuffer; //!< samples at channel processing rate
 
     double m_magsq;
     double m_magsqSum;
@@ -132,7 +135,7 @@ private:
     QVector<qint16> m_demodBuffer;
     int m_demodBufferFill;
 
-    void processOneSample(Complex &ci);
+    void processOneSample(const Complex &ci);
     MessageQueue *getMessageQueueToChannel() { return m_messageQueueToChannel; }
 };
 
@@ -37,6 +37,7 @@
 
 MESSAGE_CLASS_DEFINITION(PagerDemod::MsgConfigurePagerDemod, Message)
 MESSAGE_CLASS_DEFINITION(PagerDemod::MsgPagerMessage, Message)
+MESSAGE_POOL_DEFINITION(PagerDemod::MsgPagerMessage)
 
 const char * const PagerDemod::m_channelIdURI = "sdrangel.channel.pagerdemod";
 const char * const PagerDemod::m_channelId = "PagerDemod";
@@ -139,6 +140,11 @@ void PagerDemod::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *PagerDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool PagerDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigurePagerDemod::match(cmd))
@@ -31,6 +31,7 @@
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelapi.h"
 #include "util/message.h"
+#include "util/messagepool.h"
 
 #include "pagerdemodbaseband.h"
 #include "pagerdemodsettings.h"
@@ -67,6 +68,7 @@ public:
 
     class MsgPagerMessage : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_POOL_DECLARATION
 
     public:
         int getAddress() const { return m_address; }
@@ -152,6 +154,8 @@ public:
         return 0;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
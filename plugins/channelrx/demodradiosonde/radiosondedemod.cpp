@@ -143,6 +143,11 @@ void RadiosondeDemod::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *RadiosondeDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool RadiosondeDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureRadiosondeDemod::match(cmd))
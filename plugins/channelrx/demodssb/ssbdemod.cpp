@@ -54,7 +54,8 @@ SSBDemod::SSBDemod(DeviceAPI *deviceAPI) :
         m_deviceAPI(deviceAPI),
         m_running(false),
         m_spectrumVis(SDR_RX_SCALEF),
-        m_basebandSampleRate(0)
+        m_basebandSampleRate(0),
+        m_sharedFifo(false)
 {
 	setObjectName(m_channelId);
 
@@ -76,8 +77,15 @@ SSBDemod::SSBDemod(DeviceAPI *deviceAPI) :
         this,
         &SSBDemod::handleIndexInDeviceSetChanged
     );
+    QObject::connect(
+        m_deviceAPI,
+        &DeviceAPI::sharedBasebandFifoChanged,
+        this,
+        &SSBDemod::updateSharedFifo
+    );
 
     start();
+    updateSharedFifo();
 }
 
 SSBDemod::~SSBDemod()
@@ -101,9 +109,28 @@ void SSBDemod::setDeviceAPI(DeviceAPI *deviceAPI)
     {
         m_deviceAPI->removeChannelSinkAPI(this);
         m_deviceAPI->removeChannelSink(this);
+        QObject::disconnect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &SSBDemod::updateSharedFifo
+        );
         m_deviceAPI = deviceAPI;
         m_deviceAPI->addChannelSink(this);
         m_deviceAPI->addChannelSinkAPI(this);
+        QObject::connect(
+            m_deviceAPI,
+            &DeviceAPI::sharedBasebandFifoChanged,
+            this,
+            &SSBDemod::updateSharedFifo
+        );
+        m_sharedFifo = false;
+
+        if (m_running) {
+            m_basebandSink->setSharedFifo(nullptr);
+        }
+
+        updateSharedFifo();
     }
 }
 
@@ -130,7 +157,6 @@ void SSBDemod::start()
     }
 
     qDebug() << "SSBDemod::start";
-    m_thread = new QThread();
     m_basebandSink = new SSBDemodBaseband();
     m_basebandSink->setFifoLabel(QString("%1 [%2:%3]")
         .arg(m_channelId)
@@ -139,26 +165,41 @@ void SSBDemod::start()
     );
     m_basebandSink->setSpectrumSink(&m_spectrumVis);
     m_basebandSink->setChannel(this);
-    m_basebandSink->moveToThread(m_thread);
 
-    QObject::connect(
-        m_thread,
-        &QThread::finished,
-        m_basebandSink,
-        &QObject::deleteLater
-    );
-    QObject::connect(
-        m_thread,
-        &QThread::finished,
-        m_thread,
-        &QThread::deleteLater
-    );
+    if (DSPEngine::instance()->getDSPScheduler()) // baseband is run by the DSP scheduler workers
+    {
+        m_thread = nullptr;
+    }
+    else
+    {
+        m_thread = new QThread();
+        m_basebandSink->moveToThread(m_thread);
+
+        QObject::connect(
+            m_thread,
+            &QThread::finished,
+            m_basebandSink,
+            &QObject::deleteLater
+        );
+        QObject::connect(
+            m_thread,
+            &QThread::finished,
+            m_thread,
+            &QThread::deleteLater
+        );
+    }
 
     if (m_basebandSampleRate != 0) {
         m_basebandSink->setBasebandSampleRate(m_basebandSampleRate);
     }
 
-    m_thread->start();
+    if (m_sharedFifo) {
+        m_basebandSink->setSharedFifo(m_deviceAPI->getBasebandFifo());
+    }
+
+    if (m_thread) {
+        m_thread->start();
+    }
 
     SSBDemodBaseband::MsgConfigureSSBDemodBaseband *msg = SSBDemodBaseband::MsgConfigureSSBDemodBaseband::create(m_settings, true);
     m_basebandSink->getInputMessageQueue()->push(msg);
@@ -176,8 +217,30 @@ void SSBDemod::stop()
 
     qDebug() << "SSBDemod::stop";
     m_running = false;
-	m_thread->exit();
-	m_thread->wait();
+
+    if (m_thread)
+    {
+        m_thread->exit();
+        m_thread->wait();
+    }
+    else
+    {
+        delete m_basebandSink;
+    }
+}
+
+bool SSBDemod::getInputFifoStats(InputFifoStats& stats)
+{
+    if (m_running && m_sharedFifo) {
+        return m_basebandSink->getSharedFifoStats(stats.m_size, stats.m_fill, stats.m_overflowCount, stats.m_droppedSamples, stats.m_readPosition);
+    }
+
+    return ChannelAPI::getInputFifoStats(stats);
+}
+
+SampleSinkFifo *SSBDemod::getInputSampleFifo()
+{
+    return m_running ? m_basebandSink->getSampleFifo() : nullptr;
 }
 
 bool SSBDemod::handleMessage(const Message& cmd)
@@ -220,6 +283,25 @@ bool SSBDemod::handleMessage(const Message& cmd)
 	}
 }
 
+void SSBDemod::updateSharedFifo()
+{
+    // Read the baseband in place from the device shared FIFO when enabled
+    SampleSinkMultiReaderFifo *basebandFifo = m_deviceAPI->getBasebandFifo();
+    bool sharedFifo = basebandFifo != nullptr;
+
+    if (sharedFifo == m_sharedFifo) {
+        return;
+    }
+
+    if (m_running && !m_basebandSink->setSharedFifo(sharedFifo ? basebandFifo : nullptr)) {
+        return; // keep being fed by the device engine
+    }
+
+    qDebug("SSBDemod::updateSharedFifo: %s", sharedFifo ? "shared" : "own");
+    m_sharedFifo = sharedFifo;
+    m_deviceAPI->setChannelSinkSharedFifo(this, sharedFifo);
+}
+
 void SSBDemod::setCenterFrequency(qint64 frequency)
 {
     SSBDemodSettings settings = m_settings;
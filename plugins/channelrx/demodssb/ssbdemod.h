@@ -96,6 +96,9 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+    virtual bool getInputFifoStats(InputFifoStats& stats);
+
     void setMessageQueueToGUI(MessageQueue* queue) override {
         ChannelAPI::setMessageQueueToGUI(queue);
         m_basebandSink->setMessageQueueToGUI(queue);
@@ -148,12 +151,14 @@ private:
     SSBDemodSettings m_settings;
     SpectrumVis m_spectrumVis;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
+    bool m_sharedFifo;        //!< baseband is read from the device shared FIFO
 
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
 
 	virtual bool handleMessage(const Message& cmd);
 	void applySettings(const SSBDemodSettings& settings, bool force = false);
+    void updateSharedFifo();
     void sendSampleRateToDemodAnalyzer();
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const SSBDemodSettings& settings, bool force);
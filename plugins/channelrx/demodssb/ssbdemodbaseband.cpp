@@ -26,6 +26,8 @@
 MESSAGE_CLASS_DEFINITION(SSBDemodBaseband::MsgConfigureSSBDemodBaseband, Message)
 
 SSBDemodBaseband::SSBDemodBaseband() :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReader(-1),
     m_channelizer(&m_sink),
     m_messageQueueToGUI(nullptr),
     m_spectrumVis(nullptr)
@@ -33,24 +35,50 @@ SSBDemodBaseband::SSBDemodBaseband() :
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
 
     qDebug("SSBDemodBaseband::SSBDemodBaseband");
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        this,
-        &SSBDemodBaseband::handleData,
-        Qt::QueuedConnection
-    );
+    DSPScheduler *dspScheduler = DSPEngine::instance()->getDSPScheduler();
+
+    if (dspScheduler) // data is handled by the DSP scheduler workers instead of this object thread
+    {
+        m_dataTask = dspScheduler->createTask([this]() { handleData(); });
+        m_sharedDataTask = dspScheduler->createTask([this]() { handleSharedFifoData(); });
+        m_messageTask = dspScheduler->createTask([this]() { handleInputMessages(); });
+        m_sampleFifo.setTask(m_dataTask);
+    }
+    else
+    {
+        QObject::connect(
+            &m_sampleFifo,
+            &SampleSinkFifo::dataReady,
+            this,
+            &SSBDemodBaseband::handleData,
+            Qt::QueuedConnection
+        );
+    }
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate();
     m_sink.applyAudioSampleRate(m_audioSampleRate);
     m_channelSampleRate = 0;
 
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    if (m_messageTask) {
+        connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(scheduleInputMessages()), Qt::DirectConnection);
+    } else {
+        connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    }
 }
 
 SSBDemodBaseband::~SSBDemodBaseband()
 {
+    setSharedFifo(nullptr);
+    m_sampleFifo.setTask(nullptr);
+
+    if (m_dataTask) // not under m_mutex as the handlers take it
+    {
+        m_dataTask->disable();
+        m_sharedDataTask->disable();
+        m_messageTask->disable();
+    }
+
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
 }
 
@@ -99,6 +127,38 @@ void SSBDemodBaseband::handleData()
     }
 }
 
+void SSBDemodBaseband::handleSharedFifoData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReader) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+        SampleVector::const_iterator part1begin;
+        SampleVector::const_iterator part1end;
+        SampleVector::const_iterator part2begin;
+        SampleVector::const_iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReader, m_sharedFifo->fill(m_sharedFifoReader), &part1begin, &part1end, &part2begin, &part2end);
+
+        // data is read in place from the device baseband. The writer does not overwrite it until committed
+        if (part1begin != part1end) {
+            m_channelizer.feed(part1begin, part1end);
+        }
+
+        if (part2begin != part2end) {
+            m_channelizer.feed(part2begin, part2end);
+        }
+
+        if (m_sharedFifo->readCommit(m_sharedFifoReader, (unsigned int) count) == 0) {
+            break; // nothing was read
+        }
+    }
+}
+
 void SSBDemodBaseband::handleInputMessages()
 {
 	Message* message;
@@ -111,6 +171,11 @@ void SSBDemodBaseband::handleInputMessages()
 	}
 }
 
+void SSBDemodBaseband::scheduleInputMessages()
+{
+    m_messageTask->schedule();
+}
+
 bool SSBDemodBaseband::handleMessage(const Message& cmd)
 {
     if (MsgConfigureSSBDemodBaseband::match(cmd))
@@ -213,3 +278,71 @@ void SSBDemodBaseband::setBasebandSampleRate(int sampleRate)
     m_channelizer.setBasebandSampleRate(sampleRate);
     m_sink.applyChannelSettings(m_channelizer.getChannelSampleRate(), m_channelizer.getChannelFrequencyOffset());
 }
+
+bool SSBDemodBaseband::getSharedFifoStats(unsigned int& size, unsigned int& fill, quint64& overflowCount, quint64& droppedSamples, quint64& readPosition)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return false;
+    }
+
+    size = m_sharedFifo->size();
+    fill = m_sharedFifo->fill(m_sharedFifoReader);
+    overflowCount = m_sharedFifo->getOverflowCount(m_sharedFifoReader);
+    droppedSamples = m_sharedFifo->getDroppedCount(m_sharedFifoReader);
+    readPosition = m_sharedFifo->getReadPosition(m_sharedFifoReader);
+
+    return true;
+}
+
+bool SSBDemodBaseband::setSharedFifo(SampleSinkMultiReaderFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (sharedFifo == m_sharedFifo) {
+        return true;
+    }
+
+    if (m_sharedFifo)
+    {
+        QObject::disconnect(
+            m_sharedFifo,
+            &SampleSinkMultiReaderFifo::dataReady,
+            this,
+            &SSBDemodBaseband::handleSharedFifoData
+        );
+        m_sharedFifo->removeReader(m_sharedFifoReader);
+        m_sharedFifoReader = -1;
+    }
+
+    m_sharedFifo = sharedFifo;
+
+    if (m_sharedFifo)
+    {
+        m_sharedFifoReader = m_sharedFifo->addReader();
+
+        if (m_sharedFifoReader < 0)
+        {
+            m_sharedFifo = nullptr; // no more readers allowed: stay on own FIFO
+            return false;
+        }
+
+        if (m_sharedDataTask)
+        {
+            m_sharedFifo->setReaderTask(m_sharedFifoReader, m_sharedDataTask);
+        }
+        else
+        {
+            QObject::connect(
+                m_sharedFifo,
+                &SampleSinkMultiReaderFifo::dataReady,
+                this,
+                &SSBDemodBaseband::handleSharedFifoData,
+                Qt::QueuedConnection
+            );
+        }
+    }
+
+    return true;
+}
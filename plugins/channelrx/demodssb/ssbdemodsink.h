@@ -39,6 +39,7 @@ public:
 	~SSBDemodSink();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	virtual void feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end);
 
 	void setSpectrumSink(SpectrumVis* spectrumSink) { m_spectrumSink = spectrumSink; }
 	void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
@@ -114,6 +115,8 @@ private:
     Interpolator m_interpolator;
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
+    ComplexVector m_mixBuffer;     //!< baseband shifted to zero frequency
+    ComplexVector m_channelBuffer; //!< samples at channel processing rate
 	fftfilt* SSBFilter;
 	fftfilt* DSBFilter;
 
@@ -131,7 +134,7 @@ private:
 	static const int m_ssbFftLen;
 	static const int m_agcTarget;
 
-    void processOneSample(Complex &ci);
+    void processOneSample(const Complex &ci);
 };
 
 #endif // INCLUDE_SSBDEMODSINK_H
@@ -145,6 +145,11 @@ void VORDemod::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *VORDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool VORDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureVORDemod::match(cmd))
@@ -142,6 +142,11 @@ void VORDemodMC::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *VORDemodMC::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool VORDemodMC::handleMessage(const Message& cmd)
 {
     if (MsgConfigureVORDemod::match(cmd))
@@ -142,6 +142,11 @@ void WFMDemod::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *WFMDemod::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool WFMDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureWFMDemod::match(cmd))
@@ -92,6 +92,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
 	double getMagSq() const { return m_basebandSink->getMagSq(); }
     bool getSquelchOpen() const { return m_basebandSink->getSquelchOpen(); }
     int getAudioSampleRate() const { return m_basebandSink->getAudioSampleRate(); }
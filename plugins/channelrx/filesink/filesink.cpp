@@ -214,6 +214,11 @@ void FileSink::stop()
     }
 }
 
+SampleSinkFifo *FileSink::getInputSampleFifo()
+{
+    return m_running ? m_basebandSink->getSampleFifo() : nullptr;
+}
+
 bool FileSink::handleMessage(const Message& cmd)
 {
     if (DSPSignalNotification::match(cmd))
@@ -362,6 +367,9 @@ void FileSink::applySettings(const FileSinkSettings& settings, bool force)
     if ((settings.m_squelchRecordingEnable != m_settings.m_squelchRecordingEnable) || force) {
         reverseAPIKeys.append("squelchRecordingEnable");
     }
+    if ((settings.m_directIO != m_settings.m_directIO) || force) {
+        reverseAPIKeys.append("directIO");
+    }
 
     if (m_settings.m_streamIndex != settings.m_streamIndex)
     {
@@ -567,6 +575,9 @@ void FileSink::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("squelchRecordingEnable")) {
         settings.m_squelchRecordingEnable = response.getFileSinkSettings()->getSquelchRecordingEnable() != 0;
     }
+    if (channelSettingsKeys.contains("directIO")) {
+        settings.m_directIO = response.getFileSinkSettings()->getDirectIo() != 0;
+    }
     if (channelSettingsKeys.contains("streamIndex")) {
         settings.m_streamIndex = response.getFileSinkSettings()->getStreamIndex();
     }
@@ -623,6 +634,7 @@ void FileSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& resp
     response.getFileSinkSettings()->setPreRecordTime(settings.m_preRecordTime);
     response.getFileSinkSettings()->setSquelchPostRecordTime(settings.m_squelchPostRecordTime);
     response.getFileSinkSettings()->setSquelchRecordingEnable(settings.m_squelchRecordingEnable ? 1 : 0);
+    response.getFileSinkSettings()->setDirectIo(settings.m_directIO ? 1 : 0);
     response.getFileSinkSettings()->setStreamIndex(settings.m_streamIndex);
     response.getFileSinkSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -692,6 +704,14 @@ void FileSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
         response.getFileSinkReport()->setSinkSampleRate(m_basebandSink->getSinkSampleRate());
         response.getFileSinkReport()->setRecording(m_basebandSink->isRecording() ? 1 : 0);
         response.getFileSinkReport()->setChannelSampleRate(m_basebandSink->getChannelSampleRate());
+        FileRecordWriter::Stats stats;
+
+        if (m_basebandSink->getWriterStats(stats))
+        {
+            response.getFileSinkReport()->setRecordDroppedBytes(stats.m_droppedBytes);
+            response.getFileSinkReport()->setRecordWriteStalls(stats.m_writeStalls);
+            response.getFileSinkReport()->setRecordMaxPendingBuffers(stats.m_maxPendingBuffers);
+        }
     }
 }
 
@@ -791,6 +811,9 @@ void FileSink::webapiFormatChannelSettings(
     if (channelSettingsKeys.contains("squelchRecordingEnable")) {
         swgFileSinkSettings->setSquelchRecordingEnable(settings.m_squelchRecordingEnable ? 1 : 0);
     }
+    if (channelSettingsKeys.contains("directIO")) {
+        swgFileSinkSettings->setDirectIo(settings.m_directIO ? 1 : 0);
+    }
     if (channelSettingsKeys.contains("streamIndex")) {
         swgFileSinkSettings->setStreamIndex(settings.m_streamIndex);
     }
@@ -237,6 +237,12 @@ int FileSinkBaseband::getChannelSampleRate() const
     return m_channelizer.getChannelSampleRate();
 }
 
+bool FileSinkBaseband::getWriterStats(FileRecordWriter::Stats& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex); // file record may be replaced by applySettings
+    return m_sink.getWriterStats(stats);
+}
+
 void FileSinkBaseband::tick()
 {
     if (m_spectrumSink && m_settings.m_spectrumSquelchMode)
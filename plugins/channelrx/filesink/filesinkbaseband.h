@@ -99,7 +99,9 @@ public:
     bool isRecording() const { return m_sink.isRecording(); }
     float getSpecMax() const { return m_specMax; }
     int getSinkSampleRate() const { return m_sink.getSampleRate(); }
+    bool getWriterStats(FileRecordWriter::Stats& stats);
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
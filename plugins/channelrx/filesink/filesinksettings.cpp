@@ -43,6 +43,7 @@ void FileSinkSettings::resetToDefaults()
     m_preRecordTime = 0;
     m_squelchPostRecordTime = 0;
     m_squelchRecordingEnable = false;
+    m_directIO = false;
     m_streamIndex = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
@@ -90,6 +91,7 @@ QByteArray FileSinkSettings::serialize() const
     s.writeS32(20, m_workspaceIndex);
     s.writeBlob(21, m_geometryBytes);
     s.writeBool(22, m_hidden);
+    s.writeBool(23, m_directIO);
 
     return s.final();
 }
@@ -162,6 +164,7 @@ bool FileSinkSettings::deserialize(const QByteArray& data)
         d.readS32(20, &m_workspaceIndex, 0);
         d.readBlob(21, &m_geometryBytes);
         d.readBool(22, &m_hidden, false);
+        d.readBool(23, &m_directIO, false);
 
         return true;
     }
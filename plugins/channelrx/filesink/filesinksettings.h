@@ -35,6 +35,7 @@ struct FileSinkSettings
     int m_preRecordTime;
     int m_squelchPostRecordTime;
     bool m_squelchRecordingEnable;
+    bool m_directIO; //!< Bypass page cache when writing the file (Linux only)
     int m_streamIndex; //!< MIMO channel. Not relevant when connected to SI (single Rx).
     bool m_useReverseAPI;
     QString m_reverseAPIAddress;
@@ -53,6 +53,7 @@ void FileSinkSink::startRecording()
         // set the length of pre record time
         qint64 mSShift = m_sinkSampleRate == 0 ? 0 : (m_preRecordFill * 1000) / m_sinkSampleRate;
         m_fileSink->setMsShift(-mSShift);
+        m_fileSink->setDirectIO(m_settings.m_directIO);
 
         // notify capture start
         if (!m_fileSink->startRecording())
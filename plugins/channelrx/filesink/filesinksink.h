@@ -56,6 +56,7 @@ public:
     void squelchRecording(bool squelchOpen);
     int getSampleRate() const { return m_sinkSampleRate; }
     bool isRecording() const { return m_record; }
+    bool getWriterStats(FileRecordWriter::Stats& stats) { return m_fileSink->getWriterStats(stats); }
 
 private:
     int m_channelSampleRate;
@@ -144,6 +144,11 @@ void FreqTracker::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *FreqTracker::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool FreqTracker::handleMessage(const Message& cmd)
 {
     if (DSPSignalNotification::match(cmd))
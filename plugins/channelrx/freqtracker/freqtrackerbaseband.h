@@ -75,6 +75,7 @@ public:
 	Real getFrequency() const { return m_sink.getFrequency(); };
     Real getAvgDeltaFreq() const { return m_sink.getAvgDeltaFreq(); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
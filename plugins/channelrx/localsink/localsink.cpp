@@ -131,6 +131,11 @@ void LocalSink::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *LocalSink::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool LocalSink::handleMessage(const Message& cmd)
 {
     if (DSPSignalNotification::match(cmd))
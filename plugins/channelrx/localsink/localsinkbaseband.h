@@ -106,6 +106,7 @@ public:
     void startSource() { m_sink.start(m_localSampleSource); }
     void stopSource() { m_sink.stop(); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -170,6 +170,11 @@ void NoiseFigure::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *NoiseFigure::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool NoiseFigure::openVISADevice()
 {
     m_visa.openDefault();
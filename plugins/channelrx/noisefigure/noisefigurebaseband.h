@@ -77,6 +77,7 @@ public:
     bool isRunning() const { return m_running; }
     void startMeasurement() { m_sink.startMeasurement(); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -209,6 +209,11 @@ void RadioAstronomy::stop()
     m_workerThread.wait();
 }
 
+SampleSinkFifo *RadioAstronomy::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 void RadioAstronomy::setCenterFrequency(qint64 frequency)
 {
     RadioAstronomySettings settings = m_settings;
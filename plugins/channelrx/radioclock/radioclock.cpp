@@ -146,6 +146,11 @@ void RadioClock::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *RadioClock::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 void RadioClock::setCenterFrequency(qint64 frequency)
 {
     RadioClockSettings settings = m_settings;
@@ -145,6 +145,11 @@ void RemoteSink::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *RemoteSink::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool RemoteSink::handleMessage(const Message& cmd)
 {
     if (MsgConfigureRemoteSink::match(cmd))
@@ -73,6 +73,7 @@ public:
     void setDeviceIndex(uint32_t deviceIndex) { m_sink.setDeviceIndex(deviceIndex); }
     void setChannelIndex(uint32_t channelIndex) { m_sink.setChannelIndex(channelIndex); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
 
 private:
     bool m_running;
@@ -23,16 +23,20 @@
 
 #include <QThread>
 
+#include <vector>
+
 #include "cm256cc/cm256.h"
 
 #include "channel/remotedatablock.h"
+#include "util/workerpool.h"
 #include "remotesinksender.h"
 
 RemoteSinkSender::RemoteSinkSender() :
     m_running(false),
     m_fifo(20, this),
     m_address(QHostAddress::LocalHost),
-    m_socket(this)
+    m_socket(this),
+    m_batchSender(RemoteUdpSize)
 {
     qDebug("RemoteSinkSender::RemoteSinkSender");
     m_cm256p = m_cm256.isInitialized() ? &m_cm256 : nullptr;
@@ -42,6 +46,7 @@ RemoteSinkSender::~RemoteSinkSender()
 {
     qDebug("RemoteSinkSender::~RemoteSinkSender");
     m_socket.close();
+    m_batchSender.close();
 }
 
 bool RemoteSinkSender::startWork()
@@ -56,6 +61,7 @@ bool RemoteSinkSender::startWork()
     );
     connect(thread(), SIGNAL(started()), this, SLOT(started()));
     connect(thread(), SIGNAL(finished()), this, SLOT(finished()));
+    m_batchSender.open();
     m_running = true;
     return m_running;
 }
@@ -83,6 +89,7 @@ void RemoteSinkSender::finished()
         m_socket.close();
     }
 
+    m_batchSender.close();
     m_running = false;
     disconnect(thread(), SIGNAL(finished()), this, SLOT(finished()));
 }
@@ -95,6 +102,9 @@ RemoteDataFrame *RemoteSinkSender::getDataFrame()
 void RemoteSinkSender::handleData()
 {
     RemoteDataFrame *dataFrame;
+    std::vector<RemoteDataFrame*> dataFrames;
+    std::vector<WorkerPool::Ticket> tickets;
+    std::vector<uint8_t> encoded;
     unsigned int remainder = m_fifo.getRemainder();
 
     while (remainder != 0)
@@ -102,12 +112,40 @@ void RemoteSinkSender::handleData()
         remainder = m_fifo.readDataFrame(&dataFrame);
 
         if (dataFrame) {
-            sendDataFrame(dataFrame);
+            dataFrames.push_back(dataFrame);
+        }
+    }
+
+    if (dataFrames.size() == 0) {
+        return;
+    }
+
+    encoded.resize(dataFrames.size(), 0);
+
+    // Frames are independent: all but the first are encoded by the pool while the first is encoded and sent here
+    for (unsigned int i = 1; (i < dataFrames.size()) && m_cm256p; i++)
+    {
+        RemoteDataFrame *poolFrame = dataFrames[i];
+        uint8_t *poolEncoded = &encoded[i];
+        tickets.push_back(WorkerPool::instance().submit([poolFrame, poolEncoded](){
+            *poolEncoded = encodeDataFrame(poolFrame, nullptr);
+        }));
+    }
+
+    encoded[0] = m_cm256p && encodeDataFrame(dataFrames[0], m_cm256p);
+    sendDataFrame(dataFrames[0], encoded[0]);
+
+    for (unsigned int i = 1; i < dataFrames.size(); i++)
+    {
+        if (m_cm256p) {
+            WorkerPool::instance().wait(tickets[i-1]); // transmit in frame order
         }
+
+        sendDataFrame(dataFrames[i], encoded[i]);
     }
 }
 
-void RemoteSinkSender::sendDataFrame(RemoteDataFrame *dataFrame)
+bool RemoteSinkSender::encodeDataFrame(RemoteDataFrame *dataFrame, CM256 *cm256)
 {
 	CM256::cm256_encoder_params cm256Params;  //!< Main interface with CM256 encoder
 	CM256::cm256_block descriptorBlocks[256]; //!< Pointers to data for CM256 encoder
@@ -115,55 +153,92 @@ void RemoteSinkSender::sendDataFrame(RemoteDataFrame *dataFrame)
 
     uint16_t frameIndex = dataFrame->m_txControlBlock.m_frameIndex;
     int nbBlocksFEC = dataFrame->m_txControlBlock.m_nbBlocksFEC;
-    m_address.setAddress(dataFrame->m_txControlBlock.m_dataAddress);
-    uint16_t dataPort = dataFrame->m_txControlBlock.m_dataPort;
     RemoteSuperBlock *txBlockx = dataFrame->m_superBlocks;
 
-    if ((nbBlocksFEC == 0) || !m_cm256p) // Do not FEC encode
+    if (nbBlocksFEC == 0) {
+        return false;
+    }
+
+    if (!cm256) // pool thread
     {
-        for (int i = 0; i < RemoteNbOrginalBlocks; i++) { // send block via UDP
-            m_socket.writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
+        static thread_local CM256 threadCM256;
+
+        if (!threadCM256.isInitialized()) {
+            return false;
         }
+
+        cm256 = &threadCM256;
     }
-    else
+
+    cm256Params.BlockBytes = sizeof(RemoteProtectedBlock);
+    cm256Params.OriginalCount = RemoteNbOrginalBlocks;
+    cm256Params.RecoveryCount = nbBlocksFEC;
+
+    // Fill pointers to data
+    for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; ++i)
     {
-        cm256Params.BlockBytes = sizeof(RemoteProtectedBlock);
-        cm256Params.OriginalCount = RemoteNbOrginalBlocks;
-        cm256Params.RecoveryCount = nbBlocksFEC;
-
-        // Fill pointers to data
-        for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; ++i)
-        {
-            if (i >= cm256Params.OriginalCount) {
-                memset((void *) &txBlockx[i].m_protectedBlock, 0, sizeof(RemoteProtectedBlock));
-            }
-
-            txBlockx[i].m_header.m_frameIndex = frameIndex;
-            txBlockx[i].m_header.m_blockIndex = i;
-            txBlockx[i].m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
-            txBlockx[i].m_header.m_sampleBits = SDR_RX_SAMP_SZ;
-            descriptorBlocks[i].Block = (void *) &(txBlockx[i].m_protectedBlock);
-            descriptorBlocks[i].Index = txBlockx[i].m_header.m_blockIndex;
+        if (i >= cm256Params.OriginalCount) {
+            memset((void *) &txBlockx[i].m_protectedBlock, 0, sizeof(RemoteProtectedBlock));
         }
 
-        // Encode FEC blocks
-        if (m_cm256p->cm256_encode(cm256Params, descriptorBlocks, fecBlocks))
-        {
-            qWarning("RemoteSinkSender::handleDataBlock: CM256 encode failed. No transmission.");
-            // TODO: send without FEC changing meta data to set indication of no FEC
-        }
+        txBlockx[i].m_header.m_frameIndex = frameIndex;
+        txBlockx[i].m_header.m_blockIndex = i;
+        txBlockx[i].m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+        txBlockx[i].m_header.m_sampleBits = SDR_RX_SAMP_SZ;
+        descriptorBlocks[i].Block = (void *) &(txBlockx[i].m_protectedBlock);
+        descriptorBlocks[i].Index = txBlockx[i].m_header.m_blockIndex;
+    }
 
-        // Merge FEC with data to transmit
-        for (int i = 0; i < cm256Params.RecoveryCount; i++)
-        {
-            txBlockx[i + cm256Params.OriginalCount].m_protectedBlock = fecBlocks[i];
-        }
+    // Encode FEC blocks
+    if (cm256->cm256_encode(cm256Params, descriptorBlocks, fecBlocks))
+    {
+        qWarning("RemoteSinkSender::encodeDataFrame: CM256 encode failed. No transmission.");
+        // TODO: send without FEC changing meta data to set indication of no FEC
+    }
 
-        // Transmit all blocks
-        for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; i++) { // send block via UDP
-            m_socket.writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
-        }
+    // Merge FEC with data to transmit
+    for (int i = 0; i < cm256Params.RecoveryCount; i++)
+    {
+        txBlockx[i + cm256Params.OriginalCount].m_protectedBlock = fecBlocks[i];
+    }
+
+    return true;
+}
+
+void RemoteSinkSender::sendDataFrame(RemoteDataFrame *dataFrame, bool encoded)
+{
+    m_address.setAddress(dataFrame->m_txControlBlock.m_dataAddress);
+    uint16_t dataPort = dataFrame->m_txControlBlock.m_dataPort;
+    RemoteSuperBlock *txBlockx = dataFrame->m_superBlocks;
+
+    if (encoded) { // Transmit all blocks
+        sendBlocks(txBlockx, RemoteNbOrginalBlocks + dataFrame->m_txControlBlock.m_nbBlocksFEC, dataPort);
+    } else { // Not FEC encoded
+        sendBlocks(txBlockx, RemoteNbOrginalBlocks, dataPort);
     }
 
     dataFrame->m_txControlBlock.m_processed = true;
 }
+
+void RemoteSinkSender::sendBlocks(const RemoteSuperBlock *txBlockx, int nbBlocks, uint16_t dataPort)
+{
+    // Super blocks are packed to the UDP size so the frame can go out in a few system calls
+    int sent = 0;
+
+    if (m_batchSender.isOpen() && (m_address.protocol() == QAbstractSocket::IPv4Protocol))
+    {
+        sent = m_batchSender.send((const char*) txBlockx, nbBlocks, m_address, dataPort);
+
+        if (sent == nbBlocks) {
+            return;
+        }
+
+        qWarning("RemoteSinkSender::sendBlocks: batched send failed. Falling back to QUdpSocket.");
+        m_batchSender.close();
+        sent = sent < 0 ? 0 : sent;
+    }
+
+    for (int i = sent; i < nbBlocks; i++) { // send block via UDP
+        m_socket.writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
+    }
+}
@@ -34,10 +34,12 @@
 
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "channel/remoteudpbatch.h"
 
 #include "remotesinkfifo.h"
 
 class RemoteDataFrame;
+struct RemoteSuperBlock;
 class CM256;
 class QUdpSocket;
 
@@ -60,8 +62,11 @@ private:
 
     QHostAddress m_address;
     QUdpSocket m_socket;
+    RemoteUDPBatchSender m_batchSender; //!< Fast path when available
 
-    void sendDataFrame(RemoteDataFrame *dataFrame);
+    static bool encodeDataFrame(RemoteDataFrame *dataFrame, CM256 *cm256); //!< pool threads pass a null cm256
+    void sendDataFrame(RemoteDataFrame *dataFrame, bool encoded);
+    void sendBlocks(const RemoteSuperBlock *txBlockx, int nbBlocks, uint16_t dataPort);
 
 private slots:
     void started();
@@ -91,6 +91,7 @@ public:
         setChannelFreqOffset = 0xc4,
         setChannelGain = 0xc5,
         setSampleBitDepth = 0xc6,           // Bit depth for samples sent over network
+        setSampleCompression = 0xc7,        // Compression of samples sent over network (RemoteTCPCodec::Compression)
         //setAntenna?
         //setLOOffset?
     };
@@ -141,6 +141,11 @@ void RemoteTCPSink::stop()
     m_thread.wait();
 }
 
+SampleSinkFifo *RemoteTCPSink::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool RemoteTCPSink::handleMessage(const Message& cmd)
 {
     if (MsgConfigureRemoteTCPSink::match(cmd))
@@ -219,6 +224,7 @@ void RemoteTCPSink::applySettings(const RemoteTCPSinkSettings& settings, bool fo
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
             << " m_protocol: " << settings.m_protocol
+            << " m_compression: " << settings.m_compression
             << " m_streamIndex: " << settings.m_streamIndex
             << " force: " << force
             << " remoteChange: " << remoteChange;
@@ -246,6 +252,9 @@ void RemoteTCPSink::applySettings(const RemoteTCPSinkSettings& settings, bool fo
     if ((m_settings.m_protocol != settings.m_protocol) || force) {
         reverseAPIKeys.append("protocol");
     }
+    if ((m_settings.m_compression != settings.m_compression) || force) {
+        reverseAPIKeys.append("compression");
+    }
     if ((m_settings.m_rgbColor != settings.m_rgbColor) || force) {
         reverseAPIKeys.append("rgbColor");
     }
@@ -368,6 +377,11 @@ void RemoteTCPSink::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("protocol")) {
         settings.m_protocol = (RemoteTCPSinkSettings::Protocol)response.getRemoteTcpSinkSettings()->getProtocol();
     }
+    if (channelSettingsKeys.contains("compression"))
+    {
+        int compression = response.getRemoteTcpSinkSettings()->getCompression();
+        settings.m_compression = RemoteTCPCodec::isValid(compression) ? (RemoteTCPCodec::Compression)compression : RemoteTCPCodec::None;
+    }
 
     if (channelSettingsKeys.contains("rgbColor")) {
         settings.m_rgbColor = response.getRemoteTcpSinkSettings()->getRgbColor();
@@ -416,6 +430,7 @@ void RemoteTCPSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings&
     }
     response.getRemoteTcpSinkSettings()->setDataPort(settings.m_dataPort);
     response.getRemoteTcpSinkSettings()->setProtocol((int)settings.m_protocol);
+    response.getRemoteTcpSinkSettings()->setCompression((int)settings.m_compression);
 
     response.getRemoteTcpSinkSettings()->setRgbColor(settings.m_rgbColor);
 
@@ -554,6 +569,9 @@ void RemoteTCPSink::webapiFormatChannelSettings(
     if (channelSettingsKeys.contains("protocol") || force) {
         swgRemoteTCPSinkSettings->setProtocol(settings.m_protocol);
     }
+    if (channelSettingsKeys.contains("compression") || force) {
+        swgRemoteTCPSinkSettings->setCompression((int)settings.m_compression);
+    }
     if (channelSettingsKeys.contains("rgbColor") || force) {
         swgRemoteTCPSinkSettings->setRgbColor(settings.m_rgbColor);
     }
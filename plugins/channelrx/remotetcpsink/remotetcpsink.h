@@ -86,18 +86,24 @@ public:
 
     public:
         float getBW() const { return m_bw; }
+        float getCompressionRatio() const { return m_compressionRatio; }
+        float getEncodeCPU() const { return m_encodeCPU; }
 
-        static MsgReportBW* create(float bw)
+        static MsgReportBW* create(float bw, float compressionRatio = 1.0f, float encodeCPU = 0.0f)
         {
-            return new MsgReportBW(bw);
+            return new MsgReportBW(bw, compressionRatio, encodeCPU);
         }
 
     private:
-        float m_bw;
+        float m_bw;                 //!< Bits per second sent to each client
+        float m_compressionRatio;   //!< Uncompressed over compressed size
+        float m_encodeCPU;          //!< Percentage of wall clock time spent compressing
 
-        MsgReportBW(float bw) :
+        MsgReportBW(float bw, float compressionRatio, float encodeCPU) :
             Message(),
-            m_bw(bw)
+            m_bw(bw),
+            m_compressionRatio(compressionRatio),
+            m_encodeCPU(encodeCPU)
         { }
     };
 
@@ -133,6 +139,8 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual SampleSinkFifo *getInputSampleFifo();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
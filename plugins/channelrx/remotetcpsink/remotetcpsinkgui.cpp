@@ -117,7 +117,8 @@ bool RemoteTCPSinkGUI::handleMessage(const Message& message)
     {
         const RemoteTCPSink::MsgConfigureRemoteTCPSink& cfg = (RemoteTCPSink::MsgConfigureRemoteTCPSink&) message;
         if ((cfg.getSettings().m_channelSampleRate != m_settings.m_channelSampleRate)
-            || (cfg.getSettings().m_sampleBits != m_settings.m_sampleBits)) {
+            || (cfg.getSettings().m_sampleBits != m_settings.m_sampleBits)
+            || (cfg.getSettings().m_compression != m_settings.m_compression)) {
             m_bwAvg.reset();
         }
         m_settings = cfg.getSettings();
@@ -139,6 +140,11 @@ bool RemoteTCPSinkGUI::handleMessage(const Message& message)
         const RemoteTCPSink::MsgReportBW& report = (RemoteTCPSink::MsgReportBW&) message;
         m_bwAvg(report.getBW());
         ui->bw->setText(QString("%1bps").arg(displayScaledF(m_bwAvg.instantAverage(), 'f', 3, true)));
+        if ((m_settings.m_compression == RemoteTCPCodec::None) || (m_settings.m_protocol == RemoteTCPSinkSettings::RTL0)) {
+            ui->compressionStats->setText("");
+        } else {
+            ui->compressionStats->setText(QString("%1:1 %2%").arg(report.getCompressionRatio(), 0, 'f', 2).arg(report.getEncodeCPU(), 0, 'f', 1));
+        }
         return true;
     }
     else if (DSPSignalNotification::match(message))
@@ -253,6 +259,8 @@ void RemoteTCPSinkGUI::displaySettings()
     ui->dataAddress->setText(m_settings.m_dataAddress);
     ui->dataPort->setText(tr("%1").arg(m_settings.m_dataPort));
     ui->protocol->setCurrentIndex((int)m_settings.m_protocol);
+    ui->compression->setCurrentIndex((int)m_settings.m_compression);
+    ui->compression->setEnabled(m_settings.m_protocol == RemoteTCPSinkSettings::SDRA);
     getRollupContents()->restoreState(m_rollupState);
     blockApplySettings(false);
 }
@@ -408,6 +416,14 @@ void RemoteTCPSinkGUI::on_dataPort_editingFinished()
 void RemoteTCPSinkGUI::on_protocol_currentIndexChanged(int index)
 {
     m_settings.m_protocol = (RemoteTCPSinkSettings::Protocol)index;
+    ui->compression->setEnabled(m_settings.m_protocol == RemoteTCPSinkSettings::SDRA);
+    applySettings();
+}
+
+void RemoteTCPSinkGUI::on_compression_currentIndexChanged(int index)
+{
+    m_settings.m_compression = (RemoteTCPCodec::Compression)index;
+    m_bwAvg.reset();
     applySettings();
 }
 
@@ -427,6 +443,7 @@ void RemoteTCPSinkGUI::makeUIConnections()
     QObject::connect(ui->dataAddress, &QLineEdit::editingFinished, this, &RemoteTCPSinkGUI::on_dataAddress_editingFinished);
     QObject::connect(ui->dataPort, &QLineEdit::editingFinished, this, &RemoteTCPSinkGUI::on_dataPort_editingFinished);
     QObject::connect(ui->protocol, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &RemoteTCPSinkGUI::on_protocol_currentIndexChanged);
+    QObject::connect(ui->compression, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &RemoteTCPSinkGUI::on_compression_currentIndexChanged);
 }
 
 void RemoteTCPSinkGUI::updateAbsoluteCenterFrequency()
@@ -114,6 +114,7 @@ private slots:
     void on_dataAddress_editingFinished();
     void on_dataPort_editingFinished();
     void on_protocol_currentIndexChanged(int index);
+    void on_compression_currentIndexChanged(int index);
     void onWidgetRolled(QWidget* widget, bool rollDown);
     void onMenuDialogCalled(const QPoint& p);
     void tick();
@@ -38,6 +38,7 @@ void RemoteTCPSinkSettings::resetToDefaults()
     m_dataAddress = "127.0.0.1";
     m_dataPort = 1234;
     m_protocol = SDRA;
+    m_compression = RemoteTCPCodec::None;
     m_rgbColor = QColor(140, 4, 4).rgb();
     m_title = "Remote TCP sink";
     m_channelMarker = nullptr;
@@ -82,6 +83,7 @@ QByteArray RemoteTCPSinkSettings::serialize() const
     s.writeS32(20, m_workspaceIndex);
     s.writeBlob(21, m_geometryBytes);
     s.writeBool(22, m_hidden);
+    s.writeS32(23, (int)m_compression);
 
     return s.final();
 }
@@ -150,6 +152,10 @@ bool RemoteTCPSinkSettings::deserialize(const QByteArray& data)
         d.readBlob(21, &m_geometryBytes);
         d.readBool(22, &m_hidden, false);
 
+        int compression;
+        d.readS32(23, &compression, (int)RemoteTCPCodec::None);
+        m_compression = RemoteTCPCodec::isValid(compression) ? (RemoteTCPCodec::Compression)compression : RemoteTCPCodec::None;
+
         return true;
     }
     else
@@ -22,6 +22,8 @@
 #include <QByteArray>
 #include <QString>
 
+#include "channel/remotetcpcodec.h"
+
 class Serializable;
 
 struct RemoteTCPSinkSettings
@@ -38,6 +40,7 @@ struct RemoteTCPSinkSettings
     QString m_dataAddress;
     uint16_t m_dataPort;
     enum Protocol m_protocol;
+    RemoteTCPCodec::Compression m_compression; //!< SDRA only
     quint32 m_rgbColor;
     QString m_title;
     int m_streamIndex; //!< MIMO channel. Not relevant when connected to SI (single Rx).
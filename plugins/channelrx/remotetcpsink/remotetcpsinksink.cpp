@@ -18,6 +18,7 @@
 
 #include <QMutexLocker>
 #include <QThread>
+#include <QElapsedTimer>
 
 #include "channel/channelwebapiutils.h"
 #include "dsp/hbfilterchainconverter.h"
@@ -36,7 +37,10 @@ RemoteTCPSinkSink::RemoteTCPSinkSink() :
         m_channelFrequencyOffset(0),
         m_channelSampleRate(48000),
         m_linearGain(1.0f),
-        m_server(nullptr)
+        m_server(nullptr),
+        m_bwBytes(0),
+        m_bwUncompressedBytes(0),
+        m_bwEncodeNanos(0)
 {
     qDebug("RemoteTCPSinkSink::RemoteTCPSinkSink");
     applySettings(m_settings, true);
@@ -95,7 +99,7 @@ void RemoteTCPSinkSink::feed(const SampleVector::const_iterator& begin, const Sa
     if (m_clients.size() > 0)
     {
         Complex ci;
-        int bytes = 0;
+        int nbSamples = 0;
 
         for (SampleVector::const_iterator it = begin; it != end; ++it)
         {
@@ -107,7 +111,7 @@ void RemoteTCPSinkSink::feed(const SampleVector::const_iterator& begin, const Sa
                 while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
                 {
                     processOneSample(ci);
-                    bytes += 2 * m_settings.m_sampleBits / 8;
+                    nbSamples++;
                     m_interpolatorDistanceRemain += m_interpolatorDistance;
                 }
             }
@@ -116,12 +120,28 @@ void RemoteTCPSinkSink::feed(const SampleVector::const_iterator& begin, const Sa
                 if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
                 {
                     processOneSample(ci);
-                    bytes += 2 * m_settings.m_sampleBits / 8;
+                    nbSamples++;
                     m_interpolatorDistanceRemain += m_interpolatorDistance;
                 }
             }
         }
 
+        // Don't hold back a partial block, so compression doesn't add latency
+        if (m_iqBlock.size() > 0) {
+            encodeBlock();
+        }
+
+        int bytes = m_txBuffer.size();
+        int uncompressedBytes = nbSamples * 2 * m_settings.m_sampleBits / 8;
+
+        if (bytes > 0)
+        {
+            for (auto client : m_clients) {
+                client->write(m_txBuffer.constData(), bytes);
+            }
+
+            m_txBuffer.clear();
+        }
 
         if (m_bwDateTime.isValid())
         {
@@ -130,90 +150,96 @@ void RemoteTCPSinkSink::feed(const SampleVector::const_iterator& begin, const Sa
             if (msecs > 1000)
             {
                 float bw = (8*m_bwBytes)/(msecs/1000.0f);
+                float ratio = m_bwBytes > 0 ? m_bwUncompressedBytes / (float) m_bwBytes : 1.0f;
+                float cpu = (m_bwEncodeNanos / 1e4f) / msecs;
                 if (m_messageQueueToGUI) {
-                    m_messageQueueToGUI->push(RemoteTCPSink::MsgReportBW::create(bw));
+                    m_messageQueueToGUI->push(RemoteTCPSink::MsgReportBW::create(bw, ratio, cpu));
                 }
                 m_bwDateTime = currentDateTime;
                 m_bwBytes = bytes;
+                m_bwUncompressedBytes = uncompressedBytes;
+                m_bwEncodeNanos = 0;
             }
             else
             {
                 m_bwBytes += bytes;
+                m_bwUncompressedBytes += uncompressedBytes;
             }
         }
         else
         {
             m_bwDateTime = QDateTime::currentDateTime();
             m_bwBytes = bytes;
+            m_bwUncompressedBytes = uncompressedBytes;
+            m_bwEncodeNanos = 0;
         }
     }
 }
 
 void RemoteTCPSinkSink::processOneSample(Complex &ci)
 {
+    qint32 i, q;
+
     if (m_settings.m_sampleBits == 8)
     {
-        // Transmit data as per rtl_tcp - Interleaved unsigned 8-bit IQ
-        quint8 iqBuf[2];
-        iqBuf[0] = ((int)(ci.real() / SDR_RX_SCALEF * 256.0f * m_linearGain)) + 128;
-        iqBuf[1] = ((int)(ci.imag() / SDR_RX_SCALEF * 256.0f * m_linearGain)) + 128;
-        for (auto client : m_clients) {
-            client->write((const char *)iqBuf, sizeof(iqBuf));
-        }
+        i = (qint32)(ci.real() / SDR_RX_SCALEF * 256.0f * m_linearGain);
+        q = (qint32)(ci.imag() / SDR_RX_SCALEF * 256.0f * m_linearGain);
     }
     else if (m_settings.m_sampleBits == 16)
     {
-        // Interleaved little-endian signed 16-bit IQ
-        quint8 iqBuf[2*2];
-        qint32 i, q;
-        i = ((qint32)(ci.real() / SDR_RX_SCALEF * 65536.0f * m_linearGain));
-        q = ((qint32)(ci.imag() / SDR_RX_SCALEF * 65536.0f * m_linearGain));
-        iqBuf[1] = (i >> 8) & 0xff;
-        iqBuf[0] = i & 0xff;
-        iqBuf[3] = (q >> 8) & 0xff;
-        iqBuf[2] = q & 0xff;
-        for (auto client : m_clients) {
-            client->write((const char *)iqBuf, sizeof(iqBuf));
-        }
+        i = (qint32)(ci.real() / SDR_RX_SCALEF * 65536.0f * m_linearGain);
+        q = (qint32)(ci.imag() / SDR_RX_SCALEF * 65536.0f * m_linearGain);
     }
-    else if (m_settings.m_sampleBits == 24)
+    else
+    {
+        i = (qint32)(ci.real() * m_linearGain);
+        q = (qint32)(ci.imag() * m_linearGain);
+    }
+
+    if (getCompression() != RemoteTCPCodec::None)
     {
-        // Interleaved little-endian signed 24-bit IQ
-        quint8 iqBuf[3*2];
-        qint32 i, q;
-        i = ((qint32)(ci.real() * m_linearGain));
-        q = ((qint32)(ci.imag() * m_linearGain));
-        iqBuf[2] = (i >> 16) & 0xff;
-        iqBuf[1] = (i >> 8) & 0xff;
-        iqBuf[0] = i & 0xff;
-        iqBuf[5] = (q >> 16) & 0xff;
-        iqBuf[4] = (q >> 8) & 0xff;
-        iqBuf[3] = q & 0xff;
-        for (auto client : m_clients) {
-            client->write((const char *)iqBuf, sizeof(iqBuf));
+        m_iqBlock.push_back(i);
+        m_iqBlock.push_back(q);
+
+        if ((int) m_iqBlock.size() >= 2 * RemoteTCPCodec::m_blockSamples) {
+            encodeBlock();
         }
     }
+    else if (m_settings.m_sampleBits == 8)
+    {
+        // Transmit data as per rtl_tcp - Interleaved unsigned 8-bit IQ
+        m_txBuffer.append((char) (i + 128));
+        m_txBuffer.append((char) (q + 128));
+    }
     else
     {
-        // Interleaved little-endian signed 32-bit IQ
-        quint8 iqBuf[4*2];
-        qint32 i, q;
-        i = ((qint32)(ci.real() * m_linearGain));
-        q = ((qint32)(ci.imag() * m_linearGain));
-        iqBuf[3] = (i >> 24) & 0xff;
-        iqBuf[2] = (i >> 16) & 0xff;
-        iqBuf[1] = (i >> 8) & 0xff;
-        iqBuf[0] = i & 0xff;
-        iqBuf[7] = (q >> 24) & 0xff;
-        iqBuf[6] = (q >> 16) & 0xff;
-        iqBuf[5] = (q >> 8) & 0xff;
-        iqBuf[4] = q & 0xff;
-        for (auto client : m_clients) {
-            client->write((const char *)iqBuf, sizeof(iqBuf));
+        // Interleaved little-endian signed 16, 24 or 32-bit IQ
+        int bytesPerSample = m_settings.m_sampleBits / 8;
+
+        for (int k = 0; k < bytesPerSample; k++) {
+            m_txBuffer.append((char) ((i >> (8*k)) & 0xff));
+        }
+        for (int k = 0; k < bytesPerSample; k++) {
+            m_txBuffer.append((char) ((q >> (8*k)) & 0xff));
         }
     }
 }
 
+void RemoteTCPSinkSink::encodeBlock()
+{
+    QElapsedTimer timer;
+    timer.start();
+    RemoteTCPCodec::encode(getCompression(), m_settings.m_sampleBits, m_iqBlock.data(), m_iqBlock.size() / 2, m_txBuffer);
+    m_bwEncodeNanos += timer.nsecsElapsed();
+    m_iqBlock.clear();
+}
+
+RemoteTCPCodec::Compression RemoteTCPSinkSink::getCompression() const
+{
+    // rtl_tcp clients only understand raw samples
+    return m_settings.m_protocol == RemoteTCPSinkSettings::RTL0 ? RemoteTCPCodec::None : m_settings.m_compression;
+}
+
 void RemoteTCPSinkSink::applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force)
 {
     qDebug() << "RemoteTCPSinkSink::applyChannelSettings:"
@@ -263,11 +289,14 @@ void RemoteTCPSinkSink::applySettings(const RemoteTCPSinkSettings& settings, boo
                 || (m_settings.m_dataPort != settings.m_dataPort)
                 || (m_settings.m_sampleBits != settings.m_sampleBits)
                 || (m_settings.m_protocol != settings.m_protocol)
+                || (m_settings.m_compression != settings.m_compression)
                 || (   !remoteChange
                     && (m_settings.m_channelSampleRate != settings.m_channelSampleRate)
                    );
 
     m_settings = settings;
+    m_iqBlock.clear();
+    m_iqBlock.reserve(2 * RemoteTCPCodec::m_blockSamples);
 
     if (m_running && restart) {
         startServer();
@@ -455,6 +484,7 @@ void RemoteTCPSinkSink::acceptConnection()
         RemoteTCPProtocol::encodeUInt32(&metaData[48], m_settings.m_gain);
         RemoteTCPProtocol::encodeUInt32(&metaData[52], m_settings.m_channelSampleRate);
         RemoteTCPProtocol::encodeUInt32(&metaData[56], m_settings.m_sampleBits);
+        RemoteTCPProtocol::encodeUInt32(&metaData[60], getCompression());
         // Send API port? Not accessible via MainCore
 
         client->write((const char *)metaData, sizeof(metaData));
@@ -640,6 +670,22 @@ void RemoteTCPSinkSink::processCommand()
                 }
                 break;
             }
+            case RemoteTCPProtocol::setSampleCompression:
+            {
+                int compression = RemoteTCPProtocol::extractUInt32(&cmd[1]);
+                qDebug() << "RemoteTCPSinkSink::processCommand: set sample compression " << compression;
+                if (!RemoteTCPCodec::isValid(compression)) {
+                    break;
+                }
+                settings.m_compression = (RemoteTCPCodec::Compression)compression;
+                if (m_messageQueueToGUI) {
+                    m_messageQueueToGUI->push(RemoteTCPSink::MsgConfigureRemoteTCPSink::create(settings, false, true));
+                }
+                if (m_messageQueueToChannel) {
+                    m_messageQueueToChannel->push(RemoteTCPSink::MsgConfigureRemoteTCPSink::create(settings, false, true));
+                }
+                break;
+            }
             default:
                 qDebug() << "RemoteTCPSinkSink::processCommand: unknown command " << cmd[0];
                 break;
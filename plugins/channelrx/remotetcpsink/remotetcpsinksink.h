@@ -25,10 +25,13 @@
 #include <QTcpSocket>
 #include <QDateTime>
 
+#include <vector>
+
 #include "dsp/channelsamplesink.h"
 #include "dsp/nco.h"
 #include "dsp/interpolator.h"
 #include "channel/remotedatablock.h"
+#include "channel/remotetcpcodec.h"
 #include "util/messagequeue.h"
 
 #include "remotetcpsinksettings.h"
@@ -81,6 +84,11 @@ private:
 
     QDateTime m_bwDateTime;             //!< For calculating TX bandwidth
     qint64 m_bwBytes;
+    qint64 m_bwUncompressedBytes;       //!< For calculating compression ratio
+    qint64 m_bwEncodeNanos;             //!< For calculating compression CPU cost
+
+    QByteArray m_txBuffer;              //!< Samples written to clients once per feed
+    std::vector<qint32> m_iqBlock;      //!< Interleaved I/Q waiting to be compressed
 
     NCO m_nco;
     Interpolator m_interpolator;
@@ -90,6 +98,8 @@ private:
     void startServer();
     void stopServer();
     void processOneSample(Complex &ci);
+    void encodeBlock();
+    RemoteTCPCodec::Compression getCompression() const;
     RemoteTCPProtocol::Device getDevice();
 
 };
@@ -212,6 +212,11 @@ void SigMFFileSink::stop()
     }
 }
 
+SampleSinkFifo *SigMFFileSink::getInputSampleFifo()
+{
+    return m_running ? m_basebandSink->getSampleFifo() : nullptr;
+}
+
 bool SigMFFileSink::handleMessage(const Message& cmd)
 {
     if (DSPSignalNotification::match(cmd))
@@ -360,6 +365,9 @@ void SigMFFileSink::applySettings(const SigMFFileSinkSettings& settings, bool fo
     if ((settings.m_squelchRecordingEnable != m_settings.m_squelchRecordingEnable) || force) {
         reverseAPIKeys.append("squelchRecordingEnable");
     }
+    if ((settings.m_directIO != m_settings.m_directIO) || force) {
+        reverseAPIKeys.append("directIO");
+    }
 
     if (m_settings.m_streamIndex != settings.m_streamIndex)
     {
@@ -565,6 +573,9 @@ void SigMFFileSink::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("squelchRecordingEnable")) {
         settings.m_squelchRecordingEnable = response.getSigMfFileSinkSettings()->getSquelchRecordingEnable() != 0;
     }
+    if (channelSettingsKeys.contains("directIO")) {
+        settings.m_directIO = response.getSigMfFileSinkSettings()->getDirectIo() != 0;
+    }
     if (channelSettingsKeys.contains("streamIndex")) {
         settings.m_streamIndex = response.getSigMfFileSinkSettings()->getStreamIndex();
     }
@@ -621,6 +632,7 @@ void SigMFFileSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings&
     response.getSigMfFileSinkSettings()->setPreRecordTime(settings.m_preRecordTime);
     response.getSigMfFileSinkSettings()->setSquelchPostRecordTime(settings.m_squelchPostRecordTime);
     response.getSigMfFileSinkSettings()->setSquelchRecordingEnable(settings.m_squelchRecordingEnable ? 1 : 0);
+    response.getSigMfFileSinkSettings()->setDirectIo(settings.m_directIO ? 1 : 0);
     response.getSigMfFileSinkSettings()->setStreamIndex(settings.m_streamIndex);
     response.getSigMfFileSinkSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -686,6 +698,11 @@ void SigMFFileSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& res
         response.getSigMfFileSinkReport()->setSinkSampleRate(m_basebandSink->getSinkSampleRate());
         response.getSigMfFileSinkReport()->setRecording(m_basebandSink->isRecording() ? 1 : 0);
         response.getSigMfFileSinkReport()->setChannelSampleRate(m_basebandSink->getChannelSampleRate());
+        FileRecordWriter::Stats stats;
+        m_basebandSink->getWriterStats(stats);
+        response.getSigMfFileSinkReport()->setRecordDroppedBytes(stats.m_droppedBytes);
+        response.getSigMfFileSinkReport()->setRecordWriteStalls(stats.m_writeStalls);
+        response.getSigMfFileSinkReport()->setRecordMaxPendingBuffers(stats.m_maxPendingBuffers);
     }
 
     response.getSigMfFileSinkReport()->setRecordCaptures(getNbTracks());
@@ -789,6 +806,9 @@ void SigMFFileSink::webapiFormatChannelSettings(
     if (channelSettingsKeys.contains("squelchRecordingEnable")) {
         swgSigMFFileSinkSettings->setSquelchRecordingEnable(settings.m_squelchRecordingEnable ? 1 : 0);
     }
+    if (channelSettingsKeys.contains("directIO")) {
+        swgSigMFFileSinkSettings->setDirectIo(settings.m_directIO ? 1 : 0);
+    }
     if (channelSettingsKeys.contains("streamIndex")) {
         swgSigMFFileSinkSettings->setStreamIndex(settings.m_streamIndex);
     }
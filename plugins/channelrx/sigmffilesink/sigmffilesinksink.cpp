@@ -47,6 +47,7 @@ void SigMFFileSinkSink::startRecording()
         // set the length of pre record time
         qint64 mSShift = (m_preRecordFill * 1000) / m_sinkSampleRate;
         m_fileSink.setMsShift(-mSShift);
+        m_fileSink.setDirectIO(m_settings.m_directIO); // effective when the data file is opened
 
         // notify capture start
         m_fileSink.startRecording();
@@ -135,6 +135,11 @@ void UDPSink::stop()
 	m_thread->wait();
 }
 
+SampleSinkFifo *UDPSink::getInputSampleFifo()
+{
+    return m_basebandSink->getSampleFifo();
+}
+
 bool UDPSink::handleMessage(const Message& cmd)
 {
     if (MsgConfigureUDPSink::match(cmd))
@@ -89,6 +89,7 @@ public:
 	double getInMagSq() const { return m_sink.getInMagSq(); }
 	bool getSquelchOpen() const { return m_sink.getSquelchOpen(); }
     void setFifoLabel(const QString& label) { m_sampleFifo.setLabel(label); }
+    SampleSinkFifo *getSampleFifo() { return &m_sampleFifo; }
     void setAudioFifoLabel(const QString& label) { m_sink.setAudioFifoLabel(label); }
 
 private:
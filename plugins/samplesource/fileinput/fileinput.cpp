@@ -17,6 +17,8 @@
 
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
+#include <fstream>
 
 #include <QDebug>
 #include <QNetworkReply>
@@ -53,6 +55,7 @@ MESSAGE_CLASS_DEFINITION(FileInput::MsgReportHeaderCRC, Message)
 FileInput::FileInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
 	m_settings(),
+	m_dataOffset(0),
 	m_fileInputWorker(nullptr),
 	m_deviceDescription("FileInput"),
 	m_sampleRate(48000),
@@ -73,6 +76,15 @@ FileInput::FileInput(DeviceAPI *deviceAPI) :
         this,
         &FileInput::networkManagerFinished
     );
+    // direct connection so that a channel being deleted is removed from the worker before its FIFO goes away
+    QObject::connect(
+        m_deviceAPI,
+        &DeviceAPI::sinkChannelsChanged,
+        this,
+        &FileInput::sinkChannelsChanged,
+        Qt::DirectConnection
+    );
+    sinkChannelsChanged();
     m_masterTimer.setTimerType(Qt::PreciseTimer);
     m_masterTimer.start(50);
 }
@@ -80,6 +92,12 @@ FileInput::FileInput(DeviceAPI *deviceAPI) :
 FileInput::~FileInput()
 {
     m_masterTimer.stop();
+    QObject::disconnect(
+        m_deviceAPI,
+        &DeviceAPI::sinkChannelsChanged,
+        this,
+        &FileInput::sinkChannelsChanged
+    );
     QObject::disconnect(
         m_networkManager,
         &QNetworkAccessManager::finished,
@@ -99,23 +117,23 @@ void FileInput::destroy()
 void FileInput::openFileStream()
 {
 	//stopInput();
+	m_sampleFile.close();
+	m_dataOffset = 0;
 
-	if (m_ifstream.is_open()) {
-		m_ifstream.close();
-	}
-
+	// the header is parsed with a stream. Samples are then read from the file mapping
+	std::ifstream headerStream;
 #ifdef Q_OS_WIN
-	m_ifstream.open(m_settings.m_fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
+	headerStream.open(m_settings.m_fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
 #else
-	m_ifstream.open(m_settings.m_fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
+	headerStream.open(m_settings.m_fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
 #endif
-	quint64 fileSize = m_ifstream.tellg();
+	quint64 fileSize = headerStream.is_open() ? (quint64) headerStream.tellg() : 0;
 
 	if (m_settings.m_fileName.endsWith(".wav"))
     {
         WavFileRecord::Header header;
-        m_ifstream.seekg(0, std::ios_base::beg);
-        bool headerOK = WavFileRecord::readHeader(m_ifstream, header);
+        headerStream.seekg(0, std::ios_base::beg);
+        bool headerOK = WavFileRecord::readHeader(headerStream, header);
         m_sampleRate = header.m_sampleRate;
         if (header.m_auxiHeader.m_size > 0)
         {
@@ -136,7 +154,8 @@ void FileInput::openFileStream()
 
         if (headerOK && (m_sampleRate > 0) && (m_sampleSize > 0))
         {
-            m_recordLengthMuSec = ((fileSize - m_ifstream.tellg()) * 1000000UL) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
+            m_dataOffset = headerStream.tellg();
+            m_recordLengthMuSec = ((fileSize - m_dataOffset) * 1000000UL) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
         }
         else
         {
@@ -153,12 +172,13 @@ void FileInput::openFileStream()
     else if (fileSize > sizeof(FileRecord::Header))
 	{
 	    FileRecord::Header header;
-	    m_ifstream.seekg(0,std::ios_base::beg);
-		bool crcOK = FileRecord::readHeader(m_ifstream, header);
+	    headerStream.seekg(0,std::ios_base::beg);
+		bool crcOK = FileRecord::readHeader(headerStream, header);
 		m_sampleRate = header.sampleRate;
 		m_centerFrequency = header.centerFrequency;
 		m_startingTimeStamp = header.startTimeStamp;
 		m_sampleSize = header.sampleSize;
+		m_dataOffset = sizeof(FileRecord::Header);
 		QString crcHex = QString("%1").arg(header.crc32 , 0, 16);
 
 	    if (crcOK && (m_sampleRate > 0) && (m_sampleSize > 0))
@@ -188,6 +208,8 @@ void FileInput::openFileStream()
 		m_recordLengthMuSec = 0;
 	}
 
+	headerStream.close();
+
 	qDebug() << "FileInput::openFileStream: " << m_settings.m_fileName.toStdString().c_str()
 			<< " fileSize: " << fileSize << " bytes"
 			<< " length: " << m_recordLengthMuSec << " microseconds"
@@ -199,7 +221,8 @@ void FileInput::openFileStream()
     {
         DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
         getMessageQueueToGUI()->push(notif);
-	    MsgReportFileInputStreamData *report = MsgReportFileInputStreamData::create(m_sampleRate,
+	    MsgReportFileInputStreamData *report = MsgReportFileInputStreamData::create(m_settings.m_fileName,
+	            m_sampleRate,
 	            m_sampleSize,
 	            m_centerFrequency,
 	            m_startingTimeStamp,
@@ -207,23 +230,78 @@ void FileInput::openFileStream()
 	    getMessageQueueToGUI()->push(report);
 	}
 
-	if (m_recordLengthMuSec == 0) {
-	    m_ifstream.close();
+	if ((m_recordLengthMuSec != 0) && !m_sampleFile.open(m_settings.m_fileName)) {
+	    m_recordLengthMuSec = 0;
+	}
+
+	if (m_fileInputWorker && !m_fileInputWorker->isRunning())
+	{
+	    m_fileInputWorker->setDataOffset(m_dataOffset);
+	    m_fileInputWorker->setSamplesCount(0);
 	}
 }
 
+bool FileInput::openNextPlaylistFile()
+{
+    if (m_settings.m_playlist.size() < 2) {
+        return false;
+    }
+
+    int index = m_settings.m_playlist.indexOf(m_settings.m_fileName) + 1;
+
+    if (index >= m_settings.m_playlist.size())
+    {
+        if (!m_settings.m_loop) {
+            return false;
+        }
+
+        index = 0;
+    }
+
+    qDebug("FileInput::openNextPlaylistFile: %d: %s", index, qPrintable(m_settings.m_playlist[index]));
+    m_settings.m_fileName = m_settings.m_playlist[index];
+    openFileStream();
+
+    if (!m_sampleFile.isOpen()) {
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sampleFifo.setSize(getSampleFifoSize())) {
+        qCritical("FileInput::openNextPlaylistFile: could not reallocate sample FIFO");
+    }
+
+    m_fileInputWorker->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize);
+
+    // files of a playlist may have different sample rates and center frequencies
+    DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+    m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+
+    return true;
+}
+
+unsigned int FileInput::getSampleFifoSize() const
+{
+    unsigned int size = m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample);
+
+    // without pacing the FIFO must hold several reads for the DSP engine to work on large blocks
+    if (m_settings.m_asFastAsPossible) {
+        size = std::max(size, 4U * FILESOURCE_FAST_CHUNK_SAMPLES);
+    }
+
+    return size;
+}
+
 void FileInput::seekFileStream(int seekMillis)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
-	if ((m_ifstream.is_open()) && m_fileInputWorker && !m_fileInputWorker->isRunning())
+	if (m_sampleFile.isOpen() && m_fileInputWorker && !m_fileInputWorker->isRunning())
 	{
         quint64 seekPoint = ((m_recordLengthMuSec * seekMillis) / 1000) * m_sampleRate;
         seekPoint /= 1000000UL;
-		m_fileInputWorker->setSamplesCount(seekPoint);
-        seekPoint *= (m_sampleSize == 24 ? 8 : 4); // + sizeof(FileRecord::Header)
-		m_ifstream.clear();
-		m_ifstream.seekg(seekPoint + sizeof(FileRecord::Header), std::ios::beg);
+		m_fileInputWorker->setSamplesCount(seekPoint); // a seek is only a change of offset in the mapping
 	}
 }
 
@@ -235,7 +313,7 @@ void FileInput::init()
 
 bool FileInput::start()
 {
-    if (!m_ifstream.is_open())
+    if (!m_sampleFile.isOpen())
     {
         qWarning("FileInput::start: file not open. not starting");
         return false;
@@ -244,21 +322,18 @@ bool FileInput::start()
 	QMutexLocker mutexLocker(&m_mutex);
 	qDebug() << "FileInput::start";
 
-	if (m_ifstream.tellg() != (std::streampos)0)
-    {
-		m_ifstream.clear();
-		m_ifstream.seekg(sizeof(FileRecord::Header), std::ios::beg);
-	}
-
-	if (!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample)))
+	if (!m_sampleFifo.setSize(getSampleFifoSize()))
     {
 		qCritical("Could not allocate SampleFifo");
 		return false;
 	}
 
-	m_fileInputWorker = new FileInputWorker(&m_ifstream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+	m_fileInputWorker = new FileInputWorker(&m_sampleFile, m_dataOffset, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
 	m_fileInputWorker->moveToThread(&m_fileInputWorkerThread);
 	m_fileInputWorker->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
+	m_fileInputWorker->setAsFastAsPossible(m_settings.m_asFastAsPossible);
+	m_fileInputWorker->setChannelAPIs(m_sinkChannelAPIs);
+	m_fileInputWorker->setSamplesCount(0);
 	startWorker();
 
 	m_deviceDescription = "FileInput";
@@ -296,6 +371,20 @@ void FileInput::stop()
 	}
 }
 
+void FileInput::sinkChannelsChanged()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_sinkChannelAPIs.clear();
+
+    for (int i = 0; i < m_deviceAPI->getNbSinkChannels(); i++) {
+        m_sinkChannelAPIs.append(m_deviceAPI->getChanelSinkAPIAt(i));
+    }
+
+    if (m_fileInputWorker) {
+        m_fileInputWorker->setChannelAPIs(m_sinkChannelAPIs);
+    }
+}
+
 void FileInput::startWorker()
 {
 	m_fileInputWorker->startWork();
@@ -460,7 +549,11 @@ bool FileInput::handleMessage(const Message& message)
             getMessageQueueToGUI()->push(report);
         }
 
-        if (m_settings.m_loop)
+        if (openNextPlaylistFile())
+        {
+            startWorker();
+        }
+        else if (m_settings.m_loop && (m_settings.m_playlist.size() < 2))
         {
             seekFileStream(0);
 			startWorker();
@@ -493,9 +586,8 @@ bool FileInput::applySettings(const FileInputSettings& settings, bool force)
         if (m_fileInputWorker)
         {
             QMutexLocker mutexLocker(&m_mutex);
-            if (!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample))) {
-                qCritical("FileInput::applySettings: could not reallocate sample FIFO size to %lu",
-                        m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample));
+            if (!m_sampleFifo.setSize(getSampleFifoSize())) {
+                qCritical("FileInput::applySettings: could not reallocate sample FIFO size to %u", getSampleFifoSize());
             }
 			m_fileInputWorker->setSampleRateAndSize(settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
         }
@@ -507,6 +599,15 @@ bool FileInput::applySettings(const FileInputSettings& settings, bool force)
     if ((m_settings.m_fileName != settings.m_fileName)) {
         reverseAPIKeys.append("fileName");
     }
+    if ((m_settings.m_playlist != settings.m_playlist) || force) {
+        reverseAPIKeys.append("playlist");
+    }
+
+    bool asFastAsPossibleChanged = (m_settings.m_asFastAsPossible != settings.m_asFastAsPossible) || force;
+
+    if (asFastAsPossibleChanged) {
+        reverseAPIKeys.append("asFastAsPossible");
+    }
 
     if (settings.m_useReverseAPI)
     {
@@ -519,6 +620,29 @@ bool FileInput::applySettings(const FileInputSettings& settings, bool force)
 
     m_settings = settings;
 
+    if (asFastAsPossibleChanged && m_fileInputWorker)
+    {
+        // pacing changes only while the worker is stopped
+        bool running = m_fileInputWorker->isRunning();
+
+        if (running) {
+            stopWorker();
+        }
+
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (!m_sampleFifo.setSize(getSampleFifoSize())) {
+            qCritical("FileInput::applySettings: could not reallocate sample FIFO size to %u", getSampleFifoSize());
+        }
+
+        m_fileInputWorker->setAsFastAsPossible(m_settings.m_asFastAsPossible);
+        mutexLocker.unlock();
+
+        if (running) {
+            startWorker();
+        }
+    }
+
     // Open the file if there isn't a GUI which will open it
     if ((m_guiMessageQueue == nullptr) && reverseAPIKeys.contains("fileName") && !m_settings.m_fileName.isEmpty())
         openFileStream();
@@ -574,6 +698,21 @@ void FileInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("loop")) {
         settings.m_loop = response.getFileInputSettings()->getLoop() != 0;
     }
+    if (deviceSettingsKeys.contains("asFastAsPossible")) {
+        settings.m_asFastAsPossible = response.getFileInputSettings()->getAsFastAsPossible() != 0;
+    }
+    if (deviceSettingsKeys.contains("playlist"))
+    {
+        settings.m_playlist.clear();
+        QList<QString*> *playlist = response.getFileInputSettings()->getPlaylist();
+
+        if (playlist)
+        {
+            for (const auto& fileName : *playlist) {
+                settings.m_playlist.append(*fileName);
+            }
+        }
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getFileInputSettings()->getUseReverseApi() != 0;
     }
@@ -632,6 +771,20 @@ void FileInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& respo
     response.getFileInputSettings()->setFileName(new QString(settings.m_fileName));
     response.getFileInputSettings()->setAccelerationFactor(settings.m_accelerationFactor);
     response.getFileInputSettings()->setLoop(settings.m_loop ? 1 : 0);
+    response.getFileInputSettings()->setAsFastAsPossible(settings.m_asFastAsPossible ? 1 : 0);
+
+    if (response.getFileInputSettings()->getPlaylist()) {
+        qDeleteAll(*response.getFileInputSettings()->getPlaylist());
+        delete response.getFileInputSettings()->getPlaylist();
+    }
+
+    QList<QString*> *playlist = new QList<QString*>();
+
+    for (const auto& fileName : settings.m_playlist) {
+        playlist->append(new QString(fileName));
+    }
+
+    response.getFileInputSettings()->setPlaylist(playlist);
 
     response.getFileInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -698,6 +851,19 @@ void FileInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, co
     if (deviceSettingsKeys.contains("loop") || force) {
         swgFileInputSettings->setLoop(settings.m_loop);
     }
+    if (deviceSettingsKeys.contains("asFastAsPossible") || force) {
+        swgFileInputSettings->setAsFastAsPossible(settings.m_asFastAsPossible ? 1 : 0);
+    }
+    if (deviceSettingsKeys.contains("playlist") || force)
+    {
+        QList<QString*> *playlist = new QList<QString*>();
+
+        for (const auto& fileName : settings.m_playlist) {
+            playlist->append(new QString(fileName));
+        }
+
+        swgFileInputSettings->setPlaylist(playlist);
+    }
     if (deviceSettingsKeys.contains("fileName") || force) {
         swgFileInputSettings->setFileName(new QString(settings.m_fileName));
     }
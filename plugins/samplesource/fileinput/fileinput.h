@@ -19,8 +19,6 @@
 #define INCLUDE_FILEINPUT_H
 
 #include <ctime>
-#include <iostream>
-#include <fstream>
 
 #include <QString>
 #include <QByteArray>
@@ -30,12 +28,14 @@
 #include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
+#include "dsp/mappedsamplefile.h"
 #include "fileinputsettings.h"
 
 class QNetworkAccessManager;
 class QNetworkReply;
 class FileInputWorker;
 class DeviceAPI;
+class ChannelAPI;
 
 class FileInput : public DeviceSampleSource {
 	Q_OBJECT
@@ -202,34 +202,39 @@ public:
 		MESSAGE_CLASS_DECLARATION
 
 	public:
+		const QString& getFileName() const { return m_fileName; }
 		int getSampleRate() const { return m_sampleRate; }
 		quint32 getSampleSize() const { return m_sampleSize; }
 		quint64 getCenterFrequency() const { return m_centerFrequency; }
         quint64 getStartingTimeStamp() const { return m_startingTimeStamp; }
         quint64 getRecordLengthMuSec() const { return m_recordLengthMuSec; }
 
-		static MsgReportFileInputStreamData* create(int sampleRate,
+		static MsgReportFileInputStreamData* create(const QString& fileName,
+		        int sampleRate,
 		        quint32 sampleSize,
 				quint64 centerFrequency,
                 quint64 startingTimeStamp,
                 quint64 recordLength)
 		{
-			return new MsgReportFileInputStreamData(sampleRate, sampleSize, centerFrequency, startingTimeStamp, recordLength);
+			return new MsgReportFileInputStreamData(fileName, sampleRate, sampleSize, centerFrequency, startingTimeStamp, recordLength);
 		}
 
 	protected:
+		QString m_fileName;
 		int m_sampleRate;
 		quint32 m_sampleSize;
 		quint64 m_centerFrequency;
         quint64 m_startingTimeStamp;
         quint64 m_recordLengthMuSec;
 
-		MsgReportFileInputStreamData(int sampleRate,
+		MsgReportFileInputStreamData(const QString& fileName,
+		        int sampleRate,
 		        quint32 sampleSize,
 				quint64 centerFrequency,
                 quint64 startingTimeStamp,
                 quint64 recordLengthMuSec) :
 			Message(),
+			m_fileName(fileName),
 			m_sampleRate(sampleRate),
 			m_sampleSize(sampleSize),
 			m_centerFrequency(centerFrequency),
@@ -332,9 +337,11 @@ public:
 	DeviceAPI *m_deviceAPI;
 	QMutex m_mutex;
 	FileInputSettings m_settings;
-	std::ifstream m_ifstream;
+	MappedSampleFile m_sampleFile;
+	quint64 m_dataOffset; //!< position of first sample in file
 	FileInputWorker* m_fileInputWorker;
 	QThread m_fileInputWorkerThread;
+	QList<ChannelAPI*> m_sinkChannelAPIs; //!< copy of the device set channels maintained in the main thread
 	QString m_deviceDescription;
 	int m_sampleRate;
 	quint32 m_sampleSize;
@@ -349,6 +356,8 @@ public:
 	void stopWorker();
 	void openFileStream();
 	void seekFileStream(int seekMillis);
+	bool openNextPlaylistFile();
+	unsigned int getSampleFifoSize() const;
 	bool applySettings(const FileInputSettings& settings, bool force = false);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FileInputSettings& settings, bool force);
@@ -357,6 +366,7 @@ public:
 
 private slots:
     void networkManagerFinished(QNetworkReply *reply);
+    void sinkChannelsChanged();
 };
 
 #endif // INCLUDE_FILESOURCEINPUT_H
@@ -172,6 +172,9 @@ bool FileInputGUI::handleMessage(const Message& message)
 		m_centerFrequency = ((FileInput::MsgReportFileInputStreamData&)message).getCenterFrequency();
 		m_startingTimeStamp = ((FileInput::MsgReportFileInputStreamData&)message).getStartingTimeStamp();
 		m_recordLengthMuSec = ((FileInput::MsgReportFileInputStreamData&)message).getRecordLengthMuSec();
+		// the file changes while playing a playlist
+		m_settings.m_fileName = ((FileInput::MsgReportFileInputStreamData&)message).getFileName();
+		ui->fileNameText->setText(m_settings.m_fileName);
 		updateWithStreamData();
 		return true;
 	}
@@ -229,6 +232,7 @@ void FileInputGUI::displaySettings()
 {
     blockApplySettings(true);
     ui->playLoop->setChecked(m_settings.m_loop);
+    ui->asFastAsPossible->setChecked(m_settings.m_asFastAsPossible);
     ui->acceleration->setCurrentIndex(FileInputSettings::getAccelerationIndex(m_settings.m_accelerationFactor));
     if (!m_settings.m_fileName.isEmpty() && (m_settings.m_fileName != ui->fileNameText->text()))
     {
@@ -253,6 +257,16 @@ void FileInputGUI::on_playLoop_toggled(bool checked)
     }
 }
 
+void FileInputGUI::on_asFastAsPossible_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        m_settings.m_asFastAsPossible = checked;
+        FileInput::MsgConfigureFileInput *message = FileInput::MsgConfigureFileInput::create(m_settings, false);
+        m_sampleSource->getInputMessageQueue()->push(message);
+    }
+}
+
 void FileInputGUI::on_startStop_toggled(bool checked)
 {
     if (m_doApplySettings)
@@ -312,14 +326,19 @@ void FileInputGUI::on_navTimeSlider_valueChanged(int value)
 void FileInputGUI::on_showFileDialog_clicked(bool checked)
 {
     (void) checked;
-	QString fileName = QFileDialog::getOpenFileName(this,
-	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq *.wav)"), 0, QFileDialog::DontUseNativeDialog);
+    // selecting several files makes a playlist played in name order
+	QStringList fileNames = QFileDialog::getOpenFileNames(this,
+	    tr("Open I/Q record files"), ".", tr("SDR I/Q Files (*.sdriq *.wav)"), 0, QFileDialog::DontUseNativeDialog);
 
-	if (fileName != "")
+	if (fileNames.size() > 0)
 	{
-		m_settings.m_fileName = fileName;
+		fileNames.sort();
+		m_settings.m_fileName = fileNames.front();
+		m_settings.m_playlist = fileNames.size() > 1 ? fileNames : QStringList();
 		ui->fileNameText->setText(m_settings.m_fileName);
 		ui->crcLabel->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		FileInput::MsgConfigureFileInput *message = FileInput::MsgConfigureFileInput::create(m_settings, false);
+		m_sampleSource->getInputMessageQueue()->push(message);
 		configureFileName();
 	}
 }
@@ -467,6 +486,7 @@ void FileInputGUI::makeUIConnections()
 {
     QObject::connect(ui->startStop, &ButtonSwitch::toggled, this, &FileInputGUI::on_startStop_toggled);
     QObject::connect(ui->playLoop, &ButtonSwitch::toggled, this, &FileInputGUI::on_playLoop_toggled);
+    QObject::connect(ui->asFastAsPossible, &ButtonSwitch::toggled, this, &FileInputGUI::on_asFastAsPossible_toggled);
     QObject::connect(ui->play, &ButtonSwitch::toggled, this, &FileInputGUI::on_play_toggled);
     QObject::connect(ui->navTimeSlider, &QSlider::valueChanged, this, &FileInputGUI::on_navTimeSlider_valueChanged);
     QObject::connect(ui->showFileDialog, &QPushButton::clicked, this, &FileInputGUI::on_showFileDialog_clicked);
@@ -90,6 +90,7 @@ private slots:
     void handleInputMessages();
 	void on_startStop_toggled(bool checked);
 	void on_playLoop_toggled(bool checked);
+	void on_asFastAsPossible_toggled(bool checked);
 	void on_play_toggled(bool checked);
 	void on_navTimeSlider_valueChanged(int value);
 	void on_showFileDialog_clicked(bool checked);
@@ -32,6 +32,8 @@ void FileInputSettings::resetToDefaults()
     m_fileName = "";
     m_accelerationFactor = 1;
     m_loop = true;
+    m_asFastAsPossible = false;
+    m_playlist.clear();
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -48,6 +50,8 @@ QByteArray FileInputSettings::serialize() const
     s.writeString(5, m_reverseAPIAddress);
     s.writeU32(6, m_reverseAPIPort);
     s.writeU32(7, m_reverseAPIDeviceIndex);
+    s.writeBool(8, m_asFastAsPossible);
+    s.writeList(9, m_playlist);
 
     return s.final();
 }
@@ -80,6 +84,9 @@ bool FileInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(7, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readBool(8, &m_asFastAsPossible, false);
+        m_playlist.clear();
+        d.readList(9, &m_playlist);
 
         return true;
     }
@@ -19,12 +19,15 @@
 #define PLUGINS_SAMPLESOURCE_FILEINPUT_FILEINPUTSETTINGS_H_
 
 #include <QString>
+#include <QStringList>
 #include <QByteArray>
 
 struct FileInputSettings {
     QString m_fileName;
     quint32 m_accelerationFactor;
     bool m_loop;
+    bool m_asFastAsPossible;  //!< Replay paced by the processing only (offline processing)
+    QStringList m_playlist;   //!< Files played in sequence. m_fileName is the current one
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
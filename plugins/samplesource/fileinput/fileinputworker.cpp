@@ -17,24 +17,35 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <algorithm>
 #include <QDebug>
 
 #include "dsp/filerecord.h"
+#include "dsp/mappedsamplefile.h"
 #include "fileinputworker.h"
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandsamplesink.h"
+#include "channel/channelapi.h"
+#include "device/deviceapi.h"
 #include "util/messagequeue.h"
 
 MESSAGE_CLASS_DEFINITION(FileInputWorker::MsgReportEOF, Message)
 
-FileInputWorker::FileInputWorker(std::ifstream *samplesStream,
+FileInputWorker::FileInputWorker(MappedSampleFile *sampleFile,
+        quint64 dataOffset,
         SampleSinkFifo* sampleFifo,
         const QTimer& timer,
         MessageQueue *fileInputMessageQueue,
         QObject* parent) :
 	QObject(parent),
 	m_running(false),
-	m_ifstream(samplesStream),
-	m_fileBuf(nullptr),
+	m_sampleFile(sampleFile),
+	m_dataOffset(dataOffset),
+	m_readAheadEnd(0),
+	m_asFastAsPossible(false),
+	m_fastTickGeneration(0),
+	m_eofReported(false),
+	m_channelOverflowCount(0),
 	m_convertBuf(nullptr),
 	m_bufsize(0),
 	m_chunksize(0),
@@ -56,10 +67,6 @@ FileInputWorker::~FileInputWorker()
 		stopWork();
 	}
 
-	if (m_fileBuf) {
-		free(m_fileBuf);
-	}
-
 	if (m_convertBuf) {
 		free(m_convertBuf);
 	}
@@ -69,16 +76,29 @@ void FileInputWorker::startWork()
 {
 	qDebug() << "FileInputThread::startWork: ";
 
-    if (m_ifstream->is_open())
+    if (m_sampleFile->isOpen())
     {
-        qDebug() << "FileInputThread::startWork: file stream open, starting...";
-        m_elapsedTimer.start();
-        connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
-		m_running = true;
+        qDebug() << "FileInputThread::startWork: file open, starting" << (m_asFastAsPossible ? "as fast as possible" : "");
+        m_running = true;
+
+        if (m_asFastAsPossible)
+        {
+            // paced by the sample FIFO free space instead of the master timer
+            setBuffers(FILESOURCE_FAST_CHUNK_SAMPLES * 2 * m_samplebytes);
+            unsigned int channelFifoSize, channelFifoFree;
+            getChannelFifosSpace(channelFifoSize, channelFifoFree, m_channelOverflowCount);
+            m_fastTickGeneration++;
+            scheduleFastTick(0);
+        }
+        else
+        {
+            m_elapsedTimer.start();
+            connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+        }
     }
     else
     {
-        qDebug() << "FileInputThread::startWork: file stream closed, not starting.";
+        qDebug() << "FileInputThread::startWork: file closed, not starting.";
     }
 }
 
@@ -86,9 +106,21 @@ void FileInputWorker::stopWork()
 {
 	qDebug() << "FileInputThread::stopWork";
 	disconnect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+	m_fastTickGeneration++; // cancels pending fast ticks
 	m_running = false;
 }
 
+void FileInputWorker::setSamplesCount(quint64 samplesCount)
+{
+    m_samplesCount = samplesCount;
+    m_eofReported = false; // new file or seek
+    m_readAheadEnd = 0;
+
+    if (m_samplebytes != 0) {
+        readAhead(m_dataOffset + m_samplesCount * 2 * m_samplebytes);
+    }
+}
+
 void FileInputWorker::setSampleRateAndSize(int samplerate, quint32 samplesize)
 {
 	qDebug() << "FileInputThread::setSampleRateAndSize:"
@@ -121,22 +153,6 @@ void FileInputWorker::setBuffers(std::size_t chunksize)
         m_bufsize = chunksize;
         int nbSamples = m_bufsize/(2 * m_samplebytes);
 
-        if (!m_fileBuf)
-        {
-            qDebug() << "FileInputThread::setBuffers: Allocate file buffer";
-            m_fileBuf = (quint8*) malloc(m_bufsize);
-        }
-        else
-        {
-            qDebug() << "FileInputThread::setBuffers: Re-allocate file buffer";
-            quint8 *buf = m_fileBuf;
-            m_fileBuf = (quint8*) realloc((void*) m_fileBuf, m_bufsize);
-
-            if (!m_fileBuf) {
-                free(buf);
-            }
-        }
-
         if (!m_convertBuf)
         {
             qDebug() << "FileInputThread::setBuffers: Allocate conversion buffer";
@@ -172,21 +188,164 @@ void FileInputWorker::tick()
             setBuffers(m_chunksize);
         }
 
-		// read samples directly feeding the SampleFifo (no callback)
-		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+		// samples are taken directly from the file mapping feeding the SampleFifo (no callback)
+        if (readToSampleFifo(m_chunksize) < m_chunksize) {
+            reportEOF();
+        }
+	}
+}
+
+void FileInputWorker::scheduleFastTick(int delayMs)
+{
+    unsigned int generation = m_fastTickGeneration;
+    QTimer::singleShot(delayMs, this, [this, generation]() { fastTick(generation); });
+}
+
+void FileInputWorker::fastTick(unsigned int generation)
+{
+    if (!m_running || (generation != m_fastTickGeneration)) {
+        return;
+    }
+
+    unsigned int fifoSize = m_sampleFifo->size();
+    unsigned int fifoFill = m_sampleFifo->fill();
+    unsigned int fifoFree = fifoSize - fifoFill;
+
+    // let the DSP engine drain the FIFO rather than feeding it with tiny blocks
+    if (fifoFree < fifoSize / 4)
+    {
+        scheduleFastTick(FILESOURCE_FAST_WAIT_MS);
+        return;
+    }
+
+    unsigned int channelFifoSize, channelFifoFree;
+    quint64 channelOverflowCount;
 
-        if (m_ifstream->eof())
+    if (getChannelFifosSpace(channelFifoSize, channelFifoFree, channelOverflowCount))
+    {
+        if (channelOverflowCount > m_channelOverflowCount)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount());
-        	MsgReportEOF *message = MsgReportEOF::create();
-        	m_fileInputMessageQueue->push(message);
+            qWarning("FileInputWorker::fastTick: %llu channel FIFO overflows in fast mode",
+                channelOverflowCount - m_channelOverflowCount);
         }
-        else
+
+        m_channelOverflowCount = channelOverflowCount;
+        // samples still in the device FIFO will end up in every channel FIFO
+        unsigned int channelFree = channelFifoFree > fifoFill ? channelFifoFree - fifoFill : 0;
+
+        // let the slowest channel drain its FIFO
+        if (channelFree < channelFifoSize / 4)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
-    		m_samplesCount += m_chunksize / (2 * m_samplebytes);
+            scheduleFastTick(FILESOURCE_FAST_WAIT_MS);
+            return;
         }
-	}
+
+        fifoFree = std::min(fifoFree, channelFree);
+    }
+
+    qint64 nbBytes = std::min(fifoFree, (unsigned int) FILESOURCE_FAST_CHUNK_SAMPLES) * 2 * m_samplebytes;
+
+    if (readToSampleFifo(nbBytes) < nbBytes)
+    {
+        reportEOF();
+        return;
+    }
+
+    scheduleFastTick(0);
+}
+
+void FileInputWorker::reportEOF()
+{
+    // ticks may run again before the EOF is handled. Report once per file
+    if (!m_eofReported)
+    {
+        m_eofReported = true;
+        MsgReportEOF *message = MsgReportEOF::create();
+        m_fileInputMessageQueue->push(message);
+    }
+}
+
+void FileInputWorker::setChannelAPIs(const QList<ChannelAPI*>& channelAPIs)
+{
+    QMutexLocker mutexLocker(&m_channelsMutex);
+    m_channelAPIs = channelAPIs;
+}
+
+bool FileInputWorker::getChannelFifosSpace(unsigned int& size, unsigned int& free, quint64& overflowCount)
+{
+    QMutexLocker mutexLocker(&m_channelsMutex); // channels are not removed while their FIFO is read
+    bool found = false;
+    overflowCount = 0;
+
+    for (ChannelAPI *channelAPI : m_channelAPIs)
+    {
+        ChannelAPI::InputFifoStats fifoStats; // own or shared baseband FIFO actually read by the channel
+
+        if (!channelAPI->getInputFifoStats(fifoStats)) {
+            continue;
+        }
+
+        unsigned int channelFifoSize = fifoStats.m_size;
+        unsigned int channelFifoFill = fifoStats.m_fill;
+        overflowCount += fifoStats.m_overflowCount;
+        BasebandSampleSink *sink = dynamic_cast<BasebandSampleSink*>(channelAPI);
+        unsigned int queuedSamples, freeBlocks;
+        quint64 droppedBlocks;
+
+        if (sink && channelAPI->getDeviceAPI()->getChannelSinkFanOutQueue(sink, queuedSamples, freeBlocks, droppedBlocks))
+        {
+            // blocks waiting in the fan out queue end up in the channel FIFO. The next block is dropped if the queue is full
+            channelFifoFill = freeBlocks == 0 ? channelFifoSize : channelFifoFill + queuedSamples;
+            overflowCount += droppedBlocks;
+        }
+
+        unsigned int channelFifoFree = channelFifoSize > channelFifoFill ? channelFifoSize - channelFifoFill : 0;
+
+        if (!found || (channelFifoFree < free))
+        {
+            size = channelFifoSize;
+            free = channelFifoFree;
+        }
+
+        found = true;
+    }
+
+    return found;
+}
+
+qint64 FileInputWorker::readToSampleFifo(qint64 nbBytes)
+{
+    qint64 sampleBytes = 2 * m_samplebytes;
+    qint64 done = 0;
+    nbBytes = (nbBytes / sampleBytes) * sampleBytes;
+
+    while (done < nbBytes)
+    {
+        quint64 size = nbBytes - done;
+        const uchar *data = m_sampleFile->data(m_dataOffset + m_samplesCount * sampleBytes, size);
+        size = (size / sampleBytes) * sampleBytes;
+
+        if (!data || (size == 0)) { // end of file
+            break;
+        }
+
+        writeToSampleFifo(data, (qint32) size);
+        m_samplesCount += size / sampleBytes;
+        done += size;
+    }
+
+    readAhead(m_dataOffset + m_samplesCount * sampleBytes);
+    return done;
+}
+
+void FileInputWorker::readAhead(quint64 offset)
+{
+    // renew the hint when half of the previous read ahead range has been consumed
+    if (offset + FILESOURCE_READAHEAD_BYTES/2 > m_readAheadEnd)
+    {
+        m_sampleFile->willNeed(offset, FILESOURCE_READAHEAD_BYTES);
+        m_readAheadEnd = offset + FILESOURCE_READAHEAD_BYTES;
+    }
 }
 
 void FileInputWorker::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
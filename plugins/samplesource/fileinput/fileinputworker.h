@@ -20,17 +20,22 @@
 
 #include <QTimer>
 #include <QElapsedTimer>
-#include <iostream>
-#include <fstream>
+#include <QMutex>
+#include <QList>
 #include <cstdlib>
 
 #include "dsp/inthalfbandfilter.h"
 #include "util/message.h"
 
 #define FILESOURCE_THROTTLE_MS 50
+#define FILESOURCE_READAHEAD_BYTES (32*1024*1024)
+#define FILESOURCE_FAST_CHUNK_SAMPLES (1024*1024)
+#define FILESOURCE_FAST_WAIT_MS 2
 
 class SampleSinkFifo;
 class MessageQueue;
+class ChannelAPI;
+class MappedSampleFile;
 
 class FileInputWorker : public QObject {
 	Q_OBJECT
@@ -50,7 +55,8 @@ public:
         { }
     };
 
-	FileInputWorker(std::ifstream *samplesStream,
+	FileInputWorker(MappedSampleFile *sampleFile,
+	        quint64 dataOffset,
 	        SampleSinkFifo* sampleFifo,
 	        const QTimer& timer,
 	        MessageQueue *fileInputMessageQueue,
@@ -63,13 +69,23 @@ public:
     void setBuffers(std::size_t chunksize);
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
-    void setSamplesCount(quint64 samplesCount) { m_samplesCount = samplesCount; }
+    void setSamplesCount(quint64 samplesCount); //!< Seek to this sample. Only when not running
+    void setDataOffset(quint64 dataOffset) { m_dataOffset = dataOffset; } //!< Position of first sample in file
+    void setAsFastAsPossible(bool asFastAsPossible) { m_asFastAsPossible = asFastAsPossible; } //!< Only when not running
+    void setChannelAPIs(const QList<ChannelAPI*>& channelAPIs); //!< Channels whose FIFOs also pace the fast mode
 
 private:
 	volatile bool m_running;
 
-	std::ifstream* m_ifstream;
-	quint8  *m_fileBuf;
+	MappedSampleFile* m_sampleFile;
+	quint64 m_dataOffset;
+	quint64 m_readAheadEnd;
+	bool m_asFastAsPossible;
+	unsigned int m_fastTickGeneration;
+	bool m_eofReported;             //!< EOF already reported for the current file
+	QList<ChannelAPI*> m_channelAPIs;
+	QMutex m_channelsMutex;
+	quint64 m_channelOverflowCount; //!< overflows of the channel FIFOs at last check
 	quint8  *m_convertBuf;
 	std::size_t m_bufsize;
     qint64 m_chunksize;
@@ -86,7 +102,13 @@ private:
     bool m_throttleToggle;
 
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
+	qint64 readToSampleFifo(qint64 nbBytes);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
+	void readAhead(quint64 offset);
+	void scheduleFastTick(int delayMs);
+	void fastTick(unsigned int generation);
+	void reportEOF();
+	bool getChannelFifosSpace(unsigned int& size, unsigned int& free, quint64& overflowCount);
 
 private slots:
 	void tick();
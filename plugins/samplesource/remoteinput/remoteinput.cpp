@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
 
 #include <QDebug>
 #include <QNetworkReply>
@@ -43,6 +44,7 @@ MESSAGE_CLASS_DEFINITION(RemoteInput::MsgReportRemoteInputAcquisition, Message)
 MESSAGE_CLASS_DEFINITION(RemoteInput::MsgReportRemoteInputStreamData, Message)
 MESSAGE_CLASS_DEFINITION(RemoteInput::MsgReportRemoteInputStreamTiming, Message)
 MESSAGE_CLASS_DEFINITION(RemoteInput::MsgConfigureRemoteChannel, Message)
+MESSAGE_CLASS_DEFINITION(RemoteInput::MsgReportBlockLoss, Message)
 MESSAGE_CLASS_DEFINITION(RemoteInput::MsgStartStop, Message)
 MESSAGE_CLASS_DEFINITION(RemoteInput::MsgReportRemoteFixedData, Message)
 MESSAGE_CLASS_DEFINITION(RemoteInput::MsgReportRemoteAPIError, Message)
@@ -54,7 +56,8 @@ RemoteInput::RemoteInput(DeviceAPI *deviceAPI) :
     m_settings(),
 	m_remoteInputUDPHandler(nullptr),
 	m_deviceDescription("RemoteInput"),
-	m_startingTimeStamp(0)
+	m_startingTimeStamp(0),
+    m_adaptiveFECLossFree(0)
 {
     m_sampleFifo.setLabel(m_deviceDescription);
 	m_sampleFifo.setSize(m_sampleRate * 8);
@@ -204,6 +207,14 @@ bool RemoteInput::handleMessage(const Message& message)
 
         return true;
     }
+    else if (MsgReportBlockLoss::match(message))
+    {
+        if (m_settings.m_adaptiveFEC) {
+            adaptFEC((const MsgReportBlockLoss&) message);
+        }
+
+        return true;
+    }
     else if (MsgStartStop::match(message))
     {
         MsgStartStop& cmd = (MsgStartStop&) message;
@@ -275,6 +286,9 @@ void RemoteInput::applySettings(const RemoteInputSettings& settings, bool force)
     if ((m_settings.m_iqCorrection != settings.m_iqCorrection) || force) {
         reverseAPIKeys.append("iqCorrection");
     }
+    if ((m_settings.m_adaptiveFEC != settings.m_adaptiveFEC) || force) {
+        reverseAPIKeys.append("adaptiveFEC");
+    }
     if ((m_settings.m_dataAddress != settings.m_dataAddress) || force) {
         reverseAPIKeys.append("dataAddress");
     }
@@ -302,6 +316,10 @@ void RemoteInput::applySettings(const RemoteInputSettings& settings, bool force)
                 settings.m_iqCorrection ? "true" : "false");
     }
 
+    if (m_settings.m_adaptiveFEC != settings.m_adaptiveFEC) {
+        m_adaptiveFECLossFree = 0;
+    }
+
     if ((m_settings.m_dataAddress != settings.m_dataAddress) ||
         (m_settings.m_dataPort != settings.m_dataPort) ||
         (m_settings.m_multicastAddress != settings.m_multicastAddress) ||
@@ -367,6 +385,12 @@ void RemoteInput::applyRemoteChannelSettings(const RemoteChannelSettings& settin
         hasChanged = true;
     }
 
+    if (settings.m_nbFECBlocks != m_remoteChannelSettings.m_nbFECBlocks)
+    {
+        swgRemoteSinkSettings->setNbFecBlocks(settings.m_nbFECBlocks);
+        hasChanged = true;
+    }
+
     if (hasChanged)
     {
         QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
@@ -393,7 +417,49 @@ void RemoteInput::applyRemoteChannelSettings(const RemoteChannelSettings& settin
         << " m_deviceCenterFrequency: " << m_remoteChannelSettings.m_deviceCenterFrequency
         << " m_deviceSampleRate: " << m_remoteChannelSettings.m_deviceSampleRate
         << " m_log2Decim: " << m_remoteChannelSettings.m_log2Decim
-        << " m_filterChainHash: " << m_remoteChannelSettings.m_filterChainHash;
+        << " m_filterChainHash: " << m_remoteChannelSettings.m_filterChainHash
+        << " m_nbFECBlocks: " << m_remoteChannelSettings.m_nbFECBlocks;
+}
+
+void RemoteInput::adaptFEC(const MsgReportBlockLoss& report)
+{
+    int nbFECBlocks = report.getNbFECBlocks();
+
+    if (nbFECBlocks != m_remoteChannelSettings.m_nbFECBlocks) { // wait for the last change to reach the stream
+        return;
+    }
+
+    // blocks lost in the worst frame since last report
+    int lostBlocks = report.getNbOriginalBlocks() + nbFECBlocks - report.getMinNbBlocks();
+    int targetFECBlocks = nbFECBlocks;
+
+    if (lostBlocks > 0)
+    {
+        // keep a margin of half the loss so that frames still decode when it gets worse
+        targetFECBlocks = std::max(nbFECBlocks, lostBlocks + lostBlocks/2 + m_adaptiveFECMinBlocks);
+        m_adaptiveFECLossFree = 0;
+    }
+    else if (++m_adaptiveFECLossFree >= m_adaptiveFECDecayPeriod)
+    {
+        targetFECBlocks = nbFECBlocks - 1;
+        m_adaptiveFECLossFree = 0;
+    }
+
+    targetFECBlocks = std::min(m_adaptiveFECMaxBlocks, std::max(m_adaptiveFECMinBlocks, targetFECBlocks));
+
+    if (targetFECBlocks != nbFECBlocks)
+    {
+        qDebug("RemoteInput::adaptFEC: lost blocks: %d FEC blocks: %d -> %d", lostBlocks, nbFECBlocks, targetFECBlocks);
+        RemoteChannelSettings remoteChannelSettings = m_remoteChannelSettings;
+        remoteChannelSettings.m_nbFECBlocks = targetFECBlocks;
+        applyRemoteChannelSettings(remoteChannelSettings);
+
+        if (m_guiMessageQueue) // keep the GUI copy of remote settings in sync
+        {
+            MsgConfigureRemoteChannel *msg = MsgConfigureRemoteChannel::create(m_remoteChannelSettings);
+            m_guiMessageQueue->push(msg);
+        }
+    }
 }
 
 int RemoteInput::webapiRunGet(
@@ -487,6 +553,9 @@ void RemoteInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("iqCorrection")) {
         settings.m_iqCorrection = response.getRemoteInputSettings()->getIqCorrection() != 0;
     }
+    if (deviceSettingsKeys.contains("adaptiveFEC")) {
+        settings.m_adaptiveFEC = response.getRemoteInputSettings()->getAdaptiveFec() != 0;
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getRemoteInputSettings()->getUseReverseApi() != 0;
     }
@@ -511,6 +580,7 @@ void RemoteInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& res
     response.getRemoteInputSettings()->setMulticastJoin(settings.m_multicastJoin ? 1 : 0);
     response.getRemoteInputSettings()->setDcBlock(settings.m_dcBlock ? 1 : 0);
     response.getRemoteInputSettings()->setIqCorrection(settings.m_iqCorrection);
+    response.getRemoteInputSettings()->setAdaptiveFec(settings.m_adaptiveFEC ? 1 : 0);
 
     response.getRemoteInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -583,6 +653,9 @@ void RemoteInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("iqCorrection") || force) {
         swgRemoteInputSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
     }
+    if (deviceSettingsKeys.contains("adaptiveFEC") || force) {
+        swgRemoteInputSettings->setAdaptiveFec(settings.m_adaptiveFEC ? 1 : 0);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
@@ -723,6 +796,7 @@ void RemoteInput::analyzeRemoteChannelSettingsReply(const QJsonObject& jsonObjec
     m_remoteChannelSettings.m_deviceSampleRate = settings["deviceSampleRate"].toInt();
     m_remoteChannelSettings.m_log2Decim = settings["log2Decim"].toInt();
     m_remoteChannelSettings.m_filterChainHash = settings["filterChainHash"].toInt();
+    m_remoteChannelSettings.m_nbFECBlocks = settings["nbFECBlocks"].toInt();
 
     if (m_guiMessageQueue) // forward to GUI if any
     {
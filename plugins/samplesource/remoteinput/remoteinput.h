@@ -46,12 +46,14 @@ public:
         uint32_t m_deviceSampleRate;
         uint32_t m_log2Decim;
         uint32_t m_filterChainHash;
+        int m_nbFECBlocks;
 
         RemoteChannelSettings() :
             m_deviceCenterFrequency(0),
             m_deviceSampleRate(1),
             m_log2Decim(0),
-            m_filterChainHash(0)
+            m_filterChainHash(0),
+            m_nbFECBlocks(0)
         {}
     };
 
@@ -265,6 +267,31 @@ public:
 		{ }
 	};
 
+    class MsgReportBlockLoss : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        int getNbOriginalBlocks() const { return m_nbOriginalBlocks; }
+        int getNbFECBlocks() const { return m_nbFECBlocks; }
+        int getMinNbBlocks() const { return m_minNbBlocks; }
+
+        static MsgReportBlockLoss* create(int nbOriginalBlocks, int nbFECBlocks, int minNbBlocks) {
+            return new MsgReportBlockLoss(nbOriginalBlocks, nbFECBlocks, minNbBlocks);
+        }
+
+    private:
+        int m_nbOriginalBlocks;
+        int m_nbFECBlocks;
+        int m_minNbBlocks; //!< Least number of blocks received in a frame since last report
+
+        MsgReportBlockLoss(int nbOriginalBlocks, int nbFECBlocks, int minNbBlocks) :
+            Message(),
+            m_nbOriginalBlocks(nbOriginalBlocks),
+            m_nbFECBlocks(nbFECBlocks),
+            m_minNbBlocks(minNbBlocks)
+        {}
+    };
+
     class MsgStartStop : public Message {
         MESSAGE_CLASS_DECLARATION
 
@@ -413,9 +440,15 @@ private:
 	std::time_t m_startingTimeStamp;
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
+    int m_adaptiveFECLossFree; //!< Number of consecutive reports without block loss
+
+    static const int m_adaptiveFECMinBlocks = 2;
+    static const int m_adaptiveFECMaxBlocks = 127;
+    static const int m_adaptiveFECDecayPeriod = 10; //!< Loss free reports (seconds) before releasing one FEC block
 
     void applySettings(const RemoteInputSettings& settings, bool force = false);
     void applyRemoteChannelSettings(const RemoteChannelSettings& settings);
+    void adaptFEC(const MsgReportBlockLoss& report);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const RemoteInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
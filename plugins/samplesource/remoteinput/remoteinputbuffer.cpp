@@ -30,6 +30,7 @@ RemoteInputBuffer::RemoteInputBuffer() :
         m_frames(nullptr),
         m_curNbBlocks(0),
         m_minNbBlocks(256),
+        m_lossMinNbBlocks(256),
         m_curOriginalBlocks(0),
         m_minOriginalBlocks(128),
         m_curNbRecovery(0),
@@ -66,6 +67,8 @@ RemoteInputBuffer::RemoteInputBuffer() :
 
 RemoteInputBuffer::~RemoteInputBuffer()
 {
+    cancelDecodeSlots();
+
 	if (m_readBuffer) {
 		delete[] m_readBuffer;
 	}
@@ -79,6 +82,7 @@ RemoteInputBuffer::~RemoteInputBuffer()
 
 void RemoteInputBuffer::setNbDecoderSlots(int nbDecoderSlots)
 {
+    cancelDecodeSlots();
     m_nbDecoderSlots = nbDecoderSlots;
     m_framesSize = m_nbDecoderSlots * (RemoteNbOrginalBlocks - 1) * RemoteNbBytesPerBlock;
   	m_framesNbBytes = m_nbDecoderSlots * sizeof(BufferFrame);
@@ -104,6 +108,8 @@ void RemoteInputBuffer::setBufferLenSec(const RemoteMetaDataFEC& metaData)
 
 void RemoteInputBuffer::initDecodeAllSlots()
 {
+    cancelDecodeSlots();
+
     for (int i = 0; i < m_nbDecoderSlots; i++)
     {
         m_decoderSlots[i].m_blockCount = 0;
@@ -132,6 +138,10 @@ void RemoteInputBuffer::initDecodeSlot(int slotIndex)
         m_minNbBlocks = m_curNbBlocks;
     }
 
+    if (m_curNbBlocks < m_lossMinNbBlocks) {
+        m_lossMinNbBlocks = m_curNbBlocks;
+    }
+
     if (m_curOriginalBlocks < m_minOriginalBlocks) {
         m_minOriginalBlocks = m_curOriginalBlocks;
     }
@@ -221,9 +231,9 @@ void RemoteInputBuffer::checkSlotData(int slotIndex)
     }
 }
 
-void RemoteInputBuffer::writeData(char *array)
+void RemoteInputBuffer::writeData(const char *array)
 {
-    RemoteSuperBlock *superBlock = (RemoteSuperBlock *) array;
+    const RemoteSuperBlock *superBlock = (const RemoteSuperBlock *) array;
     int frameIndex = superBlock->m_header.m_frameIndex;
     int decoderIndex = frameIndex % m_nbDecoderSlots;
 
@@ -240,6 +250,7 @@ void RemoteInputBuffer::writeData(char *array)
     {
         m_decoderIndexHead = decoderIndex; // new decoder slot head
         m_frameHead = frameIndex;          // new frame head
+        waitDecodeSlot(decoderIndex);      // FEC decoding of the previous frame in this slot must be finished
         checkSlotData(decoderIndex);       // check slot before re-init
         rwCorrectionEstimate(decoderIndex);
         m_nbWrites++;
@@ -278,86 +289,150 @@ void RemoteInputBuffer::writeData(char *array)
     if (m_decoderSlots[decoderIndex].m_blockCount == RemoteNbOrginalBlocks) // ready to decode
     {
         m_decoderSlots[decoderIndex].m_decoded = true;
+        decodeSlot(decoderIndex);
+        m_completeSlots.push_back(decoderIndex);
+        // reads lag writes by half the buffer so a few frames can be decoding at the same time
+        finishDecodeSlots(m_nbDecoderSlots/4);
+    } // decode
+}
 
-        if (m_cm256_OK && (m_decoderSlots[decoderIndex].m_recoveryCount > 0)) // recovery data used => need to decode FEC
-        {
-            m_paramsCM256.BlockBytes = sizeof(RemoteProtectedBlock); // never changes
-            m_paramsCM256.OriginalCount = RemoteNbOrginalBlocks;  // never changes
+void RemoteInputBuffer::decodeSlot(int slotIndex)
+{
+    DecoderSlot *slot = &m_decoderSlots[slotIndex];
+    slot->m_decodeStatus = 0;
 
-            if (m_decoderSlots[decoderIndex].m_metaRetrieved) {
-                m_paramsCM256.RecoveryCount = m_currentMeta.m_nbFECBlocks;
-            } else {
-                m_paramsCM256.RecoveryCount = m_decoderSlots[decoderIndex].m_recoveryCount;
-            }
+    if (!m_cm256_OK || (slot->m_recoveryCount == 0)) { // no recovery data used => no need to decode FEC
+        return;
+    }
 
-            if (m_cm256.cm256_decode(m_paramsCM256, m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks)) // CM256 decode
-            {
-                qDebug() << "RemoteInputBuffer::writeData: decode CM256 error:"
-                        << " decoderIndex: " << decoderIndex
-                        << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
-                        << " m_originalCount: " << m_decoderSlots[decoderIndex].m_originalCount
-                        << " m_recoveryCount: " << m_decoderSlots[decoderIndex].m_recoveryCount;
+    slot->m_paramsCM256.BlockBytes = sizeof(RemoteProtectedBlock); // never changes
+    slot->m_paramsCM256.OriginalCount = RemoteNbOrginalBlocks;  // never changes
+
+    if (slot->m_metaRetrieved) {
+        slot->m_paramsCM256.RecoveryCount = getMetaData(slotIndex)->m_nbFECBlocks;
+    } else {
+        slot->m_paramsCM256.RecoveryCount = slot->m_recoveryCount;
+    }
+
+    // Frames are independent so they are decoded in the worker pool while the next frames are received
+    slot->m_decodeTicket = WorkerPool::instance().submit([slot]() {
+        static thread_local CM256 cm256;
+        slot->m_decodeStatus = cm256.isInitialized() ? cm256.cm256_decode(slot->m_paramsCM256, slot->m_cm256DescriptorBlocks) : -1;
+    });
+}
+
+void RemoteInputBuffer::finishDecodeSlots(int maxPending)
+{
+    while (!m_completeSlots.empty())
+    {
+        int slotIndex = m_completeSlots.front();
+        const WorkerPool::Ticket& ticket = m_decoderSlots[slotIndex].m_decodeTicket;
+
+        if (ticket && !ticket->isDone())
+        {
+            if ((int) m_completeSlots.size() <= maxPending) {
+                break;
             }
-            else
-            {
-                qDebug() << "RemoteInputBuffer::writeData: decode CM256 success:"
-                        << " decoderIndex: " << decoderIndex
-                        << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
-                        << " m_originalCount: " << m_decoderSlots[decoderIndex].m_originalCount
-                        << " m_recoveryCount: " << m_decoderSlots[decoderIndex].m_recoveryCount;
 
-                for (int ir = 0; ir < m_decoderSlots[decoderIndex].m_recoveryCount; ir++) // restore missing blocks
-                {
-                    int recoveryIndex = RemoteNbOrginalBlocks - m_decoderSlots[decoderIndex].m_recoveryCount + ir;
-                    int blockIndex = m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[recoveryIndex].Index;
-                    RemoteProtectedBlock *recoveredBlock = (RemoteProtectedBlock *) m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[recoveryIndex].Block;
+            WorkerPool::instance().wait(ticket);
+        }
 
-                    if (blockIndex == 0) // first block with meta
-                    {
-                        RemoteMetaDataFEC *metaData = (RemoteMetaDataFEC *) recoveredBlock;
-
-                        boost::crc_32_type crc32;
-                        crc32.process_bytes(metaData, sizeof(RemoteMetaDataFEC)-4);
-
-                        if (crc32.checksum() == metaData->m_crc32)
-                        {
-                            m_decoderSlots[decoderIndex].m_metaRetrieved = true;
-                            printMeta("RemoteInputBuffer::writeData: recovered meta", metaData);
-                        }
-                        else
-                        {
-                            qDebug() << "RemoteInputBuffer::writeData: recovered meta: invalid CRC32";
-                        }
-                    }
+        m_completeSlots.pop_front();
+        finishDecodeSlot(slotIndex); // in frame order
+    }
+}
 
-                    storeOriginalBlock(decoderIndex, blockIndex, *recoveredBlock);
+void RemoteInputBuffer::waitDecodeSlot(int slotIndex)
+{
+    while (std::find(m_completeSlots.begin(), m_completeSlots.end(), slotIndex) != m_completeSlots.end()) {
+        finishDecodeSlots(m_completeSlots.size() - 1);
+    }
+}
+
+void RemoteInputBuffer::cancelDecodeSlots()
+{
+    for (int slotIndex : m_completeSlots)
+    {
+        WorkerPool::instance().wait(m_decoderSlots[slotIndex].m_decodeTicket);
+        m_decoderSlots[slotIndex].m_decodeTicket.reset();
+    }
+
+    m_completeSlots.clear();
+}
 
-                    qDebug() << "RemoteInputBuffer::writeData: recovered block #" << blockIndex;
-                } // restore missing blocks
-            } // CM256 decode
-        } // recovery
+void RemoteInputBuffer::finishDecodeSlot(int decoderIndex)
+{
+    if (m_decoderSlots[decoderIndex].m_decodeTicket) // recovery data used => FEC was decoded
+    {
+        m_decoderSlots[decoderIndex].m_decodeTicket.reset();
 
-        if (m_decoderSlots[decoderIndex].m_metaRetrieved) // block zero with its meta data has been received
+        if (m_decoderSlots[decoderIndex].m_decodeStatus) // CM256 decode
         {
-            RemoteMetaDataFEC *metaData = getMetaData(decoderIndex);
+            qDebug() << "RemoteInputBuffer::finishDecodeSlot: decode CM256 error:"
+                    << " decoderIndex: " << decoderIndex
+                    << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
+                    << " m_originalCount: " << m_decoderSlots[decoderIndex].m_originalCount
+                    << " m_recoveryCount: " << m_decoderSlots[decoderIndex].m_recoveryCount;
+        }
+        else
+        {
+            qDebug() << "RemoteInputBuffer::finishDecodeSlot: decode CM256 success:"
+                    << " decoderIndex: " << decoderIndex
+                    << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
+                    << " m_originalCount: " << m_decoderSlots[decoderIndex].m_originalCount
+                    << " m_recoveryCount: " << m_decoderSlots[decoderIndex].m_recoveryCount;
 
-            if (!(*metaData == m_currentMeta))
+            for (int ir = 0; ir < m_decoderSlots[decoderIndex].m_recoveryCount; ir++) // restore missing blocks
             {
-                uint32_t sampleRate =  metaData->m_sampleRate;
+                int recoveryIndex = RemoteNbOrginalBlocks - m_decoderSlots[decoderIndex].m_recoveryCount + ir;
+                int blockIndex = m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[recoveryIndex].Index;
+                RemoteProtectedBlock *recoveredBlock = (RemoteProtectedBlock *) m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[recoveryIndex].Block;
 
-                if (sampleRate != 0)
+                if (blockIndex == 0) // first block with meta
                 {
-                    setBufferLenSec(*metaData);
-                    m_balCorrLimit = sampleRate / 400; // +/- 5% correction max per read
-                    m_readNbBytes = (sampleRate * metaData->m_sampleBytes * 2) / 20;
+                    RemoteMetaDataFEC *metaData = (RemoteMetaDataFEC *) recoveredBlock;
+
+                    boost::crc_32_type crc32;
+                    crc32.process_bytes(metaData, sizeof(RemoteMetaDataFEC)-4);
+
+                    if (crc32.checksum() == metaData->m_crc32)
+                    {
+                        m_decoderSlots[decoderIndex].m_metaRetrieved = true;
+                        printMeta("RemoteInputBuffer::finishDecodeSlot: recovered meta", metaData);
+                    }
+                    else
+                    {
+                        qDebug() << "RemoteInputBuffer::finishDecodeSlot: recovered meta: invalid CRC32";
+                    }
                 }
 
-                printMeta("RemoteInputBuffer::writeData: new meta", metaData); // print for change other than timestamp
+                storeOriginalBlock(decoderIndex, blockIndex, *recoveredBlock);
+
+                qDebug() << "RemoteInputBuffer::finishDecodeSlot: recovered block #" << blockIndex;
+            } // restore missing blocks
+        } // CM256 decode
+    } // recovery
+
+    if (m_decoderSlots[decoderIndex].m_metaRetrieved) // block zero with its meta data has been received
+    {
+        RemoteMetaDataFEC *metaData = getMetaData(decoderIndex);
+
+        if (!(*metaData == m_currentMeta))
+        {
+            uint32_t sampleRate =  metaData->m_sampleRate;
+
+            if (sampleRate != 0)
+            {
+                setBufferLenSec(*metaData);
+                m_balCorrLimit = sampleRate / 400; // +/- 5% correction max per read
+                m_readNbBytes = (sampleRate * metaData->m_sampleBytes * 2) / 20;
             }
 
-            m_currentMeta = *metaData; // renew current meta
-        } // check block 0
-    } // decode
+            printMeta("RemoteInputBuffer::finishDecodeSlot: new meta", metaData); // print for change other than timestamp
+        }
+
+        m_currentMeta = *metaData; // renew current meta
+    } // check block 0
 }
 
 uint8_t *RemoteInputBuffer::readData(int32_t length)
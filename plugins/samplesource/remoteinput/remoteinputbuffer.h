@@ -22,11 +22,13 @@
 #include <QDebug>
 
 #include <cstdlib>
+#include <deque>
 
 #include "cm256cc/cm256.h"
 
 #include "channel/remotedatablock.h"
 #include "util/movingaverage.h"
+#include "util/workerpool.h"
 
 
 #define REMOTEINPUT_UDPSIZE 512               // UDP payload size
@@ -44,7 +46,7 @@ public:
     void setBufferLenSec(const RemoteMetaDataFEC& metaData);
 
 	// R/W operations
-	void writeData(char *array); //!< Write data into buffer.
+	void writeData(const char *array); //!< Write data into buffer.
 	uint8_t *readData(int32_t length);            //!< Read data from buffer
 
 	// meta data
@@ -71,6 +73,13 @@ public:
         return minNbBlocks;
     }
 
+    int getLossMinNbBlocks() //!< same as getMinNbBlocks with its own poll period for the FEC adaptation
+    {
+        int minNbBlocks = m_lossMinNbBlocks;
+        m_lossMinNbBlocks = 256;
+        return minNbBlocks;
+    }
+
     int getMinOriginalBlocks()
     {
         int minOriginalBlocks = m_minOriginalBlocks;
@@ -135,6 +144,9 @@ private:
         int                     m_recoveryCount;      //!< number of recovery blocks received
         bool                    m_decoded;            //!< true if decoded
         bool                    m_metaRetrieved;      //!< true if meta data (block zero) was retrieved
+        CM256::cm256_encoder_params m_paramsCM256;    //!< CM256 decoder parameters of this frame
+        int                     m_decodeStatus;       //!< CM256 decoder return: 0 for success
+        WorkerPool::Ticket      m_decodeTicket;       //!< FEC decoding job in the worker pool if any
         DecoderSlot() {}
     };
 
@@ -147,6 +159,7 @@ private:
     int                  m_frameHead;            //!< index of the current head frame sent
     int                  m_curNbBlocks;          //!< (stats) instantaneous number of blocks received
     int                  m_minNbBlocks;          //!< (stats) minimum number of blocks received since last poll
+    int                  m_lossMinNbBlocks;      //!< (stats) minimum number of blocks received since last FEC adaptation poll
     int                  m_curOriginalBlocks;    //!< (stats) instantanous number of original blocks received
     int                  m_minOriginalBlocks;    //!< (stats) minimum number of original blocks received since last poll
     int                  m_curNbRecovery;        //!< (stats) instantaneous number of recovery blocks used
@@ -172,6 +185,7 @@ private:
     int      m_balCorrLimit;  //!< Correction absolute value limit in number of samples
     CM256    m_cm256;         //!< CM256 library
     bool     m_cm256_OK;      //!< CM256 library initialized OK
+    std::deque<int> m_completeSlots; //!< Slots with all blocks in frame order waiting for FEC decoding to finish
 
     inline RemoteProtectedBlock* storeOriginalBlock(int slotIndex, int blockIndex, const RemoteProtectedBlock& protectedBlock)
     {
@@ -217,6 +231,11 @@ private:
     void rwCorrectionEstimate(int slotIndex);
     void checkSlotData(int slotIndex);
     void initDecodeSlot(int slotIndex);
+    void decodeSlot(int slotIndex);
+    void finishDecodeSlots(int maxPending);
+    void waitDecodeSlot(int slotIndex);
+    void finishDecodeSlot(int slotIndex);
+    void cancelDecodeSlots();
 
     static void printMeta(const QString& header, RemoteMetaDataFEC *metaData);
 };
@@ -312,6 +312,7 @@ void RemoteInputGui::displaySettings()
 
 	ui->dcOffset->setChecked(m_settings.m_dcBlock);
 	ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+    ui->adaptiveFEC->setChecked(m_settings.m_adaptiveFEC);
 
 	blockApplySettings(false);
 }
@@ -503,6 +504,12 @@ void RemoteInputGui::on_iqImbalance_toggled(bool checked)
     sendSettings();
 }
 
+void RemoteInputGui::on_adaptiveFEC_toggled(bool checked)
+{
+    m_settings.m_adaptiveFEC = checked;
+    sendSettings();
+}
+
 void RemoteInputGui::on_startStop_toggled(bool checked)
 {
     if (m_doApplySettings)
@@ -709,6 +716,7 @@ void RemoteInputGui::makeUIConnections()
     QObject::connect(ui->dataApplyButton, &QPushButton::clicked, this, &RemoteInputGui::on_dataApplyButton_clicked);
     QObject::connect(ui->dcOffset, &ButtonSwitch::toggled, this, &RemoteInputGui::on_dcOffset_toggled);
     QObject::connect(ui->iqImbalance, &ButtonSwitch::toggled, this, &RemoteInputGui::on_iqImbalance_toggled);
+    QObject::connect(ui->adaptiveFEC, &ButtonSwitch::toggled, this, &RemoteInputGui::on_adaptiveFEC_toggled);
     QObject::connect(ui->apiAddress, &QLineEdit::editingFinished, this, &RemoteInputGui::on_apiAddress_editingFinished);
     QObject::connect(ui->apiPort, &QLineEdit::editingFinished, this, &RemoteInputGui::on_apiPort_editingFinished);
     QObject::connect(ui->dataAddress, &QLineEdit::editingFinished, this, &RemoteInputGui::on_dataAddress_editingFinished);
@@ -129,6 +129,7 @@ private slots:
     void on_dataApplyButton_clicked(bool checked);
 	void on_dcOffset_toggled(bool checked);
 	void on_iqImbalance_toggled(bool checked);
+    void on_adaptiveFEC_toggled(bool checked);
 	void on_apiAddress_editingFinished();
 	void on_apiPort_editingFinished();
     void on_dataAddress_editingFinished();
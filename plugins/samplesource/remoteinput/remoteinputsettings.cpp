@@ -33,6 +33,7 @@ void RemoteInputSettings::resetToDefaults()
     m_multicastJoin = false;
     m_dcBlock = false;
     m_iqCorrection = false;
+    m_adaptiveFEC = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -55,6 +56,7 @@ QByteArray RemoteInputSettings::serialize() const
     s.writeString(12, m_reverseAPIAddress);
     s.writeU32(13, m_reverseAPIPort);
     s.writeU32(14, m_reverseAPIDeviceIndex);
+    s.writeBool(15, m_adaptiveFEC);
 
     return s.final();
 }
@@ -95,6 +97,7 @@ bool RemoteInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(14, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readBool(15, &m_adaptiveFEC, false);
 
         return true;
     }
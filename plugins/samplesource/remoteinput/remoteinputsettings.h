@@ -30,6 +30,7 @@ struct RemoteInputSettings {
     bool    m_multicastJoin;
     bool    m_dcBlock;
     bool    m_iqCorrection;
+    bool    m_adaptiveFEC;  //!< Adjust the number of FEC blocks of the remote sink to the measured loss
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
@@ -18,12 +18,14 @@
 #include <QUdpSocket>
 #include <QDebug>
 #include <QTimer>
+#include <QThread>
 
 #include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
 #include "device/deviceapi.h"
 
 #include "remoteinputudphandler.h"
+#include "remoteinputudpthread.h"
 #include "remoteinput.h"
 
 MESSAGE_CLASS_DEFINITION(RemoteInputUDPHandler::MsgReportMetaDataChange, Message)
@@ -36,6 +38,8 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceA
     m_running(false),
     m_rateDivider(1000/REMOTEINPUT_THROTTLE_MS),
 	m_dataSocket(nullptr),
+    m_batchReceiver(RemoteUdpSize),
+    m_udpThread(nullptr),
 	m_dataAddress(QHostAddress::LocalHost),
 	m_remoteAddress(QHostAddress::LocalHost),
 	m_dataPort(9090),
@@ -48,6 +52,7 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceA
 	m_samplerate(0),
 	m_centerFrequency(0),
 	m_tv_msec(0),
+    m_messageQueueToInput(nullptr),
 	m_messageQueueToGUI(0),
 	m_tickCount(0),
 	m_samplesCount(0),
@@ -95,14 +100,22 @@ void RemoteInputUDPHandler::start()
 	    return;
 	}
 
-	if (!m_dataSocket)
-    {
-		m_dataSocket = new QUdpSocket(this);
-        m_dataSocket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, getDataSocketBufferSize());
-	}
+    // set before the batch receiver thread may request the timer connection
+    m_elapsedTimer.start();
+    m_running = true;
+
+    if (!m_dataConnected && startBatchReceiver()) {
+        m_dataConnected = true;
+    }
 
     if (!m_dataConnected)
 	{
+        if (!m_dataSocket)
+        {
+            m_dataSocket = new QUdpSocket(this);
+            m_dataSocket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, getDataSocketBufferSize());
+        }
+
         if (m_dataSocket->bind(m_multicast ? QHostAddress::AnyIPv4 : m_dataAddress, m_dataPort, QUdpSocket::ShareAddress))
 		{
 			qDebug("RemoteInputUDPHandler::start: bind data socket to %s:%d", m_dataAddress.toString().toStdString().c_str(),  m_dataPort);
@@ -125,9 +138,6 @@ void RemoteInputUDPHandler::start()
 			m_dataConnected = false;
 		}
 	}
-
-    m_elapsedTimer.start();
-    m_running = true;
 }
 
 void RemoteInputUDPHandler::stop()
@@ -138,14 +148,16 @@ void RemoteInputUDPHandler::stop()
 	    return;
 	}
 
+    m_running = false; // a timer connection still queued by the batch receiver is ignored
+    stopBatchReceiver();
 	disconnectTimer();
 
-    if (m_dataConnected)
-    {
-		m_dataConnected = false;
+    if (m_dataConnected && m_dataSocket) {
 	    disconnect(m_dataSocket, SIGNAL(readyRead()), this, SLOT(dataReadyRead()));
 	}
 
+    m_dataConnected = false;
+
 	if (m_dataSocket)
 	{
 		delete m_dataSocket;
@@ -154,7 +166,46 @@ void RemoteInputUDPHandler::stop()
 
 	m_centerFrequency = 0;
 	m_samplerate = 0;
-	m_running = false;
+}
+
+bool RemoteInputUDPHandler::startBatchReceiver()
+{
+    QHostAddress bindAddress = m_multicast ? QHostAddress(QHostAddress::AnyIPv4) : m_dataAddress;
+
+    if (!RemoteUDPBatchReceiver::isSupported() || (bindAddress.protocol() != QAbstractSocket::IPv4Protocol)) {
+        return false;
+    }
+
+    if (!m_batchReceiver.open(bindAddress, m_dataPort, getDataSocketBufferSize())) {
+        return false;
+    }
+
+    qDebug("RemoteInputUDPHandler::startBatchReceiver: bind data socket to %s:%d", qPrintable(bindAddress.toString()), m_dataPort);
+
+    if (m_multicast)
+    {
+        if (m_batchReceiver.joinMulticastGroup(m_multicastAddress)) {
+            qDebug("RemoteInputUDPHandler::startBatchReceiver: joined multicast group %s", qPrintable(m_multicastAddress.toString()));
+        } else {
+            qDebug("RemoteInputUDPHandler::startBatchReceiver: failed joining multicast group %s", qPrintable(m_multicastAddress.toString()));
+        }
+    }
+
+    m_udpThread = new RemoteInputUDPThread(this);
+    m_udpThread->startWork();
+    return true;
+}
+
+void RemoteInputUDPHandler::stopBatchReceiver()
+{
+    if (m_udpThread)
+    {
+        m_udpThread->stopWork();
+        delete m_udpThread;
+        m_udpThread = nullptr;
+    }
+
+    m_batchReceiver.close();
 }
 
 void RemoteInputUDPHandler::configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin)
@@ -193,8 +244,27 @@ void RemoteInputUDPHandler::applyUDPLink(const QString& address, quint16 port, c
 	start();
 }
 
+bool RemoteInputUDPHandler::readBatch(int timeoutMs)
+{
+    int nbDatagrams = m_batchReceiver.receive(timeoutMs);
+
+    if (nbDatagrams <= 0) {
+        return nbDatagrams == 0;
+    }
+
+    QMutexLocker mutexLocker(&m_dataMutex);
+
+    for (int i = 0; i < nbDatagrams; i++) {
+        processData(m_batchReceiver.getDatagram(i));
+    }
+
+    m_remoteAddress = m_batchReceiver.getSenderAddress();
+    return true;
+}
+
 void RemoteInputUDPHandler::dataReadyRead()
 {
+    QMutexLocker mutexLocker(&m_dataMutex);
     m_udpReadBytes = 0;
 
 	while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
@@ -203,15 +273,15 @@ void RemoteInputUDPHandler::dataReadyRead()
 		m_udpReadBytes += m_dataSocket->readDatagram(&m_udpBuf[m_udpReadBytes], pendingDataSize, &m_remoteAddress, 0);
 
 		if (m_udpReadBytes == RemoteUdpSize) {
-		    processData();
+		    processData(m_udpBuf);
 		    m_udpReadBytes = 0;
 		}
 	}
 }
 
-void RemoteInputUDPHandler::processData()
+void RemoteInputUDPHandler::processData(const char *datagram)
 {
-    m_remoteInputBuffer.writeData(m_udpBuf);
+    m_remoteInputBuffer.writeData(datagram);
     const RemoteMetaDataFEC& metaData =  m_remoteInputBuffer.getCurrentMeta();
 
     if (!(m_currentMeta == metaData))
@@ -260,7 +330,12 @@ void RemoteInputUDPHandler::processData()
             m_messageQueueToGUI->push(report);
         }
 
-        m_dataSocket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, getDataSocketBufferSize());
+        if (m_batchReceiver.isOpen()) {
+            m_batchReceiver.setReceiveBufferSize(getDataSocketBufferSize());
+        } else {
+            m_dataSocket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, getDataSocketBufferSize());
+        }
+
         m_elapsedTimer.restart();
         m_throttlems = 0;
         connectTimer();
@@ -281,7 +356,14 @@ void RemoteInputUDPHandler::adjustNbDecoderSlots(const RemoteMetaDataFEC& metaDa
 
 void RemoteInputUDPHandler::connectTimer()
 {
-    if (!m_masterTimerConnected)
+    if (QThread::currentThread() != thread())
+    {
+        // processData runs in the batch receiver thread. The timer connection belongs to the handler thread
+        QMetaObject::invokeMethod(this, "connectTimer", Qt::QueuedConnection);
+        return;
+    }
+
+    if (!m_masterTimerConnected && m_running) // ignore a request queued before a stop
     {
         qDebug() << "RemoteInputUDPHandler::connectTimer";
 #ifdef USE_INTERNAL_TIMER
@@ -296,6 +378,12 @@ void RemoteInputUDPHandler::connectTimer()
 
 void RemoteInputUDPHandler::disconnectTimer()
 {
+    if (QThread::currentThread() != thread())
+    {
+        QMetaObject::invokeMethod(this, "disconnectTimer", Qt::QueuedConnection);
+        return;
+    }
+
     if (m_masterTimerConnected)
     {
         qDebug() << "RemoteInputUDPHandler::disconnectTimer";
@@ -311,6 +399,7 @@ void RemoteInputUDPHandler::disconnectTimer()
 
 void RemoteInputUDPHandler::tick()
 {
+    QMutexLocker mutexLocker(&m_dataMutex);
     // auto throttling
     int throttlems = m_elapsedTimer.restart();
 
@@ -423,6 +512,15 @@ void RemoteInputUDPHandler::tick()
 	{
 		m_tickCount = 0;
 
+        if (m_messageQueueToInput)
+        {
+            RemoteInput::MsgReportBlockLoss *report = RemoteInput::MsgReportBlockLoss::create(
+                m_remoteInputBuffer.getCurrentMeta().m_nbOriginalBlocks,
+                m_remoteInputBuffer.getCurrentMeta().m_nbFECBlocks,
+                m_remoteInputBuffer.getLossMinNbBlocks());
+            m_messageQueueToInput->push(report);
+        }
+
 		if (m_messageQueueToGUI)
 		{
 	        int framesDecodingStatus;
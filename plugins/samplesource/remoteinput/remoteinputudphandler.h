@@ -18,6 +18,8 @@
 #ifndef PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPHANDLER_H_
 #define PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPHANDLER_H_
 
+#include <atomic>
+
 #include <QObject>
 #include <QUdpSocket>
 #include <QHostAddress>
@@ -25,6 +27,7 @@
 #include <QElapsedTimer>
 
 #include "util/messagequeue.h"
+#include "channel/remoteudpbatch.h"
 #include "remoteinputbuffer.h"
 
 #define REMOTEINPUT_THROTTLE_MS 50
@@ -33,6 +36,7 @@ class SampleSinkFifo;
 class MessageQueue;
 class QTimer;
 class DeviceAPI;
+class RemoteInputUDPThread;
 
 class RemoteInputUDPHandler : public QObject
 {
@@ -65,7 +69,7 @@ public:
     void start();
 	void stop();
 	void configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin);
-	void getRemoteAddress(QString& s) const { s = m_remoteAddress.toString(); }
+	void getRemoteAddress(QString& s) const { QMutexLocker mutexLocker(&m_dataMutex); s = m_remoteAddress.toString(); }
     int getNbOriginalBlocks() const { return RemoteNbOrginalBlocks; }
     bool isStreaming() const { return m_masterTimerConnected; }
     int getSampleRate() const { return m_samplerate; }
@@ -75,6 +79,7 @@ public:
     int getMinNbBlocks() { return m_remoteInputBuffer.getMinNbBlocks(); }
     int getMaxNbRecovery() { return m_remoteInputBuffer.getMaxNbRecovery(); }
 	const RemoteMetaDataFEC& getCurrentMeta() const { return m_currentMeta; }
+    bool readBatch(int timeoutMs); //!< Called from the receiving thread. Returns false on socket error.
 
 public slots:
 	void dataReadyRead();
@@ -111,12 +116,15 @@ private:
 
 	DeviceAPI *m_deviceAPI;
 	const QTimer& m_masterTimer;
-	bool m_masterTimerConnected;
-	bool m_running;
+	std::atomic<bool> m_masterTimerConnected; //!< read from the GUI and batch receiver threads
+	std::atomic<bool> m_running;
     uint32_t m_rateDivider;
 	RemoteInputBuffer m_remoteInputBuffer;
 	RemoteMetaDataFEC m_currentMeta;
 	QUdpSocket *m_dataSocket;
+    RemoteUDPBatchReceiver m_batchReceiver; //!< Fast path used when available in place of m_dataSocket
+    RemoteInputUDPThread *m_udpThread;
+    mutable QMutex m_dataMutex; //!< Serializes datagram processing with tick()
 	QHostAddress m_dataAddress;
 	QHostAddress m_remoteAddress;
 	quint16 m_dataPort;
@@ -146,9 +154,9 @@ private:
 
     MessageQueue m_inputMessageQueue;
 
-	void connectTimer();
-    void disconnectTimer();
-	void processData();
+	void processData(const char *datagram);
+    bool startBatchReceiver();
+    void stopBatchReceiver();
     void adjustNbDecoderSlots(const RemoteMetaDataFEC& metaData);
 	int getDataSocketBufferSize();
 	void applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool muticastJoin);
@@ -157,6 +165,8 @@ private:
 private slots:
 	void tick();
     void handleMessages();
+	void connectTimer();    //!< may be called from any thread. Runs in the handler thread
+    void disconnectTimer(); //!< may be called from any thread. Runs in the handler thread
 };
 
 
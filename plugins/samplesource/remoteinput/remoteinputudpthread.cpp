@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "remoteinputudphandler.h"
+#include "remoteinputudpthread.h"
+
+RemoteInputUDPThread::RemoteInputUDPThread(RemoteInputUDPHandler *handler, QObject* parent) :
+    QThread(parent),
+    m_running(false),
+    m_handler(handler)
+{
+}
+
+RemoteInputUDPThread::~RemoteInputUDPThread()
+{
+    stopWork();
+}
+
+void RemoteInputUDPThread::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void RemoteInputUDPThread::stopWork()
+{
+    m_running = false;
+    wait();
+}
+
+void RemoteInputUDPThread::run()
+{
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    while (m_running)
+    {
+        if (!m_handler->readBatch(m_pollTimeoutMs))
+        {
+            qWarning("RemoteInputUDPThread::run: socket error");
+            msleep(m_pollTimeoutMs);
+        }
+    }
+}
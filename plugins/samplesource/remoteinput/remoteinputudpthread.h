@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Reads the remote stream datagrams in batches off the GUI thread.              //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPTHREAD_H_
+#define PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPTHREAD_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+class RemoteInputUDPHandler;
+
+class RemoteInputUDPThread : public QThread
+{
+    Q_OBJECT
+public:
+    RemoteInputUDPThread(RemoteInputUDPHandler *handler, QObject* parent = nullptr);
+    ~RemoteInputUDPThread();
+
+    void startWork();
+    void stopWork();
+
+private:
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    volatile bool m_running;
+    RemoteInputUDPHandler *m_handler;
+
+    static const int m_pollTimeoutMs = 50; //!< Bounds the time to notice a stop request
+
+    void run();
+};
+
+#endif /* PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPTHREAD_H_ */
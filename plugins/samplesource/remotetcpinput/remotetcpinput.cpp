@@ -41,6 +41,7 @@
 MESSAGE_CLASS_DEFINITION(RemoteTCPInput::MsgConfigureRemoteTCPInput, Message)
 MESSAGE_CLASS_DEFINITION(RemoteTCPInput::MsgStartStop, Message)
 MESSAGE_CLASS_DEFINITION(RemoteTCPInput::MsgReportTCPBuffer, Message)
+MESSAGE_CLASS_DEFINITION(RemoteTCPInput::MsgReportCompression, Message)
 
 RemoteTCPInput::RemoteTCPInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
@@ -282,6 +283,9 @@ void RemoteTCPInput::applySettings(const RemoteTCPInputSettings& settings, bool
     if ((m_settings.m_sampleBits != settings.m_sampleBits) || force) {
         reverseAPIKeys.append("m_sampleBits");
     }
+    if ((m_settings.m_compression != settings.m_compression) || force) {
+        reverseAPIKeys.append("compression");
+    }
     if ((m_settings.m_dataAddress != settings.m_dataAddress) || force) {
         reverseAPIKeys.append("dataAddress");
     }
@@ -327,6 +331,7 @@ void RemoteTCPInput::applySettings(const RemoteTCPInputSettings& settings, bool
         << " m_channelGain: " << m_settings.m_channelGain
         << " m_channelSampleRate: " << m_settings.m_channelSampleRate
         << " m_sampleBits: " << m_settings.m_sampleBits
+        << " m_compression: " << m_settings.m_compression
         << " m_dataAddress: " << m_settings.m_dataAddress
         << " m_dataPort: " << m_settings.m_dataPort
         << " m_preFill: " << m_settings.m_preFill
@@ -445,6 +450,11 @@ void RemoteTCPInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("sampleBits")) {
         settings.m_sampleBits = response.getRemoteTcpInputSettings()->getSampleBits();
     }
+    if (deviceSettingsKeys.contains("compression"))
+    {
+        int compression = response.getRemoteTcpInputSettings()->getCompression();
+        settings.m_compression = RemoteTCPCodec::isValid(compression) ? (RemoteTCPCodec::Compression)compression : RemoteTCPCodec::None;
+    }
     if (deviceSettingsKeys.contains("dataAddress")) {
         settings.m_dataAddress = *response.getRemoteTcpInputSettings()->getDataAddress();
     }
@@ -489,6 +499,7 @@ void RemoteTCPInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings&
     response.getRemoteTcpInputSettings()->setChannelSampleRate(settings.m_channelSampleRate);
     response.getRemoteTcpInputSettings()->setChannelDecimation(settings.m_channelDecimation);
     response.getRemoteTcpInputSettings()->setSampleBits(settings.m_sampleBits);
+    response.getRemoteTcpInputSettings()->setCompression((int)settings.m_compression);
     response.getRemoteTcpInputSettings()->setDataAddress(new QString(settings.m_dataAddress));
     response.getRemoteTcpInputSettings()->setDataPort(settings.m_dataPort);
     response.getRemoteTcpInputSettings()->setOverrideRemoteSettings(settings.m_overrideRemoteSettings ? 1 : 0);
@@ -548,6 +559,9 @@ void RemoteTCPInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKey
     if (deviceSettingsKeys.contains("dataPort") || force) {
         swgRemoteTCPInputSettings->setDataPort(settings.m_dataPort);
     }
+    if (deviceSettingsKeys.contains("compression") || force) {
+        swgRemoteTCPInputSettings->setCompression((int)settings.m_compression);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
@@ -122,6 +122,31 @@ public:
         { }
     };
 
+    class MsgReportCompression : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        RemoteTCPCodec::Compression getCompression() const { return m_compression; }
+        float getRatio() const { return m_ratio; }
+        float getDecodeCPU() const { return m_decodeCPU; }
+
+        static MsgReportCompression* create(RemoteTCPCodec::Compression compression, float ratio, float decodeCPU) {
+            return new MsgReportCompression(compression, ratio, decodeCPU);
+        }
+
+    protected:
+        RemoteTCPCodec::Compression m_compression; //!< Compression of the stream being received
+        float m_ratio;              //!< Decoded over received size
+        float m_decodeCPU;          //!< Percentage of wall clock time spent decompressing
+
+        MsgReportCompression(RemoteTCPCodec::Compression compression, float ratio, float decodeCPU) :
+            Message(),
+            m_compression(compression),
+            m_ratio(ratio),
+            m_decodeCPU(decodeCPU)
+        { }
+    };
+
     RemoteTCPInput(DeviceAPI *deviceAPI);
     virtual ~RemoteTCPInput();
     virtual void destroy();
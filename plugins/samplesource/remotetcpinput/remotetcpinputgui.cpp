@@ -162,6 +162,19 @@ bool RemoteTCPInputGui::handleMessage(const Message& message)
         blockApplySettings(false);
         return true;
     }
+    else if (RemoteTCPInput::MsgReportCompression::match(message))
+    {
+        const RemoteTCPInput::MsgReportCompression& report = (RemoteTCPInput::MsgReportCompression&) message;
+        if (report.getCompression() == RemoteTCPCodec::None) {
+            ui->compressionStats->setText("");
+        } else {
+            ui->compressionStats->setText(QString("%1 %2:1 %3%")
+                .arg(RemoteTCPCodec::getName(report.getCompression()))
+                .arg(report.getRatio(), 0, 'f', 2)
+                .arg(report.getDecodeCPU(), 0, 'f', 1));
+        }
+        return true;
+    }
     else if (RemoteTCPInput::MsgReportTCPBuffer::match(message))
     {
         const RemoteTCPInput::MsgReportTCPBuffer& report = (RemoteTCPInput::MsgReportTCPBuffer&) message;
@@ -233,6 +246,7 @@ bool RemoteTCPInputGui::handleMessage(const Message& message)
                 ui->sampleBits->removeItem(ui->sampleBits->count() - 1);
             }
         }
+        ui->compression->setEnabled(sdra);
         ui->dcOffset->setVisible(sdra);
         ui->iqImbalance->setVisible(sdra);
         if (sdra && (ui->decim->count() != 7))
@@ -343,6 +357,7 @@ void RemoteTCPInputGui::displaySettings()
     ui->decimation->setChecked(!m_settings.m_channelDecimation);
     ui->channelSampleRate->setEnabled(m_settings.m_channelDecimation);
     ui->sampleBits->setCurrentIndex(m_settings.m_sampleBits/8-1);
+    ui->compression->setCurrentIndex((int)m_settings.m_compression);
 
     ui->dataPort->setText(tr("%1").arg(m_settings.m_dataPort));
     ui->dataAddress->setText(m_settings.m_dataAddress);
@@ -653,6 +668,12 @@ void RemoteTCPInputGui::on_sampleBits_currentIndexChanged(int index)
     sendSettings();
 }
 
+void RemoteTCPInputGui::on_compression_currentIndexChanged(int index)
+{
+    m_settings.m_compression = (RemoteTCPCodec::Compression)index;
+    sendSettings();
+}
+
 void RemoteTCPInputGui::on_dataAddress_editingFinished()
 {
     m_settings.m_dataAddress = ui->dataAddress->text();
@@ -774,6 +795,7 @@ void RemoteTCPInputGui::makeUIConnections()
     QObject::connect(ui->channelSampleRate, &ValueDial::changed, this, &RemoteTCPInputGui::on_channelSampleRate_changed);
     QObject::connect(ui->decimation, &ButtonSwitch::toggled, this, &RemoteTCPInputGui::on_decimation_toggled);
     QObject::connect(ui->sampleBits, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &RemoteTCPInputGui::on_sampleBits_currentIndexChanged);
+    QObject::connect(ui->compression, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &RemoteTCPInputGui::on_compression_currentIndexChanged);
     QObject::connect(ui->dataAddress, &QLineEdit::editingFinished, this, &RemoteTCPInputGui::on_dataAddress_editingFinished);
     QObject::connect(ui->dataPort, &QLineEdit::editingFinished, this, &RemoteTCPInputGui::on_dataPort_editingFinished);
     QObject::connect(ui->overrideRemoteSettings, &ButtonSwitch::toggled, this, &RemoteTCPInputGui::on_overrideRemoteSettings_toggled);
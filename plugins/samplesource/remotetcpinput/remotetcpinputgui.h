@@ -187,6 +187,7 @@ private slots:
     void on_channelSampleRate_changed(quint64 value);
     void on_decimation_toggled(bool checked);
     void on_sampleBits_currentIndexChanged(int index);
+    void on_compression_currentIndexChanged(int index);
     void on_dataAddress_editingFinished();
     void on_dataPort_editingFinished();
     void on_overrideRemoteSettings_toggled(bool checked);
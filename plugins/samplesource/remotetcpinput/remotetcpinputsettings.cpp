@@ -44,6 +44,7 @@ void RemoteTCPInputSettings::resetToDefaults()
     m_channelSampleRate = m_devSampleRate;
     m_channelDecimation = false;
     m_sampleBits = 8;
+    m_compression = RemoteTCPCodec::None;
     m_dataAddress = "127.0.0.1";
     m_dataPort = 1234;
     m_overrideRemoteSettings = true;
@@ -80,6 +81,7 @@ QByteArray RemoteTCPInputSettings::serialize() const
     s.writeString(21, m_reverseAPIAddress);
     s.writeU32(22, m_reverseAPIPort);
     s.writeU32(23, m_reverseAPIDeviceIndex);
+    s.writeS32(24, (int)m_compression);
 
     for (int i = 0; i < m_maxGains; i++) {
         s.writeS32(30+i, m_gain[i]);
@@ -134,6 +136,10 @@ bool RemoteTCPInputSettings::deserialize(const QByteArray& data)
         d.readU32(23, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
 
+        int intval;
+        d.readS32(24, &intval, (int)RemoteTCPCodec::None);
+        m_compression = RemoteTCPCodec::isValid(intval) ? (RemoteTCPCodec::Compression)intval : RemoteTCPCodec::None;
+
         for (int i = 0; i < m_maxGains; i++) {
             d.readS32(30+i, &m_gain[i], 0);
         }
@@ -22,6 +22,8 @@
 #include <QByteArray>
 #include <QString>
 
+#include "channel/remotetcpcodec.h"
+
 struct RemoteTCPInputSettings
 {
     static const int m_maxGains = 3;
@@ -42,6 +44,7 @@ struct RemoteTCPInputSettings
     qint32   m_channelSampleRate;
     bool     m_channelDecimation;       // If false, m_channelSampleRate==m_devSampleRate
     qint32   m_sampleBits;              // Number of bits used to transmit IQ samples (8,16,24,32)
+    RemoteTCPCodec::Compression m_compression; // Compression of transmitted IQ samples (SDRA only)
     QString  m_dataAddress;
     quint16  m_dataPort;
     bool     m_overrideRemoteSettings;  // When connected, apply local settings to remote, or apply remote settings to local
@@ -18,6 +18,7 @@
 
 #include <QUdpSocket>
 #include <QDebug>
+#include <QElapsedTimer>
 
 #include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
@@ -43,6 +44,10 @@ RemoteTCPInputTCPHandler::RemoteTCPInputTCPHandler(SampleSinkFifo *sampleFifo, D
     m_reconnectTimer(this),
     m_converterBuffer(nullptr),
     m_converterBufferNbSamples(0),
+    m_compression(RemoteTCPCodec::None),
+    m_compressedBytes(0),
+    m_decodedBytes(0),
+    m_decodeNanos(0),
     m_settings()
 {
     m_tcpBuf = new char[m_sampleFifo->size()*2*4];
@@ -120,6 +125,9 @@ void RemoteTCPInputTCPHandler::connectToHost(const QString& address, quint16 por
     m_dataSocket = new QTcpSocket(this);
     m_fillBuffer = true;
     m_readMetaData = false;
+    m_compression = RemoteTCPCodec::None;
+    m_compressedBuf.clear();
+    m_decodedBuf.clear();
     connect(m_dataSocket, SIGNAL(readyRead()), this, SLOT(dataReadyRead()));
     connect(m_dataSocket, SIGNAL(connected()), this, SLOT(connected()));
     connect(m_dataSocket, SIGNAL(disconnected()), this, SLOT(disconnected()));
@@ -165,7 +173,20 @@ void RemoteTCPInputTCPHandler::clearBuffer()
     if (m_dataSocket)
     {
         m_dataSocket->flush();
-        m_dataSocket->readAll();
+
+        if (m_compression == RemoteTCPCodec::None)
+        {
+            m_dataSocket->readAll();
+        }
+        else
+        {
+            // Only whole blocks can be dropped, otherwise we'd lose sync with the stream
+            if (!decodeData()) {
+                return;
+            }
+            m_decodedBuf.clear();
+        }
+
         m_fillBuffer = true;
     }
 }
@@ -374,6 +395,18 @@ void RemoteTCPInputTCPHandler::setSampleBitDepth(int sampleBits)
     }
 }
 
+void RemoteTCPInputTCPHandler::setSampleCompression(RemoteTCPCodec::Compression compression)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    quint8 request[5];
+    request[0] = RemoteTCPProtocol::setSampleCompression;
+    RemoteTCPProtocol::encodeUInt32(&request[1], compression);
+    if (m_dataSocket) {
+        m_dataSocket->write((char*)request, sizeof(request));
+    }
+}
+
 void RemoteTCPInputTCPHandler::applySettings(const RemoteTCPInputSettings& settings, bool force)
 {
     qDebug() << "RemoteTCPInputTCPHandler::applySettings: "
@@ -452,6 +485,11 @@ void RemoteTCPInputTCPHandler::applySettings(const RemoteTCPInputSettings& setti
         setSampleBitDepth(settings.m_sampleBits);
         clearBuffer();
     }
+    if ((settings.m_compression != m_settings.m_compression) || force)
+    {
+        setSampleCompression(settings.m_compression);
+        clearBuffer();
+    }
 
     // Don't use force, as disconnect can cause rtl_tcp to quit
     if ((settings.m_dataPort != m_settings.m_dataPort) || (settings.m_dataAddress != m_settings.m_dataAddress) || (m_dataSocket == nullptr))
@@ -541,10 +579,12 @@ void RemoteTCPInputTCPHandler::dataReadyRead()
                     if (m_messageQueueToGUI) {
                         m_messageQueueToGUI->push(MsgReportRemoteDevice::create(tuner, protocol));
                     }
-                    if (m_settings.m_sampleBits != 8)
+                    m_compression = RemoteTCPCodec::None;
+                    if ((m_settings.m_sampleBits != 8) || (m_settings.m_compression != RemoteTCPCodec::None))
                     {
                         RemoteTCPInputSettings& settings = m_settings;
                         settings.m_sampleBits = 8;
+                        settings.m_compression = RemoteTCPCodec::None;
                         if (m_messageQueueToInput) {
                             m_messageQueueToInput->push(RemoteTCPInput::MsgConfigureRemoteTCPInput::create(settings));
                         }
@@ -561,6 +601,9 @@ void RemoteTCPInputTCPHandler::dataReadyRead()
                     if (m_messageQueueToGUI) {
                         m_messageQueueToGUI->push(MsgReportRemoteDevice::create(device, protocol));
                     }
+                    // Servers predating compression leave this zero (None)
+                    quint32 compression = RemoteTCPProtocol::extractUInt32(&metaData[60]);
+                    m_compression = RemoteTCPCodec::isValid(compression) ? (RemoteTCPCodec::Compression)compression : RemoteTCPCodec::None;
                     if (!m_settings.m_overrideRemoteSettings)
                     {
                         // Update local settings to match remote
@@ -583,6 +626,7 @@ void RemoteTCPInputTCPHandler::dataReadyRead()
                         settings.m_channelGain = RemoteTCPProtocol::extractUInt32(&metaData[48]);
                         settings.m_channelSampleRate = RemoteTCPProtocol::extractUInt32(&metaData[52]);
                         settings.m_sampleBits = RemoteTCPProtocol::extractUInt32(&metaData[56]);
+                        settings.m_compression = m_compression;
                         if (settings.m_channelSampleRate != (settings.m_devSampleRate >> settings.m_log2Decim)) {
                             settings.m_channelDecimation = true;
                         }
@@ -610,11 +654,18 @@ void RemoteTCPInputTCPHandler::processData()
     QMutexLocker mutexLocker(&m_mutex);
     if (m_dataSocket && (m_dataSocket->state() == QAbstractSocket::ConnectedState))
     {
+        if ((m_compression != RemoteTCPCodec::None) && !decodeData()) {
+            return;
+        }
+
+        reportCompression();
+
         int sampleRate = m_settings.m_channelSampleRate;
         int bytesPerSample = m_settings.m_sampleBits / 8;
         int bytesPerSecond = sampleRate * 2 * bytesPerSample;
+        qint64 available = bytesAvailable();
 
-        if (m_dataSocket->bytesAvailable() < (0.1f * m_settings.m_preFill * bytesPerSecond))
+        if (available < (0.1f * m_settings.m_preFill * bytesPerSecond))
         {
             qDebug() << "RemoteTCPInputTCPHandler::processData: Buffering!";
             m_fillBuffer = true;
@@ -624,9 +675,9 @@ void RemoteTCPInputTCPHandler::processData()
         // QTcpSockets buffer size should be unlimited - we pretend here it's twice as big as the point we start reading from it
         if (m_messageQueueToGUI)
         {
-            qint64 size = std::max(m_dataSocket->bytesAvailable(), (qint64)(m_settings.m_preFill * bytesPerSecond));
+            qint64 size = std::max(available, (qint64)(m_settings.m_preFill * bytesPerSecond));
             RemoteTCPInput::MsgReportTCPBuffer *report = RemoteTCPInput::MsgReportTCPBuffer::create(
-                                                            m_dataSocket->bytesAvailable(), size, m_dataSocket->bytesAvailable() / (float)bytesPerSecond,
+                                                            available, size, available / (float)bytesPerSecond,
                                                             m_sampleFifo->fill(),  m_sampleFifo->size(), m_sampleFifo->fill() / (float)bytesPerSecond
                                                             );
             m_messageQueueToGUI->push(report);
@@ -636,9 +687,9 @@ void RemoteTCPInputTCPHandler::processData()
         // Prime buffer, before we start reading
         if (m_fillBuffer)
         {
-            if (m_dataSocket->bytesAvailable() >= m_settings.m_preFill * bytesPerSecond)
+            if (available >= m_settings.m_preFill * bytesPerSecond)
             {
-                qDebug() << "Buffer primed bytesAvailable:" << m_dataSocket->bytesAvailable();
+                qDebug() << "Buffer primed bytesAvailable:" << available;
                 m_fillBuffer = false;
                 m_prevDateTime = QDateTime::currentDateTime();
                 factor = 6.0f / 8.0f;
@@ -656,15 +707,130 @@ void RemoteTCPInputTCPHandler::processData()
 
         if (!m_fillBuffer)
         {
-            if (m_dataSocket->bytesAvailable() >= requiredSamples*2*bytesPerSample)
+            int requiredBytes = requiredSamples*2*bytesPerSample;
+
+            if (available >= requiredBytes)
             {
-                m_dataSocket->read(&m_tcpBuf[0], requiredSamples*2*bytesPerSample);
+                if (m_compression == RemoteTCPCodec::None)
+                {
+                    m_dataSocket->read(&m_tcpBuf[0], requiredBytes);
+                }
+                else
+                {
+                    memcpy(&m_tcpBuf[0], m_decodedBuf.constData(), requiredBytes);
+                    m_decodedBuf.remove(0, requiredBytes);
+                }
+
                 convert(requiredSamples);
             }
         }
     }
 }
 
+qint64 RemoteTCPInputTCPHandler::bytesAvailable() const
+{
+    if (m_compression == RemoteTCPCodec::None) {
+        return m_dataSocket->bytesAvailable();
+    } else {
+        return m_decodedBuf.size();
+    }
+}
+
+// Decode all complete blocks received so far into the uncompressed wire format, so convert() doesn't need to care
+bool RemoteTCPInputTCPHandler::decodeData()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    m_compressedBuf.append(m_dataSocket->readAll());
+
+    int bytesPerSample = m_settings.m_sampleBits / 8;
+    int offset = 0;
+    int decodedBytes = 0;
+
+    while (true)
+    {
+        m_decodedIQ.clear();
+        int used = RemoteTCPCodec::decode(m_compressedBuf.constData() + offset, m_compressedBuf.size() - offset, m_decodedIQ);
+
+        if (used == 0) {
+            break;
+        }
+
+        if (used < 0)
+        {
+            qWarning() << "RemoteTCPInputTCPHandler::decodeData: invalid compressed block - reconnecting";
+            m_compressedBuf.clear();
+            m_decodedBuf.clear();
+            disconnectFromHost();
+            if (m_messageQueueToGUI) {
+                m_messageQueueToGUI->push(MsgReportConnection::create(false));
+            }
+            m_reconnectTimer.start(500);
+            return false;
+        }
+
+        offset += used;
+
+        int start = m_decodedBuf.size();
+        m_decodedBuf.resize(start + m_decodedIQ.size() * bytesPerSample);
+        quint8 *out = (quint8 *) m_decodedBuf.data() + start;
+
+        if (bytesPerSample == 1)
+        {
+            for (auto v : m_decodedIQ) {
+                *out++ = v + 128; // Unsigned as per rtl_tcp
+            }
+        }
+        else
+        {
+            for (auto v : m_decodedIQ)
+            {
+                for (int k = 0; k < bytesPerSample; k++) {
+                    *out++ = (v >> (8*k)) & 0xff;
+                }
+            }
+        }
+
+        decodedBytes += m_decodedIQ.size() * bytesPerSample;
+    }
+
+    m_compressedBuf.remove(0, offset);
+    m_compressedBytes += offset;
+    m_decodedBytes += decodedBytes;
+    m_decodeNanos += timer.nsecsElapsed();
+
+    return true;
+}
+
+void RemoteTCPInputTCPHandler::reportCompression()
+{
+    QDateTime currentDateTime = QDateTime::currentDateTime();
+
+    if (!m_compressionDateTime.isValid())
+    {
+        m_compressionDateTime = currentDateTime;
+        return;
+    }
+
+    qint64 msecs = m_compressionDateTime.msecsTo(currentDateTime);
+
+    if (msecs >= 1000)
+    {
+        if (m_messageQueueToGUI)
+        {
+            float ratio = m_compressedBytes > 0 ? m_decodedBytes / (float) m_compressedBytes : 1.0f;
+            float cpu = (m_decodeNanos / 1e4f) / msecs;
+            m_messageQueueToGUI->push(RemoteTCPInput::MsgReportCompression::create(m_compression, ratio, cpu));
+        }
+
+        m_compressionDateTime = currentDateTime;
+        m_compressedBytes = 0;
+        m_decodedBytes = 0;
+        m_decodeNanos = 0;
+    }
+}
+
 // The following code assumes host is little endian
 void RemoteTCPInputTCPHandler::convert(int nbSamples)
 {
@@ -25,7 +25,10 @@
 #include <QRecursiveMutex>
 #include <QDateTime>
 
+#include <vector>
+
 #include "util/messagequeue.h"
+#include "channel/remotetcpcodec.h"
 #include "remotetcpinputsettings.h"
 #include "../../channelrx/remotetcpsink/remotetcpprotocol.h"
 
@@ -138,6 +141,15 @@ private:
     int32_t *m_converterBuffer;
     uint32_t m_converterBufferNbSamples;
 
+    RemoteTCPCodec::Compression m_compression; //!< Compression of the stream as given in the metadata
+    QByteArray m_compressedBuf;         //!< Received bytes not yet decoded
+    QByteArray m_decodedBuf;            //!< Decoded samples in the uncompressed wire format
+    std::vector<qint32> m_decodedIQ;
+    QDateTime m_compressionDateTime;    //!< For calculating compression ratio and CPU cost
+    qint64 m_compressedBytes;
+    qint64 m_decodedBytes;
+    qint64 m_decodeNanos;
+
     QRecursiveMutex m_mutex;
     RemoteTCPInputSettings m_settings;
 
@@ -165,6 +177,10 @@ private:
     void setChannelFreqOffset(int offset);
     void setChannelGain(int gain);
     void setSampleBitDepth(int sampleBits);
+    void setSampleCompression(RemoteTCPCodec::Compression compression);
+    void decodeData();
+    void reportCompression();
+    qint64 bytesAvailable() const;
     void applySettings(const RemoteTCPInputSettings& settings, bool force = false);
 
 private slots:
@@ -17,6 +17,7 @@
 
 #include <string>
 #include <regex>
+#include <algorithm>
 #include <errno.h>
 #include <boost/lexical_cast.hpp>
 
@@ -89,6 +90,15 @@ SigMFFileInput::SigMFFileInput(DeviceAPI *deviceAPI) :
         this,
         &SigMFFileInput::networkManagerFinished
     );
+    // direct connection so that a channel being deleted is removed from the worker before its FIFO goes away
+    QObject::connect(
+        m_deviceAPI,
+        &DeviceAPI::sinkChannelsChanged,
+        this,
+        &SigMFFileInput::sinkChannelsChanged,
+        Qt::DirectConnection
+    );
+    sinkChannelsChanged();
     m_masterTimer.setTimerType(Qt::PreciseTimer);
     m_masterTimer.start(50);
 }
@@ -96,6 +106,12 @@ SigMFFileInput::SigMFFileInput(DeviceAPI *deviceAPI) :
 SigMFFileInput::~SigMFFileInput()
 {
     m_masterTimer.stop();
+    QObject::disconnect(
+        m_deviceAPI,
+        &DeviceAPI::sinkChannelsChanged,
+        this,
+        &SigMFFileInput::sinkChannelsChanged
+    );
     QObject::disconnect(
         m_networkManager,
         &QNetworkAccessManager::finished,
@@ -118,9 +134,7 @@ bool SigMFFileInput::openFileStreams(const QString& fileName)
 		m_metaStream.close();
 	}
 
-	if (m_dataStream.is_open()) {
-		m_dataStream.close();
-	}
+	m_dataFile.close();
 
     QString metaFileName = fileName + ".sigmf-meta";
     QString dataFileName = fileName + ".sigmf-data";
@@ -131,19 +145,13 @@ bool SigMFFileInput::openFileStreams(const QString& fileName)
 	m_metaStream.open(metaFileName.toStdString().c_str());
 #endif
 
-#ifdef Q_OS_WIN
-	m_dataStream.open(dataFileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
-#else
-	m_dataStream.open(dataFileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
-#endif
-
-    if (!m_dataStream.is_open())
+    if (!m_dataFile.open(dataFileName))
     {
         qCritical("SigMFFileInput::openFileStreams: error opening data file %s", qPrintable(dataFileName));
         return false;
     }
 
-    uint64_t dataFileSize = m_dataStream.tellg();
+    uint64_t dataFileSize = m_dataFile.size();
 
     sigmf::SigMF<sigmf::Global<core::DescrT, sdrangel::DescrT>,
             sigmf::Capture<core::DescrT, sdrangel::DescrT>,
@@ -421,11 +429,11 @@ void SigMFFileInput::seekFileStream(uint64_t sampleIndex)
 {
     QMutexLocker mutexLocker(&m_mutex);
 
-	if (m_dataStream.is_open())
+	if (m_dataFile.isOpen())
 	{
+        // the read position is the worker sample count. Just have the kernel read the new position ahead
         uint64_t seekPoint = sampleIndex*m_sampleBytes*2;
-		m_dataStream.clear();
-		m_dataStream.seekg(seekPoint, std::ios::beg);
+		m_dataFile.willNeed(seekPoint, FILESOURCE_READAHEAD_BYTES);
     }
 }
 
@@ -447,7 +455,7 @@ void SigMFFileInput::init()
 
 bool SigMFFileInput::start()
 {
-    if (!m_dataStream.is_open())
+    if (!m_dataFile.isOpen())
     {
         qWarning("SigMFFileInput::start: file not open. not starting");
         return false;
@@ -456,20 +464,17 @@ bool SigMFFileInput::start()
 	QMutexLocker mutexLocker(&m_mutex);
 	qDebug() << "SigMFFileInput::start";
 
-	if (m_dataStream.tellg() != (std::streampos) 0) {
-		m_dataStream.clear();
-		m_dataStream.seekg(0, std::ios::beg);
-	}
-
-	if(!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample))) {
+	if(!m_sampleFifo.setSize(getSampleFifoSize())) {
 		qCritical("Could not allocate SampleFifo");
 		return false;
 	}
 
-	m_fileInputWorker = new SigMFFileInputWorker(&m_dataStream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+	m_fileInputWorker = new SigMFFileInputWorker(&m_dataFile, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+    m_fileInputWorker->setChannelAPIs(m_sinkChannelAPIs);
 	startWorker();
     m_fileInputWorker->setMetaInformation(&m_metaInfo, &m_captures);
     m_fileInputWorker->setAccelerationFactor(m_settings.m_accelerationFactor);
+    m_fileInputWorker->setAsFastAsPossible(m_settings.m_asFastAsPossible);
     m_fileInputWorker->setTrackIndex(0);
     m_fileInputWorker->moveToThread(&m_fileInputWorkerThread);
 	m_deviceDescription = "SigMFFileInput";
@@ -505,6 +510,20 @@ void SigMFFileInput::stop()
 	}
 }
 
+void SigMFFileInput::sinkChannelsChanged()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_sinkChannelAPIs.clear();
+
+    for (int i = 0; i < m_deviceAPI->getNbSinkChannels(); i++) {
+        m_sinkChannelAPIs.append(m_deviceAPI->getChanelSinkAPIAt(i));
+    }
+
+    if (m_fileInputWorker) {
+        m_fileInputWorker->setChannelAPIs(m_sinkChannelAPIs);
+    }
+}
+
 void SigMFFileInput::startWorker()
 {
     m_fileInputWorker->startWork();
@@ -668,7 +687,7 @@ bool SigMFFileInput::handleMessage(const Message& message)
     {
         MsgConfigureFileSeek& conf = (MsgConfigureFileSeek&) message;
         int seekMillis = conf.getMillis();
-        seekFileStream(seekMillis);
+        seekFileMillis(seekMillis);
         uint64_t sampleCount = (m_metaInfo.m_totalSamples*seekMillis)/1000UL;
         m_currentTrackIndex = getTrackIndex(sampleCount);
 
@@ -762,12 +781,15 @@ bool SigMFFileInput::handleMessage(const Message& message)
             stopWorker();
         }
 
+        bool rewound = false;
+
         if (m_trackMode)
         {
             if (m_settings.m_trackLoop)
             {
                 seekFileStream(m_captures[m_currentTrackIndex].m_sampleStart);
                 m_fileInputWorker->setTrackIndex(m_currentTrackIndex);
+                rewound = true;
             }
         }
         else
@@ -776,10 +798,12 @@ bool SigMFFileInput::handleMessage(const Message& message)
             {
                 seekFileStream(0);
                 m_fileInputWorker->setTrackIndex(0);
+                rewound = true;
             }
         }
 
-        if (working) {
+        // without pacing a restart at end of file would immediately report end of file again
+        if (working && (rewound || !m_settings.m_asFastAsPossible)) {
             startWorker();
         }
 
@@ -827,9 +851,8 @@ bool SigMFFileInput::applySettings(const SigMFFileInputSettings& settings, bool
         if (m_fileInputWorker)
         {
             QMutexLocker mutexLocker(&m_mutex);
-            if (!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample))) {
-                qCritical("SigMFFileInput::applySettings: could not reallocate sample FIFO size to %lu",
-                        m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample));
+            if (!m_sampleFifo.setSize(getSampleFifoSize())) {
+                qCritical("SigMFFileInput::applySettings: could not reallocate sample FIFO size to %u", getSampleFifoSize());
             }
 
             m_fileInputWorker->setAccelerationFactor(settings.m_accelerationFactor); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
@@ -843,6 +866,12 @@ bool SigMFFileInput::applySettings(const SigMFFileInputSettings& settings, bool
         reverseAPIKeys.append("fullLoop");
     }
 
+    bool asFastAsPossibleChanged = (m_settings.m_asFastAsPossible != settings.m_asFastAsPossible) || force;
+
+    if (asFastAsPossibleChanged) {
+        reverseAPIKeys.append("asFastAsPossible");
+    }
+
     if ((m_settings.m_fileName != settings.m_fileName))
     {
         reverseAPIKeys.append("fileName");
@@ -859,9 +888,45 @@ bool SigMFFileInput::applySettings(const SigMFFileInputSettings& settings, bool
     }
 
     m_settings = settings;
+
+    if (asFastAsPossibleChanged && m_fileInputWorker)
+    {
+        // pacing changes only while the worker is stopped
+        bool working = m_fileInputWorker->isRunning();
+
+        if (working) {
+            stopWorker();
+        }
+
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (!m_sampleFifo.setSize(getSampleFifoSize())) {
+            qCritical("SigMFFileInput::applySettings: could not reallocate sample FIFO size to %u", getSampleFifoSize());
+        }
+
+        m_fileInputWorker->setAsFastAsPossible(m_settings.m_asFastAsPossible);
+        mutexLocker.unlock();
+
+        if (working) {
+            startWorker();
+        }
+    }
+
     return true;
 }
 
+unsigned int SigMFFileInput::getSampleFifoSize() const
+{
+    unsigned int size = m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample);
+
+    // without pacing the FIFO must hold several reads for the DSP engine to work on large blocks
+    if (m_settings.m_asFastAsPossible) {
+        size = std::max(size, 4U * FILESOURCE_FAST_CHUNK_SAMPLES);
+    }
+
+    return size;
+}
+
 int SigMFFileInput::webapiSettingsGet(
                 SWGSDRangel::SWGDeviceSettings& response,
                 QString& errorMessage)
@@ -913,6 +978,9 @@ void SigMFFileInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("fullLoop")) {
         settings.m_trackLoop = response.getSigMfFileInputSettings()->getFullLoop() != 0;
     }
+    if (deviceSettingsKeys.contains("asFastAsPossible")) {
+        settings.m_asFastAsPossible = response.getSigMfFileInputSettings()->getAsFastAsPossible() != 0;
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getSigMfFileInputSettings()->getUseReverseApi() != 0;
     }
@@ -1051,6 +1119,7 @@ void SigMFFileInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings&
     response.getSigMfFileInputSettings()->setAccelerationFactor(settings.m_accelerationFactor);
     response.getSigMfFileInputSettings()->setTrackLoop(settings.m_trackLoop ? 1 : 0);
     response.getSigMfFileInputSettings()->setFullLoop(settings.m_fullLoop ? 1 : 0);
+    response.getSigMfFileInputSettings()->setAsFastAsPossible(settings.m_asFastAsPossible ? 1 : 0);
 
     response.getSigMfFileInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -1150,6 +1219,9 @@ void SigMFFileInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKey
     if (deviceSettingsKeys.contains("fullLoop") || force) {
         swgSigMFFileInputSettings->setFullLoop(settings.m_fullLoop);
     }
+    if (deviceSettingsKeys.contains("asFastAsPossible") || force) {
+        swgSigMFFileInputSettings->setAsFastAsPossible(settings.m_asFastAsPossible ? 1 : 0);
+    }
     if (deviceSettingsKeys.contains("fileName") || force) {
         swgSigMFFileInputSettings->setFileName(new QString(settings.m_fileName));
     }
@@ -31,6 +31,7 @@
 #include "dsp/sigmf_forward.h"
 
 #include "dsp/devicesamplesource.h"
+#include "dsp/mappedsamplefile.h"
 #include "sigmffileinputsettings.h"
 #include "sigmffiledata.h"
 
@@ -38,6 +39,7 @@ class QNetworkAccessManager;
 class QNetworkReply;
 class SigMFFileInputWorker;
 class DeviceAPI;
+class ChannelAPI;
 
 class SigMFFileInput : public DeviceSampleSource {
 	Q_OBJECT
@@ -446,7 +448,7 @@ private:
 	QMutex m_mutex;
 	SigMFFileInputSettings m_settings;
 	std::ifstream m_metaStream;
-    std::ifstream m_dataStream;
+    MappedSampleFile m_dataFile;
     SigMFFileMetaInfo m_metaInfo;
     QList<SigMFFileCapture> m_captures;
     std::vector<uint64_t> m_captureStarts;
@@ -459,6 +461,7 @@ private:
     QString m_recordSummary;
 	SigMFFileInputWorker* m_fileInputWorker;
     QThread m_fileInputWorkerThread;
+    QList<ChannelAPI*> m_sinkChannelAPIs; //!< copy of the device set channels maintained in the main thread
 	QString m_deviceDescription;
 	int m_sampleRate;
 	unsigned int m_sampleBytes;
@@ -489,6 +492,7 @@ private:
 	void seekFileStream(uint64_t sampleIndex);
 	void seekTrackMillis(int seekMillis);
     void seekFileMillis(int seekMillis);
+	unsigned int getSampleFifoSize() const;
 	bool applySettings(const SigMFFileInputSettings& settings, bool force = false);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const SigMFFileInputSettings& settings, bool force);
@@ -496,6 +500,7 @@ private:
 
 private slots:
     void networkManagerFinished(QNetworkReply *reply);
+    void sinkChannelsChanged();
 };
 
 #endif // INCLUDE_SIGMFFILEINPUT_H
@@ -327,6 +327,7 @@ void SigMFFileInputGUI::displaySettings()
     blockApplySettings(true);
     ui->playTrackLoop->setChecked(m_settings.m_trackLoop);
     ui->playFullLoop->setChecked(m_settings.m_fullLoop);
+    ui->asFastAsPossible->setChecked(m_settings.m_asFastAsPossible);
     ui->acceleration->setCurrentIndex(SigMFFileInputSettings::getAccelerationIndex(m_settings.m_accelerationFactor));
     blockApplySettings(false);
 }
@@ -461,6 +462,12 @@ void SigMFFileInputGUI::on_playFullLoop_toggled(bool checked)
     sendSettings();
 }
 
+void SigMFFileInputGUI::on_asFastAsPossible_toggled(bool checked)
+{
+    m_settings.m_asFastAsPossible = checked;
+    sendSettings();
+}
+
 void SigMFFileInputGUI::on_playFull_toggled(bool checked)
 {
 	SigMFFileInput::MsgConfigureFileWork* message = SigMFFileInput::MsgConfigureFileWork::create(checked);
@@ -701,6 +708,7 @@ void SigMFFileInputGUI::makeUIConnections()
     QObject::connect(ui->fullNavTimeSlider, &QSlider::valueChanged, this, &SigMFFileInputGUI::on_fullNavTimeSlider_valueChanged);
     QObject::connect(ui->playFull, &ButtonSwitch::toggled, this, &SigMFFileInputGUI::on_playFull_toggled);
     QObject::connect(ui->playFullLoop, &ButtonSwitch::toggled, this, &SigMFFileInputGUI::on_playFullLoop_toggled);
+    QObject::connect(ui->asFastAsPossible, &ButtonSwitch::toggled, this, &SigMFFileInputGUI::on_asFastAsPossible_toggled);
     QObject::connect(ui->showFileDialog, &QPushButton::clicked, this, &SigMFFileInputGUI::on_showFileDialog_clicked);
     QObject::connect(ui->acceleration, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &SigMFFileInputGUI::on_acceleration_currentIndexChanged);
 }
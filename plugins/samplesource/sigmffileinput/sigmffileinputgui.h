@@ -106,6 +106,7 @@ private slots:
     void on_fullNavTimeSlider_valueChanged(int value);
 	void on_playFull_toggled(bool checked);
 	void on_playFullLoop_toggled(bool checked);
+	void on_asFastAsPossible_toggled(bool checked);
 	void on_showFileDialog_clicked(bool checked);
 	void on_acceleration_currentIndexChanged(int index);
     void updateStatus();
@@ -32,6 +32,7 @@ void SigMFFileInputSettings::resetToDefaults()
     m_accelerationFactor = 1;
     m_trackLoop = false;
     m_fullLoop = true;
+    m_asFastAsPossible = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -49,6 +50,7 @@ QByteArray SigMFFileInputSettings::serialize() const
     s.writeString(6, m_reverseAPIAddress);
     s.writeU32(7, m_reverseAPIPort);
     s.writeU32(8, m_reverseAPIDeviceIndex);
+    s.writeBool(9, m_asFastAsPossible);
 
     return s.final();
 }
@@ -82,6 +84,7 @@ bool SigMFFileInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(8, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readBool(9, &m_asFastAsPossible, false);
 
         return true;
     }
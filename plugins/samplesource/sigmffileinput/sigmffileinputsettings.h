@@ -26,6 +26,7 @@ struct SigMFFileInputSettings {
     quint32  m_accelerationFactor;
     bool     m_trackLoop;
     bool     m_fullLoop;
+    bool     m_asFastAsPossible; //!< Replay paced by the processing only (offline processing)
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
@@ -17,10 +17,15 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <algorithm>
 #include <QDebug>
 
 #include "dsp/filerecord.h"
+#include "dsp/mappedsamplefile.h"
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandsamplesink.h"
+#include "channel/channelapi.h"
+#include "device/deviceapi.h"
 #include "util/messagequeue.h"
 
 #include "sigmffiledata.h"
@@ -31,7 +36,7 @@
 MESSAGE_CLASS_DEFINITION(SigMFFileInputWorker::MsgReportEOF, Message)
 MESSAGE_CLASS_DEFINITION(SigMFFileInputWorker::MsgReportTrackChange, Message)
 
-SigMFFileInputWorker::SigMFFileInputWorker(std::ifstream *samplesStream,
+SigMFFileInputWorker::SigMFFileInputWorker(MappedSampleFile *sampleFile,
         SampleSinkFifo* sampleFifo,
         const QTimer& timer,
         MessageQueue *fileInputMessageQueue,
@@ -39,8 +44,12 @@ SigMFFileInputWorker::SigMFFileInputWorker(std::ifstream *samplesStream,
 	QObject(parent),
 	m_running(false),
     m_currentTrackIndex(0),
-	m_ifstream(samplesStream),
-	m_fileBuf(0),
+	m_sampleFile(sampleFile),
+	m_readAheadEnd(0),
+	m_asFastAsPossible(false),
+	m_fastTickGeneration(0),
+	m_eofReported(false),
+	m_channelOverflowCount(0),
 	m_convertBuf(0),
 	m_bufsize(0),
 	m_chunksize(0),
@@ -64,10 +73,6 @@ SigMFFileInputWorker::~SigMFFileInputWorker()
 		stopWork();
 	}
 
-	if (m_fileBuf != 0) {
-		free(m_fileBuf);
-	}
-
 	if (m_convertBuf != 0) {
 		free(m_convertBuf);
 	}
@@ -77,16 +82,29 @@ void SigMFFileInputWorker::startWork()
 {
 	qDebug() << "SigMFFileInputWorker::startWork: ";
 
-    if (m_ifstream->is_open())
+    if (m_sampleFile->isOpen())
     {
-        qDebug() << "SigMFFileInputWorker::startWork: file stream open, starting...";
-        m_elapsedTimer.start();
-        connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+        qDebug() << "SigMFFileInputWorker::startWork: file open, starting" << (m_asFastAsPossible ? "as fast as possible" : "");
         m_running = true;
+
+        if (m_asFastAsPossible)
+        {
+            // paced by the sample FIFO free space instead of the master timer
+            setBuffers(FILESOURCE_FAST_CHUNK_SAMPLES * 2 * m_samplebytes);
+            unsigned int channelFifoSize, channelFifoFree;
+            getChannelFifosSpace(channelFifoSize, channelFifoFree, m_channelOverflowCount);
+            m_fastTickGeneration++;
+            scheduleFastTick(0);
+        }
+        else
+        {
+            m_elapsedTimer.start();
+            connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+        }
     }
     else
     {
-        qDebug() << "SigMFFileInputWorker::startWork: file stream closed, not starting.";
+        qDebug() << "SigMFFileInputWorker::startWork: file closed, not starting.";
     }
 }
 
@@ -94,9 +112,18 @@ void SigMFFileInputWorker::stopWork()
 {
 	qDebug() << "SigMFFileInputWorker::stopWork";
 	disconnect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+	m_fastTickGeneration++; // cancels pending fast ticks
 	m_running = false;
 }
 
+void SigMFFileInputWorker::setSamplesCount(uint64_t samplesCount)
+{
+    m_samplesCount = samplesCount;
+    m_eofReported = false; // new file, track or seek
+    m_readAheadEnd = 0;
+    readAhead(m_samplesCount * 2 * m_samplebytes);
+}
+
 void SigMFFileInputWorker::setMetaInformation(const SigMFFileMetaInfo *metaInfo, const QList<SigMFFileCapture> *captures)
 {
     m_metaInfo = metaInfo;
@@ -110,7 +137,7 @@ void SigMFFileInputWorker::setMetaInformation(const SigMFFileMetaInfo *metaInfo,
 void SigMFFileInputWorker::setTrackIndex(int trackIndex)
 {
     m_currentTrackIndex = trackIndex;
-    m_samplesCount = m_captures->at(m_currentTrackIndex).m_sampleStart;
+    setSamplesCount(m_captures->at(m_currentTrackIndex).m_sampleStart);
     int sampleRate = m_captures->at(m_currentTrackIndex).m_sampleRate;
 
     if (sampleRate != m_samplerate)
@@ -154,19 +181,6 @@ void SigMFFileInputWorker::setBuffers(std::size_t chunksize)
         m_bufsize = chunksize;
         int nbSamples = m_bufsize/(2 * m_samplebytes);
 
-        if (m_fileBuf == 0)
-        {
-            qDebug() << "FileInputThread::setBuffers: Allocate file buffer";
-            m_fileBuf = (quint8*) malloc(m_bufsize);
-        }
-        else
-        {
-            qDebug() << "FileInputThread::setBuffers: Re-allocate file buffer";
-            quint8 *buf = m_fileBuf;
-            m_fileBuf = (quint8*) realloc((void*) m_fileBuf, m_bufsize);
-            if (!m_fileBuf) free(buf);
-        }
-
         if (m_convertBuf == 0)
         {
             qDebug() << "FileInputThread::setBuffers: Allocate conversion buffer";
@@ -199,42 +213,201 @@ void SigMFFileInputWorker::tick()
             setBuffers(m_chunksize);
         }
 
-		// read samples directly feeding the SampleFifo (no callback)
+		// samples are taken directly from the file mapping feeding the SampleFifo (no callback)
+        qint64 nbBytes = std::min((quint64) m_chunksize, (m_totalSamples - std::min(m_samplesCount, m_totalSamples)) * 2 * m_samplebytes);
 
-        if (m_samplesCount + m_chunksize > m_totalSamples) {
-            m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_totalSamples - m_samplesCount);
-        } else {
-    		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+        if (readToSampleFifo(nbBytes) < m_chunksize)
+        {
+            reportEOF();
+        }
+        else
+        {
+            checkTrackChange();
         }
+	}
+}
+
+void SigMFFileInputWorker::scheduleFastTick(int delayMs)
+{
+    unsigned int generation = m_fastTickGeneration;
+    QTimer::singleShot(delayMs, this, [this, generation]() { fastTick(generation); });
+}
+
+void SigMFFileInputWorker::fastTick(unsigned int generation)
+{
+    if (!m_running || (generation != m_fastTickGeneration)) {
+        return;
+    }
+
+    unsigned int fifoSize = m_sampleFifo->size();
+    unsigned int fifoFill = m_sampleFifo->fill();
+    unsigned int fifoFree = fifoSize - fifoFill;
+
+    // let the DSP engine drain the FIFO rather than feeding it with tiny blocks
+    if (fifoFree < fifoSize / 4)
+    {
+        scheduleFastTick(FILESOURCE_FAST_WAIT_MS);
+        return;
+    }
+
+    unsigned int channelFifoSize, channelFifoFree;
+    quint64 channelOverflowCount;
 
-        if ((m_samplesCount + m_chunksize > m_totalSamples) || m_ifstream->eof())
+    if (getChannelFifosSpace(channelFifoSize, channelFifoFree, channelOverflowCount))
+    {
+        if (channelOverflowCount > m_channelOverflowCount)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount()); // take what has been read
-        	MsgReportEOF *message = MsgReportEOF::create();
-        	m_fileInputMessageQueue->push(message);
+            qWarning("SigMFFileInputWorker::fastTick: %llu channel FIFO overflows in fast mode",
+                channelOverflowCount - m_channelOverflowCount);
         }
-        else
+
+        m_channelOverflowCount = channelOverflowCount;
+        // samples still in the device FIFO will end up in every channel FIFO
+        unsigned int channelFree = channelFifoFree > fifoFill ? channelFifoFree - fifoFill : 0;
+
+        // let the slowest channel drain its FIFO
+        if (channelFree < channelFifoSize / 4)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
-    		m_samplesCount += m_chunksize / (2 * m_samplebytes);
+            scheduleFastTick(FILESOURCE_FAST_WAIT_MS);
+            return;
+        }
 
-            if ((m_currentTrackIndex + 1 < m_captures->size())
-             && (m_samplesCount > m_captures->at(m_currentTrackIndex+1).m_sampleStart))
-            {
-                m_currentTrackIndex++;
-                int sampleRate = m_captures->at(m_currentTrackIndex).m_sampleRate;
+        fifoFree = std::min(fifoFree, channelFree);
+    }
 
-                if (sampleRate != m_samplerate)
-                {
-                    m_samplerate = sampleRate;
-                    setSampleRate();
-                }
+    quint64 nbSamples = std::min(fifoFree, (unsigned int) FILESOURCE_FAST_CHUNK_SAMPLES);
 
-                MsgReportTrackChange *message = MsgReportTrackChange::create(m_currentTrackIndex);
-                m_fileInputMessageQueue->push(message);
-            }
+    if (m_samplesCount + nbSamples >= m_totalSamples)
+    {
+        readToSampleFifo((m_totalSamples - std::min(m_samplesCount, m_totalSamples)) * 2 * m_samplebytes);
+        reportEOF();
+        return;
+    }
+
+    if (readToSampleFifo(nbSamples * 2 * m_samplebytes) < (qint64) (nbSamples * 2 * m_samplebytes))
+    {
+        reportEOF();
+        return;
+    }
+
+    checkTrackChange();
+
+    if (generation == m_fastTickGeneration) { // else restarted by a sample rate change
+        scheduleFastTick(0);
+    }
+}
+
+void SigMFFileInputWorker::reportEOF()
+{
+    // ticks may run again before the EOF is handled. Report once per file
+    if (!m_eofReported)
+    {
+        m_eofReported = true;
+        MsgReportEOF *message = MsgReportEOF::create();
+        m_fileInputMessageQueue->push(message);
+    }
+}
+
+void SigMFFileInputWorker::setChannelAPIs(const QList<ChannelAPI*>& channelAPIs)
+{
+    QMutexLocker mutexLocker(&m_channelsMutex);
+    m_channelAPIs = channelAPIs;
+}
+
+bool SigMFFileInputWorker::getChannelFifosSpace(unsigned int& size, unsigned int& free, quint64& overflowCount)
+{
+    QMutexLocker mutexLocker(&m_channelsMutex); // channels are not removed while their FIFO is read
+    bool found = false;
+    overflowCount = 0;
+
+    for (ChannelAPI *channelAPI : m_channelAPIs)
+    {
+        ChannelAPI::InputFifoStats fifoStats; // own or shared baseband FIFO actually read by the channel
+
+        if (!channelAPI->getInputFifoStats(fifoStats)) {
+            continue;
         }
-	}
+
+        unsigned int channelFifoSize = fifoStats.m_size;
+        unsigned int channelFifoFill = fifoStats.m_fill;
+        overflowCount += fifoStats.m_overflowCount;
+        BasebandSampleSink *sink = dynamic_cast<BasebandSampleSink*>(channelAPI);
+        unsigned int queuedSamples, freeBlocks;
+        quint64 droppedBlocks;
+
+        if (sink && channelAPI->getDeviceAPI()->getChannelSinkFanOutQueue(sink, queuedSamples, freeBlocks, droppedBlocks))
+        {
+            // blocks waiting in the fan out queue end up in the channel FIFO. The next block is dropped if the queue is full
+            channelFifoFill = freeBlocks == 0 ? channelFifoSize : channelFifoFill + queuedSamples;
+            overflowCount += droppedBlocks;
+        }
+
+        unsigned int channelFifoFree = channelFifoSize > channelFifoFill ? channelFifoSize - channelFifoFill : 0;
+
+        if (!found || (channelFifoFree < free))
+        {
+            size = channelFifoSize;
+            free = channelFifoFree;
+        }
+
+        found = true;
+    }
+
+    return found;
+}
+
+qint64 SigMFFileInputWorker::readToSampleFifo(qint64 nbBytes)
+{
+    qint64 sampleBytes = 2 * m_samplebytes;
+    qint64 done = 0;
+    nbBytes = (nbBytes / sampleBytes) * sampleBytes;
+
+    while (done < nbBytes)
+    {
+        quint64 size = nbBytes - done;
+        const uchar *data = m_sampleFile->data(m_samplesCount * sampleBytes, size);
+        size = (size / sampleBytes) * sampleBytes;
+
+        if (!data || (size == 0)) { // end of file
+            break;
+        }
+
+        writeToSampleFifo(data, (qint32) size);
+        m_samplesCount += size / sampleBytes;
+        done += size;
+    }
+
+    readAhead(m_samplesCount * sampleBytes);
+    return done;
+}
+
+void SigMFFileInputWorker::readAhead(quint64 offset)
+{
+    // renew the hint when half of the previous read ahead range has been consumed
+    if (offset + FILESOURCE_READAHEAD_BYTES/2 > m_readAheadEnd)
+    {
+        m_sampleFile->willNeed(offset, FILESOURCE_READAHEAD_BYTES);
+        m_readAheadEnd = offset + FILESOURCE_READAHEAD_BYTES;
+    }
+}
+
+void SigMFFileInputWorker::checkTrackChange()
+{
+    if ((m_currentTrackIndex + 1 < m_captures->size())
+     && (m_samplesCount > m_captures->at(m_currentTrackIndex+1).m_sampleStart))
+    {
+        m_currentTrackIndex++;
+        int sampleRate = m_captures->at(m_currentTrackIndex).m_sampleRate;
+
+        if (sampleRate != m_samplerate)
+        {
+            m_samplerate = sampleRate;
+            setSampleRate();
+        }
+
+        MsgReportTrackChange *message = MsgReportTrackChange::create(m_currentTrackIndex);
+        m_fileInputMessageQueue->push(message);
+    }
 }
 
 void SigMFFileInputWorker::setConverter()
@@ -21,17 +21,22 @@
 #include <QObject>
 #include <QTimer>
 #include <QElapsedTimer>
-#include <iostream>
-#include <fstream>
+#include <QMutex>
+#include <QList>
 #include <cstdlib>
 
 #include "dsp/inthalfbandfilter.h"
 #include "util/message.h"
 
 #define FILESOURCE_THROTTLE_MS 50
+#define FILESOURCE_READAHEAD_BYTES (32*1024*1024)
+#define FILESOURCE_FAST_CHUNK_SAMPLES (1024*1024)
+#define FILESOURCE_FAST_WAIT_MS 2
 
 class SampleSinkFifo;
 class MessageQueue;
+class ChannelAPI;
+class MappedSampleFile;
 class SigMFFileCapture;
 class SigMFFileMetaInfo;
 class SigMFConverterInterface;
@@ -71,7 +76,7 @@ public:
         { }
     };
 
-	SigMFFileInputWorker(std::ifstream *samplesStream,
+	SigMFFileInputWorker(MappedSampleFile *sampleFile,
 	        SampleSinkFifo* sampleFifo,
 	        const QTimer& timer,
 	        MessageQueue *fileInputMessageQueue,
@@ -83,11 +88,13 @@ public:
     void setBuffers(std::size_t chunksize);
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
-    void setSamplesCount(uint64_t samplesCount) { m_samplesCount = samplesCount; }
+    void setSamplesCount(uint64_t samplesCount); //!< Seek to this sample. Only when not running
     void setTotalSamples(uint64_t totalSamples) { m_totalSamples = totalSamples; }
     void setMetaInformation(const SigMFFileMetaInfo *metaInfo, const QList<SigMFFileCapture> *captures);
     void setAccelerationFactor(int accelerationFactor);
     void setTrackIndex(int trackIndex);
+    void setAsFastAsPossible(bool asFastAsPossible) { m_asFastAsPossible = asFastAsPossible; } //!< Only when not running
+    void setChannelAPIs(const QList<ChannelAPI*>& channelAPIs); //!< Channels whose FIFOs also pace the fast mode
 
 private:
 	volatile bool m_running;
@@ -95,8 +102,14 @@ private:
     const SigMFFileMetaInfo *m_metaInfo;
     const QList<SigMFFileCapture> *m_captures;
     int m_currentTrackIndex;
-	std::ifstream* m_ifstream;
-	quint8  *m_fileBuf;
+	MappedSampleFile* m_sampleFile;
+	quint64 m_readAheadEnd;
+	bool m_asFastAsPossible;
+	unsigned int m_fastTickGeneration;
+	bool m_eofReported;             //!< EOF already reported for the current file
+	QList<ChannelAPI*> m_channelAPIs;
+	QMutex m_channelsMutex;
+	quint64 m_channelOverflowCount; //!< overflows of the channel FIFOs at last check
 	quint8  *m_convertBuf;
 	std::size_t m_bufsize;
     qint64 m_chunksize;
@@ -120,7 +133,14 @@ private:
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
 	void setSampleRate();
     void setConverter();
+	qint64 readToSampleFifo(qint64 nbBytes);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
+	void readAhead(quint64 offset);
+	void checkTrackChange();
+	void scheduleFastTick(int delayMs);
+	void fastTick(unsigned int generation);
+	void reportEOF();
+	bool getChannelFifosSpace(unsigned int& size, unsigned int& free, quint64& overflowCount);
 	void writeToSampleFifoBAK(const quint8* buf, qint32 nbBytes);
 
 private slots:
@@ -20,6 +20,7 @@
 #include "util/uid.h"
 #include "channelapi.h"
 #include "maincore.h"
+#include "dsp/samplesinkfifo.h"
 
 ChannelAPI::ChannelAPI(const QString& uri, StreamType streamType) :
     m_guiMessageQueue(nullptr),
@@ -44,3 +45,20 @@ void ChannelAPI::handleInputMessages()
 		}
 	}
 }
+
+bool ChannelAPI::getInputFifoStats(InputFifoStats& stats)
+{
+    SampleSinkFifo *fifo = getInputSampleFifo();
+
+    if (!fifo || (fifo->size() == 0)) {
+        return false;
+    }
+
+    stats.m_size = fifo->size();
+    stats.m_fill = fifo->fill();
+    stats.m_overflowCount = fifo->getOverflowCount();
+    stats.m_droppedSamples = fifo->getOverflowSamples();
+    stats.m_readPosition = fifo->getReadPosition();
+
+    return true;
+}
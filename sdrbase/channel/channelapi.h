@@ -31,6 +31,7 @@
 #include "util/messagequeue.h"
 
 class DeviceAPI;
+class SampleSinkFifo;
 
 namespace SWGSDRangel
 {
@@ -151,6 +152,32 @@ public:
     virtual int getNbSourceStreams() const = 0;
     virtual qint64 getStreamCenterFrequency(int streamIndex, bool sinkElseSource) const = 0;
 
+    /** Input sample FIFO of the running Rx channel baseband for statistics. Null if the channel has none or is stopped */
+    virtual SampleSinkFifo *getInputSampleFifo() { return nullptr; }
+
+    struct InputFifoStats
+    {
+        unsigned int m_size;     //!< FIFO size in samples
+        unsigned int m_fill;     //!< samples waiting to be read
+        quint64 m_overflowCount; //!< number of times the channel fell behind
+        quint64 m_droppedSamples; //!< samples the channel did not get
+        quint64 m_readPosition;  //!< input sample index reached by the channel including the samples it did not get
+        bool m_subband;          //!< input is a device polyphase channelizer sub-band instead of the baseband
+
+        InputFifoStats() :
+            m_size(0),
+            m_fill(0),
+            m_overflowCount(0),
+            m_droppedSamples(0),
+            m_readPosition(0),
+            m_subband(false)
+        {}
+    };
+
+    /** Statistics of the FIFO the running Rx channel actually reads its input from. Defaults to the input sample FIFO.
+     *  Returns false if the channel has none or is stopped */
+    virtual bool getInputFifoStats(InputFifoStats& stats);
+
     void handlePipeMessageQueue(MessageQueue* messageQueue)
     {
         Message* message;
@@ -0,0 +1,354 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+
+#include "remotetcpcodec.h"
+
+namespace {
+
+// Bits are packed LSB first. Fields are at most 40 bits wide.
+class BitWriter
+{
+public:
+    BitWriter(QByteArray& out) : m_out(out), m_acc(0), m_nbBits(0) {}
+
+    void put(quint64 value, int nbBits)
+    {
+        m_acc |= value << m_nbBits;
+        m_nbBits += nbBits;
+
+        while (m_nbBits >= 8)
+        {
+            m_out.append((char) (m_acc & 0xff));
+            m_acc >>= 8;
+            m_nbBits -= 8;
+        }
+    }
+
+    void flush()
+    {
+        if (m_nbBits > 0)
+        {
+            m_out.append((char) (m_acc & 0xff));
+            m_acc = 0;
+            m_nbBits = 0;
+        }
+    }
+
+private:
+    QByteArray& m_out;
+    quint64 m_acc;
+    int m_nbBits;
+};
+
+class BitReader
+{
+public:
+    BitReader(const quint8 *data, int size) : m_data(data), m_size(size), m_index(0), m_acc(0), m_nbBits(0), m_overrun(false) {}
+
+    quint64 get(int nbBits)
+    {
+        while (m_nbBits < nbBits)
+        {
+            if (m_index < m_size) {
+                m_acc |= ((quint64) m_data[m_index++]) << m_nbBits;
+            } else {
+                m_overrun = true;
+            }
+
+            m_nbBits += 8;
+        }
+
+        quint64 value = m_acc & ((1ULL << nbBits) - 1);
+        m_acc >>= nbBits;
+        m_nbBits -= nbBits;
+        return value;
+    }
+
+    void align()
+    {
+        m_acc = 0;
+        m_nbBits = 0;
+    }
+
+    bool overrun() const { return m_overrun; }
+
+private:
+    const quint8 *m_data;
+    int m_size;
+    int m_index;
+    quint64 m_acc;
+    int m_nbBits;
+    bool m_overrun;
+};
+
+inline int bitWidth(quint64 value)
+{
+    int width = 0;
+
+    while (value != 0)
+    {
+        value >>= 1;
+        width++;
+    }
+
+    return width;
+}
+
+inline quint64 zigzag(qint64 value) {
+    return ((quint64) value << 1) ^ (quint64) (value >> 63);
+}
+
+inline qint64 unzigzag(quint64 value) {
+    return (qint64) (value >> 1) ^ -((qint64) (value & 1));
+}
+
+// Residual of the fixed polynomial predictor of given order. The first samples use a lower order.
+inline qint64 residual(const qint32 *x, int n, int order)
+{
+    switch (std::min(order, n))
+    {
+    case 0:
+        return x[2*n];
+    case 1:
+        return (qint64) x[2*n] - x[2*(n-1)];
+    default:
+        return (qint64) x[2*n] - 2*(qint64) x[2*(n-1)] + x[2*(n-2)];
+    }
+}
+
+} // namespace
+
+const char *RemoteTCPCodec::getName(Compression compression)
+{
+    switch (compression)
+    {
+    case Lossless:
+        return "Lossless";
+    case BFP8:
+        return "BFP8";
+    case BFP12:
+        return "BFP12";
+    default:
+        return "None";
+    }
+}
+
+void RemoteTCPCodec::encode(Compression compression, int sampleBits, const qint32 *iq, int nbSamples, QByteArray& out)
+{
+    int headerIndex = out.size();
+    out.append(m_headerSize, (char) 0);
+
+    if (compression == Lossless) {
+        encodeLossless(iq, nbSamples, out);
+    } else {
+        encodeBFP(iq, nbSamples, compression == BFP8 ? 8 : 12, out);
+    }
+
+    quint32 payloadSize = out.size() - headerIndex - m_headerSize;
+    char *header = out.data() + headerIndex;
+    header[0] = (payloadSize >> 24) & 0xff;
+    header[1] = (payloadSize >> 16) & 0xff;
+    header[2] = (payloadSize >> 8) & 0xff;
+    header[3] = payloadSize & 0xff;
+    header[4] = (char) compression;
+    header[5] = (char) sampleBits;
+    header[6] = (nbSamples >> 8) & 0xff;
+    header[7] = nbSamples & 0xff;
+}
+
+int RemoteTCPCodec::decode(const char *data, int size, std::vector<qint32>& iq)
+{
+    if (size < m_headerSize) {
+        return 0;
+    }
+
+    const quint8 *header = (const quint8 *) data;
+    quint32 payloadSize = ((quint32) header[0] << 24) | ((quint32) header[1] << 16) | ((quint32) header[2] << 8) | header[3];
+    int compression = header[4];
+    int nbSamples = (header[6] << 8) | header[7];
+
+    if ((compression == None) || !isValid(compression) || (nbSamples > m_blockSamples) || (payloadSize > (quint32) (INT32_MAX - m_headerSize))) {
+        return -1;
+    }
+
+    if (size < m_headerSize + (int) payloadSize) {
+        return 0;
+    }
+
+    bool ok;
+
+    if (compression == Lossless) {
+        ok = decodeLossless(header + m_headerSize, payloadSize, nbSamples, iq);
+    } else {
+        ok = decodeBFP(header + m_headerSize, payloadSize, nbSamples, compression == BFP8 ? 8 : 12, iq);
+    }
+
+    return ok ? m_headerSize + payloadSize : -1;
+}
+
+void RemoteTCPCodec::encodeLossless(const qint32 *iq, int nbSamples, QByteArray& out)
+{
+    BitWriter writer(out);
+
+    for (int c = 0; c < 2; c++) // I then Q
+    {
+        const qint32 *x = iq + c;
+        quint64 costs[3] = {0, 0, 0};
+
+        for (int n = 0; n < nbSamples; n++)
+        {
+            for (int order = 0; order < 3; order++)
+            {
+                qint64 r = residual(x, n, order);
+                costs[order] += r < 0 ? -r : r;
+            }
+        }
+
+        int order = std::min_element(costs, costs + 3) - costs;
+        writer.put(order, 2);
+
+        for (int g = 0; g < nbSamples; g += m_losslessGroupSize)
+        {
+            int end = std::min(g + m_losslessGroupSize, nbSamples);
+            quint64 maxValue = 0;
+
+            for (int n = g; n < end; n++) {
+                maxValue |= zigzag(residual(x, n, order));
+            }
+
+            int width = bitWidth(maxValue);
+            writer.put(width, 6);
+
+            if (width != 0)
+            {
+                for (int n = g; n < end; n++) {
+                    writer.put(zigzag(residual(x, n, order)), width);
+                }
+            }
+        }
+
+        writer.flush();
+    }
+}
+
+bool RemoteTCPCodec::decodeLossless(const quint8 *data, int size, int nbSamples, std::vector<qint32>& iq)
+{
+    int start = iq.size();
+    iq.resize(start + 2*nbSamples);
+    BitReader reader(data, size);
+
+    for (int c = 0; c < 2; c++)
+    {
+        qint32 *x = iq.data() + start + c;
+        int order = reader.get(2);
+
+        for (int g = 0; g < nbSamples; g += m_losslessGroupSize)
+        {
+            int end = std::min(g + m_losslessGroupSize, nbSamples);
+            int width = reader.get(6);
+
+            if (width > m_maxLosslessWidth) {
+                return false;
+            }
+
+            for (int n = g; n < end; n++)
+            {
+                qint64 r = width == 0 ? 0 : unzigzag(reader.get(width));
+
+                switch (std::min(order, n))
+                {
+                case 0:
+                    x[2*n] = r;
+                    break;
+                case 1:
+                    x[2*n] = r + x[2*(n-1)];
+                    break;
+                default:
+                    x[2*n] = r + 2*(qint64) x[2*(n-1)] - x[2*(n-2)];
+                    break;
+                }
+            }
+        }
+
+        reader.align();
+    }
+
+    return !reader.overrun();
+}
+
+void RemoteTCPCodec::encodeBFP(const qint32 *iq, int nbSamples, int mantissaBits, QByteArray& out)
+{
+    BitWriter writer(out);
+    const qint32 maxMantissa = (1 << (mantissaBits - 1)) - 1;
+    const qint32 minMantissa = -(1 << (mantissaBits - 1));
+    const quint64 mask = (1ULL << mantissaBits) - 1;
+
+    for (int g = 0; g < nbSamples; g += m_bfpGroupSize)
+    {
+        int end = 2*std::min(g + m_bfpGroupSize, nbSamples);
+        quint64 maxAbs = 0;
+
+        for (int k = 2*g; k < end; k++) {
+            maxAbs = std::max(maxAbs, (quint64) (iq[k] < 0 ? -(qint64) iq[k] : iq[k]));
+        }
+
+        // sign bit plus magnitude bits must fit the mantissa
+        int exponent = std::max(0, bitWidth(maxAbs) + 1 - mantissaBits);
+        writer.put(exponent, 5);
+
+        for (int k = 2*g; k < end; k++)
+        {
+            qint64 m = exponent == 0 ? iq[k] : ((qint64) iq[k] + (1LL << (exponent - 1))) >> exponent;
+            m = std::max((qint64) minMantissa, std::min((qint64) maxMantissa, m));
+            writer.put((quint64) m & mask, mantissaBits);
+        }
+    }
+
+    writer.flush();
+}
+
+bool RemoteTCPCodec::decodeBFP(const quint8 *data, int size, int nbSamples, int mantissaBits, std::vector<qint32>& iq)
+{
+    int start = iq.size();
+    iq.resize(start + 2*nbSamples);
+    qint32 *x = iq.data() + start;
+    BitReader reader(data, size);
+    const int shift = 64 - mantissaBits;
+
+    for (int g = 0; g < nbSamples; g += m_bfpGroupSize)
+    {
+        int end = 2*std::min(g + m_bfpGroupSize, nbSamples);
+        int exponent = reader.get(5);
+
+        // the encoder never shifts a 32 bit sample by more than needed to fit the mantissa
+        if (exponent > 33 - mantissaBits) {
+            return false;
+        }
+
+        for (int k = 2*g; k < end; k++)
+        {
+            qint64 m = ((qint64) (reader.get(mantissaBits) << shift)) >> shift; // sign extension
+            // rounding in the encoder may carry one step beyond the sample range
+            x[k] = (qint32) std::max((qint64) INT32_MIN, std::min((qint64) INT32_MAX, m * ((qint64) 1 << exponent)));
+        }
+    }
+
+    return !reader.overrun();
+}
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// I/Q block compression for the Remote TCP SDRA protocol.                       //
+//                                                                               //
+// Lossless: fixed polynomial predictor (order 0 to 2 chosen per block and       //
+// channel as in FLAC) followed by zigzag coding of the residuals bit packed in  //
+// groups of 32 with a per group width.                                          //
+// Lossy: block floating point. Groups of 16 I/Q pairs share a 5 bit exponent    //
+// and each component is a 8 or 12 bits mantissa.                                //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHANNEL_REMOTETCPCODEC_H_
+#define CHANNEL_REMOTETCPCODEC_H_
+
+#include <vector>
+#include <QtGlobal>
+#include <QByteArray>
+
+#include "export.h"
+
+class SDRBASE_API RemoteTCPCodec
+{
+public:
+    enum Compression {
+        None = 0,       //!< Raw samples as in rtl_tcp
+        Lossless = 1,   //!< Predictor and bit packed residuals
+        BFP8 = 2,       //!< Block floating point with 8 bits mantissas
+        BFP12 = 3       //!< Block floating point with 12 bits mantissas
+    };
+
+    // Each block is preceded by a header:
+    // 0-3: payload size in bytes (big endian) 4: compression 5: sample bits 6-7: number of I/Q pairs (big endian)
+    static const int m_headerSize = 8;
+    static const int m_blockSamples = 4096; //!< Maximum number of I/Q pairs in a block
+
+    /** Compress nbSamples I/Q pairs of interleaved signed values with sampleBits significant bits
+     *  and append the block with its header to out. nbSamples must not exceed m_blockSamples.
+     */
+    static void encode(Compression compression, int sampleBits, const qint32 *iq, int nbSamples, QByteArray& out);
+
+    /** Decode the block at the start of data if it is complete. Interleaved I/Q values are
+     *  appended to iq. Returns the number of bytes used, 0 if the block is not complete
+     *  or -1 if the header is invalid.
+     */
+    static int decode(const char *data, int size, std::vector<qint32>& iq);
+
+    static bool isValid(int compression) { return (compression >= None) && (compression <= BFP12); }
+    static const char *getName(Compression compression);
+
+private:
+    static const int m_losslessGroupSize = 32;
+    static const int m_bfpGroupSize = 16;
+    static const int m_maxLosslessWidth = 40; //!< Zigzag coded second order residuals of 32 bit samples fit in 35 bits
+
+    static void encodeLossless(const qint32 *iq, int nbSamples, QByteArray& out);
+    static void encodeBFP(const qint32 *iq, int nbSamples, int mantissaBits, QByteArray& out);
+    static bool decodeLossless(const quint8 *data, int size, int nbSamples, std::vector<qint32>& iq);
+    static bool decodeBFP(const quint8 *data, int size, int nbSamples, int mantissaBits, std::vector<qint32>& iq);
+};
+
+#endif // CHANNEL_REMOTETCPCODEC_H_
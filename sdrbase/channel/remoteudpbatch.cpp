@@ -0,0 +1,396 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#endif
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "remoteudpbatch.h"
+
+#if defined(__linux__)
+// Not defined by older C libraries headers
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif
+
+RemoteUDPBatchSender::RemoteUDPBatchSender(int datagramSize) :
+    m_datagramSize(datagramSize),
+    m_fd(-1),
+    m_gso(false)
+{}
+
+RemoteUDPBatchSender::~RemoteUDPBatchSender()
+{
+    close();
+}
+
+RemoteUDPBatchReceiver::RemoteUDPBatchReceiver(int datagramSize) :
+    m_datagramSize(datagramSize),
+    m_fd(-1),
+    m_gro(false),
+    m_messageSize(datagramSize),
+    m_messageCount(0)
+{}
+
+RemoteUDPBatchReceiver::~RemoteUDPBatchReceiver()
+{
+    close();
+}
+
+#if defined(__linux__)
+
+bool RemoteUDPBatchSender::isSupported()
+{
+    return true;
+}
+
+bool RemoteUDPBatchSender::open()
+{
+    if (m_fd >= 0) {
+        return true;
+    }
+
+    m_fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (m_fd < 0)
+    {
+        qWarning("RemoteUDPBatchSender::open: cannot create socket: %s", strerror(errno));
+        return false;
+    }
+
+    int segmentSize = m_datagramSize;
+    m_gso = ::setsockopt(m_fd, SOL_UDP, UDP_SEGMENT, &segmentSize, sizeof(segmentSize)) == 0;
+    qDebug("RemoteUDPBatchSender::open: GSO: %s", m_gso ? "on" : "off");
+    return true;
+}
+
+void RemoteUDPBatchSender::close()
+{
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    m_gso = false;
+}
+
+void RemoteUDPBatchSender::disableGSO()
+{
+    int segmentSize = 0;
+    ::setsockopt(m_fd, SOL_UDP, UDP_SEGMENT, &segmentSize, sizeof(segmentSize));
+    m_gso = false;
+    qDebug("RemoteUDPBatchSender::disableGSO: not supported by the output device");
+}
+
+int RemoteUDPBatchSender::send(const char *data, int nbDatagrams, const QHostAddress& address, quint16 port)
+{
+    if ((m_fd < 0) || (address.protocol() != QAbstractSocket::IPv4Protocol)) {
+        return -1;
+    }
+
+    struct sockaddr_in dest;
+    memset(&dest, 0, sizeof(dest));
+    dest.sin_family = AF_INET;
+    dest.sin_port = htons(port);
+    dest.sin_addr.s_addr = htonl(address.toIPv4Address());
+
+    struct mmsghdr msgs[m_maxMessages];
+    struct iovec iovs[m_maxMessages];
+    int sent = 0;
+
+    while (sent < nbDatagrams)
+    {
+        // with GSO each message is segmented into several datagrams by the kernel or the NIC
+        int perMessage = m_gso ? m_maxSegments : 1;
+        int nbMessages = 0;
+        int index = sent;
+
+        while ((index < nbDatagrams) && (nbMessages < m_maxMessages))
+        {
+            int count = std::min(perMessage, nbDatagrams - index);
+            iovs[nbMessages].iov_base = (void *) (data + (size_t) index * m_datagramSize);
+            iovs[nbMessages].iov_len = (size_t) count * m_datagramSize;
+            memset(&msgs[nbMessages], 0, sizeof(struct mmsghdr));
+            msgs[nbMessages].msg_hdr.msg_name = &dest;
+            msgs[nbMessages].msg_hdr.msg_namelen = sizeof(dest);
+            msgs[nbMessages].msg_hdr.msg_iov = &iovs[nbMessages];
+            msgs[nbMessages].msg_hdr.msg_iovlen = 1;
+            index += count;
+            nbMessages++;
+        }
+
+        int nbSent = ::sendmmsg(m_fd, msgs, nbMessages, 0);
+
+        if (nbSent < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if ((errno == EIO) && m_gso) // device cannot checksum offload segments
+            {
+                disableGSO();
+                continue;
+            }
+
+            qWarning("RemoteUDPBatchSender::send: %s", strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < nbSent; i++) {
+            sent += iovs[i].iov_len / m_datagramSize;
+        }
+    }
+
+    return sent == 0 ? -1 : sent;
+}
+
+bool RemoteUDPBatchReceiver::isSupported()
+{
+    return true;
+}
+
+bool RemoteUDPBatchReceiver::open(const QHostAddress& address, quint16 port, int receiveBufferSize)
+{
+    close();
+
+    if (address.protocol() != QAbstractSocket::IPv4Protocol) {
+        return false;
+    }
+
+    m_fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (m_fd < 0)
+    {
+        qWarning("RemoteUDPBatchReceiver::open: cannot create socket: %s", strerror(errno));
+        return false;
+    }
+
+    int one = 1;
+    ::setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(address.toIPv4Address());
+
+    if (::bind(m_fd, (struct sockaddr *) &local, sizeof(local)) < 0)
+    {
+        qWarning("RemoteUDPBatchReceiver::open: cannot bind to %s:%d: %s", qPrintable(address.toString()), port, strerror(errno));
+        close();
+        return false;
+    }
+
+    setReceiveBufferSize(receiveBufferSize);
+    m_gro = ::setsockopt(m_fd, SOL_UDP, UDP_GRO, &one, sizeof(one)) == 0;
+
+    // with GRO the kernel coalesces consecutive datagrams of a flow into one large message
+    m_messageSize = m_gro ? m_groMessageSize : m_datagramSize;
+    m_messageCount = m_gro ? m_groNbMessages : m_nbMessages;
+    m_buffer.resize((size_t) m_messageSize * m_messageCount);
+    m_datagrams.reserve(m_buffer.size() / m_datagramSize);
+    qDebug("RemoteUDPBatchReceiver::open: bound to %s:%d GRO: %s", qPrintable(address.toString()), port, m_gro ? "on" : "off");
+    return true;
+}
+
+bool RemoteUDPBatchReceiver::joinMulticastGroup(const QHostAddress& groupAddress)
+{
+    if ((m_fd < 0) || (groupAddress.protocol() != QAbstractSocket::IPv4Protocol)) {
+        return false;
+    }
+
+    struct ip_mreq mreq;
+    mreq.imr_multiaddr.s_addr = htonl(groupAddress.toIPv4Address());
+    mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+    return ::setsockopt(m_fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) == 0;
+}
+
+void RemoteUDPBatchReceiver::setReceiveBufferSize(int size)
+{
+    if (m_fd >= 0) {
+        ::setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+}
+
+void RemoteUDPBatchReceiver::close()
+{
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    m_gro = false;
+    m_datagrams.clear();
+}
+
+int RemoteUDPBatchReceiver::receive(int timeoutMs)
+{
+    m_datagrams.clear();
+
+    if (m_fd < 0) {
+        return -1;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = m_fd;
+    pfd.events = POLLIN;
+    int ready = ::poll(&pfd, 1, timeoutMs);
+
+    if (ready <= 0) {
+        return ((ready < 0) && (errno != EINTR)) ? -1 : 0;
+    }
+
+    struct mmsghdr msgs[m_nbMessages];
+    struct iovec iovs[m_nbMessages];
+    struct sockaddr_in senders[m_nbMessages];
+    char control[m_nbMessages][CMSG_SPACE(sizeof(int))];
+
+    for (int i = 0; i < m_messageCount; i++)
+    {
+        iovs[i].iov_base = m_buffer.data() + (size_t) i * m_messageSize;
+        iovs[i].iov_len = m_messageSize;
+        memset(&msgs[i], 0, sizeof(struct mmsghdr));
+        msgs[i].msg_hdr.msg_name = &senders[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = m_gro ? control[i] : nullptr;
+        msgs[i].msg_hdr.msg_controllen = m_gro ? sizeof(control[i]) : 0;
+    }
+
+    int nbMessages = ::recvmmsg(m_fd, msgs, m_messageCount, MSG_DONTWAIT, nullptr);
+
+    if (nbMessages < 0) {
+        return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) ? 0 : -1;
+    }
+
+    for (int i = 0; i < nbMessages; i++)
+    {
+        if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+            continue;
+        }
+
+        int length = msgs[i].msg_len;
+        int segmentSize = length;
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cmsg; cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg))
+        {
+            if ((cmsg->cmsg_level == SOL_UDP) && (cmsg->cmsg_type == UDP_GRO)) {
+                memcpy(&segmentSize, CMSG_DATA(cmsg), sizeof(int));
+            }
+        }
+
+        const char *message = (const char *) iovs[i].iov_base;
+
+        // only the last segment of a coalesced message may be shorter
+        for (int offset = 0; offset < length; offset += segmentSize)
+        {
+            if (std::min(segmentSize, length - offset) == m_datagramSize) {
+                m_datagrams.push_back(message + offset);
+            }
+        }
+
+        m_senderAddress.setAddress(ntohl(senders[i].sin_addr.s_addr));
+    }
+
+    return m_datagrams.size();
+}
+
+#else // other platforms use QUdpSocket
+
+bool RemoteUDPBatchSender::isSupported()
+{
+    return false;
+}
+
+bool RemoteUDPBatchSender::open()
+{
+    return false;
+}
+
+void RemoteUDPBatchSender::close()
+{}
+
+void RemoteUDPBatchSender::disableGSO()
+{}
+
+int RemoteUDPBatchSender::send(const char *data, int nbDatagrams, const QHostAddress& address, quint16 port)
+{
+    (void) data;
+    (void) nbDatagrams;
+    (void) address;
+    (void) port;
+    return -1;
+}
+
+bool RemoteUDPBatchReceiver::isSupported()
+{
+    return false;
+}
+
+bool RemoteUDPBatchReceiver::open(const QHostAddress& address, quint16 port, int receiveBufferSize)
+{
+    (void) address;
+    (void) port;
+    (void) receiveBufferSize;
+    return false;
+}
+
+bool RemoteUDPBatchReceiver::joinMulticastGroup(const QHostAddress& groupAddress)
+{
+    (void) groupAddress;
+    return false;
+}
+
+void RemoteUDPBatchReceiver::setReceiveBufferSize(int size)
+{
+    (void) size;
+}
+
+void RemoteUDPBatchReceiver::close()
+{}
+
+int RemoteUDPBatchReceiver::receive(int timeoutMs)
+{
+    (void) timeoutMs;
+    return -1;
+}
+
+#endif
@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Batched UDP I/O of fixed size datagrams for the Remote sink/input pair.       //
+// On Linux many datagrams are moved per system call with sendmmsg/recvmmsg      //
+// and UDP segmentation offload (GSO/GRO) is used when the kernel supports it.   //
+// Elsewhere open() fails and callers keep using QUdpSocket.                     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHANNEL_REMOTEUDPBATCH_H_
+#define CHANNEL_REMOTEUDPBATCH_H_
+
+#include <vector>
+
+#include <QHostAddress>
+
+#include "export.h"
+
+class SDRBASE_API RemoteUDPBatchSender
+{
+public:
+    RemoteUDPBatchSender(int datagramSize);
+    ~RemoteUDPBatchSender();
+
+    static bool isSupported();
+    bool open();
+    void close();
+    bool isOpen() const { return m_fd >= 0; }
+    bool getGSO() const { return m_gso; }
+
+    /** Send nbDatagrams datagrams laid out contiguously in data to an IPv4 address.
+     *  Returns the number of datagrams sent or -1 if nothing could be sent.
+     */
+    int send(const char *data, int nbDatagrams, const QHostAddress& address, quint16 port);
+
+private:
+    static const int m_maxSegments = 64; //!< Datagrams per GSO send (kernel UDP_MAX_SEGMENTS)
+    static const int m_maxMessages = 256;
+    int m_datagramSize;
+    int m_fd;
+    bool m_gso;
+
+    void disableGSO();
+};
+
+class SDRBASE_API RemoteUDPBatchReceiver
+{
+public:
+    RemoteUDPBatchReceiver(int datagramSize);
+    ~RemoteUDPBatchReceiver();
+
+    static bool isSupported();
+    bool open(const QHostAddress& address, quint16 port, int receiveBufferSize);
+    bool joinMulticastGroup(const QHostAddress& groupAddress);
+    void setReceiveBufferSize(int size);
+    void close();
+    bool isOpen() const { return m_fd >= 0; }
+    bool getGRO() const { return m_gro; }
+
+    /** Wait at most timeoutMs for datagrams then read as many as are queued up to the batch capacity.
+     *  Returns the number of datagrams of the expected size, 0 on timeout or -1 on error.
+     */
+    int receive(int timeoutMs);
+    const char *getDatagram(int index) const { return m_datagrams[index]; }
+    const QHostAddress& getSenderAddress() const { return m_senderAddress; }
+
+private:
+    static const int m_groMessageSize = 65536;
+    static const int m_groNbMessages = 16;
+    static const int m_nbMessages = 256;
+    int m_datagramSize;
+    int m_fd;
+    bool m_gro;
+    int m_messageSize;
+    int m_messageCount;
+    std::vector<char> m_buffer;
+    std::vector<const char*> m_datagrams;
+    QHostAddress m_senderAddress;
+};
+
+#endif // CHANNEL_REMOTEUDPBATCH_H_
@@ -48,6 +48,9 @@ DeviceAPI::DeviceAPI(
     m_buddySharedPtr(nullptr),
     m_isBuddyLeader(false),
     m_deviceSourceEngine(deviceSourceEngine),
+    m_polyphaseSubbands(0),
+    m_channelSinkFanOut(false),
+    m_sharedBasebandFifo(false),
     m_deviceSinkEngine(deviceSinkEngine),
     m_deviceMIMOEngine(deviceMIMOEngine)
 {
@@ -91,6 +94,79 @@ void DeviceAPI::removeChannelSink(BasebandSampleSink* sink, int streamIndex)
     }
 }
 
+void DeviceAPI::setChannelSinkSubband(BasebandSampleSink* sink, int subbandIndex)
+{
+    if (m_deviceSourceEngine) {
+        m_deviceSourceEngine->setSinkSubband(sink, subbandIndex);
+    }
+}
+
+void DeviceAPI::configurePolyphaseChannelizer(unsigned int nbSubbands)
+{
+    if ((nbSubbands != 0) && ((nbSubbands < 4) || ((nbSubbands & (nbSubbands - 1)) != 0)))
+    {
+        qWarning("DeviceAPI::configurePolyphaseChannelizer: number of sub-bands must be 0 or a power of two >= 4: %u", nbSubbands);
+        return;
+    }
+
+    m_polyphaseSubbands = nbSubbands;
+
+    if (m_deviceSourceEngine) {
+        m_deviceSourceEngine->configurePolyphaseChannelizer(nbSubbands);
+    }
+}
+
+unsigned int DeviceAPI::getPolyphaseSubbands() const
+{
+    return m_polyphaseSubbands;
+}
+
+void DeviceAPI::setChannelSinkSharedFifo(BasebandSampleSink* sink, bool sharedFifo)
+{
+    if (m_deviceSourceEngine) {
+        m_deviceSourceEngine->setSinkSharedFifo(sink, sharedFifo);
+    }
+}
+
+void DeviceAPI::setSharedBasebandFifo(bool sharedFifo)
+{
+    if (sharedFifo == m_sharedBasebandFifo) {
+        return;
+    }
+
+    m_sharedBasebandFifo = sharedFifo;
+    emit sharedBasebandFifoChanged();
+}
+
+bool DeviceAPI::getChannelSinkFanOutQueue(BasebandSampleSink* sink, unsigned int& queuedSamples, unsigned int& freeBlocks, quint64& droppedBlocks)
+{
+    BasebandSampleSinkFanOut::SinkStats stats;
+
+    if (!m_deviceSourceEngine || !m_deviceSourceEngine->getFanOutStats(sink, stats)) {
+        return false;
+    }
+
+    queuedSamples = stats.m_queuedSamples;
+    freeBlocks = stats.m_queueSize > stats.m_queueDepth ? stats.m_queueSize - stats.m_queueDepth : 0;
+    droppedBlocks = stats.m_droppedBlocks;
+
+    return true;
+}
+
+SampleSinkMultiReaderFifo *DeviceAPI::getBasebandFifo()
+{
+    return (m_deviceSourceEngine && m_sharedBasebandFifo) ? m_deviceSourceEngine->getBasebandFifo() : nullptr;
+}
+
+void DeviceAPI::setChannelSinkFanOut(bool fanOut)
+{
+    m_channelSinkFanOut = fanOut;
+
+    if (m_deviceSourceEngine) {
+        m_deviceSourceEngine->setFanOut(fanOut);
+    }
+}
+
 void DeviceAPI::addChannelSource(BasebandSampleSource* source, int streamIndex)
 {
     if (m_deviceSinkEngine) {
@@ -127,12 +203,15 @@ void DeviceAPI::addChannelSinkAPI(ChannelAPI* channelAPI)
 {
     m_channelSinkAPIs.append(channelAPI);
     renumerateChannels();
+    emit sinkChannelsChanged();
 }
 
 void DeviceAPI::removeChannelSinkAPI(ChannelAPI* channelAPI)
 {
-    if (m_channelSinkAPIs.removeOne(channelAPI)) {
+    if (m_channelSinkAPIs.removeOne(channelAPI))
+    {
         renumerateChannels();
+        emit sinkChannelsChanged();
     }
 
     channelAPI->setIndexInDeviceSet(-1);
@@ -231,13 +310,21 @@ bool DeviceAPI::initDeviceEngine(int subsystemIndex)
 
 bool DeviceAPI::startDeviceEngine(int subsystemIndex)
 {
-    if (m_deviceSourceEngine) {
+    if (m_deviceSourceEngine)
+    {
+        m_deviceSourceEngine->configurePolyphaseChannelizer(m_polyphaseSubbands);
         return m_deviceSourceEngine->startAcquisition();
-    } else if (m_deviceSinkEngine) {
+    }
+    else if (m_deviceSinkEngine)
+    {
         return m_deviceSinkEngine->startGeneration();
-    } else if (m_deviceMIMOEngine) {
+    }
+    else if (m_deviceMIMOEngine)
+    {
         return m_deviceMIMOEngine->startProcess(subsystemIndex);
-    } else {
+    }
+    else
+    {
         return false;
     }
 }
@@ -506,6 +593,10 @@ void DeviceAPI::loadSamplingDeviceSettings(const Preset* preset)
         {
             qDebug("DeviceAPI::loadSamplingDeviceSettings: no source");
         }
+
+        configurePolyphaseChannelizer(preset->getPolyphaseSubbands());
+        setChannelSinkFanOut(preset->getChannelSinkFanOut());
+        setSharedBasebandFifo(preset->getSharedBasebandFifo());
     }
     else if (m_deviceSinkEngine && preset->isSinkPreset())
     {
@@ -588,6 +679,10 @@ void DeviceAPI::saveSamplingDeviceSettings(Preset* preset)
         {
             qDebug("DeviceAPI::saveSamplingDeviceSettings: no source");
         }
+
+        preset->setPolyphaseSubbands(m_polyphaseSubbands);
+        preset->setChannelSinkFanOut(m_channelSinkFanOut);
+        preset->setSharedBasebandFifo(m_sharedBasebandFifo);
     }
     else if (m_deviceSinkEngine && preset->isSinkPreset())
     {
@@ -25,6 +25,7 @@
 #include "export.h"
 
 class BasebandSampleSink;
+class SampleSinkMultiReaderFifo;
 class BasebandSampleSource;
 class MIMOChannel;
 class ChannelAPI;
@@ -69,6 +70,16 @@ public:
 
     void addChannelSink(BasebandSampleSink* sink, int streamIndex = 0);                //!< Add a channel sink (Rx)
     void removeChannelSink(BasebandSampleSink* sink, int streamIndex = 0);             //!< Remove a channel sink (Rx)
+    void setChannelSinkSubband(BasebandSampleSink* sink, int subbandIndex);            //!< Feed a channel sink (Rx) from a polyphase channelizer sub-band (-1 for baseband)
+    void configurePolyphaseChannelizer(unsigned int nbSubbands);                       //!< Set number of device polyphase channelizer sub-bands (Rx, 0 to disable). Kept with the device set and applied on start
+    unsigned int getPolyphaseSubbands() const;                                         //!< Number of device polyphase channelizer sub-bands (Rx, 0 if disabled)
+    void setChannelSinkFanOut(bool fanOut);                                            //!< Feed each channel sink (Rx) on its own thread. Kept with the device set
+    bool getChannelSinkFanOut() const { return m_channelSinkFanOut; }                  //!< Channel sinks (Rx) fed on their own thread
+    bool getChannelSinkFanOutQueue(BasebandSampleSink* sink, unsigned int& queuedSamples, unsigned int& freeBlocks, quint64& droppedBlocks); //!< Fan out queue of a channel sink (Rx). False if the sink is not fed on its own thread
+    void setChannelSinkSharedFifo(BasebandSampleSink* sink, bool sharedFifo);          //!< Channel sink (Rx) reads the baseband from the shared FIFO instead of being fed
+    void setSharedBasebandFifo(bool sharedFifo);                                       //!< Let channel sinks (Rx) that support it read the baseband from the shared FIFO. Kept with the device set
+    bool getSharedBasebandFifo() const { return m_sharedBasebandFifo; }                //!< Channel sinks (Rx) may read the baseband from the shared FIFO
+    SampleSinkMultiReaderFifo *getBasebandFifo();                                      //!< Shared baseband FIFO (Rx, nullptr if not available or not enabled)
     void addChannelSource(BasebandSampleSource* sink, int streamIndex = 0);            //!< Add a channel source (Tx)
     void removeChannelSource(BasebandSampleSource* sink, int streamIndex = 0);         //!< Remove a channel source (Tx)
     void addMIMOChannel(MIMOChannel* channel);   //!< Add a MIMO channel (n Rx and m Tx combination)
@@ -199,6 +210,9 @@ protected:
 
     DSPDeviceSourceEngine *m_deviceSourceEngine;
     QList<ChannelAPI*> m_channelSinkAPIs;
+    unsigned int m_polyphaseSubbands;    //!< Device polyphase channelizer sub-bands setting (0 if disabled)
+    bool m_channelSinkFanOut;            //!< Channel sinks fan out setting
+    bool m_sharedBasebandFifo;           //!< Channel sinks shared baseband FIFO setting
 
     // Single Tx (i.e. sink)
 
@@ -218,5 +232,7 @@ private slots:
 
 signals:
     void stateChanged(DeviceAPI *deviceAPI);
+    void sinkChannelsChanged(); //!< a channel sink API was added or removed. Emitted in the caller thread
+    void sharedBasebandFifoChanged(); //!< shared baseband FIFO setting changed. Emitted in the caller thread
 };
 #endif // SDRBASE_DEVICE_DEVICEAPI_H_
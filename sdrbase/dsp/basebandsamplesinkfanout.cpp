@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include "dsp/basebandsamplesink.h"
+#include "basebandsamplesinkfanout.h"
+
+BasebandSampleSinkFanOut::BasebandSampleSinkFanOut(unsigned int queueSize) :
+    m_queueSize(queueSize),
+    m_blockPoolIndex(0)
+{
+}
+
+BasebandSampleSinkFanOut::~BasebandSampleSinkFanOut()
+{
+    removeAllSinks();
+}
+
+void BasebandSampleSinkFanOut::addSink(BasebandSampleSink* sink)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_workers.find(sink) != m_workers.end()) {
+        return;
+    }
+
+    qDebug() << "BasebandSampleSinkFanOut::addSink: " << sink->getSinkName();
+    Worker *worker = new Worker(sink, m_queueSize);
+    m_workers[sink] = worker;
+    worker->start();
+}
+
+void BasebandSampleSinkFanOut::removeSink(BasebandSampleSink* sink)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Workers::iterator it = m_workers.find(sink);
+
+    if (it == m_workers.end()) {
+        return;
+    }
+
+    qDebug() << "BasebandSampleSinkFanOut::removeSink: " << sink->getSinkName();
+    it->second->stopWork();
+    it->second->wait();
+    delete it->second;
+    m_workers.erase(it);
+}
+
+void BasebandSampleSinkFanOut::removeAllSinks()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (Workers::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    {
+        it->second->stopWork();
+        it->second->wait();
+        delete it->second;
+    }
+
+    m_workers.clear();
+}
+
+void BasebandSampleSinkFanOut::publish(const SampleBlock& block, BasebandSampleSink* excludedSink)
+{
+    for (Workers::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    {
+        if (it->first != excludedSink) {
+            it->second->push(block);
+        }
+    }
+}
+
+void BasebandSampleSinkFanOut::publish(BasebandSampleSink* sink, const SampleBlock& block)
+{
+    Workers::iterator it = m_workers.find(sink);
+
+    if (it != m_workers.end()) {
+        it->second->push(block);
+    }
+}
+
+void BasebandSampleSinkFanOut::flush()
+{
+    for (Workers::iterator it = m_workers.begin(); it != m_workers.end(); ++it) {
+        it->second->flush();
+    }
+}
+
+std::shared_ptr<SampleVector> BasebandSampleSinkFanOut::allocateBlock()
+{
+    // Every sink holds at most its queue plus the block being fed. Leave room for sub-band blocks.
+    const unsigned int maxPoolSize = 4 * (m_queueSize + 2);
+
+    for (unsigned int i = 0; i < m_blockPool.size(); i++)
+    {
+        std::shared_ptr<SampleVector>& block = m_blockPool[(m_blockPoolIndex + i) % m_blockPool.size()];
+
+        if (block.use_count() == 1) // released by all sinks
+        {
+            std::atomic_thread_fence(std::memory_order_acquire); // sinks are done reading it
+            m_blockPoolIndex = (m_blockPoolIndex + i + 1) % m_blockPool.size();
+            block->clear(); // keeps capacity
+            return block;
+        }
+    }
+
+    if (m_blockPool.size() < maxPoolSize)
+    {
+        m_blockPool.push_back(std::make_shared<SampleVector>());
+        return m_blockPool.back();
+    }
+
+    return std::make_shared<SampleVector>(); // pool exhausted: not recycled
+}
+
+void BasebandSampleSinkFanOut::getStats(std::vector<SinkStats>& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    stats.clear();
+
+    for (Workers::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    {
+        stats.push_back(SinkStats());
+        it->second->getStats(stats.back());
+        stats.back().m_sinkName = it->first->getSinkName();
+    }
+}
+
+bool BasebandSampleSinkFanOut::getStats(BasebandSampleSink* sink, SinkStats& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Workers::iterator it = m_workers.find(sink);
+
+    if (it == m_workers.end()) {
+        return false;
+    }
+
+    it->second->getStats(stats);
+    stats.m_sinkName = sink->getSinkName();
+
+    return true;
+}
+
+BasebandSampleSinkFanOut::Worker::Worker(BasebandSampleSink* sink, unsigned int queueSize) :
+    m_sink(sink),
+    m_queueSize(queueSize),
+    m_running(true),
+    m_busy(false)
+{
+}
+
+void BasebandSampleSinkFanOut::Worker::push(const SampleBlock& block)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_queue.size() >= m_queueSize)
+    {
+        m_stats.m_droppedBlocks++;
+        return;
+    }
+
+    m_queue.push_back(block);
+
+    if (m_queue.size() > m_stats.m_maxQueueDepth) {
+        m_stats.m_maxQueueDepth = m_queue.size();
+    }
+
+    m_dataCondition.wakeOne();
+}
+
+void BasebandSampleSinkFanOut::Worker::flush()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_queue.clear();
+
+    while (m_busy) {
+        m_idleCondition.wait(&m_mutex);
+    }
+}
+
+void BasebandSampleSinkFanOut::Worker::stopWork()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_running = false;
+    m_queue.clear();
+    m_dataCondition.wakeOne();
+}
+
+void BasebandSampleSinkFanOut::Worker::getStats(SinkStats& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    stats = m_stats;
+    stats.m_queueDepth = m_queue.size();
+    stats.m_queueSize = m_queueSize;
+    stats.m_queuedSamples = 0;
+
+    for (const auto& block : m_queue) {
+        stats.m_queuedSamples += block->size();
+    }
+}
+
+void BasebandSampleSinkFanOut::Worker::run()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (m_running)
+    {
+        if (m_queue.size() == 0)
+        {
+            m_dataCondition.wait(&m_mutex);
+            continue;
+        }
+
+        SampleBlock block = m_queue.front();
+        m_queue.pop_front();
+        m_busy = true;
+        mutexLocker.unlock();
+
+        m_sink->feed(block->begin(), block->end(), false);
+
+        mutexLocker.relock();
+        m_busy = false;
+        m_stats.m_blocks++;
+        m_stats.m_samples += block->size();
+        m_idleCondition.wakeAll();
+    }
+}
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Fan-out of device baseband sample blocks to baseband sample sinks each        //
+// running on its own thread. Blocks are published once in a shared read-only   //
+// buffer and queued per sink. When a sink queue is full the block is dropped    //
+// for this sink only so that a slow sink does not delay the others.            //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_BASEBANDSAMPLESINKFANOUT_H
+#define SDRBASE_DSP_BASEBANDSAMPLESINKFANOUT_H
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class BasebandSampleSink;
+
+class SDRBASE_API BasebandSampleSinkFanOut
+{
+public:
+    typedef std::shared_ptr<const SampleVector> SampleBlock;
+
+    struct SinkStats
+    {
+        QString m_sinkName;
+        quint64 m_blocks;        //!< blocks fed to the sink
+        quint64 m_samples;       //!< samples fed to the sink
+        quint64 m_droppedBlocks; //!< blocks dropped because the sink queue was full
+        unsigned int m_queueDepth;
+        unsigned int m_maxQueueDepth;
+        unsigned int m_queueSize;     //!< maximum number of blocks in the sink queue
+        unsigned int m_queuedSamples; //!< samples in the blocks waiting in the sink queue
+
+        SinkStats() :
+            m_blocks(0),
+            m_samples(0),
+            m_droppedBlocks(0),
+            m_queueDepth(0),
+            m_maxQueueDepth(0),
+            m_queueSize(0),
+            m_queuedSamples(0)
+        {}
+    };
+
+    BasebandSampleSinkFanOut(unsigned int queueSize = 16);
+    ~BasebandSampleSinkFanOut();
+
+    void addSink(BasebandSampleSink* sink);    //!< Create the sink worker thread
+    void removeSink(BasebandSampleSink* sink); //!< Stop the sink worker thread. Sink is not fed anymore on return
+    void removeAllSinks();
+    bool hasSink(BasebandSampleSink* sink) const { return m_workers.find(sink) != m_workers.end(); }
+    bool isEmpty() const { return m_workers.size() == 0; }
+    void publish(const SampleBlock& block, BasebandSampleSink* excludedSink = nullptr); //!< Queue block for all sinks
+    void publish(BasebandSampleSink* sink, const SampleBlock& block); //!< Queue block for one sink
+    void flush(); //!< Discard pending blocks and wait for sinks to return from feed
+    std::shared_ptr<SampleVector> allocateBlock(); //!< Empty block buffer from the pool. To be called from the publishing thread only
+    void getStats(std::vector<SinkStats>& stats);
+    bool getStats(BasebandSampleSink* sink, SinkStats& stats); //!< False if the sink is not fed by the fan out
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(BasebandSampleSink* sink, unsigned int queueSize);
+        void push(const SampleBlock& block);
+        void flush();
+        void stopWork();
+        void getStats(SinkStats& stats);
+
+    protected:
+        void run() override;
+
+    private:
+        BasebandSampleSink* m_sink;
+        unsigned int m_queueSize;
+        std::deque<SampleBlock> m_queue;
+        bool m_running;
+        bool m_busy;
+        SinkStats m_stats;
+        QMutex m_mutex;
+        QWaitCondition m_dataCondition;
+        QWaitCondition m_idleCondition;
+    };
+
+    typedef std::map<BasebandSampleSink*, Worker*> Workers;
+    Workers m_workers;
+    unsigned int m_queueSize;
+    QMutex m_mutex; //!< protects workers map against concurrent statistics access
+    std::vector<std::shared_ptr<SampleVector>> m_blockPool; //!< a buffer is free when the pool holds the only reference
+    unsigned int m_blockPoolIndex;
+};
+
+#endif // SDRBASE_DSP_BASEBANDSAMPLESINKFANOUT_H
@@ -22,4 +22,10 @@ ChannelSampleSink::ChannelSampleSink()
 {}
 
 ChannelSampleSink::~ChannelSampleSink()
-{}
\ No newline at end of file
+{}
+
+void ChannelSampleSink::feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end)
+{
+    (void) begin;
+    (void) end;
+}
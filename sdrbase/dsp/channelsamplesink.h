@@ -32,6 +32,10 @@ public:
 	virtual ~ChannelSampleSink();
 
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) = 0;
+    /** Process a contiguous block of samples at channel processing rate. Sinks that shift and resample
+     *  the baseband in feed() pass the whole block here instead of processing samples one by one.
+     *  Default does nothing. */
+    virtual void feedBlock(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end);
 };
 
 #endif // SDRBASE_DSP_CHANNELSAMPLESINK_H_
@@ -22,6 +22,7 @@
 #include "dsp/inthalfbandfilter.h"
 #include "dsp/dspcommands.h"
 #include "dsp/hbfilterchainconverter.h"
+#include "dsp/polyphasechannelizer.h"
 #include "downchannelizer.h"
 
 DownChannelizer::DownChannelizer(ChannelSampleSink* sampleSink) :
@@ -33,7 +34,9 @@ DownChannelizer::DownChannelizer(ChannelSampleSink* sampleSink) :
     m_channelSampleRate(0),
 	m_channelFrequencyOffset(0),
     m_log2Decim(0),
-    m_filterChainHash(0)
+    m_filterChainHash(0),
+    m_nbSubbands(0),
+    m_subbandIndex(-1)
 {
 }
 
@@ -56,30 +59,43 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 	}
 	else
 	{
-		for (SampleVector::const_iterator sample = begin; sample != end; ++sample)
+		// Split I and Q once then run each filter stage over the whole block
+		int count = end - begin;
+		m_blockI.resize(count);
+		m_blockQ.resize(count);
+		FixReal *blockI = m_blockI.data();
+		FixReal *blockQ = m_blockQ.data();
+		SampleVector::const_iterator sample = begin;
+
+		for (int i = 0; i < count; i++, ++sample)
 		{
-			Sample s(*sample);
-			FilterStages::iterator stage = m_filterStages.begin();
+			blockI[i] = sample->m_real;
+			blockQ[i] = sample->m_imag;
+		}
 
-			for (; stage != m_filterStages.end(); ++stage)
-			{
+		for (FilterStages::iterator stage = m_filterStages.begin(); stage != m_filterStages.end(); ++stage)
+		{
 #ifndef SDR_RX_SAMPLE_24BIT
-                s.m_real /= 2; // avoid saturation on 16 bit samples
-                s.m_imag /= 2;
-#endif
-				if (!(*stage)->work(&s)) {
-					break;
-				}
+			for (int i = 0; i < count; i++)
+			{
+				blockI[i] /= 2; // avoid saturation on 16 bit samples
+				blockQ[i] /= 2;
 			}
+#endif
+			count = (*stage)->work(blockI, blockQ, count);
+		}
 
-			if(stage == m_filterStages.end())
-			{
+		m_sampleBuffer.resize(count);
+
+		for (int i = 0; i < count; i++)
+		{
 #ifdef SDR_RX_SAMPLE_24BIT
-			    s.m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
-			    s.m_imag /= (1<<(m_filterStages.size()));
+			m_sampleBuffer[i].m_real = blockI[i] / (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
+			m_sampleBuffer[i].m_imag = blockQ[i] / (1<<(m_filterStages.size()));
+#else
+			m_sampleBuffer[i].m_real = blockI[i];
+			m_sampleBuffer[i].m_imag = blockQ[i];
 #endif
-				m_sampleBuffer.push_back(s);
-			}
 		}
 
 		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
@@ -111,6 +127,24 @@ void DownChannelizer::setBasebandSampleRate(int basebandSampleRate, bool decim)
     }
 }
 
+void DownChannelizer::setSubband(unsigned int nbSubbands, int subbandIndex)
+{
+    if (subbandIndex < 0) {
+        nbSubbands = 0;
+    }
+
+    if ((nbSubbands == m_nbSubbands) && (subbandIndex == m_subbandIndex)) {
+        return;
+    }
+
+    m_nbSubbands = nbSubbands;
+    m_subbandIndex = nbSubbands == 0 ? -1 : subbandIndex;
+
+    if (!m_filterChainSetMode) {
+        applyChannelization();
+    }
+}
+
 void DownChannelizer::applyChannelization()
 {
     m_filterChainSetMode = false;
@@ -127,15 +161,26 @@ void DownChannelizer::applyChannelization()
 
 	freeFilterChain();
 
+    // when attached to a sub-band the input is centered on the sub-band center at the sub-band rate
+    int inputSampleRate = m_basebandSampleRate;
+    int requestedCenterFrequency = m_requestedCenterFrequency;
+
+    if (m_subbandIndex >= 0)
+    {
+        inputSampleRate = PolyphaseChannelizer::getSubbandSampleRate(m_nbSubbands, m_basebandSampleRate);
+        requestedCenterFrequency -= PolyphaseChannelizer::getSubbandFrequencyOffset(m_nbSubbands, m_basebandSampleRate, m_subbandIndex);
+    }
+
 	m_channelFrequencyOffset = createFilterChain(
-		m_basebandSampleRate / -2, m_basebandSampleRate / 2,
-		m_requestedCenterFrequency - m_requestedOutputSampleRate / 2, m_requestedCenterFrequency + m_requestedOutputSampleRate / 2);
+		inputSampleRate / -2, inputSampleRate / 2,
+		requestedCenterFrequency - m_requestedOutputSampleRate / 2, requestedCenterFrequency + m_requestedOutputSampleRate / 2);
 
-	m_channelSampleRate = m_basebandSampleRate / (1 << m_filterStages.size());
+	m_channelSampleRate = inputSampleRate / (1 << m_filterStages.size());
 
 	qDebug() << "DownChannelizer::applyChannelization done:"
         << " nb stages:" << m_filterStages.size()
         << " in (baseband):" << m_basebandSampleRate
+        << " sub-band:" << m_subbandIndex << "/" << m_nbSubbands
 		<< " req:" << m_requestedOutputSampleRate
 		<< " out (channel):" << m_channelSampleRate
 		<< " fc:" << m_channelFrequencyOffset;
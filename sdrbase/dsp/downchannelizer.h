@@ -25,6 +25,7 @@
 #include "export.h"
 #include "util/message.h"
 #include "dsp/inthalfbandfiltereo.h"
+#include "util/alignedallocator.h"
 
 #include "channelsamplesink.h"
 
@@ -40,9 +41,11 @@ public:
     void setDecimation(unsigned int log2Decim, unsigned int filterChainHash);         //!< Define channelizer with decimation factor and filter chain definition
     void setChannelization(int requestedSampleRate, qint64 requestedCenterFrequency); //!< Define channelizer with requested sample rate and center frequency (shift in the baseband)
     void setBasebandSampleRate(int basebandSampleRate, bool decim = false);           //!< decim: true => use direct decimation false => use channel configuration
+    void setSubband(unsigned int nbSubbands, int subbandIndex);                       //!< Input is a polyphase channelizer sub-band instead of the baseband (subbandIndex < 0 for baseband)
 	int getBasebandSampleRate() const { return m_basebandSampleRate; }
     int getChannelSampleRate() const { return m_channelSampleRate; }
 	int getChannelFrequencyOffset() const { return m_channelFrequencyOffset; }
+    int getSubbandIndex() const { return m_subbandIndex; }
 
 protected:
 	struct FilterStage {
@@ -53,10 +56,10 @@ protected:
 		};
 
 #ifdef SDR_RX_SAMPLE_24BIT
-        typedef bool (IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(Sample* s);
+        typedef int (IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(FixReal *sampleI, FixReal *sampleQ, int count);
         IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>* m_filter;
 #else
-        typedef bool (IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(Sample* s);
+        typedef int (IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(FixReal *sampleI, FixReal *sampleQ, int count);
         IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>* m_filter;
 #endif
 
@@ -67,9 +70,9 @@ protected:
 		FilterStage(Mode mode);
 		~FilterStage();
 
-		bool work(Sample* sample)
+		int work(FixReal *sampleI, FixReal *sampleQ, int count) //!< Decimates the block in place and returns the output size
 		{
-			return (m_filter->*m_workFunction)(sample);
+			return (m_filter->*m_workFunction)(sampleI, sampleQ, count);
 		}
 	};
 	typedef std::list<FilterStage*> FilterStages;
@@ -83,7 +86,11 @@ protected:
     int m_channelFrequencyOffset;
     unsigned int m_log2Decim;
     unsigned int m_filterChainHash;
+    unsigned int m_nbSubbands;
+    int m_subbandIndex;
 	SampleVector m_sampleBuffer;
+	std::vector<FixReal, AlignedAllocator<FixReal>> m_blockI; //!< Split I and Q of the block going through the filter stages
+	std::vector<FixReal, AlignedAllocator<FixReal>> m_blockQ;
 
 	void applyChannelization();
     void applyDecimation();
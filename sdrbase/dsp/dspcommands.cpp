@@ -30,6 +30,7 @@ MESSAGE_CLASS_DEFINITION(DSPGetErrorMessage, Message)
 MESSAGE_CLASS_DEFINITION(DSPSetSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPSetSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddBasebandSampleSink, Message)
+MESSAGE_CLASS_DEFINITION(DSPSetBasebandSampleSinkSubband, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddSpectrumSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddBasebandSampleSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPRemoveBasebandSampleSink, Message)
@@ -38,9 +39,13 @@ MESSAGE_CLASS_DEFINITION(DSPRemoveBasebandSampleSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddAudioSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPRemoveAudioSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureCorrection, Message)
+MESSAGE_CLASS_DEFINITION(DSPSetBasebandSampleSinkSharedFifo, Message)
+MESSAGE_CLASS_DEFINITION(DSPConfigurePolyphaseChannelizer, Message)
+MESSAGE_CLASS_DEFINITION(DSPConfigureFanOut, Message)
 MESSAGE_CLASS_DEFINITION(DSPEngineReport, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureScopeVis, Message)
 MESSAGE_CLASS_DEFINITION(DSPSignalNotification, Message)
+MESSAGE_POOL_DEFINITION(DSPSignalNotification)
 MESSAGE_CLASS_DEFINITION(DSPMIMOSignalNotification, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureChannelizer, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureAudio, Message)
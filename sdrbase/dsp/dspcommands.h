@@ -21,6 +21,7 @@
 
 #include <QString>
 #include "util/message.h"
+#include "util/messagepool.h"
 #include "fftwindow.h"
 #include "export.h"
 
@@ -123,6 +124,24 @@ private:
 	BasebandSampleSink* m_sampleSink;
 };
 
+class SDRBASE_API DSPSetBasebandSampleSinkSubband : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPSetBasebandSampleSinkSubband(BasebandSampleSink* sampleSink, int subbandIndex) :
+		Message(),
+		m_sampleSink(sampleSink),
+		m_subbandIndex(subbandIndex)
+	{ }
+
+	BasebandSampleSink* getSampleSink() const { return m_sampleSink; }
+	int getSubbandIndex() const { return m_subbandIndex; }
+
+private:
+	BasebandSampleSink* m_sampleSink;
+	int m_subbandIndex; //!< polyphase channelizer sub-band or -1 for baseband
+};
+
 class SDRBASE_API DSPAddSpectrumSink : public Message {
 	MESSAGE_CLASS_DECLARATION
 
@@ -226,6 +245,54 @@ private:
 
 };
 
+class SDRBASE_API DSPSetBasebandSampleSinkSharedFifo : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPSetBasebandSampleSinkSharedFifo(BasebandSampleSink* sampleSink, bool sharedFifo) :
+		Message(),
+		m_sampleSink(sampleSink),
+		m_sharedFifo(sharedFifo)
+	{ }
+
+	BasebandSampleSink* getSampleSink() const { return m_sampleSink; }
+	bool getSharedFifo() const { return m_sharedFifo; }
+
+private:
+	BasebandSampleSink* m_sampleSink;
+	bool m_sharedFifo;
+};
+
+class SDRBASE_API DSPConfigurePolyphaseChannelizer : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPConfigurePolyphaseChannelizer(unsigned int nbSubbands) :
+		Message(),
+		m_nbSubbands(nbSubbands)
+	{ }
+
+	unsigned int getNbSubbands() const { return m_nbSubbands; }
+
+private:
+	unsigned int m_nbSubbands; //!< 0 to disable
+};
+
+class SDRBASE_API DSPConfigureFanOut : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPConfigureFanOut(bool fanOut) :
+		Message(),
+		m_fanOut(fanOut)
+	{ }
+
+	bool getFanOut() const { return m_fanOut; }
+
+private:
+	bool m_fanOut;
+};
+
 class SDRBASE_API DSPEngineReport : public Message {
 	MESSAGE_CLASS_DECLARATION
 
@@ -267,6 +334,7 @@ private:
 
 class SDRBASE_API DSPSignalNotification : public Message {
 	MESSAGE_CLASS_DECLARATION
+	MESSAGE_POOL_DECLARATION
 
 public:
 	DSPSignalNotification(int samplerate, qint64 centerFrequency) :
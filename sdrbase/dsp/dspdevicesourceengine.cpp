@@ -33,6 +33,7 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_deviceSampleSource(nullptr),
 	m_sampleSourceSequence(0),
 	m_basebandSampleSinks(),
+	m_fanOut(false),
 	m_sampleRate(0),
 	m_centerFrequency(0),
 	m_dcOffsetCorrection(false),
@@ -45,6 +46,7 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 {
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
 	connect(&m_syncMessenger, SIGNAL(messageSent()), this, SLOT(handleSynchronousMessages()), Qt::QueuedConnection);
+	m_basebandFifo.setLabel(QString("DSPDeviceSourceEngine [%1]").arg(m_uid));
 
 	moveToThread(this);
 }
@@ -143,6 +145,34 @@ void DSPDeviceSourceEngine::removeSink(BasebandSampleSink* sink)
 	m_syncMessenger.sendWait(cmd);
 }
 
+void DSPDeviceSourceEngine::setSinkSubband(BasebandSampleSink* sink, int subbandIndex)
+{
+	qDebug() << "DSPDeviceSourceEngine::setSinkSubband: " << sink->getSinkName().toStdString().c_str() << " sub-band: " << subbandIndex;
+	DSPSetBasebandSampleSinkSubband cmd(sink, subbandIndex);
+	m_syncMessenger.sendWait(cmd);
+}
+
+void DSPDeviceSourceEngine::configurePolyphaseChannelizer(unsigned int nbSubbands)
+{
+	qDebug() << "DSPDeviceSourceEngine::configurePolyphaseChannelizer: " << nbSubbands;
+	DSPConfigurePolyphaseChannelizer cmd(nbSubbands);
+	m_syncMessenger.sendWait(cmd);
+}
+
+void DSPDeviceSourceEngine::setSinkSharedFifo(BasebandSampleSink* sink, bool sharedFifo)
+{
+	qDebug() << "DSPDeviceSourceEngine::setSinkSharedFifo: " << sink->getSinkName().toStdString().c_str() << " shared: " << sharedFifo;
+	DSPSetBasebandSampleSinkSharedFifo cmd(sink, sharedFifo);
+	m_syncMessenger.sendWait(cmd);
+}
+
+void DSPDeviceSourceEngine::setFanOut(bool fanOut)
+{
+	qDebug() << "DSPDeviceSourceEngine::setFanOut: " << fanOut;
+	DSPConfigureFanOut cmd(fanOut);
+	m_syncMessenger.sendWait(cmd);
+}
+
 void DSPDeviceSourceEngine::configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection)
 {
 	qDebug() << "DSPDeviceSourceEngine::configureCorrections";
@@ -321,6 +351,8 @@ void DSPDeviceSourceEngine::work()
 	SampleSinkFifo* sampleFifo = m_deviceSampleSource->getSampleFifo();
 	std::size_t samplesDone = 0;
 	bool positiveOnly = false;
+	bool subbands = m_polyphaseChannelizer.isEnabled() && (m_subbandSampleSinks.size() != 0);
+	bool sharedFifo = m_sharedFifoSampleSinks.size() != 0;
 
 	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
 	{
@@ -331,6 +363,14 @@ void DSPDeviceSourceEngine::work()
 
 		std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
 
+		if (m_fanOut)
+		{
+			workFanOut(part1begin, part1end, part2begin, part2end, subbands);
+			sampleFifo->readCommit((unsigned int) count);
+			samplesDone += count;
+			continue;
+		}
+
 		// first part of FIFO data
 		if (part1begin != part1end)
 		{
@@ -343,9 +383,18 @@ void DSPDeviceSourceEngine::work()
 			// feed data to direct sinks
 			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
 			{
-				(*it)->feed(part1begin, part1end, positiveOnly);
+				if (isDirectSink(*it, subbands)) {
+					(*it)->feed(part1begin, part1end, positiveOnly);
+				}
+			}
+
+			if (sharedFifo) {
+				m_basebandFifo.write(part1begin, part1end);
 			}
 
+			if (subbands) {
+				m_polyphaseChannelizer.feed(part1begin, part1end);
+			}
 		}
 
 		// second part of FIFO data (used when block wraps around)
@@ -360,9 +409,23 @@ void DSPDeviceSourceEngine::work()
 			// feed data to direct sinks
 			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
 			{
-				(*it)->feed(part2begin, part2end, positiveOnly);
+				if (isDirectSink(*it, subbands)) {
+					(*it)->feed(part2begin, part2end, positiveOnly);
+				}
+			}
+
+			if (sharedFifo) {
+				m_basebandFifo.write(part2begin, part2end);
 			}
 
+			if (subbands) {
+				m_polyphaseChannelizer.feed(part2begin, part2end);
+			}
+		}
+
+		// feed sub-band data to sub-band sinks
+		if (subbands) {
+			feedSubbandSinks();
 		}
 
 		// adjust FIFO pointers
@@ -371,6 +434,93 @@ void DSPDeviceSourceEngine::work()
 	}
 }
 
+void DSPDeviceSourceEngine::workFanOut(
+	SampleVector::iterator part1begin,
+	SampleVector::iterator part1end,
+	SampleVector::iterator part2begin,
+	SampleVector::iterator part2end,
+	bool subbands)
+{
+	if (m_dcOffsetCorrection)
+	{
+		iqCorrections(part1begin, part1end, m_iqImbalanceCorrection);
+		iqCorrections(part2begin, part2end, m_iqImbalanceCorrection);
+	}
+
+	// the block is copied once out of the FIFO into a pooled buffer and shared read only by all sinks
+	std::shared_ptr<SampleVector> block = m_sinkFanOut.allocateBlock();
+	block->reserve((part1end - part1begin) + (part2end - part2begin));
+	block->insert(block->end(), part1begin, part1end);
+	block->insert(block->end(), part2begin, part2end);
+
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+	{
+		if (isDirectSink(*it, subbands)) {
+			m_sinkFanOut.publish(*it, block);
+		}
+	}
+
+	if (m_sharedFifoSampleSinks.size() != 0) {
+		m_basebandFifo.write(block->begin(), block->end());
+	}
+
+	if (subbands)
+	{
+		m_polyphaseChannelizer.feed(block->begin(), block->end());
+		feedSubbandSinks();
+	}
+}
+
+bool DSPDeviceSourceEngine::isDirectSink(BasebandSampleSink* sink, bool subbands) const
+{
+	if (subbands && (m_subbandSampleSinks.find(sink) != m_subbandSampleSinks.end())) {
+		return false;
+	}
+
+	return m_sharedFifoSampleSinks.find(sink) == m_sharedFifoSampleSinks.end();
+}
+
+void DSPDeviceSourceEngine::feedSubbandSinks()
+{
+	if (m_fanOut)
+	{
+		std::map<int, BasebandSampleSinkFanOut::SampleBlock> subbandBlocks;
+
+		for (SubbandSampleSinks::const_iterator it = m_subbandSampleSinks.begin(); it != m_subbandSampleSinks.end(); ++it)
+		{
+			const SampleVector& samples = m_polyphaseChannelizer.getSubbandSamples(it->second);
+
+			if (samples.size() == 0) {
+				continue;
+			}
+
+			if (subbandBlocks.find(it->second) == subbandBlocks.end())
+			{
+				std::shared_ptr<SampleVector> block = m_sinkFanOut.allocateBlock();
+				block->assign(samples.begin(), samples.end());
+				subbandBlocks[it->second] = block;
+			}
+
+			m_sinkFanOut.publish(it->first, subbandBlocks[it->second]);
+		}
+
+		m_polyphaseChannelizer.clearSubbandSamples();
+		return;
+	}
+
+
+	for (SubbandSampleSinks::const_iterator it = m_subbandSampleSinks.begin(); it != m_subbandSampleSinks.end(); ++it)
+	{
+		const SampleVector& samples = m_polyphaseChannelizer.getSubbandSamples(it->second);
+
+		if (samples.size() != 0) {
+			it->first->feed(samples.begin(), samples.end(), false);
+		}
+	}
+
+	m_polyphaseChannelizer.clearSubbandSamples();
+}
+
 // notStarted -> idle -> init -> running -+
 //                ^                       |
 //                +-----------------------+
@@ -399,6 +549,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoIdle()
 
 	// stop everything
 	m_deviceSampleSource->stop();
+	m_sinkFanOut.flush();
 
 	for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
 	{
@@ -439,10 +590,12 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 	m_qOffset = 0;
 	m_iRange = 1 << 16;
 	m_qRange = 1 << 16;
+	m_polyphaseChannelizer.reset();
 
 	m_deviceDescription = m_deviceSampleSource->getDeviceDescription();
 	m_centerFrequency = m_deviceSampleSource->getCenterFrequency();
 	m_sampleRate = m_deviceSampleSource->getSampleRate();
+	m_basebandFifo.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
 
 	qDebug() << "DSPDeviceSourceEngine::gotoInit: "
 	        << " m_deviceDescription: " << m_deviceDescription.toStdString().c_str()
@@ -589,6 +742,11 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		BasebandSampleSink* sink = ((DSPAddBasebandSampleSink*) message)->getSampleSink();
 		m_basebandSampleSinks.push_back(sink);
+
+		if (m_fanOut) {
+			m_sinkFanOut.addSink(sink);
+		}
+
         // initialize sample rate and center frequency in the sink:
         DSPSignalNotification *msg = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
         sink->pushMessage(msg);
@@ -600,13 +758,90 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	else if (DSPRemoveBasebandSampleSink::match(*message))
 	{
 		BasebandSampleSink* sink = ((DSPRemoveBasebandSampleSink*) message)->getSampleSink();
+		m_sinkFanOut.removeSink(sink); // sink is not fed from its worker thread past this point
 
 		if(m_state == StRunning) {
 			sink->stop();
 		}
 
+		SubbandSampleSinks::iterator sit = m_subbandSampleSinks.find(sink);
+
+		if (sit != m_subbandSampleSinks.end())
+		{
+			m_polyphaseChannelizer.setSubbandActive(sit->second, false);
+			m_subbandSampleSinks.erase(sit);
+		}
+
+		m_sharedFifoSampleSinks.erase(sink);
 		m_basebandSampleSinks.remove(sink);
 	}
+	else if (DSPSetBasebandSampleSinkSubband::match(*message))
+	{
+		DSPSetBasebandSampleSinkSubband *cmd = (DSPSetBasebandSampleSinkSubband*) message;
+		BasebandSampleSink* sink = cmd->getSampleSink();
+		int subbandIndex = cmd->getSubbandIndex();
+		SubbandSampleSinks::iterator sit = m_subbandSampleSinks.find(sink);
+
+		if (sit != m_subbandSampleSinks.end())
+		{
+			m_polyphaseChannelizer.setSubbandActive(sit->second, false);
+			m_subbandSampleSinks.erase(sit);
+		}
+
+		if ((subbandIndex >= 0) && (subbandIndex < (int) m_polyphaseChannelizer.getNbSubbands()))
+		{
+			m_subbandSampleSinks[sink] = subbandIndex;
+			m_polyphaseChannelizer.setSubbandActive(subbandIndex, true);
+		}
+	}
+	else if (DSPConfigurePolyphaseChannelizer::match(*message))
+	{
+		unsigned int nbSubbands = ((DSPConfigurePolyphaseChannelizer*) message)->getNbSubbands();
+
+		if (nbSubbands != m_polyphaseChannelizer.getNbSubbands())
+		{
+			// all sinks go back to the baseband and are notified so that they can select a new sub-band
+			m_subbandSampleSinks.clear();
+			m_polyphaseChannelizer.configure(nbSubbands);
+
+			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+			{
+				DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+				(*it)->pushMessage(notif);
+			}
+		}
+	}
+
+	else if (DSPSetBasebandSampleSinkSharedFifo::match(*message))
+	{
+		DSPSetBasebandSampleSinkSharedFifo *cmd = (DSPSetBasebandSampleSinkSharedFifo*) message;
+
+		if (cmd->getSharedFifo()) {
+			m_sharedFifoSampleSinks.insert(cmd->getSampleSink());
+		} else {
+			m_sharedFifoSampleSinks.erase(cmd->getSampleSink());
+		}
+	}
+	else if (DSPConfigureFanOut::match(*message))
+	{
+		bool fanOut = ((DSPConfigureFanOut*) message)->getFanOut();
+
+		if (fanOut != m_fanOut)
+		{
+			m_fanOut = fanOut;
+
+			if (m_fanOut)
+			{
+				for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it) {
+					m_sinkFanOut.addSink(*it);
+				}
+			}
+			else
+			{
+				m_sinkFanOut.removeAllSinks();
+			}
+		}
+	}
 
 	m_syncMessenger.done(m_state);
 }
@@ -658,6 +893,7 @@ void DSPDeviceSourceEngine::handleInputMessages()
 
 			m_sampleRate = notif->getSampleRate();
 			m_centerFrequency = notif->getCenterFrequency();
+			m_basebandFifo.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
 
 			qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification:"
 				<< " m_sampleRate: " << m_sampleRate
@@ -19,12 +19,19 @@
 #ifndef INCLUDE_DSPDEVICEENGINE_H
 #define INCLUDE_DSPDEVICEENGINE_H
 
+#include <map>
+#include <set>
+#include <vector>
+
 #include <QThread>
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
+#include "dsp/basebandsamplesinkfanout.h"
+#include "dsp/samplesinkmultireaderfifo.h"
+#include "dsp/polyphasechannelizer.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "export.h"
@@ -65,6 +72,18 @@ public:
 
 	void addSink(BasebandSampleSink* sink); //!< Add a sample sink
 	void removeSink(BasebandSampleSink* sink); //!< Remove a sample sink
+	void setSinkSubband(BasebandSampleSink* sink, int subbandIndex); //!< Feed sink from a polyphase channelizer sub-band (-1 for baseband)
+
+	void configurePolyphaseChannelizer(unsigned int nbSubbands); //!< Enable device level polyphase channelizer with this number of sub-bands (0 to disable)
+	unsigned int getPolyphaseSubbands() const { return m_polyphaseChannelizer.getNbSubbands(); }
+
+	void setSinkSharedFifo(BasebandSampleSink* sink, bool sharedFifo); //!< Sink reads the baseband in place from the shared FIFO instead of being fed
+	SampleSinkMultiReaderFifo *getBasebandFifo() { return &m_basebandFifo; }
+
+	void setFanOut(bool fanOut); //!< Feed each sink on its own thread from a shared block
+	bool getFanOut() const { return m_fanOut; }
+	void getFanOutStats(std::vector<BasebandSampleSinkFanOut::SinkStats>& stats) { m_sinkFanOut.getStats(stats); }
+	bool getFanOutStats(BasebandSampleSink* sink, BasebandSampleSinkFanOut::SinkStats& stats) { return m_sinkFanOut.getStats(sink, stats); }
 
 	void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure DSP corrections
 
@@ -90,6 +109,17 @@ private:
 	typedef std::list<BasebandSampleSink*> BasebandSampleSinks;
 	BasebandSampleSinks m_basebandSampleSinks; //!< sample sinks within main thread (usually spectrum, file output)
 
+	typedef std::map<BasebandSampleSink*, int> SubbandSampleSinks;
+	SubbandSampleSinks m_subbandSampleSinks; //!< sinks fed from a polyphase channelizer sub-band instead of the baseband
+	PolyphaseChannelizer m_polyphaseChannelizer;
+
+	typedef std::set<BasebandSampleSink*> SharedFifoSampleSinks;
+	SharedFifoSampleSinks m_sharedFifoSampleSinks; //!< sinks reading the baseband from the shared FIFO
+	SampleSinkMultiReaderFifo m_basebandFifo;      //!< baseband written once for all shared FIFO readers
+
+	bool m_fanOut;
+	BasebandSampleSinkFanOut m_sinkFanOut; //!< per sink threads when fan out is enabled
+
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
 
@@ -129,6 +159,15 @@ private:
 	void dcOffset(SampleVector::iterator begin, SampleVector::iterator end);
 	void imbalance(SampleVector::iterator begin, SampleVector::iterator end);
 	void work(); //!< transfer samples from source to sinks if in running state
+	void workFanOut(
+		SampleVector::iterator part1begin,
+		SampleVector::iterator part1end,
+		SampleVector::iterator part2begin,
+		SampleVector::iterator part2end,
+		bool subbands
+	); //!< publish FIFO data to per sink threads
+	void feedSubbandSinks();
+	bool isDirectSink(BasebandSampleSink* sink, bool subbands) const; //!< sink is neither on a sub-band nor reading the shared FIFO
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
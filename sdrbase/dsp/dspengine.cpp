@@ -17,13 +17,17 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QGlobalStatic>
+#include <QDebug>
 #include <QThread>
 
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
+#include "dsp/dspscheduler.h"
 #include "dsp/fftfactory.h"
+#include "dsp/halfbandkernels.h"
+#include "dsp/ncokernels.h"
 
 DSPEngine::DSPEngine() :
     m_deviceSourceEnginesUIDSequence(0),
@@ -31,11 +35,16 @@ DSPEngine::DSPEngine() :
     m_deviceMIMOEnginesUIDSequence(0),
     m_audioInputDeviceIndex(-1),    // default device
     m_audioOutputDeviceIndex(-1),   // default device
-    m_fftFactory(nullptr)
+    m_fftFactory(nullptr),
+    m_dspScheduler(nullptr)
 {
 	m_dvSerialSupport = false;
     m_mimoSupport = false;
     m_masterTimer.start(50);
+    qDebug("DSPEngine::DSPEngine: halfband filter kernels: %s",
+        HalfbandKernels::getInstructionSetName(HalfbandKernels::getInstructionSet()));
+    qDebug("DSPEngine::DSPEngine: NCO kernels: %s",
+        HalfbandKernels::getInstructionSetName(NCOKernels::getInstructionSet()));
 }
 
 DSPEngine::~DSPEngine()
@@ -51,6 +60,10 @@ DSPEngine::~DSPEngine()
     if (m_fftFactory) {
         delete m_fftFactory;
     }
+
+    if (m_dspScheduler) {
+        delete m_dspScheduler;
+    }
 }
 
 Q_GLOBAL_STATIC(DSPEngine, dspEngine)
@@ -173,6 +186,24 @@ void DSPEngine::createFFTFactory(const QString& fftWisdomFileName)
     m_fftFactory = new FFTFactory(fftWisdomFileName);
 }
 
+void DSPEngine::createDSPScheduler(int nbThreads, const QString& cpuAffinity, int priority)
+{
+    if (m_dspScheduler) {
+        delete m_dspScheduler;
+    }
+
+    m_dspScheduler = nbThreads > 0 ? new DSPScheduler(nbThreads, cpuAffinity, priority) : nullptr;
+}
+
+void DSPEngine::configureFFTPlanning(int nbThreads, int minThreadedSize, bool backgroundPlanning)
+{
+    if (m_fftFactory)
+    {
+        m_fftFactory->setThreading(nbThreads < 0 ? 0 : nbThreads, minThreadedSize < 0 ? 0 : minThreadedSize); // 0 threads: automatic
+        m_fftFactory->setBackgroundPlanning(backgroundPlanning);
+    }
+}
+
 void DSPEngine::preAllocateFFTs()
 {
     m_fftFactory->preallocate(7, 10, 1, 0); // pre-acllocate forward FFT only 1 per size from 128 to 1024
@@ -31,6 +31,7 @@ class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
 class DSPDeviceMIMOEngine;
 class FFTFactory;
+class DSPScheduler;
 
 class SDRBASE_API DSPEngine : public QObject {
 	Q_OBJECT
@@ -69,7 +70,10 @@ public:
     bool getMIMOSupport() const { return m_mimoSupport; }
     void createFFTFactory(const QString& fftWisdomFileName);
     void preAllocateFFTs();
+    void configureFFTPlanning(int nbThreads, int minThreadedSize, bool backgroundPlanning); //!< Applies to FFT sizes planned from now on
     FFTFactory *getFFTFactory() { return m_fftFactory; }
+    void createDSPScheduler(int nbThreads, const QString& cpuAffinity, int priority); //!< Must be done before channels are created
+    DSPScheduler *getDSPScheduler() { return m_dspScheduler; } //!< nullptr if channels use their own threads
 
 private:
     struct DeviceEngineReference
@@ -94,6 +98,7 @@ private:
 	bool m_dvSerialSupport;
     bool m_mimoSupport;
     FFTFactory *m_fftFactory;
+    DSPScheduler *m_dspScheduler;
 };
 
 #endif // INCLUDE_DSPENGINE_H
@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <QDebug>
+#include <QStringList>
+
+#include "dspscheduler.h"
+
+DSPScheduler::Task::Task(DSPScheduler *scheduler, const Handler& handler, int homeWorker) :
+    m_scheduler(scheduler),
+    m_handler(handler),
+    m_homeWorker(homeWorker),
+    m_state(Idle),
+    m_enabled(true)
+{
+}
+
+void DSPScheduler::Task::schedule()
+{
+    if (!m_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    int state = m_state.load();
+
+    while (true)
+    {
+        if (state == Idle)
+        {
+            if (m_state.compare_exchange_weak(state, Queued))
+            {
+                m_scheduler->push(shared_from_this(), m_homeWorker);
+                return;
+            }
+        }
+        else if (state == Running)
+        {
+            if (m_state.compare_exchange_weak(state, Rescheduled)) {
+                return;
+            }
+        }
+        else // already queued or rescheduled
+        {
+            return;
+        }
+    }
+}
+
+void DSPScheduler::Task::disable()
+{
+    m_enabled.store(false);
+
+    // workers set the running state before they check if the task is enabled
+    while ((m_state.load() == Running) || (m_state.load() == Rescheduled)) {
+        QThread::usleep(100);
+    }
+}
+
+DSPScheduler::DSPScheduler(int nbThreads, const QString& cpuAffinity, int priority) :
+    m_nextWorker(0),
+    m_pending(0),
+    m_nbSleeping(0),
+    m_running(true)
+{
+    std::vector<int> cpus = parseCPUList(cpuAffinity);
+
+    for (int i = 0; i < nbThreads; i++) {
+        m_queues.push_back(new WorkQueue());
+    }
+
+    for (int i = 0; i < nbThreads; i++)
+    {
+        m_workers.push_back(new Worker(this, i, cpus.size() == 0 ? -1 : cpus[i % cpus.size()]));
+        m_workers.back()->start((QThread::Priority) priority);
+    }
+
+    qDebug("DSPScheduler::DSPScheduler: %d workers affinity: \"%s\" priority: %d",
+        nbThreads, qPrintable(cpuAffinity), priority);
+}
+
+DSPScheduler::~DSPScheduler()
+{
+    m_running.store(false);
+    m_sleepMutex.lock();
+    m_wakeCondition.wakeAll();
+    m_sleepMutex.unlock();
+
+    for (auto worker : m_workers)
+    {
+        worker->wait();
+        delete worker;
+    }
+
+    for (auto queue : m_queues) {
+        delete queue;
+    }
+}
+
+DSPScheduler::TaskPtr DSPScheduler::createTask(const Task::Handler& handler)
+{
+    int homeWorker = m_nextWorker.fetch_add(1) % m_workers.size();
+    return std::make_shared<Task>(this, handler, homeWorker);
+}
+
+void DSPScheduler::getStats(std::vector<WorkerStats>& stats)
+{
+    stats.resize(m_workers.size());
+
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        stats[i].m_cpu = m_workers[i]->getCPU();
+        stats[i].m_runs = m_queues[i]->m_runs.load(std::memory_order_relaxed);
+        stats[i].m_steals = m_queues[i]->m_steals.load(std::memory_order_relaxed);
+    }
+}
+
+std::vector<int> DSPScheduler::parseCPUList(const QString& cpuList)
+{
+    std::vector<int> cpus;
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    QStringList items = cpuList.split(',', Qt::SkipEmptyParts);
+#else
+    QStringList items = cpuList.split(',', QString::SkipEmptyParts);
+#endif
+
+    for (const auto& item : items)
+    {
+        QStringList bounds = item.trimmed().split('-');
+        bool ok1, ok2 = true;
+        int first = bounds[0].toInt(&ok1);
+        int last = bounds.size() > 1 ? bounds[1].toInt(&ok2) : first;
+
+        if (!ok1 || !ok2 || (bounds.size() > 2) || (first < 0) || (last < first))
+        {
+            qWarning("DSPScheduler::parseCPUList: invalid item \"%s\" in \"%s\"", qPrintable(item), qPrintable(cpuList));
+            continue;
+        }
+
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+
+    return cpus;
+}
+
+void DSPScheduler::push(const TaskPtr& task, int worker)
+{
+    m_queues[worker]->m_mutex.lock();
+    m_queues[worker]->m_tasks.push_back(task);
+    m_queues[worker]->m_mutex.unlock();
+    m_pending.fetch_add(1);
+
+    // a worker going to sleep counts itself before it checks the pending tasks
+    if (m_nbSleeping.load() > 0)
+    {
+        m_sleepMutex.lock();
+        m_wakeCondition.wakeOne();
+        m_sleepMutex.unlock();
+    }
+}
+
+DSPScheduler::TaskPtr DSPScheduler::take(int worker)
+{
+    TaskPtr task;
+    WorkQueue *queue = m_queues[worker];
+
+    queue->m_mutex.lock();
+
+    if (!queue->m_tasks.empty())
+    {
+        task = queue->m_tasks.front(); // own queue in order
+        queue->m_tasks.pop_front();
+    }
+
+    queue->m_mutex.unlock();
+
+    for (unsigned int i = 1; !task && (i < m_queues.size()); i++)
+    {
+        WorkQueue *victim = m_queues[(worker + i) % m_queues.size()];
+        victim->m_mutex.lock();
+
+        if (!victim->m_tasks.empty())
+        {
+            task = victim->m_tasks.back(); // steal the most recent: the victim is busy with the oldest
+            victim->m_tasks.pop_back();
+            queue->m_steals.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        victim->m_mutex.unlock();
+    }
+
+    if (task) {
+        m_pending.fetch_sub(1);
+    }
+
+    return task;
+}
+
+void DSPScheduler::runTask(const TaskPtr& task, int worker)
+{
+    task->m_state.store(Task::Running);
+
+    if (task->m_enabled.load())
+    {
+        task->m_handler();
+        m_queues[worker]->m_runs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int state = Task::Running;
+
+    if (!task->m_state.compare_exchange_strong(state, Task::Idle)) // rescheduled while running
+    {
+        task->m_state.store(Task::Queued);
+        push(task, worker); // at the back so that other tasks of this worker get their turn
+    }
+}
+
+void DSPScheduler::runWorker(int worker)
+{
+    while (m_running.load())
+    {
+        TaskPtr task = take(worker);
+
+        if (task)
+        {
+            runTask(task, worker);
+            continue;
+        }
+
+        m_sleepMutex.lock();
+        m_nbSleeping.fetch_add(1);
+
+        if ((m_pending.load() == 0) && m_running.load()) {
+            m_wakeCondition.wait(&m_sleepMutex, 100);
+        }
+
+        m_nbSleeping.fetch_sub(1);
+        m_sleepMutex.unlock();
+    }
+}
+
+DSPScheduler::Worker::Worker(DSPScheduler *scheduler, int index, int cpu) :
+    m_scheduler(scheduler),
+    m_index(index),
+    m_cpu(cpu)
+{
+    setObjectName(QString("DSPScheduler%1").arg(index));
+}
+
+void DSPScheduler::Worker::run()
+{
+    if (m_cpu >= 0)
+    {
+#ifdef __linux__
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(m_cpu, &cpuSet);
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0)
+        {
+            qWarning("DSPScheduler::Worker::run: worker %d cannot be pinned to CPU %d", m_index, m_cpu);
+            m_cpu = -1;
+        }
+#else
+        qWarning("DSPScheduler::Worker::run: CPU affinity is not supported on this system");
+        m_cpu = -1;
+#endif
+    }
+
+    m_scheduler->runWorker(m_index);
+}
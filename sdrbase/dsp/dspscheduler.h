@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Runs the data handlers of channel basebands on a fixed pool of worker         //
+// threads instead of waking one thread per channel through queued signals.     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DSPSCHEDULER_H
+#define SDRBASE_DSP_DSPSCHEDULER_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include <QString>
+
+#include "export.h"
+
+class SDRBASE_API DSPScheduler
+{
+public:
+    /**
+     * A handler that is run by one worker at a time. Scheduling it while it runs makes it
+     * run once more so data arriving during the run is not missed.
+     */
+    class SDRBASE_API Task : public std::enable_shared_from_this<Task>
+    {
+    public:
+        typedef std::function<void()> Handler;
+
+        Task(DSPScheduler *scheduler, const Handler& handler, int homeWorker);
+        void schedule();  //!< Thread safe. Does nothing once disabled
+        void disable();   //!< The handler is not called anymore after return. Call before destroying what it uses
+
+    private:
+        enum State
+        {
+            Idle,
+            Queued,
+            Running,
+            Rescheduled
+        };
+
+        DSPScheduler *m_scheduler;
+        Handler m_handler;
+        int m_homeWorker;
+        std::atomic<int> m_state;
+        std::atomic<bool> m_enabled;
+
+        friend class DSPScheduler;
+    };
+
+    typedef std::shared_ptr<Task> TaskPtr;
+
+    struct WorkerStats
+    {
+        int m_cpu;           //!< CPU the worker is pinned to or -1
+        quint64 m_runs;      //!< handler runs
+        quint64 m_steals;    //!< tasks taken from another worker queue
+
+        WorkerStats() : m_cpu(-1), m_runs(0), m_steals(0) {}
+    };
+
+    /**
+     * cpuAffinity is a list of CPUs like "2-5,7". Worker n is pinned to the n-th CPU of the list
+     * modulo its length (Linux only). priority is a QThread::Priority value.
+     */
+    DSPScheduler(int nbThreads, const QString& cpuAffinity, int priority);
+    ~DSPScheduler();
+
+    TaskPtr createTask(const Task::Handler& handler); //!< Tasks are spread round robin on the workers
+    int getNbThreads() const { return m_workers.size(); }
+    void getStats(std::vector<WorkerStats>& stats);
+
+    static std::vector<int> parseCPUList(const QString& cpuList);
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(DSPScheduler *scheduler, int index, int cpu);
+        int getCPU() const { return m_cpu; }
+
+    protected:
+        void run() override;
+
+    private:
+        DSPScheduler *m_scheduler;
+        int m_index;
+        int m_cpu;
+    };
+
+    struct WorkQueue
+    {
+        QMutex m_mutex;
+        std::deque<TaskPtr> m_tasks;
+        std::atomic<quint64> m_runs;
+        std::atomic<quint64> m_steals;
+
+        WorkQueue() : m_runs(0), m_steals(0) {}
+    };
+
+    std::vector<Worker*> m_workers;
+    std::vector<WorkQueue*> m_queues;
+    std::atomic<int> m_nextWorker;
+    std::atomic<int> m_pending;    //!< tasks in all queues
+    std::atomic<int> m_nbSleeping; //!< workers waiting for tasks
+    std::atomic<bool> m_running;
+    QMutex m_sleepMutex;
+    QWaitCondition m_wakeCondition;
+
+    void push(const TaskPtr& task, int worker);
+    TaskPtr take(int worker);
+    void runTask(const TaskPtr& task, int worker);
+    void runWorker(int worker);
+};
+
+#endif // SDRBASE_DSP_DSPSCHEDULER_H
@@ -17,6 +17,9 @@
 
 #include <QMutexLocker>
 #include "fftfactory.h"
+#ifdef USE_FFTW
+#include "fftwplancache.h"
+#endif
 
 FFTFactory::FFTFactory(const QString& fftwWisdomFileName) :
     m_fftwWisdomFileName(fftwWisdomFileName)
@@ -139,3 +142,29 @@ void FFTFactory::releaseEngine(unsigned int fftSize, bool inverse, unsigned int
         }
     }
 }
+
+void FFTFactory::setThreading(unsigned int nbThreads, unsigned int minThreadedSize)
+{
+#ifdef USE_FFTW
+    FFTWPlanCache::instance().setThreading(nbThreads, minThreadedSize);
+#else
+    (void) nbThreads;
+    (void) minThreadedSize;
+#endif
+}
+
+void FFTFactory::setBackgroundPlanning(bool backgroundPlanning)
+{
+#ifdef USE_FFTW
+    FFTWPlanCache::instance().setBackgroundPlanning(backgroundPlanning);
+#else
+    (void) backgroundPlanning;
+#endif
+}
+
+void FFTFactory::waitForBackgroundPlanning()
+{
+#ifdef USE_FFTW
+    FFTWPlanCache::instance().waitForBackgroundPlanning();
+#endif
+}
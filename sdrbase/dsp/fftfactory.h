@@ -36,6 +36,9 @@ public:
     void preallocate(unsigned int minLog2Size, unsigned int maxLog2Size, unsigned int numberFFT, unsigned int numberInvFFT);
     unsigned int getEngine(unsigned int fftSize, bool inverse, FFTEngine **engine); //!< returns an engine sequence
     void releaseEngine(unsigned int fftSize, bool inverse, unsigned int engineSequence);
+    void setThreading(unsigned int nbThreads, unsigned int minThreadedSize); //!< FFTW: plan sizes of minThreadedSize or more with nbThreads threads
+    void setBackgroundPlanning(bool backgroundPlanning); //!< FFTW: start new sizes with an estimated plan and optimize it in the background
+    void waitForBackgroundPlanning(); //!< FFTW: wait until background plans are ready
 
 private:
     struct AllocatedEngine
@@ -15,7 +15,6 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include <QElapsedTimer>
 #include "dsp/fftwengine.h"
 
 FFTWEngine::FFTWEngine(const QString& fftWisdomFileName) :
@@ -50,36 +49,14 @@ void FFTWEngine::configure(int n, bool inverse)
 	m_currentPlan->inverse = inverse;
 	m_currentPlan->in = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
 	m_currentPlan->out = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
-	QElapsedTimer t;
-	t.start();
-    m_globalPlanMutex.lock();
-
-    if (m_fftWisdomFileName.size() > 0)
-    {
-        int rc = fftwf_import_wisdom_from_filename(m_fftWisdomFileName.toStdString().c_str());
-
-        if (rc == 0) { // that's an error (undocumented)
-            qInfo("FFTWEngine::configure: importing from FFTW wisdom file: '%s' failed", qPrintable(m_fftWisdomFileName));
-        } else {
-            qDebug("FFTWEngine::configure: successfully imported from FFTW wisdom file: '%s'", qPrintable(m_fftWisdomFileName));
-        }
-    }
-    else
-    {
-        qDebug("FFTWEngine::configure: no FFTW wisdom file");
-    }
-
-	m_currentPlan->plan = fftwf_plan_dft_1d(n, m_currentPlan->in, m_currentPlan->out, inverse ? FFTW_BACKWARD : FFTW_FORWARD, FFTW_PATIENT);
-    m_globalPlanMutex.unlock();
-
-    qDebug("FFT: creating FFTW plan (n=%d,%s) took %lld ms", n, inverse ? "inverse" : "forward", t.elapsed());
+	m_currentPlan->plan = FFTWPlanCache::instance().getPlan(n, inverse, m_fftWisdomFileName);
 	m_plans.push_back(m_currentPlan);
 }
 
 void FFTWEngine::transform()
 {
 	if(m_currentPlan != NULL)
-		fftwf_execute(m_currentPlan->plan);
+		fftwf_execute_dft(m_currentPlan->plan->m_plan.load(std::memory_order_acquire), m_currentPlan->in, m_currentPlan->out);
 }
 
 Complex* FFTWEngine::in()
@@ -96,12 +73,9 @@ Complex* FFTWEngine::out()
 	else return NULL;
 }
 
-QMutex FFTWEngine::m_globalPlanMutex;
-
 void FFTWEngine::freeAll()
 {
 	for(Plans::iterator it = m_plans.begin(); it != m_plans.end(); ++it) {
-		fftwf_destroy_plan((*it)->plan);
 		fftwf_free((*it)->in);
 		fftwf_free((*it)->out);
 		delete *it;
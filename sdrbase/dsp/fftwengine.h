@@ -18,12 +18,12 @@
 #ifndef INCLUDE_FFTWENGINE_H
 #define INCLUDE_FFTWENGINE_H
 
-#include <QMutex>
 #include <QString>
 
 #include <fftw3.h>
 #include <list>
 #include "dsp/fftengine.h"
+#include "dsp/fftwplancache.h"
 #include "export.h"
 
 class SDRBASE_API FFTWEngine : public FFTEngine {
@@ -40,13 +40,12 @@ public:
     virtual void setReuse(bool reuse) { m_reuse = reuse; }
 
 protected:
-	static QMutex m_globalPlanMutex;
     QString m_fftWisdomFileName;
 
 	struct Plan {
 		int n;
 		bool inverse;
-		fftwf_plan plan;
+		const FFTWPlanCache::Entry *plan; //!< shared plan executed on this engine buffers
 		fftwf_complex* in;
 		fftwf_complex* out;
 	};
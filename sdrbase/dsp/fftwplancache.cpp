@@ -0,0 +1,306 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QThread>
+
+#include "fftwplancache.h"
+
+const double FFTWPlanCache::m_backgroundTimeLimit = 2.0;
+// A new size requested while a background plan is running waits for the current slice so keep it short
+const double FFTWPlanCache::m_backgroundSliceTime = 0.25;
+
+FFTWPlanCache& FFTWPlanCache::instance()
+{
+    static FFTWPlanCache cache;
+    return cache;
+}
+
+FFTWPlanCache::FFTWPlanCache() :
+    m_nbThreads(std::max(1, std::min(QThread::idealThreadCount(), 4))),
+    m_minThreadedSize(65536),
+    m_backgroundPlanning(true),
+    m_planning(false),
+    m_running(false),
+    m_worker(nullptr)
+{
+#ifdef USE_FFTW_THREADS
+    if (fftwf_init_threads() == 0)
+    {
+        qWarning("FFTWPlanCache::FFTWPlanCache: cannot initialize FFTW threads");
+        m_nbThreads = 1;
+    }
+#else
+    m_nbThreads = 1;
+#endif
+}
+
+FFTWPlanCache::~FFTWPlanCache()
+{
+    if (m_worker)
+    {
+        m_queueMutex.lock();
+        m_running = false;
+        m_queueCondition.wakeAll();
+        m_queueMutex.unlock();
+        m_worker->wait();
+        delete m_worker;
+    }
+
+    for (auto& entry : m_entries)
+    {
+        fftwf_destroy_plan(entry.second->m_plan.load());
+
+        for (auto plan : entry.second->m_retiredPlans) {
+            fftwf_destroy_plan(plan);
+        }
+
+        delete entry.second;
+    }
+}
+
+const FFTWPlanCache::Entry *FFTWPlanCache::getPlan(int n, bool inverse, const QString& wisdomFileName, unsigned int flags)
+{
+    int nbThreads = getPlanThreads(n);
+    PlanKey key(n, inverse, flags, nbThreads);
+    Entry *entry = findEntry(key);
+
+    if (entry) {
+        return entry;
+    }
+
+    QMutexLocker plannerLock(&m_plannerMutex);
+    entry = findEntry(key); // may have been planned while waiting for the planner
+
+    if (entry) {
+        return entry;
+    }
+
+    importWisdom(wisdomFileName);
+    QElapsedTimer t;
+    t.start();
+    bool backgroundPlanning = m_backgroundPlanning.load() && ((flags & FFTW_ESTIMATE) == 0);
+    fftwf_plan plan = createPlan(n, inverse, flags | FFTW_WISDOM_ONLY, nbThreads);
+    bool optimized = plan != nullptr;
+
+    if (!plan)
+    {
+        plan = createPlan(n, inverse, backgroundPlanning ? FFTW_ESTIMATE : flags, nbThreads);
+        optimized = !backgroundPlanning;
+    }
+
+    entry = new Entry(plan, optimized);
+
+    {
+        QMutexLocker entriesLock(&m_entriesMutex);
+        m_entries[key] = entry;
+    }
+
+    plannerLock.unlock();
+    qDebug("FFTWPlanCache::getPlan: creating FFTW plan (n=%d,%s,flags=%u,threads=%d,%s) took %lld ms",
+        n, inverse ? "inverse" : "forward", flags, nbThreads, optimized ? "optimized" : "estimated", t.elapsed());
+
+    if (!optimized) {
+        queue(key);
+    }
+
+    return entry;
+}
+
+FFTWPlanCache::Entry *FFTWPlanCache::findEntry(const PlanKey& key)
+{
+    QMutexLocker entriesLock(&m_entriesMutex);
+    Entries::iterator it = m_entries.find(key);
+    return it == m_entries.end() ? nullptr : it->second;
+}
+
+void FFTWPlanCache::setThreading(int nbThreads, int minThreadedSize)
+{
+    if (nbThreads <= 0) { // automatic
+        nbThreads = std::max(1, std::min(QThread::idealThreadCount(), 4));
+    }
+
+#ifdef USE_FFTW_THREADS
+    m_nbThreads = nbThreads;
+#else
+    if (nbThreads > 1) {
+        qWarning("FFTWPlanCache::setThreading: FFTW threads library not available");
+    }
+#endif
+    m_minThreadedSize = minThreadedSize;
+    qDebug("FFTWPlanCache::setThreading: %d threads for sizes from %d", m_nbThreads.load(), m_minThreadedSize.load());
+}
+
+void FFTWPlanCache::setBackgroundPlanning(bool backgroundPlanning)
+{
+    m_backgroundPlanning = backgroundPlanning;
+    qDebug("FFTWPlanCache::setBackgroundPlanning: %s", backgroundPlanning ? "on" : "off");
+}
+
+void FFTWPlanCache::waitForBackgroundPlanning()
+{
+    QMutexLocker queueLock(&m_queueMutex);
+
+    while (!m_queue.empty() || m_planning) {
+        m_idleCondition.wait(&m_queueMutex);
+    }
+}
+
+void FFTWPlanCache::importWisdom(const QString& wisdomFileName)
+{
+    // importing is slow and wisdom accumulates so each file is imported once
+    if (wisdomFileName.isEmpty() || m_importedWisdomFiles.contains(wisdomFileName)) {
+        return;
+    }
+
+    m_importedWisdomFiles.insert(wisdomFileName);
+    m_wisdomFileName = wisdomFileName;
+
+    if (fftwf_import_wisdom_from_filename(wisdomFileName.toStdString().c_str()) == 0) { // that's an error (undocumented)
+        qInfo("FFTWPlanCache::importWisdom: importing from FFTW wisdom file: '%s' failed", qPrintable(wisdomFileName));
+    } else {
+        qDebug("FFTWPlanCache::importWisdom: successfully imported from FFTW wisdom file: '%s'", qPrintable(wisdomFileName));
+    }
+}
+
+int FFTWPlanCache::getPlanThreads(int n) const
+{
+    return n >= m_minThreadedSize.load() ? m_nbThreads.load() : 1;
+}
+
+fftwf_plan FFTWPlanCache::createPlan(int n, bool inverse, unsigned int flags, int nbThreads)
+{
+    // Planning buffers only. Plans are executed on the engines buffers which are
+    // allocated with fftwf_malloc hence have the same alignment.
+    fftwf_complex *in = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * n);
+    fftwf_complex *out = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * n);
+#ifdef USE_FFTW_THREADS
+    fftwf_plan_with_nthreads(nbThreads);
+#else
+    (void) nbThreads;
+#endif
+    fftwf_plan plan = fftwf_plan_dft_1d(n, in, out, inverse ? FFTW_BACKWARD : FFTW_FORWARD, flags);
+    fftwf_free(in);
+    fftwf_free(out);
+    return plan;
+}
+
+void FFTWPlanCache::queue(const PlanKey& key)
+{
+    QMutexLocker queueLock(&m_queueMutex);
+    m_queue.push_back(key);
+
+    if (!m_worker)
+    {
+        m_running = true;
+        m_worker = new Worker(this);
+        m_worker->start(QThread::LowPriority);
+    }
+
+    m_queueCondition.wakeAll();
+}
+
+void FFTWPlanCache::runBackgroundPlanning()
+{
+    m_queueMutex.lock();
+
+    while (m_running)
+    {
+        if (m_queue.empty())
+        {
+            m_planning = false;
+            m_idleCondition.wakeAll();
+            m_queueCondition.wait(&m_queueMutex);
+            continue;
+        }
+
+        PlanKey key = m_queue.front();
+        m_queue.pop_front();
+        m_planning = true;
+        m_queueMutex.unlock();
+
+        int n = std::get<0>(key);
+        bool inverse = std::get<1>(key);
+        unsigned int flags = std::get<2>(key);
+        int nbThreads = std::get<3>(key);
+        fftwf_plan plan = nullptr;
+        double planningTime = 0.0;
+        QElapsedTimer t;
+        t.start();
+
+        // Plan in time limited slices releasing the planner in between so that new sizes are not held
+        // up for the whole plan. Sub-problems solved within a slice are kept as wisdom and reused by the next.
+        while (planningTime < m_backgroundTimeLimit)
+        {
+            QMutexLocker plannerLock(&m_plannerMutex);
+
+            if (plan) {
+                fftwf_destroy_plan(plan);
+            }
+
+            QElapsedTimer sliceTimer;
+            sliceTimer.start();
+            fftwf_set_timelimit(m_backgroundSliceTime);
+            plan = createPlan(n, inverse, flags, nbThreads);
+            fftwf_set_timelimit(FFTW_NO_TIMELIMIT);
+            double sliceTime = sliceTimer.nsecsElapsed() / 1e9;
+            planningTime += sliceTime;
+            plannerLock.unlock();
+
+            if (!plan || (sliceTime < m_backgroundSliceTime)) { // completed within the slice
+                break;
+            }
+
+            QThread::yieldCurrentThread();
+        }
+
+        Entry *entry = findEntry(key);
+
+        if (plan && entry)
+        {
+            // engines may be executing the estimated plan so it is only destroyed at exit
+            entry->m_retiredPlans.push_back(entry->m_plan.load());
+            entry->m_plan.store(plan);
+            entry->m_optimized = true;
+        }
+
+        qDebug("FFTWPlanCache::runBackgroundPlanning: FFTW plan (n=%d,%s,flags=%u,threads=%d) took %lld ms",
+            n, inverse ? "inverse" : "forward", flags, nbThreads, t.elapsed());
+
+        m_plannerMutex.lock();
+
+        if (!m_wisdomFileName.isEmpty() && (fftwf_export_wisdom_to_filename(m_wisdomFileName.toStdString().c_str()) == 0)) {
+            qWarning("FFTWPlanCache::runBackgroundPlanning: cannot export FFTW wisdom to '%s'", qPrintable(m_wisdomFileName));
+        }
+
+        m_plannerMutex.unlock();
+        m_queueMutex.lock();
+    }
+
+    m_planning = false;
+    m_idleCondition.wakeAll();
+    m_queueMutex.unlock();
+}
+
+void FFTWPlanCache::Worker::run()
+{
+    m_cache->runBackgroundPlanning();
+}
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Process wide cache of FFTW plans shared by all FFTW engines. Engines execute  //
+// the shared plan on their own buffers (new-array execute) so a size is only    //
+// planned once. Sizes without wisdom get a quick estimated plan at once and     //
+// are planned again in the background, the better plan replacing the first one //
+// when it is ready. Large sizes can be planned multi-threaded. Lookups of sizes //
+// already planned never wait for the planner.                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FFTWPLANCACHE_H_
+#define SDRBASE_DSP_FFTWPLANCACHE_H_
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <QMutex>
+#include <QSet>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+
+#include <fftw3.h>
+
+#include "export.h"
+
+class SDRBASE_API FFTWPlanCache
+{
+public:
+    struct Entry
+    {
+        std::atomic<fftwf_plan> m_plan; //!< current best plan, replaced when the background plan is ready
+        bool m_optimized;               //!< planned patiently or from wisdom
+        std::vector<fftwf_plan> m_retiredPlans; //!< replaced plans that may still be executing
+
+        Entry(fftwf_plan plan, bool optimized) :
+            m_plan(plan),
+            m_optimized(optimized)
+        {}
+    };
+
+    static FFTWPlanCache& instance();
+
+    const Entry *getPlan(int n, bool inverse, const QString& wisdomFileName, unsigned int flags = FFTW_PATIENT); //!< plans on first request for this size, direction, flags and threads
+    void setThreading(int nbThreads, int minThreadedSize); //!< plans of minThreadedSize or more use nbThreads (0: automatic). Applies to new plans
+    void setBackgroundPlanning(bool backgroundPlanning); //!< when false new sizes are planned patiently at once as before
+    void waitForBackgroundPlanning(); //!< return when all queued plans are done
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(FFTWPlanCache *cache) : m_cache(cache) {}
+
+    protected:
+        void run() override;
+
+    private:
+        FFTWPlanCache *m_cache;
+    };
+
+    typedef std::tuple<int, bool, unsigned int, int> PlanKey; //!< size, inverse, planner flags, planner threads
+    typedef std::map<PlanKey, Entry*> Entries;
+
+    Entries m_entries;
+    QMutex m_entriesMutex;      //!< held for lookups and insertions only
+    QSet<QString> m_importedWisdomFiles;
+    QString m_wisdomFileName;   //!< where background plans are saved
+    std::atomic<int> m_nbThreads;
+    std::atomic<int> m_minThreadedSize;
+    std::atomic<bool> m_backgroundPlanning;
+    std::deque<PlanKey> m_queue;
+    bool m_planning;
+    bool m_running;
+    Worker *m_worker;
+    QMutex m_plannerMutex;      //!< FFTW planner is not thread safe. Held while creating or destroying plans
+    QMutex m_queueMutex;
+    QWaitCondition m_queueCondition;
+    QWaitCondition m_idleCondition;
+
+    static const double m_backgroundTimeLimit; //!< seconds allowed for a background plan
+    static const double m_backgroundSliceTime; //!< seconds the background planner holds the planner at once
+
+    FFTWPlanCache();
+    ~FFTWPlanCache();
+    void importWisdom(const QString& wisdomFileName);
+    int getPlanThreads(int n) const;
+    fftwf_plan createPlan(int n, bool inverse, unsigned int flags, int nbThreads);
+    Entry *findEntry(const PlanKey& key);
+    void queue(const PlanKey& key);
+    void runBackgroundPlanning();
+};
+
+#endif // SDRBASE_DSP_FFTWPLANCACHE_H_
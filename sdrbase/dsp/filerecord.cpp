@@ -35,7 +35,8 @@ FileRecord::FileRecord(quint32 sampleRate, quint64 centerFrequency) :
 	m_recordOn(false),
     m_recordStart(false),
     m_byteCount(0),
-    m_msShift(0)
+    m_msShift(0),
+    m_directIO(false)
 {
 	setObjectName("FileRecord");
 }
@@ -47,7 +48,9 @@ FileRecord::FileRecord(const QString& fileBase) :
     m_centerFrequency(0),
     m_recordOn(false),
     m_recordStart(false),
-    m_byteCount(0)
+    m_byteCount(0),
+    m_msShift(0),
+    m_directIO(false)
 {
     setObjectName("FileRecord");
 }
@@ -92,8 +95,9 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
             m_recordStart = false;
         }
 
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
-        m_byteCount += end - begin;
+        // samples are queued to the writer thread. They are dropped if the disk cannot keep up
+        qint64 written = m_sampleWriter.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        m_byteCount += written / sizeof(Sample);
     }
 }
 
@@ -114,12 +118,11 @@ bool FileRecord::startRecording()
         stopRecording();
     }
 
-    if (!m_sampleFile.is_open())
+    if (!m_sampleWriter.isOpen())
     {
     	qDebug() << "FileRecord::startRecording";
         m_curentFileName = QString("%1.%2.sdriq").arg(m_fileBase).arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz"));
-        m_sampleFile.open(m_curentFileName.toStdString().c_str(), std::ios::binary);
-        if (!m_sampleFile.is_open())
+        if (!m_sampleWriter.open(m_curentFileName, false, m_directIO))
         {
             qWarning() << "FileRecord::startRecording: failed to open file: " << m_curentFileName;
             return false;
@@ -135,17 +138,24 @@ bool FileRecord::stopRecording()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
-    if (m_sampleFile.is_open())
+    if (m_sampleWriter.isOpen())
     {
     	qDebug() << "FileRecord::stopRecording";
-        m_sampleFile.close();
+        m_sampleWriter.close();
         m_recordOn = false;
         m_recordStart = false;
-        if (m_sampleFile.bad())
+        FileRecordWriter::Stats stats;
+        m_sampleWriter.getStats(stats);
+        if (stats.m_error)
         {
             qWarning() << "FileRecord::stopRecording: an error occurred while writing to " << m_curentFileName;
             return false;
         }
+        if (stats.m_droppedBytes != 0)
+        {
+            qWarning() << "FileRecord::stopRecording: " << stats.m_droppedBytes / sizeof(Sample)
+                << " samples dropped while writing to " << m_curentFileName;
+        }
     }
     return true;
 }
@@ -185,22 +195,25 @@ void FileRecord::writeHeader()
     header.startTimeStamp = (quint64)(ts + m_msShift);
     header.sampleSize = SDR_RX_SAMP_SZ;
     header.filler = 0;
+    header.crc32 = getHeaderCRC(header);
+    m_sampleWriter.write((const char *) &header, sizeof(Header));
+}
 
-    writeHeader(m_sampleFile, header);
+quint32 FileRecord::getHeaderCRC(const Header& header)
+{
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, 28);
+    return crc32.checksum();
 }
 
 bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
 {
     sampleFile.read((char *) &header, sizeof(Header));
-    boost::crc_32_type crc32;
-    crc32.process_bytes(&header, 28);
-    return header.crc32 == crc32.checksum();
+    return header.crc32 == getHeaderCRC(header);
 }
 
 void FileRecord::writeHeader(std::ofstream& sampleFile, Header& header)
 {
-    boost::crc_32_type crc32;
-    crc32.process_bytes(&header, 28);
-    header.crc32 = crc32.checksum();
+    header.crc32 = getHeaderCRC(header);
     sampleFile.write((const char *) &header, sizeof(Header));
 }
@@ -25,6 +25,7 @@
 #include <ctime>
 
 #include "dsp/filerecordinterface.h"
+#include "dsp/filerecordwriter.h"
 #include "export.h"
 
 class Message;
@@ -51,6 +52,8 @@ public:
     quint64 getByteCount() const { return m_byteCount; }
     void setMsShift(qint64 shift) { m_msShift = shift; }
     const QString& getCurrentFileName() { return m_curentFileName; }
+    virtual void setDirectIO(bool directIO) { m_directIO = directIO; } //!< Bypass page cache on next recording (Linux only)
+    virtual bool getWriterStats(FileRecordWriter::Stats& stats) { m_sampleWriter.getStats(stats); return true; }
 
     void genUniqueFileName(uint deviceUID, int istream = -1);
 
@@ -73,13 +76,15 @@ private:
 	quint64 m_centerFrequency;
 	bool m_recordOn;
     bool m_recordStart;
-    std::ofstream m_sampleFile;
+    FileRecordWriter m_sampleWriter;
     QString m_curentFileName;
     quint64 m_byteCount;
     qint64 m_msShift;
+    bool m_directIO;
     QRecursiveMutex m_mutex;
 
     void writeHeader();
+    static quint32 getHeaderCRC(const Header& header); //!< CRC32 of the header fields preceding the checksum
 };
 
 #endif // INCLUDE_FILERECORD_H
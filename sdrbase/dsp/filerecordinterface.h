@@ -26,6 +26,7 @@
 #include "dsp/dsptypes.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "dsp/filerecordwriter.h"
 #include "export.h"
 
 class SDRBASE_API FileRecordInterface : public QObject {
@@ -59,6 +60,8 @@ public:
 
     virtual void setMsShift(qint64 msShift) = 0;
     virtual int getBytesPerSample() { return sizeof(Sample); };
+    virtual void setDirectIO(bool directIO) { (void) directIO; } //!< Bypass page cache when supported
+    virtual bool getWriterStats(FileRecordWriter::Stats& stats) { (void) stats; return false; } //!< False if not written asynchronously
 
     static QString genUniqueFileName(unsigned int deviceUID, int istream = -1);
     static RecordType guessTypeFromFileName(const QString& fileName, QString& fileBase);
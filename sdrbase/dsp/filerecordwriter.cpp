@@ -0,0 +1,362 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "filerecordwriter.h"
+
+static const unsigned int directIOAlignment = 4096;
+static const quint64 preallocateStep = 256*1024*1024;
+
+FileRecordWriter::FileRecordWriter(unsigned int bufferSize, unsigned int nbBuffers) :
+    m_bufferSize(((std::max(bufferSize, directIOAlignment) + directIOAlignment - 1) / directIOAlignment) * directIOAlignment),
+    m_buffers(std::max(nbBuffers, 2U)),
+    m_bufferFill(std::max(nbBuffers, 2U), 0),
+    m_currentBuffer(-1),
+    m_fd(-1),
+    m_position(0),
+    m_filePosition(0),
+    m_preallocatedPosition(0),
+    m_directIO(false),
+    m_preallocate(false),
+    m_running(false),
+    m_busy(false),
+    m_stallThresholdNs(100000000)
+{
+    setObjectName("FileRecordWriter");
+}
+
+FileRecordWriter::~FileRecordWriter()
+{
+    close();
+}
+
+bool FileRecordWriter::open(const QString& fileName, bool append, bool directIO, bool preallocate)
+{
+    close();
+
+#ifdef _WIN32
+    int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (append ? 0 : _O_TRUNC);
+    m_fd = _wopen(fileName.toStdWString().c_str(), flags, _S_IREAD | _S_IWRITE);
+    directIO = false;
+#else
+    int flags = O_WRONLY | O_CREAT | (append ? 0 : O_TRUNC);
+#ifdef O_DIRECT
+    if (directIO) {
+        flags |= O_DIRECT;
+    }
+#else
+    directIO = false;
+#endif
+    m_fd = ::open(fileName.toStdString().c_str(), flags, 0644);
+
+    if ((m_fd < 0) && directIO)
+    {
+        qDebug("FileRecordWriter::open: %s: direct I/O not supported: %s", qPrintable(fileName), strerror(errno));
+        directIO = false;
+        m_fd = ::open(fileName.toStdString().c_str(), flags & ~O_DIRECT, 0644);
+    }
+#endif
+
+    if (m_fd < 0)
+    {
+        qWarning("FileRecordWriter::open: cannot open %s: %s", qPrintable(fileName), strerror(errno));
+        return false;
+    }
+
+#ifdef _WIN32
+    qint64 position = append ? _lseeki64(m_fd, 0, SEEK_END) : 0;
+#else
+    qint64 position = append ? ::lseek(m_fd, 0, SEEK_END) : 0;
+#endif
+    m_fileName = fileName;
+    m_position = position < 0 ? 0 : position;
+    m_filePosition = m_position;
+    m_preallocatedPosition = m_position;
+    m_directIO = directIO;
+    m_preallocate = preallocate;
+    m_currentBuffer = -1;
+    m_stats = Stats();
+    m_freeBuffers.clear();
+    m_pendingBuffers.clear();
+
+    if (m_directIO && (m_filePosition % directIOAlignment != 0)) {
+        disableDirectIO();
+    }
+
+    for (unsigned int i = 0; i < m_buffers.size(); i++)
+    {
+        m_buffers[i].resize(m_bufferSize);
+        m_bufferFill[i] = 0;
+        m_freeBuffers.push_back(i);
+    }
+
+    qDebug("FileRecordWriter::open: %s: %u buffers of %u bytes directIO: %s preallocate: %s",
+        qPrintable(fileName), (unsigned int) m_buffers.size(), m_bufferSize,
+        m_directIO ? "on" : "off", m_preallocate ? "on" : "off");
+    m_running = true;
+    start(QThread::HighPriority);
+    return true;
+}
+
+void FileRecordWriter::close()
+{
+    if (m_fd < 0) {
+        return;
+    }
+
+    flush();
+    m_mutex.lock();
+    m_running = false;
+    m_dataCondition.wakeOne();
+    m_mutex.unlock();
+    wait();
+
+#ifdef _WIN32
+    _close(m_fd);
+#else
+    ::close(m_fd);
+#endif
+    m_fd = -1;
+
+    // release buffer memory while not recording
+    for (auto& buffer : m_buffers) {
+        Buffer().swap(buffer);
+    }
+
+    if (m_stats.m_droppedBytes != 0 || m_stats.m_writeStalls != 0 || m_stats.m_error)
+    {
+        qWarning("FileRecordWriter::close: %s: written: %llu dropped: %llu bytes stalls: %llu max write: %lld ms%s",
+            qPrintable(m_fileName), m_stats.m_bytesWritten, m_stats.m_droppedBytes, m_stats.m_writeStalls,
+            m_stats.m_maxWriteNs / 1000000, m_stats.m_error ? " write error" : "");
+    }
+    else
+    {
+        qDebug("FileRecordWriter::close: %s: written: %llu bytes max write: %lld ms max pending buffers: %u",
+            qPrintable(m_fileName), m_stats.m_bytesWritten, m_stats.m_maxWriteNs / 1000000, m_stats.m_maxPendingBuffers);
+    }
+}
+
+qint64 FileRecordWriter::write(const char *data, qint64 size)
+{
+    if (m_fd < 0) {
+        return 0;
+    }
+
+    qint64 accepted = 0;
+
+    while (size > 0)
+    {
+        if (m_currentBuffer < 0)
+        {
+            QMutexLocker mutexLocker(&m_mutex);
+
+            if (m_stats.m_error || m_freeBuffers.empty())
+            {
+                m_stats.m_droppedBytes += size;
+                break;
+            }
+
+            m_currentBuffer = m_freeBuffers.front();
+            m_freeBuffers.pop_front();
+            m_bufferFill[m_currentBuffer] = 0;
+        }
+
+        unsigned int& fill = m_bufferFill[m_currentBuffer];
+        qint64 count = std::min(size, (qint64) (m_bufferSize - fill));
+        std::copy(data, data + count, m_buffers[m_currentBuffer].data() + fill);
+        fill += count;
+        data += count;
+        size -= count;
+        accepted += count;
+
+        if (fill == m_bufferSize) {
+            queueCurrentBuffer();
+        }
+    }
+
+    m_position += accepted;
+    return accepted;
+}
+
+void FileRecordWriter::flush()
+{
+    if (m_fd < 0) {
+        return;
+    }
+
+    if ((m_currentBuffer >= 0) && (m_bufferFill[m_currentBuffer] != 0)) {
+        queueCurrentBuffer();
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (!m_pendingBuffers.empty() || m_busy) {
+        m_idleCondition.wait(&m_mutex);
+    }
+}
+
+void FileRecordWriter::getStats(Stats& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    stats = m_stats;
+}
+
+void FileRecordWriter::queueCurrentBuffer()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_pendingBuffers.push_back(m_currentBuffer);
+    m_stats.m_maxPendingBuffers = std::max(m_stats.m_maxPendingBuffers, (unsigned int) m_pendingBuffers.size());
+    m_currentBuffer = -1;
+    m_dataCondition.wakeOne();
+}
+
+void FileRecordWriter::run()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (true)
+    {
+        while (m_running && m_pendingBuffers.empty()) {
+            m_dataCondition.wait(&m_mutex);
+        }
+
+        if (m_pendingBuffers.empty()) {
+            break;
+        }
+
+        unsigned int index = m_pendingBuffers.front();
+        m_pendingBuffers.pop_front();
+        bool error = m_stats.m_error;
+        m_busy = true;
+        mutexLocker.unlock();
+
+        // the disk write is done without holding the lock so the producer can keep filling buffers
+        QElapsedTimer timer;
+        timer.start();
+        bool success = error || writeBuffer(index);
+        qint64 nsecs = timer.nsecsElapsed();
+
+        mutexLocker.relock();
+
+        if (!error)
+        {
+            if (success) {
+                m_stats.m_bytesWritten += m_bufferFill[index];
+            } else {
+                m_stats.m_error = true;
+            }
+
+            if (nsecs > m_stallThresholdNs) {
+                m_stats.m_writeStalls++;
+            }
+
+            m_stats.m_maxWriteNs = std::max(m_stats.m_maxWriteNs, nsecs);
+        }
+
+        m_bufferFill[index] = 0;
+        m_freeBuffers.push_back(index);
+        m_busy = false;
+
+        if (m_pendingBuffers.empty()) {
+            m_idleCondition.wakeAll();
+        }
+    }
+}
+
+bool FileRecordWriter::writeBuffer(unsigned int index)
+{
+    unsigned int size = m_bufferFill[index];
+    const char *data = m_buffers[index].data();
+
+    // O_DIRECT requires aligned sizes and offsets. Once a partial buffer is written the
+    // following offsets are not aligned anymore so direct I/O stays off for this file.
+    if (m_directIO && (size % directIOAlignment != 0)) {
+        disableDirectIO();
+    }
+
+    if (m_preallocate && (m_filePosition + size > m_preallocatedPosition)) {
+        preallocate(m_filePosition + size + preallocateStep);
+    }
+
+    while (size > 0)
+    {
+#ifdef _WIN32
+        int written = _write(m_fd, data, size);
+#else
+        ssize_t written = ::write(m_fd, data, size);
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            qWarning("FileRecordWriter::writeBuffer: %s: %s", qPrintable(m_fileName), strerror(errno));
+            return false;
+        }
+
+        data += written;
+        size -= written;
+        m_filePosition += written;
+    }
+
+    return true;
+}
+
+void FileRecordWriter::preallocate(quint64 end)
+{
+#if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+    // keep size so that the file does not need to be truncated to its actual length on close
+    if (fallocate(m_fd, FALLOC_FL_KEEP_SIZE, m_preallocatedPosition, end - m_preallocatedPosition) == 0)
+    {
+        m_preallocatedPosition = end;
+        return;
+    }
+
+    qDebug("FileRecordWriter::preallocate: %s: %s", qPrintable(m_fileName), strerror(errno));
+#else
+    (void) end;
+#endif
+    m_preallocate = false;
+}
+
+void FileRecordWriter::disableDirectIO()
+{
+#if !defined(_WIN32) && defined(O_DIRECT)
+    int flags = fcntl(m_fd, F_GETFL);
+
+    if (flags >= 0) {
+        fcntl(m_fd, F_SETFL, flags & ~O_DIRECT);
+    }
+#endif
+    m_directIO = false;
+}
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Asynchronous sample file writer. The DSP thread copies samples into large     //
+// aligned buffers and a dedicated thread writes full buffers to disk so that    //
+// disk latency does not block the sample flow. When all buffers are waiting     //
+// to be written incoming data is dropped and counted.                           //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FILERECORDWRITER_H_
+#define SDRBASE_DSP_FILERECORDWRITER_H_
+
+#include <deque>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QString>
+
+#include "util/alignedallocator.h"
+#include "export.h"
+
+class SDRBASE_API FileRecordWriter : public QThread
+{
+public:
+    struct Stats
+    {
+        quint64 m_bytesWritten;   //!< bytes written to disk
+        quint64 m_droppedBytes;   //!< bytes dropped because all buffers were waiting to be written
+        quint64 m_writeStalls;    //!< number of writes that took longer than the stall threshold
+        qint64 m_maxWriteNs;      //!< longest single buffer write
+        unsigned int m_maxPendingBuffers; //!< highest number of buffers waiting to be written
+        bool m_error;             //!< a write failed. Recording to this file stopped
+
+        Stats() :
+            m_bytesWritten(0),
+            m_droppedBytes(0),
+            m_writeStalls(0),
+            m_maxWriteNs(0),
+            m_maxPendingBuffers(0),
+            m_error(false)
+        {}
+    };
+
+    static const unsigned int m_defaultBufferSize = 8*1024*1024;
+    static const unsigned int m_defaultNbBuffers = 8;
+
+    FileRecordWriter(unsigned int bufferSize = m_defaultBufferSize, unsigned int nbBuffers = m_defaultNbBuffers);
+    ~FileRecordWriter();
+
+    /** Open file and start the writer thread.
+     *  With directIO set the file is opened with O_DIRECT on Linux. The page cache is bypassed
+     *  as long as writes stay aligned. A partial buffer write (flush or close) reverts to normal I/O.
+     *  With preallocate set disk space is reserved ahead of the write position on Linux
+     *  (fallocate with FALLOC_FL_KEEP_SIZE) to limit fragmentation and metadata updates.
+     */
+    bool open(const QString& fileName, bool append = false, bool directIO = false, bool preallocate = true);
+    void close();  //!< Write pending data, stop the writer thread and close the file
+    bool isOpen() const { return m_fd >= 0; }
+    /** Queue data for writing. Only called from one thread. Returns the number of bytes accepted.
+     *  Data that does not fit in the free buffers is dropped.
+     */
+    qint64 write(const char *data, qint64 size);
+    void flush();  //!< Write pending data and wait until it is on its way to disk
+    quint64 getPosition() const { return m_position; } //!< Position in file of next accepted byte
+    void getStats(Stats& stats);
+    void setStallThreshold(qint64 ns) { m_stallThresholdNs = ns; }
+
+protected:
+    void run() override;
+
+private:
+    typedef std::vector<char, AlignedAllocator<char, 4096>> Buffer;
+
+    unsigned int m_bufferSize;
+    std::vector<Buffer> m_buffers;
+    std::vector<unsigned int> m_bufferFill;
+    std::deque<unsigned int> m_freeBuffers;
+    std::deque<unsigned int> m_pendingBuffers;
+    int m_currentBuffer;   //!< buffer being filled by the producer or -1
+    int m_fd;
+    QString m_fileName;
+    quint64 m_position;    //!< producer side file position
+    quint64 m_filePosition;        //!< writer side file position
+    quint64 m_preallocatedPosition;
+    bool m_directIO;
+    bool m_preallocate;
+    bool m_running;
+    bool m_busy;
+    qint64 m_stallThresholdNs;
+    Stats m_stats;
+    QMutex m_mutex;
+    QWaitCondition m_dataCondition;
+    QWaitCondition m_idleCondition;
+
+    void queueCurrentBuffer();
+    bool writeBuffer(unsigned int index);
+    void preallocate(quint64 end);
+    void disableDirectIO();
+};
+
+#endif // SDRBASE_DSP_FILERECORDWRITER_H_
@@ -0,0 +1,573 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "halfbandkernels.h"
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_x86) || defined(__x86_64__) || defined(__i386__) || defined(_M_AMD64) || defined(_M_IX86)
+#define HBK_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define HBK_TARGET(isa) // MSVC allows any intrinsic without a specific compiler flag
+#else
+#define HBK_TARGET(isa) __attribute__((target(isa)))
+#endif
+#elif defined(ARCHITECTURE_ARM64) || defined(__aarch64__) || defined(USE_ARM_NEON) || defined(__ARM_NEON)
+#define HBK_NEON
+#include <arm_neon.h>
+#endif
+
+// ==== Scalar ====
+
+template<typename T>
+static void symmetricFIRScalar(const T *bufI, const T *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    qint64 i = 0;
+    qint64 q = 0;
+
+    for (int k = 0; k < nbCoeffs; k++)
+    {
+        i += ((qint64) (bufI[tip - k] + bufI[tail + k])) * coeffs[k];
+        q += ((qint64) (bufQ[tip - k] + bufQ[tail + k])) * coeffs[k];
+    }
+
+    iAcc = i;
+    qAcc = q;
+}
+
+static void symmetricFIRFScalar(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc)
+{
+    float i = 0.0f;
+    float q = 0.0f;
+
+    for (int k = 0; k < nbCoeffs; k++)
+    {
+        i += (bufI[tip - k] + bufI[tail + k]) * coeffs[k];
+        q += (bufQ[tip - k] + bufQ[tail + k]) * coeffs[k];
+    }
+
+    iAcc = i;
+    qAcc = q;
+}
+
+#if defined(HBK_X86)
+
+// ==== SSE4.1 ====
+
+HBK_TARGET("sse4.1")
+static inline qint64 hsum64SSE41(__m128i v)
+{
+    qint64 t[2];
+    _mm_storeu_si128((__m128i*) t, v);
+    return t[0] + t[1];
+}
+
+HBK_TARGET("sse4.1")
+static void symmetricFIR32SSE41(const qint32 *bufI, const qint32 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    __m128i accI = _mm_setzero_si128();
+    __m128i accQ = _mm_setzero_si128();
+    int k = 0;
+
+    for (; k + 4 <= nbCoeffs; k += 4)
+    {
+        __m128i c = _mm_loadu_si128((const __m128i*) &coeffs[k]);
+        __m128i cOdd = _mm_srli_epi64(c, 32);
+        __m128i s = _mm_add_epi32(
+            _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &bufI[tip - k - 3]), _MM_SHUFFLE(0,1,2,3)),
+            _mm_loadu_si128((const __m128i*) &bufI[tail + k]));
+        accI = _mm_add_epi64(accI, _mm_mul_epi32(s, c));
+        accI = _mm_add_epi64(accI, _mm_mul_epi32(_mm_srli_epi64(s, 32), cOdd));
+        s = _mm_add_epi32(
+            _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &bufQ[tip - k - 3]), _MM_SHUFFLE(0,1,2,3)),
+            _mm_loadu_si128((const __m128i*) &bufQ[tail + k]));
+        accQ = _mm_add_epi64(accQ, _mm_mul_epi32(s, c));
+        accQ = _mm_add_epi64(accQ, _mm_mul_epi32(_mm_srli_epi64(s, 32), cOdd));
+    }
+
+    qint64 i, q;
+    symmetricFIRScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = hsum64SSE41(accI) + i;
+    qAcc = hsum64SSE41(accQ) + q;
+}
+
+HBK_TARGET("sse4.1")
+static void symmetricFIR64SSE41(const qint64 *bufI, const qint64 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    __m128i accI = _mm_setzero_si128();
+    __m128i accQ = _mm_setzero_si128();
+    int k = 0;
+
+    for (; k + 2 <= nbCoeffs; k += 2)
+    {
+        __m128i c = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i*) &coeffs[k]));
+        __m128i s = _mm_add_epi64(
+            _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &bufI[tip - k - 1]), _MM_SHUFFLE(1,0,3,2)),
+            _mm_loadu_si128((const __m128i*) &bufI[tail + k]));
+        accI = _mm_add_epi64(accI, _mm_mul_epi32(s, c));
+        s = _mm_add_epi64(
+            _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &bufQ[tip - k - 1]), _MM_SHUFFLE(1,0,3,2)),
+            _mm_loadu_si128((const __m128i*) &bufQ[tail + k]));
+        accQ = _mm_add_epi64(accQ, _mm_mul_epi32(s, c));
+    }
+
+    qint64 i, q;
+    symmetricFIRScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = hsum64SSE41(accI) + i;
+    qAcc = hsum64SSE41(accQ) + q;
+}
+
+HBK_TARGET("sse4.1")
+static inline float hsumSSE41(__m128 v)
+{
+    float t[4];
+    _mm_storeu_ps(t, v);
+    return (t[0] + t[1]) + (t[2] + t[3]);
+}
+
+HBK_TARGET("sse4.1")
+static void symmetricFIRFSSE41(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc)
+{
+    __m128 accI = _mm_setzero_ps();
+    __m128 accQ = _mm_setzero_ps();
+    int k = 0;
+
+    for (; k + 4 <= nbCoeffs; k += 4)
+    {
+        __m128 c = _mm_loadu_ps(&coeffs[k]);
+        __m128 t = _mm_loadu_ps(&bufI[tip - k - 3]);
+        __m128 s = _mm_add_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(0,1,2,3)), _mm_loadu_ps(&bufI[tail + k]));
+        accI = _mm_add_ps(accI, _mm_mul_ps(s, c));
+        t = _mm_loadu_ps(&bufQ[tip - k - 3]);
+        s = _mm_add_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(0,1,2,3)), _mm_loadu_ps(&bufQ[tail + k]));
+        accQ = _mm_add_ps(accQ, _mm_mul_ps(s, c));
+    }
+
+    float i, q;
+    symmetricFIRFScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = hsumSSE41(accI) + i;
+    qAcc = hsumSSE41(accQ) + q;
+}
+
+// ==== AVX2 ====
+
+HBK_TARGET("avx2")
+static inline qint64 hsum64AVX2(__m256i v)
+{
+    qint64 t[4];
+    _mm256_storeu_si256((__m256i*) t, v);
+    return (t[0] + t[1]) + (t[2] + t[3]);
+}
+
+HBK_TARGET("avx2")
+static void symmetricFIR32AVX2(const qint32 *bufI, const qint32 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i accI = _mm256_setzero_si256();
+    __m256i accQ = _mm256_setzero_si256();
+    int k = 0;
+
+    for (; k + 8 <= nbCoeffs; k += 8)
+    {
+        // 32x32 -> 64 bit products of even lanes then of odd lanes
+        __m256i c = _mm256_loadu_si256((const __m256i*) &coeffs[k]);
+        __m256i cOdd = _mm256_srli_epi64(c, 32);
+        __m256i s = _mm256_add_epi32(
+            _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) &bufI[tip - k - 7]), reverse),
+            _mm256_loadu_si256((const __m256i*) &bufI[tail + k]));
+        accI = _mm256_add_epi64(accI, _mm256_mul_epi32(s, c));
+        accI = _mm256_add_epi64(accI, _mm256_mul_epi32(_mm256_srli_epi64(s, 32), cOdd));
+        s = _mm256_add_epi32(
+            _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) &bufQ[tip - k - 7]), reverse),
+            _mm256_loadu_si256((const __m256i*) &bufQ[tail + k]));
+        accQ = _mm256_add_epi64(accQ, _mm256_mul_epi32(s, c));
+        accQ = _mm256_add_epi64(accQ, _mm256_mul_epi32(_mm256_srli_epi64(s, 32), cOdd));
+    }
+
+    qint64 i, q;
+    symmetricFIRScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = hsum64AVX2(accI) + i;
+    qAcc = hsum64AVX2(accQ) + q;
+}
+
+HBK_TARGET("avx2")
+static void symmetricFIR64AVX2(const qint64 *bufI, const qint64 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    __m256i accI = _mm256_setzero_si256();
+    __m256i accQ = _mm256_setzero_si256();
+    int k = 0;
+
+    for (; k + 4 <= nbCoeffs; k += 4)
+    {
+        __m256i c = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) &coeffs[k]));
+        __m256i s = _mm256_add_epi64(
+            _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*) &bufI[tip - k - 3]), _MM_SHUFFLE(0,1,2,3)),
+            _mm256_loadu_si256((const __m256i*) &bufI[tail + k]));
+        accI = _mm256_add_epi64(accI, _mm256_mul_epi32(s, c));
+        s = _mm256_add_epi64(
+            _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*) &bufQ[tip - k - 3]), _MM_SHUFFLE(0,1,2,3)),
+            _mm256_loadu_si256((const __m256i*) &bufQ[tail + k]));
+        accQ = _mm256_add_epi64(accQ, _mm256_mul_epi32(s, c));
+    }
+
+    qint64 i, q;
+    symmetricFIRScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = hsum64AVX2(accI) + i;
+    qAcc = hsum64AVX2(accQ) + q;
+}
+
+HBK_TARGET("avx2,fma")
+static inline float hsumAVX2(__m256 v)
+{
+    float t[8];
+    _mm256_storeu_ps(t, v);
+    return ((t[0] + t[1]) + (t[2] + t[3])) + ((t[4] + t[5]) + (t[6] + t[7]));
+}
+
+HBK_TARGET("avx2,fma")
+static void symmetricFIRFAVX2(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc)
+{
+    const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256 accI = _mm256_setzero_ps();
+    __m256 accQ = _mm256_setzero_ps();
+    int k = 0;
+
+    for (; k + 8 <= nbCoeffs; k += 8)
+    {
+        __m256 c = _mm256_loadu_ps(&coeffs[k]);
+        __m256 s = _mm256_add_ps(
+            _mm256_permutevar8x32_ps(_mm256_loadu_ps(&bufI[tip - k - 7]), reverse),
+            _mm256_loadu_ps(&bufI[tail + k]));
+        accI = _mm256_fmadd_ps(s, c, accI);
+        s = _mm256_add_ps(
+            _mm256_permutevar8x32_ps(_mm256_loadu_ps(&bufQ[tip - k - 7]), reverse),
+            _mm256_loadu_ps(&bufQ[tail + k]));
+        accQ = _mm256_fmadd_ps(s, c, accQ);
+    }
+
+    float i, q;
+    symmetricFIRFScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = hsumAVX2(accI) + i;
+    qAcc = hsumAVX2(accQ) + q;
+}
+
+// ==== AVX-512 ====
+
+HBK_TARGET("avx512f")
+static void symmetricFIR32AVX512(const qint32 *bufI, const qint32 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    const __m512i reverse = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512i accI = _mm512_setzero_si512();
+    __m512i accQ = _mm512_setzero_si512();
+    int k = 0;
+
+    for (; k + 16 <= nbCoeffs; k += 16)
+    {
+        __m512i c = _mm512_loadu_si512((const void*) &coeffs[k]);
+        __m512i cOdd = _mm512_srli_epi64(c, 32);
+        __m512i s = _mm512_add_epi32(
+            _mm512_permutexvar_epi32(reverse, _mm512_loadu_si512((const void*) &bufI[tip - k - 15])),
+            _mm512_loadu_si512((const void*) &bufI[tail + k]));
+        accI = _mm512_add_epi64(accI, _mm512_mul_epi32(s, c));
+        accI = _mm512_add_epi64(accI, _mm512_mul_epi32(_mm512_srli_epi64(s, 32), cOdd));
+        s = _mm512_add_epi32(
+            _mm512_permutexvar_epi32(reverse, _mm512_loadu_si512((const void*) &bufQ[tip - k - 15])),
+            _mm512_loadu_si512((const void*) &bufQ[tail + k]));
+        accQ = _mm512_add_epi64(accQ, _mm512_mul_epi32(s, c));
+        accQ = _mm512_add_epi64(accQ, _mm512_mul_epi32(_mm512_srli_epi64(s, 32), cOdd));
+    }
+
+    qint64 i, q;
+    symmetricFIR32AVX2(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q); // AVX-512F implies AVX2 on all CPUs
+    iAcc = _mm512_reduce_add_epi64(accI) + i;
+    qAcc = _mm512_reduce_add_epi64(accQ) + q;
+}
+
+HBK_TARGET("avx512f")
+static void symmetricFIR64AVX512(const qint64 *bufI, const qint64 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    const __m512i reverse = _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+    __m512i accI = _mm512_setzero_si512();
+    __m512i accQ = _mm512_setzero_si512();
+    int k = 0;
+
+    for (; k + 8 <= nbCoeffs; k += 8)
+    {
+        __m512i c = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*) &coeffs[k]));
+        __m512i s = _mm512_add_epi64(
+            _mm512_permutexvar_epi64(reverse, _mm512_loadu_si512((const void*) &bufI[tip - k - 7])),
+            _mm512_loadu_si512((const void*) &bufI[tail + k]));
+        accI = _mm512_add_epi64(accI, _mm512_mul_epi32(s, c));
+        s = _mm512_add_epi64(
+            _mm512_permutexvar_epi64(reverse, _mm512_loadu_si512((const void*) &bufQ[tip - k - 7])),
+            _mm512_loadu_si512((const void*) &bufQ[tail + k]));
+        accQ = _mm512_add_epi64(accQ, _mm512_mul_epi32(s, c));
+    }
+
+    qint64 i, q;
+    symmetricFIR64AVX2(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = _mm512_reduce_add_epi64(accI) + i;
+    qAcc = _mm512_reduce_add_epi64(accQ) + q;
+}
+
+HBK_TARGET("avx512f")
+static void symmetricFIRFAVX512(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc)
+{
+    const __m512i reverse = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512 accI = _mm512_setzero_ps();
+    __m512 accQ = _mm512_setzero_ps();
+    int k = 0;
+
+    for (; k + 16 <= nbCoeffs; k += 16)
+    {
+        __m512 c = _mm512_loadu_ps(&coeffs[k]);
+        __m512 s = _mm512_add_ps(
+            _mm512_permutexvar_ps(reverse, _mm512_loadu_ps(&bufI[tip - k - 15])),
+            _mm512_loadu_ps(&bufI[tail + k]));
+        accI = _mm512_fmadd_ps(s, c, accI);
+        s = _mm512_add_ps(
+            _mm512_permutexvar_ps(reverse, _mm512_loadu_ps(&bufQ[tip - k - 15])),
+            _mm512_loadu_ps(&bufQ[tail + k]));
+        accQ = _mm512_fmadd_ps(s, c, accQ);
+    }
+
+    float i, q;
+    symmetricFIRFAVX2(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = _mm512_reduce_add_ps(accI) + i;
+    qAcc = _mm512_reduce_add_ps(accQ) + q;
+}
+
+#endif // HBK_X86
+
+#if defined(HBK_NEON)
+
+// ==== NEON ====
+
+static inline int32x4_t reverseNEON(int32x4_t v)
+{
+    v = vrev64q_s32(v);
+    return vcombine_s32(vget_high_s32(v), vget_low_s32(v));
+}
+
+static void symmetricFIR32NEON(const qint32 *bufI, const qint32 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    int64x2_t accI = vdupq_n_s64(0);
+    int64x2_t accQ = vdupq_n_s64(0);
+    int k = 0;
+
+    for (; k + 4 <= nbCoeffs; k += 4)
+    {
+        int32x4_t c = vld1q_s32(&coeffs[k]);
+        int32x4_t s = vaddq_s32(reverseNEON(vld1q_s32(&bufI[tip - k - 3])), vld1q_s32(&bufI[tail + k]));
+        accI = vmlal_s32(accI, vget_low_s32(s), vget_low_s32(c));
+        accI = vmlal_s32(accI, vget_high_s32(s), vget_high_s32(c));
+        s = vaddq_s32(reverseNEON(vld1q_s32(&bufQ[tip - k - 3])), vld1q_s32(&bufQ[tail + k]));
+        accQ = vmlal_s32(accQ, vget_low_s32(s), vget_low_s32(c));
+        accQ = vmlal_s32(accQ, vget_high_s32(s), vget_high_s32(c));
+    }
+
+    qint64 i, q;
+    symmetricFIRScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = vgetq_lane_s64(accI, 0) + vgetq_lane_s64(accI, 1) + i;
+    qAcc = vgetq_lane_s64(accQ, 0) + vgetq_lane_s64(accQ, 1) + q;
+}
+
+static void symmetricFIR64NEON(const qint64 *bufI, const qint64 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc)
+{
+    int64x2_t accI = vdupq_n_s64(0);
+    int64x2_t accQ = vdupq_n_s64(0);
+    int k = 0;
+
+    for (; k + 2 <= nbCoeffs; k += 2)
+    {
+        int32x2_t c = vld1_s32(&coeffs[k]);
+        int64x2_t t = vld1q_s64((const int64_t*) &bufI[tip - k - 1]);
+        int64x2_t s = vaddq_s64(vcombine_s64(vget_high_s64(t), vget_low_s64(t)), vld1q_s64((const int64_t*) &bufI[tail + k]));
+        accI = vmlal_s32(accI, vmovn_s64(s), c);
+        t = vld1q_s64((const int64_t*) &bufQ[tip - k - 1]);
+        s = vaddq_s64(vcombine_s64(vget_high_s64(t), vget_low_s64(t)), vld1q_s64((const int64_t*) &bufQ[tail + k]));
+        accQ = vmlal_s32(accQ, vmovn_s64(s), c);
+    }
+
+    qint64 i, q;
+    symmetricFIRScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = vgetq_lane_s64(accI, 0) + vgetq_lane_s64(accI, 1) + i;
+    qAcc = vgetq_lane_s64(accQ, 0) + vgetq_lane_s64(accQ, 1) + q;
+}
+
+static void symmetricFIRFNEON(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc)
+{
+    float32x4_t accI = vdupq_n_f32(0.0f);
+    float32x4_t accQ = vdupq_n_f32(0.0f);
+    int k = 0;
+
+    for (; k + 4 <= nbCoeffs; k += 4)
+    {
+        float32x4_t c = vld1q_f32(&coeffs[k]);
+        float32x4_t t = vrev64q_f32(vld1q_f32(&bufI[tip - k - 3]));
+        float32x4_t s = vaddq_f32(vcombine_f32(vget_high_f32(t), vget_low_f32(t)), vld1q_f32(&bufI[tail + k]));
+        accI = vmlaq_f32(accI, s, c);
+        t = vrev64q_f32(vld1q_f32(&bufQ[tip - k - 3]));
+        s = vaddq_f32(vcombine_f32(vget_high_f32(t), vget_low_f32(t)), vld1q_f32(&bufQ[tail + k]));
+        accQ = vmlaq_f32(accQ, s, c);
+    }
+
+    float i, q;
+    symmetricFIRFScalar(bufI, bufQ, tip - k, tail + k, &coeffs[k], nbCoeffs - k, i, q);
+    iAcc = (vgetq_lane_f32(accI, 0) + vgetq_lane_f32(accI, 1)) + (vgetq_lane_f32(accI, 2) + vgetq_lane_f32(accI, 3)) + i;
+    qAcc = (vgetq_lane_f32(accQ, 0) + vgetq_lane_f32(accQ, 1)) + (vgetq_lane_f32(accQ, 2) + vgetq_lane_f32(accQ, 3)) + q;
+}
+
+#endif // HBK_NEON
+
+// ==== Dispatch ====
+
+// constant initialized so that filters used before dynamic initialization run the scalar code
+HalfbandKernels::SymmetricFIR32 HalfbandKernels::m_symmetricFIR32 = symmetricFIRScalar<qint32>;
+HalfbandKernels::SymmetricFIR64 HalfbandKernels::m_symmetricFIR64 = symmetricFIRScalar<qint64>;
+HalfbandKernels::SymmetricFIRF HalfbandKernels::m_symmetricFIRF = symmetricFIRFScalar;
+HalfbandKernels::InstructionSet HalfbandKernels::m_instructionSet = HalfbandKernels::select(HalfbandKernels::detectInstructionSet());
+
+HalfbandKernels::InstructionSet HalfbandKernels::detectInstructionSet()
+{
+#if defined(HBK_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int nIds = info[0];
+    bool sse41 = false, avx2 = false, fma = false, avx512f = false, osxsave = false;
+
+    if (nIds >= 1)
+    {
+        __cpuid(info, 1);
+        sse41 = (info[2] & (1 << 19)) != 0;
+        fma = (info[2] & (1 << 12)) != 0;
+        osxsave = (info[2] & (1 << 27)) != 0;
+    }
+
+    if (nIds >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+        avx512f = (info[1] & (1 << 16)) != 0;
+    }
+
+    // check that the OS saves the YMM and ZMM registers
+    unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    avx2 = avx2 && fma && ((xcr0 & 0x06) == 0x06);
+    avx512f = avx512f && avx2 && ((xcr0 & 0xe6) == 0xe6);
+#else
+    __builtin_cpu_init();
+    bool sse41 = __builtin_cpu_supports("sse4.1");
+    bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    bool avx512f = avx2 && __builtin_cpu_supports("avx512f");
+#endif
+
+    if (avx512f) {
+        return InstructionSetAVX512;
+    } else if (avx2) {
+        return InstructionSetAVX2;
+    } else if (sse41) {
+        return InstructionSetSSE4_1;
+    } else {
+        return InstructionSetScalar;
+    }
+#elif defined(HBK_NEON)
+    return InstructionSetNEON;
+#else
+    return InstructionSetScalar;
+#endif
+}
+
+HalfbandKernels::InstructionSet HalfbandKernels::select(InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+#if defined(HBK_X86)
+    case InstructionSetAVX512:
+        m_symmetricFIR32 = symmetricFIR32AVX512;
+        m_symmetricFIR64 = symmetricFIR64AVX512;
+        m_symmetricFIRF = symmetricFIRFAVX512;
+        break;
+    case InstructionSetAVX2:
+        m_symmetricFIR32 = symmetricFIR32AVX2;
+        m_symmetricFIR64 = symmetricFIR64AVX2;
+        m_symmetricFIRF = symmetricFIRFAVX2;
+        break;
+    case InstructionSetSSE4_1:
+        m_symmetricFIR32 = symmetricFIR32SSE41;
+        m_symmetricFIR64 = symmetricFIR64SSE41;
+        m_symmetricFIRF = symmetricFIRFSSE41;
+        break;
+#endif
+#if defined(HBK_NEON)
+    case InstructionSetNEON:
+        m_symmetricFIR32 = symmetricFIR32NEON;
+        m_symmetricFIR64 = symmetricFIR64NEON;
+        m_symmetricFIRF = symmetricFIRFNEON;
+        break;
+#endif
+    default:
+        instructionSet = InstructionSetScalar;
+        m_symmetricFIR32 = symmetricFIRScalar<qint32>;
+        m_symmetricFIR64 = symmetricFIRScalar<qint64>;
+        m_symmetricFIRF = symmetricFIRFScalar;
+        break;
+    }
+
+    return instructionSet;
+}
+
+HalfbandKernels::InstructionSet HalfbandKernels::getSupportedInstructionSet()
+{
+    static const InstructionSet supported = detectInstructionSet();
+    return supported;
+}
+
+void HalfbandKernels::setInstructionSet(InstructionSet instructionSet)
+{
+    InstructionSet supported = getSupportedInstructionSet();
+
+    if ((instructionSet > supported) || ((instructionSet == InstructionSetNEON) != (supported == InstructionSetNEON)))
+    {
+        qWarning("HalfbandKernels::setInstructionSet: %s not supported. Using %s",
+            getInstructionSetName(instructionSet), getInstructionSetName(supported));
+        instructionSet = supported;
+    }
+
+    m_instructionSet = select(instructionSet);
+    qDebug("HalfbandKernels::setInstructionSet: %s", getInstructionSetName(m_instructionSet));
+}
+
+const char *HalfbandKernels::getInstructionSetName(InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+    case InstructionSetSSE4_1:
+        return "SSE4.1";
+    case InstructionSetAVX2:
+        return "AVX2";
+    case InstructionSetAVX512:
+        return "AVX-512";
+    case InstructionSetNEON:
+        return "NEON";
+    default:
+        return "scalar";
+    }
+}
@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// SIMD kernels of the symmetric FIR at the heart of the even/odd halfband       //
+// filters used by the decimators and interpolators. The implementation is       //
+// selected once at startup from the instruction sets supported by the CPU so    //
+// that a single binary benefits from AVX2 or AVX-512 when available.            //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_HALFBANDKERNELS_H_
+#define SDRBASE_DSP_HALFBANDKERNELS_H_
+
+#include <QtGlobal>
+
+#include "export.h"
+
+class SDRBASE_API HalfbandKernels
+{
+public:
+    enum InstructionSet
+    {
+        InstructionSetScalar,
+        InstructionSetSSE4_1,
+        InstructionSetAVX2,
+        InstructionSetAVX512,
+        InstructionSetNEON
+    };
+
+    // Symmetric FIR on I and Q double buffers: acc = sum(k=0..nbCoeffs-1) (buf[tip-k] + buf[tail+k]) * coeffs[k]
+    // Integer samples must fit in 24 bits so that the sum of two of them fits in 32 bits.
+    typedef void (*SymmetricFIR32)(const qint32 *bufI, const qint32 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc);
+    typedef void (*SymmetricFIR64)(const qint64 *bufI, const qint64 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc);
+    typedef void (*SymmetricFIRF)(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc);
+
+    static inline void symmetricFIR(const qint32 *bufI, const qint32 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc) {
+        m_symmetricFIR32(bufI, bufQ, tip, tail, coeffs, nbCoeffs, iAcc, qAcc);
+    }
+    static inline void symmetricFIR(const qint64 *bufI, const qint64 *bufQ, int tip, int tail, const qint32 *coeffs, int nbCoeffs, qint64& iAcc, qint64& qAcc) {
+        m_symmetricFIR64(bufI, bufQ, tip, tail, coeffs, nbCoeffs, iAcc, qAcc);
+    }
+    static inline void symmetricFIR(const float *bufI, const float *bufQ, int tip, int tail, const float *coeffs, int nbCoeffs, float& iAcc, float& qAcc) {
+        m_symmetricFIRF(bufI, bufQ, tip, tail, coeffs, nbCoeffs, iAcc, qAcc);
+    }
+
+    static InstructionSet getInstructionSet() { return m_instructionSet; }        //!< Instruction set in use
+    static InstructionSet getSupportedInstructionSet();                          //!< Best instruction set supported by the CPU
+    static void setInstructionSet(InstructionSet instructionSet);                //!< Force an instruction set (e.g. for benchmarks). Limited to what the CPU supports.
+    static const char *getInstructionSetName(InstructionSet instructionSet);
+
+private:
+    static InstructionSet m_instructionSet;
+    static SymmetricFIR32 m_symmetricFIR32;
+    static SymmetricFIR64 m_symmetricFIR64;
+    static SymmetricFIRF m_symmetricFIRF;
+
+    static InstructionSet detectInstructionSet();
+    static InstructionSet select(InstructionSet instructionSet);
+};
+
+#endif /* SDRBASE_DSP_HALFBANDKERNELS_H_ */
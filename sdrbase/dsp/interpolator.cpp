@@ -172,3 +172,31 @@ void Interpolator::free()
 		m_alignedTaps2 = NULL;
 	}
 }
+
+void Interpolator::decimate(Real *distance, Real step, const Complex *input, unsigned int nbInput, ComplexVector& output)
+{
+	Complex result;
+
+	for (unsigned int i = 0; i < nbInput; i++)
+	{
+		if (decimate(distance, input[i], &result))
+		{
+			output.push_back(result);
+			*distance += step;
+		}
+	}
+}
+
+void Interpolator::interpolate(Real *distance, Real step, const Complex *input, unsigned int nbInput, ComplexVector& output)
+{
+	Complex result;
+
+	for (unsigned int i = 0; i < nbInput; i++)
+	{
+		while (!interpolate(distance, input[i], &result))
+		{
+			output.push_back(result);
+			*distance += step;
+		}
+	}
+}
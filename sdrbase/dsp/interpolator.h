@@ -89,6 +89,11 @@ public:
 		return true;
 	}
 
+	// Block versions of decimate and interpolate. Results are appended to the output vector and
+	// the distance is advanced by step after each result like the per sample callers do.
+	void decimate(Real *distance, Real step, const Complex *input, unsigned int nbInput, ComplexVector& output);
+	void interpolate(Real *distance, Real step, const Complex *input, unsigned int nbInput, ComplexVector& output);
+
 private:
 	float* m_taps;
 	float* m_alignedTaps;
@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include "dsp/dsptypes.h"
 #include "dsp/hbfiltertraits.h"
+#include "dsp/halfbandkernels.h"
 
 template<typename EOStorageType, typename AccuType, uint32_t HBFilterOrder, bool IQorder>
 class IntHalfbandFilterEO {
@@ -420,6 +421,109 @@ public:
         }
     }
 
+    // Block variants of the decimators on split I and Q arrays. They work in place: the nth output
+    // sample overwrites the nth input sample. They return the number of output samples.
+
+    // downsample by 2, return center part of original spectrum
+    int workDecimateCenter(FixReal *sampleI, FixReal *sampleQ, int count)
+    {
+        int nbOut = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            storeSample(sampleI[i], sampleQ[i]);
+
+            if (m_state != 0)
+            {
+                doFIRSplit(&sampleI[nbOut], &sampleQ[nbOut]);
+                nbOut++;
+            }
+
+            advancePointer();
+            m_state = 1 - m_state;
+        }
+
+        return nbOut;
+    }
+
+    // downsample by 2, return lower half of original spectrum
+    int workDecimateLowerHalf(FixReal *sampleI, FixReal *sampleQ, int count)
+    {
+        int nbOut = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            FixReal re = sampleI[i];
+            FixReal im = sampleQ[i];
+
+            switch(m_state)
+            {
+                case 0:
+                    storeSample((FixReal) -im, re);
+                    break;
+                case 1:
+                    storeSample((FixReal) -re, (FixReal) -im);
+                    break;
+                case 2:
+                    storeSample(im, (FixReal) -re);
+                    break;
+                default:
+                    storeSample(re, im);
+                    break;
+            }
+
+            if (m_state & 1)
+            {
+                doFIRSplit(&sampleI[nbOut], &sampleQ[nbOut]);
+                nbOut++;
+            }
+
+            advancePointer();
+            m_state = (m_state + 1) & 3;
+        }
+
+        return nbOut;
+    }
+
+    // downsample by 2, return upper half of original spectrum
+    int workDecimateUpperHalf(FixReal *sampleI, FixReal *sampleQ, int count)
+    {
+        int nbOut = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            FixReal re = sampleI[i];
+            FixReal im = sampleQ[i];
+
+            switch(m_state)
+            {
+                case 0:
+                    storeSample(im, (FixReal) -re);
+                    break;
+                case 1:
+                    storeSample((FixReal) -re, (FixReal) -im);
+                    break;
+                case 2:
+                    storeSample((FixReal) -im, re);
+                    break;
+                default:
+                    storeSample(re, im);
+                    break;
+            }
+
+            if (m_state & 1)
+            {
+                doFIRSplit(&sampleI[nbOut], &sampleQ[nbOut]);
+                nbOut++;
+            }
+
+            advancePointer();
+            m_state = (m_state + 1) & 3;
+        }
+
+        return nbOut;
+    }
+
     // upsample by 2, move original spectrum to upper half - double buffer variant
     bool workInterpolateUpperHalfZeroStuffing(Sample* sampleIn, Sample *sampleOut)
     {
@@ -837,31 +941,28 @@ protected:
         m_ptr = m_ptr + 1 < 2*m_size ? m_ptr + 1: 0;
     }
 
-    void doFIR(Sample* sample)
+    void doSymmetricFIR(AccuType& iAcc, AccuType& qAcc)
     {
-        AccuType iAcc = 0;
-        AccuType qAcc = 0;
-
+        qint64 iAcc64, qAcc64;
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
-        {
-            if ((m_ptr % 2) == 0)
-            {
-                iAcc += ((EOStorageType)(m_even[0][a] + m_even[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_even[1][a] + m_even[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-            else
-            {
-                iAcc += ((EOStorageType)(m_odd[0][a] + m_odd[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_odd[1][a] + m_odd[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-
-            a -= 1;
-            b += 1;
+        if ((m_ptr % 2) == 0) {
+            HalfbandKernels::symmetricFIR(m_even[0], m_even[1], a, b, HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc64, qAcc64);
+        } else {
+            HalfbandKernels::symmetricFIR(m_odd[0], m_odd[1], a, b, HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc64, qAcc64);
         }
 
+        iAcc = iAcc64;
+        qAcc = qAcc64;
+    }
+
+    void doFIR(Sample* sample)
+    {
+        AccuType iAcc;
+        AccuType qAcc;
+        doSymmetricFIR(iAcc, qAcc);
+
         if ((m_ptr % 2) == 0)
         {
             iAcc += m_odd[0][m_ptr/2 + m_size/2] << (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
@@ -879,28 +980,9 @@ protected:
 
     void doFIR(int32_t *x, int32_t *y)
     {
-        AccuType iAcc = 0;
-        AccuType qAcc = 0;
-
-        int a = m_ptr/2 + m_size; // tip pointer
-        int b = m_ptr/2 + 1; // tail pointer
-
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
-        {
-            if ((m_ptr % 2) == 0)
-            {
-                iAcc += ((EOStorageType)(m_even[0][a] + m_even[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_even[1][a] + m_even[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-            else
-            {
-                iAcc += ((EOStorageType)(m_odd[0][a] + m_odd[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_odd[1][a] + m_odd[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-
-            a -= 1;
-            b += 1;
-        }
+        AccuType iAcc;
+        AccuType qAcc;
+        doSymmetricFIR(iAcc, qAcc);
 
         if ((m_ptr % 2) == 0)
         {
@@ -917,6 +999,14 @@ protected:
         *y = qAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1);
     }
 
+    void doFIRSplit(FixReal *sampleI, FixReal *sampleQ)
+    {
+        int32_t x, y;
+        doFIR(&x, &y);
+        *sampleI = x;
+        *sampleQ = y;
+    }
+
     void doInterpolateFIR(Sample* sample)
     {
         AccuType iAcc = 0;
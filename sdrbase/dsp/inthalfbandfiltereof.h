@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include "dsp/dsptypes.h"
 #include "dsp/hbfiltertraits.h"
+#include "dsp/halfbandkernels.h"
 #include "export.h"
 
 template<uint32_t HBFilterOrder, bool IQOrder>
@@ -171,6 +172,23 @@ protected:
         m_ptr = m_ptr + 1 < 2*m_size ? m_ptr + 1: 0;
     }
 
+    // SIMD kernels are available for single precision coefficients only
+    bool symmetricFIR(const float *coeffs, int a, int b, float& iAcc, float& qAcc)
+    {
+        if ((m_ptr % 2) == 0) {
+            HalfbandKernels::symmetricFIR(m_even[0], m_even[1], a, b, coeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc, qAcc);
+        } else {
+            HalfbandKernels::symmetricFIR(m_odd[0], m_odd[1], a, b, coeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc, qAcc);
+        }
+
+        return true;
+    }
+
+    bool symmetricFIR(const double*, int, int, float&, float&)
+    {
+        return false;
+    }
+
     void doFIR(float *x, float *y)
     {
         float iAcc = 0;
@@ -179,21 +197,24 @@ protected:
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+        if (!symmetricFIR(HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF, a, b, iAcc, qAcc))
         {
-            if ((m_ptr % 2) == 0)
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
             {
-                iAcc += (m_even[0][a] + m_even[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-                qAcc += (m_even[1][a] + m_even[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+                if ((m_ptr % 2) == 0)
+                {
+                    iAcc += (m_even[0][a] + m_even[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+                    qAcc += (m_even[1][a] + m_even[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+                }
+                else
+                {
+                    iAcc += (m_odd[0][a] + m_odd[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+                    qAcc += (m_odd[1][a] + m_odd[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+                }
+
+                a -= 1;
+                b += 1;
             }
-            else
-            {
-                iAcc += (m_odd[0][a] + m_odd[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-                qAcc += (m_odd[1][a] + m_odd[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-            }
-
-            a -= 1;
-            b += 1;
         }
 
         if ((m_ptr % 2) == 0)
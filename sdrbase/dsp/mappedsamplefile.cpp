@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <QDebug>
+
+#include "mappedsamplefile.h"
+
+// With a 64 bit address space the whole file is mapped. Otherwise use windows
+// that keep address space usage reasonable. Window offsets are multiple of 64 kB
+// which satisfies the mapping granularity of all supported systems.
+static const quint64 windowSize = sizeof(void*) >= 8 ? 0 : 64*1024*1024;
+static const quint64 windowGranularity = 64*1024;
+
+MappedSampleFile::MappedSampleFile() :
+    m_size(0),
+    m_map(nullptr),
+    m_mapOffset(0),
+    m_mapSize(0)
+{
+}
+
+MappedSampleFile::~MappedSampleFile()
+{
+    close();
+}
+
+bool MappedSampleFile::open(const QString& fileName)
+{
+    close();
+    m_file.setFileName(fileName);
+
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "MappedSampleFile::open: cannot open" << fileName << ":" << m_file.errorString();
+        return false;
+    }
+
+    m_fileName = fileName;
+    m_size = m_file.size();
+
+    if ((m_size != 0) && !mapWindow(0))
+    {
+        close();
+        return false;
+    }
+
+    setSequential(true);
+    qDebug("MappedSampleFile::open: %s: %llu bytes mapping: %llu bytes", qPrintable(fileName), m_size, m_mapSize);
+    return true;
+}
+
+void MappedSampleFile::close()
+{
+    if (m_map)
+    {
+        m_file.unmap(m_map);
+        m_map = nullptr;
+    }
+
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+
+    m_size = 0;
+    m_mapOffset = 0;
+    m_mapSize = 0;
+}
+
+const uchar *MappedSampleFile::data(quint64 offset, quint64& size)
+{
+    if (offset >= m_size)
+    {
+        size = 0;
+        return nullptr;
+    }
+
+    size = std::min(size, m_size - offset);
+
+    if ((offset < m_mapOffset) || (offset + size > m_mapOffset + m_mapSize))
+    {
+        if (!mapWindow(offset))
+        {
+            size = 0;
+            return nullptr;
+        }
+    }
+
+    size = std::min(size, m_mapOffset + m_mapSize - offset);
+    return m_map + (offset - m_mapOffset);
+}
+
+void MappedSampleFile::willNeed(quint64 offset, quint64 size)
+{
+#ifndef _WIN32
+    advise(offset, size, POSIX_MADV_WILLNEED);
+#else
+    (void) offset;
+    (void) size;
+#endif
+}
+
+void MappedSampleFile::setSequential(bool sequential)
+{
+#ifndef _WIN32
+    advise(m_mapOffset, m_mapSize, sequential ? POSIX_MADV_SEQUENTIAL : POSIX_MADV_RANDOM);
+#else
+    (void) sequential;
+#endif
+}
+
+bool MappedSampleFile::mapWindow(quint64 offset)
+{
+    if (m_map)
+    {
+        m_file.unmap(m_map);
+        m_map = nullptr;
+    }
+
+    if (windowSize == 0)
+    {
+        m_mapOffset = 0;
+        m_mapSize = m_size;
+    }
+    else
+    {
+        m_mapOffset = (offset / windowGranularity) * windowGranularity;
+        m_mapSize = std::min(windowSize, m_size - m_mapOffset);
+    }
+
+    m_map = m_file.map(m_mapOffset, m_mapSize);
+
+    if (!m_map)
+    {
+        qWarning() << "MappedSampleFile::mapWindow: cannot map" << m_fileName << ":" << m_file.errorString();
+        m_mapSize = 0;
+        return false;
+    }
+
+    return true;
+}
+
+void MappedSampleFile::advise(quint64 offset, quint64 size, int advice)
+{
+#ifndef _WIN32
+    if (!m_map || (offset >= m_mapOffset + m_mapSize) || (offset + size <= m_mapOffset)) {
+        return;
+    }
+
+    // restrict to the mapping and align start on a page boundary as required by madvise
+    quint64 start = std::max(offset, m_mapOffset) - m_mapOffset;
+    quint64 end = std::min(offset + size, m_mapOffset + m_mapSize) - m_mapOffset;
+    quint64 pageSize = sysconf(_SC_PAGESIZE);
+    quint64 pageStart = (start / pageSize) * pageSize;
+    posix_madvise(m_map + pageStart, end - pageStart, advice);
+#else
+    (void) offset;
+    (void) size;
+    (void) advice;
+#endif
+}
@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Read only memory mapped access to a recorded I/Q file. The whole file is      //
+// mapped when the address space allows it otherwise a sliding window is used.  //
+// Seeking is just a change of offset and read ahead is hinted to the kernel.   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_MAPPEDSAMPLEFILE_H_
+#define SDRBASE_DSP_MAPPEDSAMPLEFILE_H_
+
+#include <QFile>
+#include <QString>
+
+#include "export.h"
+
+class SDRBASE_API MappedSampleFile
+{
+public:
+    MappedSampleFile();
+    ~MappedSampleFile();
+
+    bool open(const QString& fileName);
+    void close();
+    bool isOpen() const { return m_file.isOpen(); }
+    quint64 size() const { return m_size; }
+    const QString& getFileName() const { return m_fileName; }
+
+    /** Pointer to size bytes at offset. size is reduced to what is available at end of file
+     *  or in the current mapping window. The pointer is valid until the next call or close.
+     *  Returns nullptr at end of file or on mapping error.
+     */
+    const uchar *data(quint64 offset, quint64& size);
+    void willNeed(quint64 offset, quint64 size); //!< Hint the kernel to read this range ahead
+    void setSequential(bool sequential);         //!< Hint sequential (larger read ahead) or random access
+
+private:
+    QFile m_file;
+    QString m_fileName;
+    quint64 m_size;
+    uchar *m_map;
+    quint64 m_mapOffset;
+    quint64 m_mapSize;
+
+    bool mapWindow(quint64 offset);
+    void advise(quint64 offset, quint64 size, int advice);
+};
+
+#endif // SDRBASE_DSP_MAPPEDSAMPLEFILE_H_
@@ -20,6 +20,7 @@
 #include <cstdio>
 #include <cmath>
 #include "dsp/nco.h"
+#include "dsp/ncokernels.h"
 
 
 Real NCO::m_table[NCO::TableSize];
@@ -78,6 +79,18 @@ void NCO::nextIQMul(Real& i, Real& q)
     q = x*v + y*u;
 }
 
+void NCO::mix(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, Complex *out)
+{
+    if (begin != end) {
+        NCOKernels::mix(m_table, TableSize, m_phase, m_phaseIncrement, &(*begin), out, end - begin);
+    }
+}
+
+void NCO::nextIQ(Complex *iq, unsigned int nbSamples)
+{
+    NCOKernels::generate(m_table, TableSize, m_phase, m_phaseIncrement, iq, nbSamples);
+}
+
 float NCO::get()
 {
 	return m_table[m_phase];
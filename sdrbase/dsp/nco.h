@@ -52,8 +52,10 @@ public:
 
 	Real next();            //!< Return next real sample
 	Complex nextIQ();       //!< Return next complex sample
+	void nextIQ(Complex *iq, unsigned int nbSamples); //!< Return next block of complex samples
 	Complex nextQI();       //!< Return next complex sample (reversed)
 	void nextIQMul(Real& i, Real& q); //!< multiply I,Q separately with next sample
+	void mix(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, Complex *out); //!< multiply a block of samples by the next complex samples
 	Real get();             //!< Return current real sample (no phase increment)
 	Complex getIQ();        //!< Return current complex sample (no phase increment)
 	void getIQ(Complex& c); //!< Sets to the current complex sample (no phase increment)
@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <cmath>
 #include "dsp/ncof.h"
+#include "dsp/ncokernels.h"
 
 Real NCOF::m_table[NCOF::TableSize+1];
 bool NCOF::m_tableInitialized = false;
@@ -76,6 +77,18 @@ Complex NCOF::nextQI()
 	return Complex(-m_table[(phase + TableSize / 4) % TableSize], m_table[phase]);
 }
 
+void NCOF::mix(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, Complex *out)
+{
+    if (begin != end) {
+        NCOKernels::mix(m_table, TableSize, m_phase, m_phaseIncrement, &(*begin), out, end - begin);
+    }
+}
+
+void NCOF::nextIQ(Complex *iq, unsigned int nbSamples)
+{
+    NCOKernels::generate(m_table, TableSize, m_phase, m_phaseIncrement, iq, nbSamples);
+}
+
 float NCOF::get()
 {
 	return m_table[(int) m_phase];
@@ -56,7 +56,9 @@ public:
 	Real next();                        //!< Return next real sample
 	Complex nextIQ();                   //!< Return next complex sample
 	Complex nextIQ(float imbalance);    //!< Return next complex sample with an imbalance factor on I
+	void nextIQ(Complex *iq, unsigned int nbSamples); //!< Return next block of complex samples
 	Complex nextQI();                   //!< Return next complex sample (reversed)
+	void mix(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, Complex *out); //!< Multiply a block of samples by the next complex samples
 	Real get();                         //!< Return current real sample (no phase increment)
 	Complex getIQ();                    //!< Return current complex sample (no phase increment)
 	void getIQ(Complex& c);             //!< Sets to the current complex sample (no phase increment)
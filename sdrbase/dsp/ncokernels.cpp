@@ -0,0 +1,443 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "ncokernels.h"
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_x86) || defined(__x86_64__) || defined(__i386__) || defined(_M_AMD64) || defined(_M_IX86)
+#define NCOK_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NCOK_TARGET(isa) // MSVC allows any intrinsic without a specific compiler flag
+#else
+#define NCOK_TARGET(isa) __attribute__((target(isa)))
+#endif
+#elif defined(ARCHITECTURE_ARM64) || defined(__aarch64__) || defined(USE_ARM_NEON) || defined(__ARM_NEON)
+#define NCOK_NEON
+#include <arm_neon.h>
+#endif
+
+// ==== Scalar ====
+// Same arithmetic as NCO::nextIQ() and NCOF::nextIQ() one sample at a time
+
+static inline int nextPhase(int phase, int phaseIncrement, int tableSize)
+{
+    phase += phaseIncrement;
+
+    while (phase >= tableSize) {
+        phase -= tableSize;
+    }
+    while (phase < 0) {
+        phase += tableSize;
+    }
+
+    return phase;
+}
+
+static inline Real nextPhase(Real phase, Real phaseIncrement, int tableSize)
+{
+    phase += phaseIncrement;
+
+    while (phase >= (float) tableSize) {
+        phase -= tableSize;
+    }
+    while (phase < 0.0) {
+        phase += tableSize;
+    }
+
+    return phase;
+}
+
+static inline void mixOne(const Real *table, int tableSize, int phase, const Sample& in, Complex& out)
+{
+    Real x = in.real();
+    Real y = in.imag();
+    Real u = table[phase];
+    Real v = -table[(phase + tableSize / 4) % tableSize];
+    out.real(x*u - y*v);
+    out.imag(x*v + y*u);
+}
+
+static void generateScalar(const Real *table, int tableSize, int& phase, int phaseIncrement, Complex *out, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        phase = nextPhase(phase, phaseIncrement, tableSize);
+        out[i] = Complex(table[phase], -table[(phase + tableSize / 4) % tableSize]);
+    }
+}
+
+static void mixScalar(const Real *table, int tableSize, int& phase, int phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        phase = nextPhase(phase, phaseIncrement, tableSize);
+        mixOne(table, tableSize, phase, in[i], out[i]);
+    }
+}
+
+static void generateFScalar(const Real *table, int tableSize, Real& phase, Real phaseIncrement, Complex *out, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        phase = nextPhase(phase, phaseIncrement, tableSize);
+        int p = (int) phase;
+        out[i] = Complex(table[p], -table[(p + tableSize / 4) % tableSize]);
+    }
+}
+
+static void mixFScalar(const Real *table, int tableSize, Real& phase, Real phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        phase = nextPhase(phase, phaseIncrement, tableSize);
+        mixOne(table, tableSize, (int) phase, in[i], out[i]);
+    }
+}
+
+#if defined(NCOK_X86)
+
+// ==== AVX2 ====
+// Eight phases are computed at once and the table is read with gathers as interleaved cos, sin pairs
+// of four samples in each half of the block. Integer phases give exactly the scalar results.
+
+NCOK_TARGET("avx2")
+static inline void lookupAVX2(const Real *table, __m256i phases, __m256i quarter, __m256i mask, __m256& wLo, __m256& wHi)
+{
+    const __m256i dupLo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i dupHi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+    const __m256 negQ = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+    __m256i idxLo = _mm256_and_si256(_mm256_add_epi32(_mm256_permutevar8x32_epi32(phases, dupLo), quarter), mask);
+    __m256i idxHi = _mm256_and_si256(_mm256_add_epi32(_mm256_permutevar8x32_epi32(phases, dupHi), quarter), mask);
+    wLo = _mm256_xor_ps(_mm256_i32gather_ps(table, idxLo, 4), negQ); // u0 v0 u1 v1 ... with v = -sin
+    wHi = _mm256_xor_ps(_mm256_i32gather_ps(table, idxHi, 4), negQ);
+}
+
+NCOK_TARGET("avx2")
+static inline void loadSamplesAVX2(const Sample *in, __m256& aLo, __m256& aHi)
+{
+#ifdef SDR_RX_SAMPLE_24BIT
+    aLo = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*) &in[0]));
+    aHi = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*) &in[4]));
+#else
+    __m256i raw = _mm256_loadu_si256((const __m256i*) in);
+    aLo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(raw)));
+    aHi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(raw, 1)));
+#endif
+}
+
+NCOK_TARGET("avx2")
+static inline __m256 complexMulAVX2(__m256 a, __m256 w)
+{
+    // (x + jy)(u + jv) = (xu - yv) + j(yu + xv)
+    __m256 aSwap = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_addsub_ps(_mm256_mul_ps(a, _mm256_moveldup_ps(w)), _mm256_mul_ps(aSwap, _mm256_movehdup_ps(w)));
+}
+
+NCOK_TARGET("avx2")
+static void generateAVX2(const Real *table, int tableSize, int& phase, int phaseIncrement, Complex *out, unsigned int nbSamples)
+{
+    const __m256i mask = _mm256_set1_epi32(tableSize - 1);
+    const __m256i quarter = _mm256_setr_epi32(0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4);
+    const __m256i steps = _mm256_mullo_epi32(_mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8), _mm256_set1_epi32(phaseIncrement));
+    int p = phase;
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbSamples; i += 8)
+    {
+        __m256i phases = _mm256_and_si256(_mm256_add_epi32(_mm256_set1_epi32(p), steps), mask);
+        __m256 wLo, wHi;
+        lookupAVX2(table, phases, quarter, mask, wLo, wHi);
+        _mm256_storeu_ps((float*) &out[i], wLo);
+        _mm256_storeu_ps((float*) &out[i + 4], wHi);
+        p = (p + 8 * phaseIncrement) & (tableSize - 1);
+    }
+
+    phase = p;
+    generateScalar(table, tableSize, phase, phaseIncrement, &out[i], nbSamples - i);
+}
+
+NCOK_TARGET("avx2")
+static void mixAVX2(const Real *table, int tableSize, int& phase, int phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples)
+{
+    const __m256i mask = _mm256_set1_epi32(tableSize - 1);
+    const __m256i quarter = _mm256_setr_epi32(0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4);
+    const __m256i steps = _mm256_mullo_epi32(_mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8), _mm256_set1_epi32(phaseIncrement));
+    int p = phase;
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbSamples; i += 8)
+    {
+        __m256i phases = _mm256_and_si256(_mm256_add_epi32(_mm256_set1_epi32(p), steps), mask);
+        __m256 wLo, wHi, aLo, aHi;
+        lookupAVX2(table, phases, quarter, mask, wLo, wHi);
+        loadSamplesAVX2(&in[i], aLo, aHi);
+        _mm256_storeu_ps((float*) &out[i], complexMulAVX2(aLo, wLo));
+        _mm256_storeu_ps((float*) &out[i + 4], complexMulAVX2(aHi, wHi));
+        p = (p + 8 * phaseIncrement) & (tableSize - 1);
+    }
+
+    phase = p;
+    mixScalar(table, tableSize, phase, phaseIncrement, &in[i], &out[i], nbSamples - i);
+}
+
+// Float phases of the block are computed from the phase at start of block rather than accumulated sample
+// after sample so they may differ from the scalar version by rounding errors of the phase accumulator.
+NCOK_TARGET("avx2")
+static inline __m256i phasesFAVX2(Real p, __m256 stepsF, __m256 size, __m256 invSize)
+{
+    __m256 phases = _mm256_add_ps(_mm256_set1_ps(p), stepsF);
+    phases = _mm256_sub_ps(phases, _mm256_mul_ps(size, _mm256_floor_ps(_mm256_mul_ps(phases, invSize))));
+    return _mm256_cvttps_epi32(phases);
+}
+
+NCOK_TARGET("avx2")
+static void generateFAVX2(const Real *table, int tableSize, Real& phase, Real phaseIncrement, Complex *out, unsigned int nbSamples)
+{
+    const __m256i mask = _mm256_set1_epi32(tableSize - 1);
+    const __m256i quarter = _mm256_setr_epi32(0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4);
+    const __m256 stepsF = _mm256_mul_ps(_mm256_setr_ps(1, 2, 3, 4, 5, 6, 7, 8), _mm256_set1_ps(phaseIncrement));
+    const __m256 size = _mm256_set1_ps(tableSize);
+    const __m256 invSize = _mm256_set1_ps(1.0f / tableSize);
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbSamples; i += 8)
+    {
+        __m256i phases = phasesFAVX2(phase, stepsF, size, invSize);
+        __m256 wLo, wHi;
+        lookupAVX2(table, phases, quarter, mask, wLo, wHi);
+        _mm256_storeu_ps((float*) &out[i], wLo);
+        _mm256_storeu_ps((float*) &out[i + 4], wHi);
+        phase = nextPhase(phase, 8 * phaseIncrement, tableSize);
+    }
+
+    generateFScalar(table, tableSize, phase, phaseIncrement, &out[i], nbSamples - i);
+}
+
+NCOK_TARGET("avx2")
+static void mixFAVX2(const Real *table, int tableSize, Real& phase, Real phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples)
+{
+    const __m256i mask = _mm256_set1_epi32(tableSize - 1);
+    const __m256i quarter = _mm256_setr_epi32(0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4, 0, tableSize / 4);
+    const __m256 stepsF = _mm256_mul_ps(_mm256_setr_ps(1, 2, 3, 4, 5, 6, 7, 8), _mm256_set1_ps(phaseIncrement));
+    const __m256 size = _mm256_set1_ps(tableSize);
+    const __m256 invSize = _mm256_set1_ps(1.0f / tableSize);
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbSamples; i += 8)
+    {
+        __m256i phases = phasesFAVX2(phase, stepsF, size, invSize);
+        __m256 wLo, wHi, aLo, aHi;
+        lookupAVX2(table, phases, quarter, mask, wLo, wHi);
+        loadSamplesAVX2(&in[i], aLo, aHi);
+        _mm256_storeu_ps((float*) &out[i], complexMulAVX2(aLo, wLo));
+        _mm256_storeu_ps((float*) &out[i + 4], complexMulAVX2(aHi, wHi));
+        phase = nextPhase(phase, 8 * phaseIncrement, tableSize);
+    }
+
+    mixFScalar(table, tableSize, phase, phaseIncrement, &in[i], &out[i], nbSamples - i);
+}
+
+#endif // NCOK_X86
+
+#if defined(NCOK_NEON)
+
+// ==== NEON ====
+// No gather in NEON: four phases are computed at once then the table is read lane by lane
+// and the complex multiplication is done on deinterleaved I and Q vectors.
+
+static inline void lookupNEON(const Real *table, int tableSize, int32x4_t phases, float32x4_t& u, float32x4_t& v)
+{
+    int32_t p[4];
+    float uf[4], vf[4];
+    vst1q_s32(p, phases);
+
+    for (int k = 0; k < 4; k++)
+    {
+        uf[k] = table[p[k] & (tableSize - 1)];
+        vf[k] = -table[(p[k] + tableSize / 4) & (tableSize - 1)];
+    }
+
+    u = vld1q_f32(uf);
+    v = vld1q_f32(vf);
+}
+
+static inline void loadSamplesNEON(const Sample *in, float32x4_t& x, float32x4_t& y)
+{
+#ifdef SDR_RX_SAMPLE_24BIT
+    int32x4x2_t s = vld2q_s32((const int32_t*) in);
+    x = vcvtq_f32_s32(s.val[0]);
+    y = vcvtq_f32_s32(s.val[1]);
+#else
+    int16x4x2_t s = vld2_s16((const int16_t*) in);
+    x = vcvtq_f32_s32(vmovl_s16(s.val[0]));
+    y = vcvtq_f32_s32(vmovl_s16(s.val[1]));
+#endif
+}
+
+static inline float32x4x2_t complexMulNEON(float32x4_t x, float32x4_t y, float32x4_t u, float32x4_t v)
+{
+    float32x4x2_t r;
+    r.val[0] = vsubq_f32(vmulq_f32(x, u), vmulq_f32(y, v));
+    r.val[1] = vaddq_f32(vmulq_f32(x, v), vmulq_f32(y, u));
+    return r;
+}
+
+static inline int32x4_t phasesFNEON(Real p, float32x4_t stepsF, float32x4_t size, float32x4_t invSize)
+{
+    float32x4_t phases = vaddq_f32(vdupq_n_f32(p), stepsF);
+    float32x4_t t = vmulq_f32(phases, invSize);
+    float32x4_t f = vcvtq_f32_s32(vcvtq_s32_f32(t)); // truncation
+    f = vsubq_f32(f, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(f, t), vreinterpretq_u32_f32(vdupq_n_f32(1.0f))))); // floor
+    return vcvtq_s32_f32(vsubq_f32(phases, vmulq_f32(size, f)));
+}
+
+static void generateNEON(const Real *table, int tableSize, int& phase, int phaseIncrement, Complex *out, unsigned int nbSamples)
+{
+    const int32_t stepsInit[4] = {1, 2, 3, 4};
+    const int32x4_t steps = vmulq_n_s32(vld1q_s32(stepsInit), phaseIncrement);
+    unsigned int i = 0;
+
+    for (; i + 4 <= nbSamples; i += 4)
+    {
+        float32x4x2_t w;
+        lookupNEON(table, tableSize, vaddq_s32(vdupq_n_s32(phase), steps), w.val[0], w.val[1]);
+        vst2q_f32((float*) &out[i], w);
+        phase = (phase + 4 * phaseIncrement) & (tableSize - 1);
+    }
+
+    generateScalar(table, tableSize, phase, phaseIncrement, &out[i], nbSamples - i);
+}
+
+static void mixNEON(const Real *table, int tableSize, int& phase, int phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples)
+{
+    const int32_t stepsInit[4] = {1, 2, 3, 4};
+    const int32x4_t steps = vmulq_n_s32(vld1q_s32(stepsInit), phaseIncrement);
+    unsigned int i = 0;
+
+    for (; i + 4 <= nbSamples; i += 4)
+    {
+        float32x4_t u, v, x, y;
+        lookupNEON(table, tableSize, vaddq_s32(vdupq_n_s32(phase), steps), u, v);
+        loadSamplesNEON(&in[i], x, y);
+        vst2q_f32((float*) &out[i], complexMulNEON(x, y, u, v));
+        phase = (phase + 4 * phaseIncrement) & (tableSize - 1);
+    }
+
+    mixScalar(table, tableSize, phase, phaseIncrement, &in[i], &out[i], nbSamples - i);
+}
+
+static void generateFNEON(const Real *table, int tableSize, Real& phase, Real phaseIncrement, Complex *out, unsigned int nbSamples)
+{
+    const float stepsInit[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    const float32x4_t stepsF = vmulq_n_f32(vld1q_f32(stepsInit), phaseIncrement);
+    const float32x4_t size = vdupq_n_f32(tableSize);
+    const float32x4_t invSize = vdupq_n_f32(1.0f / tableSize);
+    unsigned int i = 0;
+
+    for (; i + 4 <= nbSamples; i += 4)
+    {
+        float32x4x2_t w;
+        lookupNEON(table, tableSize, phasesFNEON(phase, stepsF, size, invSize), w.val[0], w.val[1]);
+        vst2q_f32((float*) &out[i], w);
+        phase = nextPhase(phase, 4 * phaseIncrement, tableSize);
+    }
+
+    generateFScalar(table, tableSize, phase, phaseIncrement, &out[i], nbSamples - i);
+}
+
+static void mixFNEON(const Real *table, int tableSize, Real& phase, Real phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples)
+{
+    const float stepsInit[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    const float32x4_t stepsF = vmulq_n_f32(vld1q_f32(stepsInit), phaseIncrement);
+    const float32x4_t size = vdupq_n_f32(tableSize);
+    const float32x4_t invSize = vdupq_n_f32(1.0f / tableSize);
+    unsigned int i = 0;
+
+    for (; i + 4 <= nbSamples; i += 4)
+    {
+        float32x4_t u, v, x, y;
+        lookupNEON(table, tableSize, phasesFNEON(phase, stepsF, size, invSize), u, v);
+        loadSamplesNEON(&in[i], x, y);
+        vst2q_f32((float*) &out[i], complexMulNEON(x, y, u, v));
+        phase = nextPhase(phase, 4 * phaseIncrement, tableSize);
+    }
+
+    mixFScalar(table, tableSize, phase, phaseIncrement, &in[i], &out[i], nbSamples - i);
+}
+
+#endif // NCOK_NEON
+
+// ==== Dispatch ====
+
+// constant initialized so that NCOs used before dynamic initialization run the scalar code
+NCOKernels::Generate NCOKernels::m_generate = generateScalar;
+NCOKernels::Mix NCOKernels::m_mix = mixScalar;
+NCOKernels::GenerateF NCOKernels::m_generateF = generateFScalar;
+NCOKernels::MixF NCOKernels::m_mixF = mixFScalar;
+HalfbandKernels::InstructionSet NCOKernels::m_instructionSet = NCOKernels::select(HalfbandKernels::getSupportedInstructionSet());
+
+HalfbandKernels::InstructionSet NCOKernels::select(HalfbandKernels::InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+#if defined(NCOK_X86)
+    case HalfbandKernels::InstructionSetAVX512: // gathers are not faster with 512 bit vectors
+    case HalfbandKernels::InstructionSetAVX2:
+        instructionSet = HalfbandKernels::InstructionSetAVX2;
+        m_generate = generateAVX2;
+        m_mix = mixAVX2;
+        m_generateF = generateFAVX2;
+        m_mixF = mixFAVX2;
+        break;
+#endif
+#if defined(NCOK_NEON)
+    case HalfbandKernels::InstructionSetNEON:
+        m_generate = generateNEON;
+        m_mix = mixNEON;
+        m_generateF = generateFNEON;
+        m_mixF = mixFNEON;
+        break;
+#endif
+    default: // SSE4.1 has no gather
+        instructionSet = HalfbandKernels::InstructionSetScalar;
+        m_generate = generateScalar;
+        m_mix = mixScalar;
+        m_generateF = generateFScalar;
+        m_mixF = mixFScalar;
+        break;
+    }
+
+    return instructionSet;
+}
+
+void NCOKernels::setInstructionSet(HalfbandKernels::InstructionSet instructionSet)
+{
+    HalfbandKernels::InstructionSet supported = HalfbandKernels::getSupportedInstructionSet();
+
+    if ((instructionSet > supported)
+    || ((instructionSet == HalfbandKernels::InstructionSetNEON) != (supported == HalfbandKernels::InstructionSetNEON)))
+    {
+        qWarning("NCOKernels::setInstructionSet: %s not supported. Using %s",
+            HalfbandKernels::getInstructionSetName(instructionSet), HalfbandKernels::getInstructionSetName(supported));
+        instructionSet = supported;
+    }
+
+    m_instructionSet = select(instructionSet);
+    qDebug("NCOKernels::setInstructionSet: %s", HalfbandKernels::getInstructionSetName(m_instructionSet));
+}
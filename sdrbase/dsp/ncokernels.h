@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Block kernels of the lookup table NCOs (NCO and NCOF). A whole buffer of      //
+// samples is generated or mixed at once with a vectorized phase accumulator.   //
+// The implementation is selected at startup like the halfband kernels.         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_NCOKERNELS_H_
+#define SDRBASE_DSP_NCOKERNELS_H_
+
+#include "dsp/dsptypes.h"
+#include "dsp/halfbandkernels.h"
+#include "export.h"
+
+class SDRBASE_API NCOKernels
+{
+public:
+    // The cosine table has tableSize entries (plus one for the float phase version). tableSize is a power of two.
+    // The phase is advanced before each sample and is left at the phase of the last sample for the next block.
+    // Output is cos(phase) - j.sin(phase) for generation and input multiplied by it for mixing.
+    typedef void (*Generate)(const Real *table, int tableSize, int& phase, int phaseIncrement, Complex *out, unsigned int nbSamples);
+    typedef void (*Mix)(const Real *table, int tableSize, int& phase, int phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples);
+    typedef void (*GenerateF)(const Real *table, int tableSize, Real& phase, Real phaseIncrement, Complex *out, unsigned int nbSamples);
+    typedef void (*MixF)(const Real *table, int tableSize, Real& phase, Real phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples);
+
+    static inline void generate(const Real *table, int tableSize, int& phase, int phaseIncrement, Complex *out, unsigned int nbSamples) {
+        m_generate(table, tableSize, phase, phaseIncrement, out, nbSamples);
+    }
+    static inline void mix(const Real *table, int tableSize, int& phase, int phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples) {
+        m_mix(table, tableSize, phase, phaseIncrement, in, out, nbSamples);
+    }
+    static inline void generate(const Real *table, int tableSize, Real& phase, Real phaseIncrement, Complex *out, unsigned int nbSamples) {
+        m_generateF(table, tableSize, phase, phaseIncrement, out, nbSamples);
+    }
+    static inline void mix(const Real *table, int tableSize, Real& phase, Real phaseIncrement, const Sample *in, Complex *out, unsigned int nbSamples) {
+        m_mixF(table, tableSize, phase, phaseIncrement, in, out, nbSamples);
+    }
+
+    static HalfbandKernels::InstructionSet getInstructionSet() { return m_instructionSet; } //!< Instruction set in use
+    static void setInstructionSet(HalfbandKernels::InstructionSet instructionSet);          //!< Force an instruction set (e.g. for benchmarks). Limited to what the CPU supports.
+
+private:
+    static HalfbandKernels::InstructionSet m_instructionSet;
+    static Generate m_generate;
+    static Mix m_mix;
+    static GenerateF m_generateF;
+    static MixF m_mixF;
+
+    static HalfbandKernels::InstructionSet select(HalfbandKernels::InstructionSet instructionSet);
+};
+
+#endif /* SDRBASE_DSP_NCOKERNELS_H_ */
@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "dsp/wfir.h"
+#include "polyphasechannelizer.h"
+
+PolyphaseChannelizer::PolyphaseChannelizer() :
+    m_nbSubbands(0),
+    m_tapsPerSubband(0),
+    m_decimation(0),
+    m_historyLength(0),
+    m_writeIndex(0),
+    m_inputCount(0),
+    m_outputCount(0),
+    m_fft(nullptr),
+    m_fftSequence(0)
+{
+}
+
+PolyphaseChannelizer::~PolyphaseChannelizer()
+{
+    releaseFFT();
+}
+
+void PolyphaseChannelizer::releaseFFT()
+{
+    if (m_fft)
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(m_nbSubbands, true, m_fftSequence);
+        m_fft = nullptr;
+    }
+}
+
+void PolyphaseChannelizer::configure(unsigned int nbSubbands, unsigned int tapsPerSubband)
+{
+    if ((nbSubbands != 0) && ((nbSubbands < 4) || ((nbSubbands & (nbSubbands - 1)) != 0)))
+    {
+        qWarning("PolyphaseChannelizer::configure: number of sub-bands must be a power of two >= 4: %u", nbSubbands);
+        return;
+    }
+
+    if ((nbSubbands == m_nbSubbands) && (tapsPerSubband == m_tapsPerSubband)) {
+        return;
+    }
+
+    releaseFFT();
+    m_nbSubbands = nbSubbands;
+    m_tapsPerSubband = tapsPerSubband;
+    m_decimation = nbSubbands / 2;
+    m_historyLength = nbSubbands * tapsPerSubband;
+    m_subbandRefCount.assign(nbSubbands, 0);
+    m_subbandSamples.assign(nbSubbands, SampleVector());
+
+    if (nbSubbands == 0)
+    {
+        m_taps.clear();
+        m_history.clear();
+        m_accumulator.clear();
+        qDebug("PolyphaseChannelizer::configure: disabled");
+        return;
+    }
+
+    // Prototype lowpass with -6dB point at Fs/M (normalized to Nyquist: 2/M)
+    std::vector<double> taps(m_historyLength);
+    WFIR::BasicFIR(taps.data(), m_historyLength, WFIR::LPF, 2.0 / nbSubbands, 0.0, WFIR::wtBLACKMAN_HARRIS, 0.0);
+    double sum = 0.0;
+
+    for (auto tap : taps) {
+        sum += tap;
+    }
+
+    m_taps.resize(m_historyLength);
+
+    for (unsigned int i = 0; i < m_historyLength; i++) {
+        m_taps[i] = taps[i] / sum; // unity gain at DC
+    }
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    m_fftSequence = fftFactory->getEngine(m_nbSubbands, true, &m_fft);
+    m_history.resize(2 * m_historyLength);
+    m_accumulator.resize(m_nbSubbands);
+    reset();
+
+    qDebug("PolyphaseChannelizer::configure: %u sub-bands %u taps per sub-band", m_nbSubbands, m_tapsPerSubband);
+}
+
+void PolyphaseChannelizer::reset()
+{
+    m_history.fill(Complex{0.0f, 0.0f});
+    m_writeIndex = 0;
+    m_inputCount = 0;
+    m_outputCount = 0;
+}
+
+void PolyphaseChannelizer::setSubbandActive(int subbandIndex, bool active)
+{
+    if ((subbandIndex < 0) || (subbandIndex >= (int) m_nbSubbands)) {
+        return;
+    }
+
+    if (active) {
+        m_subbandRefCount[subbandIndex]++;
+    } else if (m_subbandRefCount[subbandIndex] > 0) {
+        m_subbandRefCount[subbandIndex]--;
+    }
+}
+
+void PolyphaseChannelizer::clearSubbandSamples()
+{
+    for (auto& samples : m_subbandSamples) {
+        samples.clear();
+    }
+}
+
+void PolyphaseChannelizer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (m_nbSubbands == 0) {
+        return;
+    }
+
+    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    {
+        // history is stored newest first from m_writeIndex and mirrored so that it is always contiguous
+        m_writeIndex = (m_writeIndex == 0 ? m_historyLength : m_writeIndex) - 1;
+        Real re = it->m_real;
+        Real im = it->m_imag;
+        m_history.re()[m_writeIndex] = re;
+        m_history.im()[m_writeIndex] = im;
+        m_history.re()[m_writeIndex + m_historyLength] = re;
+        m_history.im()[m_writeIndex + m_historyLength] = im;
+
+        if (++m_inputCount == m_decimation)
+        {
+            m_inputCount = 0;
+            runFilterbank();
+        }
+    }
+}
+
+void PolyphaseChannelizer::runFilterbank()
+{
+    // y_k[n] = (-1)^(k*n) * IDFT_k( sum_l h[p+lM] * x[nD-p-lM] ) with D = M/2
+    // I and Q are split and the sum runs one tap row of M branches at a time
+    // so that the inner loops are over contiguous memory and vectorize
+    const Real *xRe = m_history.re() + m_writeIndex;
+    const Real *xIm = m_history.im() + m_writeIndex;
+    const Real *h = m_taps.data();
+    Real *accRe = m_accumulator.re();
+    Real *accIm = m_accumulator.im();
+    const unsigned int M = m_nbSubbands;
+
+    for (unsigned int p = 0; p < M; p++)
+    {
+        accRe[p] = xRe[p] * h[p];
+        accIm[p] = xIm[p] * h[p];
+    }
+
+    for (unsigned int l = M; l < m_historyLength; l += M)
+    {
+        const Real *xr = xRe + l;
+        const Real *xi = xIm + l;
+        const Real *hl = h + l;
+
+        for (unsigned int p = 0; p < M; p++)
+        {
+            accRe[p] += xr[p] * hl[p];
+            accIm[p] += xi[p] * hl[p];
+        }
+    }
+
+    m_accumulator.copyTo(m_fft->in());
+
+    m_fft->transform();
+    const Complex *out = m_fft->out();
+    bool oddOutput = (m_outputCount & 1) != 0;
+
+    for (unsigned int k = 0; k < m_nbSubbands; k++)
+    {
+        if (m_subbandRefCount[k] == 0) {
+            continue;
+        }
+
+        Complex y = (oddOutput && (k & 1)) ? -out[k] : out[k];
+        m_subbandSamples[k].push_back(Sample(std::round(y.real()), std::round(y.imag())));
+    }
+
+    m_outputCount++;
+}
+
+int PolyphaseChannelizer::getSubbandSampleRate(unsigned int nbSubbands, int basebandSampleRate)
+{
+    return nbSubbands == 0 ? basebandSampleRate : (2 * basebandSampleRate) / (int) nbSubbands;
+}
+
+qint64 PolyphaseChannelizer::getSubbandFrequencyOffset(unsigned int nbSubbands, int basebandSampleRate, int subbandIndex)
+{
+    if (nbSubbands == 0) {
+        return 0;
+    }
+
+    int k = subbandIndex < (int) nbSubbands / 2 ? subbandIndex : subbandIndex - (int) nbSubbands;
+    return ((qint64) k * basebandSampleRate) / nbSubbands;
+}
+
+int PolyphaseChannelizer::getSubbandIndex(unsigned int nbSubbands, int basebandSampleRate, qint64 frequencyOffset, int bandwidth)
+{
+    if ((nbSubbands == 0) || (basebandSampleRate <= 0)) {
+        return -1;
+    }
+
+    double spacing = (double) basebandSampleRate / nbSubbands;
+
+    // channel must lie within the baseband
+    if ((std::abs((double) frequencyOffset) + bandwidth / 2.0) > basebandSampleRate / 2.0) {
+        return -1;
+    }
+
+    int k = (int) std::round(frequencyOffset / spacing);
+
+    if ((k >= (int) nbSubbands / 2) || (k < -(int) nbSubbands / 2)) {
+        return -1;
+    }
+
+    // channel must lie within the prototype filter passband
+    if ((std::abs(frequencyOffset - k * spacing) + bandwidth / 2.0) > 0.75 * spacing) {
+        return -1;
+    }
+
+    return k < 0 ? k + (int) nbSubbands : k;
+}
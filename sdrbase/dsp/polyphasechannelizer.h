@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_POLYPHASECHANNELIZER_H
+#define SDRBASE_DSP_POLYPHASECHANNELIZER_H
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "dsp/splitcomplexvector.h"
+#include "export.h"
+
+class FFTEngine;
+
+// Polyphase FFT filterbank analysis channelizer. Splits the device baseband in
+// M overlapping sub-bands in one pass so that many narrowband channels do not
+// have to mix and decimate the full rate baseband each on their own.
+//
+// The filterbank is 2x oversampled: sub-band k is centered at k*Fs/M and is
+// output at 2*Fs/M. The prototype filter passband is +/-0.75*Fs/M so that any
+// channel up to Fs/(2M) wide fits in the sub-band of the nearest center.
+class SDRBASE_API PolyphaseChannelizer
+{
+public:
+    PolyphaseChannelizer();
+    ~PolyphaseChannelizer();
+
+    void configure(unsigned int nbSubbands, unsigned int tapsPerSubband = 16); //!< nbSubbands power of two >= 4 or 0 to disable
+    unsigned int getNbSubbands() const { return m_nbSubbands; }
+    bool isEnabled() const { return m_nbSubbands != 0; }
+    void reset(); //!< clear filter history
+
+    void setSubbandActive(int subbandIndex, bool active); //!< only active sub-bands are converted to output samples
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    const SampleVector& getSubbandSamples(int subbandIndex) const { return m_subbandSamples[subbandIndex]; }
+    void clearSubbandSamples();
+
+    static int getSubbandSampleRate(unsigned int nbSubbands, int basebandSampleRate);
+    static qint64 getSubbandFrequencyOffset(unsigned int nbSubbands, int basebandSampleRate, int subbandIndex);
+    static int getSubbandIndex(unsigned int nbSubbands, int basebandSampleRate, qint64 frequencyOffset, int bandwidth); //!< -1 if channel does not fit in a sub-band
+
+private:
+    unsigned int m_nbSubbands;    //!< M
+    unsigned int m_tapsPerSubband; //!< P
+    unsigned int m_decimation;    //!< M/2
+    AlignedRealVector m_taps;     //!< prototype filter of M*P taps
+    SplitComplexVector m_history; //!< input history mirrored twice for contiguous access newest first
+    SplitComplexVector m_accumulator; //!< M polyphase branch outputs
+    unsigned int m_historyLength; //!< M*P
+    unsigned int m_writeIndex;
+    unsigned int m_inputCount;
+    unsigned int m_outputCount;
+    std::vector<int> m_subbandRefCount;
+    std::vector<SampleVector> m_subbandSamples;
+    FFTEngine *m_fft;
+    unsigned int m_fftSequence;
+
+    void runFilterbank();
+    void releaseFFT();
+};
+
+#endif // SDRBASE_DSP_POLYPHASECHANNELIZER_H
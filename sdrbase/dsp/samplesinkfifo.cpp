@@ -23,6 +23,7 @@
 
 void SampleSinkFifo::create(unsigned int s)
 {
+	m_readSamples += m_fill; // discarded
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
@@ -35,6 +36,7 @@ void SampleSinkFifo::reset()
 {
 	QMutexLocker mutexLocker(&m_mutex);
 	m_suppressed = -1;
+	m_readSamples += m_fill; // discarded
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
@@ -45,7 +47,10 @@ SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	m_data(),
 	m_total(0),
 	m_writtenSignalCount(0),
-	m_writtenSignalRateDivider(1)
+	m_writtenSignalRateDivider(1),
+	m_overflowCount(0),
+	m_overflowSamples(0),
+	m_readSamples(0)
 {
 	m_suppressed = -1;
 	m_size = 0;
@@ -59,7 +64,10 @@ SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	m_data(),
 	m_total(0),
 	m_writtenSignalCount(0),
-	m_writtenSignalRateDivider(1)
+	m_writtenSignalRateDivider(1),
+	m_overflowCount(0),
+	m_overflowSamples(0),
+	m_readSamples(0)
 {
 	m_suppressed = -1;
 	create(size);
@@ -70,7 +78,10 @@ SampleSinkFifo::SampleSinkFifo(const SampleSinkFifo& other) :
     m_data(other.m_data),
 	m_total(0),
 	m_writtenSignalCount(0),
-	m_writtenSignalRateDivider(1)
+	m_writtenSignalRateDivider(1),
+	m_overflowCount(0),
+	m_overflowSamples(0),
+	m_readSamples(0)
 {
   	m_suppressed = -1;
 	m_size = m_data.size();
@@ -92,6 +103,12 @@ bool SampleSinkFifo::setSize(int size)
 	return m_data.size() == (unsigned int)size;
 }
 
+void SampleSinkFifo::setTask(const DSPScheduler::TaskPtr& task)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+	m_task = task;
+}
+
 void SampleSinkFifo::setWrittenSignalRateDivider(unsigned int divider)
 {
 	QMutexLocker mutexLocker(&m_mutex);
@@ -116,6 +133,9 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 
     if (total < count)
     {
+		m_overflowCount++;
+		m_overflowSamples += count - total;
+
 		if (m_suppressed < 0)
         {
 			m_suppressed = 0;
@@ -154,9 +174,14 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
+	if (m_fill > 0)
+	{
 		emit dataReady();
-    }
+
+		if (m_task) {
+			m_task->schedule();
+		}
+	}
 
 	m_total += total;
 
@@ -187,6 +212,9 @@ unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVec
 
     if (total < count)
     {
+		m_overflowCount++;
+		m_overflowSamples += count - total;
+
 		if (m_suppressed < 0)
         {
 			m_suppressed = 0;
@@ -225,9 +253,14 @@ unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVec
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
+	if (m_fill > 0)
+	{
 		emit dataReady();
-    }
+
+		if (m_task) {
+			m_task->schedule();
+		}
+	}
 
 	m_total += total;
 
@@ -276,6 +309,8 @@ unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::it
 		remaining -= len;
 	}
 
+	m_readSamples += total;
+
 	return total;
 }
 
@@ -351,10 +386,17 @@ unsigned int SampleSinkFifo::readCommit(unsigned int count)
 
     m_head = (m_head + count) % m_size;
 	m_fill -= count;
+	m_readSamples += count;
 
 	return count;
 }
 
+quint64 SampleSinkFifo::getReadPosition()
+{
+	QMutexLocker mutexLocker(&m_mutex);
+	return m_readSamples + m_overflowSamples;
+}
+
 unsigned int SampleSinkFifo::getSizePolicy(unsigned int sampleRate)
 {
     return (sampleRate/100)*64; // .64s
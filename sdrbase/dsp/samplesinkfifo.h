@@ -23,6 +23,7 @@
 #include <QRecursiveMutex>
 #include <QElapsedTimer>
 #include "dsp/dsptypes.h"
+#include "dsp/dspscheduler.h"
 #include "export.h"
 
 class SDRBASE_API SampleSinkFifo : public QObject {
@@ -35,6 +36,9 @@ private:
 	int m_total;
 	unsigned int m_writtenSignalCount;
 	unsigned int m_writtenSignalRateDivider;
+	quint64 m_overflowCount;   //!< number of writes that did not fit entirely
+	quint64 m_overflowSamples; //!< total number of samples dropped on overflow
+	quint64 m_readSamples;     //!< samples read or discarded on reset
 	QRecursiveMutex m_mutex;
 
 	unsigned int m_size;
@@ -42,6 +46,7 @@ private:
 	unsigned int m_head;
 	unsigned int m_tail;
 	QString m_label;
+	DSPScheduler::TaskPtr m_task;
 
 	void create(unsigned int s);
 
@@ -56,6 +61,9 @@ public:
 	void setWrittenSignalRateDivider(unsigned int divider);
 	inline unsigned int size() { QMutexLocker mutexLocker(&m_mutex); unsigned int size = m_size; return size; }
 	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
+	inline quint64 getOverflowCount() { QMutexLocker mutexLocker(&m_mutex); return m_overflowCount; }
+	inline quint64 getOverflowSamples() { QMutexLocker mutexLocker(&m_mutex); return m_overflowSamples; }
+	quint64 getReadPosition(); //!< Input sample index reached by the reader including dropped samples
 
 	unsigned int write(const quint8* data, unsigned int count);
 	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
@@ -67,6 +75,7 @@ public:
 		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
 	unsigned int readCommit(unsigned int count);
 	void setLabel(const QString& label) { m_label = label; }
+	void setTask(const DSPScheduler::TaskPtr& task); //!< Task scheduled when data is written in addition to the dataReady() signal
     static unsigned int getSizePolicy(unsigned int sampleRate);
 
 signals:
@@ -0,0 +1,325 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QThread>
+
+#include "samplesinkmultireaderfifo.h"
+
+SampleSinkMultiReaderFifo::SampleSinkMultiReaderFifo(QObject* parent) :
+	QObject(parent),
+	m_buffer(std::make_shared<SampleVector>()),
+	m_size(0),
+	m_generation(0),
+	m_writeCount(0),
+	m_droppedCount(0)
+{
+}
+
+SampleSinkMultiReaderFifo::~SampleSinkMultiReaderFifo()
+{
+}
+
+void SampleSinkMultiReaderFifo::setSize(unsigned int size)
+{
+	unsigned int pow2Size = 1;
+
+	while (pow2Size < size) {
+		pow2Size <<= 1;
+	}
+
+	if (size == 0) {
+		pow2Size = 0;
+	}
+
+	if (pow2Size == m_size.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	qDebug("SampleSinkMultiReaderFifo::setSize: (%s) %u", qPrintable(m_label), pow2Size);
+	// Readers still working in the previous buffer keep it alive. The new buffer is published
+	// before the generation changes so that a reader seeing the new generation sees the new buffer.
+	std::shared_ptr<SampleVector> buffer = std::make_shared<SampleVector>(pow2Size);
+	std::atomic_store(&m_buffer, buffer);
+	m_size.store(pow2Size, std::memory_order_release);
+	m_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+unsigned int SampleSinkMultiReaderFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+{
+	SampleVector& buffer = *m_buffer; // only the writer thread swaps the buffer
+	unsigned int size = buffer.size();
+
+	if (size == 0) {
+		return 0;
+	}
+
+	unsigned int count = end - begin;
+	quint64 writeCount = m_writeCount.load(std::memory_order_relaxed);
+	quint64 writeLimit = writeCount + count;
+	bool locked[m_maxReaders];
+
+	// Readers whose unread samples would be overwritten are moved forward if idle.
+	// A reader in the middle of a read keeps its samples and limits what is written.
+	for (int i = 0; i < m_maxReaders; i++)
+	{
+		Reader& rd = m_readers[i];
+		locked[i] = false;
+
+		if ((writeCount + count <= size) || (rd.m_state.load(std::memory_order_acquire) == ReaderFree)) {
+			continue;
+		}
+
+		if (rd.m_readCount.load(std::memory_order_acquire) >= writeCount + count - size) {
+			continue;
+		}
+
+		int expected = ReaderIdle;
+
+		if (rd.m_state.compare_exchange_strong(expected, ReaderLocked, std::memory_order_acq_rel)) {
+			locked[i] = true;
+		} else if (expected == ReaderReading) {
+			writeLimit = std::min(writeLimit, rd.m_readCount.load(std::memory_order_acquire) + size);
+		}
+	}
+
+	unsigned int remaining = std::max(writeLimit, writeCount) - writeCount;
+
+	if (remaining < count)
+	{
+		m_droppedCount.fetch_add(count - remaining, std::memory_order_relaxed);
+
+		for (int i = 0; i < m_maxReaders; i++) // samples not written are missed by every reader
+		{
+			if (m_readers[i].m_state.load(std::memory_order_acquire) != ReaderFree) {
+				m_readers[i].m_droppedCount.fetch_add(count - remaining, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	if (remaining > size) // only the last samples fit
+	{
+		writeCount += remaining - size;
+		begin += remaining - size;
+		remaining = size;
+	}
+
+	unsigned int pos = writeCount & (size - 1);
+	unsigned int len = std::min(remaining, size - pos);
+	std::copy(begin, begin + len, buffer.begin() + pos);
+	std::copy(begin + len, begin + remaining, buffer.begin());
+	writeCount += remaining;
+	m_writeCount.store(writeCount, std::memory_order_release);
+
+	for (int i = 0; i < m_maxReaders; i++)
+	{
+		if (!locked[i]) {
+			continue;
+		}
+
+		Reader& rd = m_readers[i];
+
+		if (writeCount - rd.m_readCount.load(std::memory_order_relaxed) > size) {
+			overflow(rd, writeCount - size, size);
+		}
+
+		rd.m_state.store(ReaderIdle, std::memory_order_release);
+	}
+
+	emit dataReady();
+
+	for (int i = 0; i < m_maxReaders; i++)
+	{
+		if (m_readers[i].m_hasTask.load(std::memory_order_acquire))
+		{
+			DSPScheduler::TaskPtr task = std::atomic_load(&m_readers[i].m_task);
+
+			if (task) {
+				task->schedule();
+			}
+		}
+	}
+
+	return remaining;
+}
+
+int SampleSinkMultiReaderFifo::addReader()
+{
+	for (int i = 0; i < m_maxReaders; i++)
+	{
+		int expected = ReaderFree;
+
+		if (m_readers[i].m_state.compare_exchange_strong(expected, ReaderLocked, std::memory_order_acq_rel))
+		{
+			Reader& reader = m_readers[i];
+			reader.m_generation = m_generation.load(std::memory_order_acquire);
+			reader.m_readCount.store(m_writeCount.load(std::memory_order_acquire), std::memory_order_relaxed);
+			reader.m_overflowCount.store(0, std::memory_order_relaxed);
+			reader.m_droppedCount.store(0, std::memory_order_relaxed);
+			reader.m_readStart = 0;
+			reader.m_buffer.reset();
+			reader.m_state.store(ReaderIdle, std::memory_order_release);
+			qDebug("SampleSinkMultiReaderFifo::addReader: (%s) reader %d", qPrintable(m_label), i);
+			return i;
+		}
+	}
+
+	qWarning("SampleSinkMultiReaderFifo::addReader: (%s) no more reader slots", qPrintable(m_label));
+	return -1;
+}
+
+void SampleSinkMultiReaderFifo::removeReader(int reader)
+{
+	if ((reader < 0) || (reader >= m_maxReaders)) {
+		return;
+	}
+
+	qDebug("SampleSinkMultiReaderFifo::removeReader: (%s) reader %d", qPrintable(m_label), reader);
+	setReaderTask(reader, nullptr);
+	acquireReader(m_readers[reader], ReaderLocked);
+	m_readers[reader].m_buffer.reset();
+	m_readers[reader].m_state.store(ReaderFree, std::memory_order_release);
+}
+
+void SampleSinkMultiReaderFifo::setReaderTask(int reader, const DSPScheduler::TaskPtr& task)
+{
+	if ((reader < 0) || (reader >= m_maxReaders)) {
+		return;
+	}
+
+	std::atomic_store(&m_readers[reader].m_task, task);
+	m_readers[reader].m_hasTask.store(task != nullptr, std::memory_order_release);
+}
+
+unsigned int SampleSinkMultiReaderFifo::fill(int reader) const
+{
+	quint64 writeCount = m_writeCount.load(std::memory_order_acquire);
+	quint64 readCount = m_readers[reader].m_readCount.load(std::memory_order_acquire);
+	quint64 size = m_size.load(std::memory_order_acquire);
+
+	return std::min(writeCount - readCount, size);
+}
+
+unsigned int SampleSinkMultiReaderFifo::readBegin(int reader, unsigned int count,
+	SampleVector::const_iterator* part1Begin, SampleVector::const_iterator* part1End,
+	SampleVector::const_iterator* part2Begin, SampleVector::const_iterator* part2End)
+{
+	Reader& rd = m_readers[reader];
+	acquireReader(rd, ReaderReading); // from now on the writer does not overwrite from the read position
+	unsigned int generation;
+
+	do // make sure buffer and generation match
+	{
+		generation = m_generation.load(std::memory_order_acquire);
+		rd.m_buffer = std::atomic_load(&m_buffer);
+	} while (generation != m_generation.load(std::memory_order_acquire));
+
+	const SampleVector& buffer = *rd.m_buffer;
+	unsigned int size = buffer.size();
+	quint64 writeCount = m_writeCount.load(std::memory_order_acquire);
+	quint64 readCount = rd.m_readCount.load(std::memory_order_relaxed);
+
+	if (generation != rd.m_generation) // buffer was resized: start over from the write position
+	{
+		rd.m_generation = generation;
+		readCount = writeCount;
+		rd.m_readCount.store(readCount, std::memory_order_release);
+	}
+	else if (writeCount - readCount > size) // only when added while the writer was writing
+	{
+		overflow(rd, writeCount, size);
+		readCount = writeCount;
+	}
+
+	unsigned int total = std::min((quint64) count, writeCount - readCount);
+	rd.m_readStart = readCount;
+
+	if (total == 0)
+	{
+		*part1Begin = buffer.end();
+		*part1End = buffer.end();
+		*part2Begin = buffer.end();
+		*part2End = buffer.end();
+		rd.m_state.store(ReaderIdle, std::memory_order_release);
+		return 0;
+	}
+
+	unsigned int pos = readCount & (size - 1);
+	unsigned int len = std::min(total, size - pos);
+	*part1Begin = buffer.begin() + pos;
+	*part1End = buffer.begin() + pos + len;
+
+	if (len < total)
+	{
+		*part2Begin = buffer.begin();
+		*part2End = buffer.begin() + (total - len);
+	}
+	else
+	{
+		*part2Begin = buffer.end();
+		*part2End = buffer.end();
+	}
+
+	return total;
+}
+
+unsigned int SampleSinkMultiReaderFifo::readCommit(int reader, unsigned int count)
+{
+	Reader& rd = m_readers[reader];
+
+	if (rd.m_state.load(std::memory_order_relaxed) != ReaderReading) {
+		return 0;
+	}
+
+	// the writer has not overwritten the samples read in place so they can all be committed
+	rd.m_readCount.store(rd.m_readStart + count, std::memory_order_release);
+	rd.m_state.store(ReaderIdle, std::memory_order_release);
+	return count;
+}
+
+quint64 SampleSinkMultiReaderFifo::getReadPosition(int reader) const
+{
+	// samples not written are counted as passed by every reader
+	return m_readers[reader].m_readCount.load(std::memory_order_acquire) + m_droppedCount.load(std::memory_order_relaxed);
+}
+
+void SampleSinkMultiReaderFifo::overflow(Reader& reader, quint64 readCount, unsigned int size)
+{
+	quint64 lastReadCount = reader.m_readCount.load(std::memory_order_relaxed);
+	qCritical("SampleSinkMultiReaderFifo::overflow: (%s) reader %d skipping %llu samples with size %u",
+		qPrintable(m_label), (int) (&reader - m_readers), (unsigned long long) (readCount - lastReadCount), size);
+	reader.m_overflowCount.fetch_add(1, std::memory_order_relaxed);
+	reader.m_droppedCount.fetch_add(readCount - lastReadCount, std::memory_order_relaxed);
+	reader.m_readCount.store(readCount, std::memory_order_release);
+}
+
+void SampleSinkMultiReaderFifo::acquireReader(Reader& reader, ReaderState state)
+{
+	int expected = ReaderIdle;
+
+	while (!reader.m_state.compare_exchange_weak(expected, state, std::memory_order_acq_rel))
+	{
+		if (expected == state) { // already there e.g. readBegin without readCommit
+			return;
+		}
+
+		expected = ReaderIdle;
+		QThread::yieldCurrentThread(); // the writer holds the reader while moving its read position
+	}
+}
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Single producer multiple consumer baseband sample ring buffer. The device     //
+// engine writes the baseband once and each channel reads it in place with its  //
+// own read position. The writer never waits and never overwrites samples that  //
+// a reader is reading: an idle reader that would be lapped is moved forward    //
+// and the overflow is counted for this reader only. When a lagging reader is   //
+// in the middle of a read the samples that do not fit are dropped instead.     //
+// No lock is taken on the data path.                                           //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLESINKMULTIREADERFIFO_H
+#define SDRBASE_DSP_SAMPLESINKMULTIREADERFIFO_H
+
+#include <atomic>
+#include <memory>
+
+#include <QObject>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "dsp/dspscheduler.h"
+#include "export.h"
+
+class SDRBASE_API SampleSinkMultiReaderFifo : public QObject {
+	Q_OBJECT
+
+public:
+	static const int m_maxReaders = 32;
+
+	SampleSinkMultiReaderFifo(QObject* parent = nullptr);
+	~SampleSinkMultiReaderFifo();
+
+	// writer side (single thread)
+	void setSize(unsigned int size); //!< Rounded up to a power of two. Readers are resynchronized.
+	unsigned int size() const { return m_size.load(std::memory_order_acquire); }
+	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
+
+	// reader side (any thread, one thread per reader)
+	int addReader(); //!< Returns reader index or -1 if all reader slots are taken
+	void removeReader(int reader);
+	void setReaderTask(int reader, const DSPScheduler::TaskPtr& task); //!< Task scheduled when data is written in addition to the dataReady() signal
+	unsigned int fill(int reader) const;
+	unsigned int readBegin(int reader, unsigned int count,
+		SampleVector::const_iterator* part1Begin, SampleVector::const_iterator* part1End,
+		SampleVector::const_iterator* part2Begin, SampleVector::const_iterator* part2End);
+	unsigned int readCommit(int reader, unsigned int count); //!< Ends the in place read. Returns the number of samples committed (0 if no read was in progress)
+	quint64 getOverflowCount(int reader) const { return m_readers[reader].m_overflowCount.load(std::memory_order_relaxed); }
+	quint64 getDroppedCount(int reader) const { return m_readers[reader].m_droppedCount.load(std::memory_order_relaxed); } //!< Samples this reader did not get (skipped or not written)
+	quint64 getDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); } //!< Samples not written because a lagging reader was reading
+	quint64 getReadPosition(int reader) const; //!< Input sample index reached by the reader including the samples not written
+	void setLabel(const QString& label) { m_label = label; }
+
+signals:
+	void dataReady();
+
+private:
+	enum ReaderState
+	{
+		ReaderFree,    //!< slot not in use
+		ReaderIdle,    //!< between reads: the writer may move the read position
+		ReaderReading, //!< between readBegin and readCommit: the writer must not overwrite from the read position
+		ReaderLocked   //!< read position being moved by the writer or slot being set up
+	};
+
+	struct Reader
+	{
+		std::atomic<int> m_state;
+		std::atomic<quint64> m_readCount;     //!< absolute position of the next sample to read
+		std::atomic<quint64> m_overflowCount;
+		std::atomic<quint64> m_droppedCount;  //!< samples this reader did not get
+		quint64 m_readStart;                  //!< position of the current in place read
+		unsigned int m_generation;            //!< buffer generation of the current in place read
+		std::shared_ptr<const SampleVector> m_buffer; //!< keeps the buffer alive during an in place read
+		std::atomic<bool> m_hasTask;
+		DSPScheduler::TaskPtr m_task;         //!< accessed with atomic_load/atomic_store as it is read by the writer
+
+		Reader() :
+			m_state(ReaderFree),
+			m_readCount(0),
+			m_overflowCount(0),
+			m_droppedCount(0),
+			m_readStart(0),
+			m_generation(0),
+			m_hasTask(false)
+		{}
+	};
+
+	std::shared_ptr<SampleVector> m_buffer; //!< accessed with atomic_load/atomic_store as it is swapped on resize
+	std::atomic<unsigned int> m_size;
+	std::atomic<unsigned int> m_generation; //!< incremented on each buffer swap
+	std::atomic<quint64> m_writeCount;      //!< absolute number of samples written
+	std::atomic<quint64> m_droppedCount;    //!< samples dropped by the writer
+	Reader m_readers[m_maxReaders];
+	QString m_label;
+
+	void overflow(Reader& reader, quint64 readCount, unsigned int size);
+	static void acquireReader(Reader& reader, ReaderState state); //!< Reader side. Moves an idle reader to state waiting for the writer to release it
+};
+
+#endif // SDRBASE_DSP_SAMPLESINKMULTIREADERFIFO_H
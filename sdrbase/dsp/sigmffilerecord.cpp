@@ -42,7 +42,8 @@ SigMFFileRecord::SigMFFileRecord() :
     m_sampleStart(0),
     m_sampleCount(0),
     m_initialMsCount(0),
-    m_initialBytesCount(0)
+    m_initialBytesCount(0),
+    m_directIO(false)
 {
     qDebug("SigMFFileRecord::SigMFFileRecord: test");
 	setObjectName("SigMFFileSink");
@@ -62,7 +63,8 @@ SigMFFileRecord::SigMFFileRecord(const QString& fileName, const QString& hardwar
     m_sampleStart(0),
     m_sampleCount(0),
     m_initialMsCount(0),
-    m_initialBytesCount(0)
+    m_initialBytesCount(0),
+    m_directIO(false)
 {
     qDebug("SigMFFileRecord::SigMFFileRecord: %s", qPrintable(fileName));
     setObjectName("SigMFFileSink");
@@ -81,9 +83,7 @@ SigMFFileRecord::~SigMFFileRecord()
         m_metaFile.close();
     }
 
-    if (m_sampleFile.is_open()) {
-        m_sampleFile.close();
-    }
+    m_sampleWriter.close();
 
     delete m_metaRecord;
 }
@@ -98,9 +98,7 @@ void SigMFFileRecord::setFileName(const QString& fileName)
             m_metaFile.close();
         }
 
-        if (m_sampleFile.is_open()) {
-            m_sampleFile.close();
-        }
+        m_sampleWriter.close();
 
         m_fileName = fileName;
 
@@ -135,8 +133,8 @@ void SigMFFileRecord::setFileName(const QString& fileName)
                     }
 
                     m_sampleFileName = m_fileName + ".sigmf-data";
-                    m_sampleFile.open(m_sampleFileName.toStdString().c_str(), std::ios::binary & std::ios::app);
-                    m_initialBytesCount = (uint64_t) m_sampleFile.tellp();
+                    m_sampleWriter.open(m_sampleFileName, true, m_directIO);
+                    m_initialBytesCount = m_sampleWriter.getPosition();
                     m_sampleStart =  m_initialBytesCount / sizeof(Sample);
 
                     m_recordStart = false;
@@ -182,8 +180,7 @@ bool SigMFFileRecord::startRecording()
         m_sampleStart = 0;
         m_sampleFileName = m_fileName + ".sigmf-data";
         m_metaFileName = m_fileName + ".sigmf-meta";
-        m_sampleFile.open(m_sampleFileName.toStdString().c_str(), std::ios::binary);
-        if (!m_sampleFile.is_open())
+        if (!m_sampleWriter.open(m_sampleFileName, false, m_directIO))
         {
             qWarning() << "SigMFFileRecord::startRecording: failed to open file: " << m_sampleFileName;
             success = false;
@@ -215,7 +212,14 @@ bool SigMFFileRecord::stopRecording()
       	qDebug("SigMFFileRecord::stopRecording: file previous capture");
         makeCapture();
         m_recordOn = false;
-        if (m_sampleFile.bad())
+        FileRecordWriter::Stats stats;
+        m_sampleWriter.getStats(stats);
+        if (stats.m_droppedBytes != 0)
+        {
+            qWarning() << "SigMFFileRecord::stopRecording: " << stats.m_droppedBytes / sizeof(Sample)
+                << " samples dropped while writing to " << m_sampleFileName;
+        }
+        if (stats.m_error)
         {
             qWarning() << "SigMFFileRecord::stopRecording: an error occurred while writing to " << m_sampleFileName;
             return false;
@@ -252,8 +256,8 @@ void SigMFFileRecord::makeCapture()
     if (m_sampleCount)
     {
         qDebug("SigMFFileRecord::makeCapture: m_sampleStart: %llu m_sampleCount: %llu", m_sampleStart, m_sampleCount);
-        // Flush samples to disk
-        m_sampleFile.flush();
+        // Samples are not flushed: the capture only refers to sample counts and the writer keeps
+        // them in order. A flush here would stall the DSP thread on the disk at every retune.
         // calculate SHA512 and write it to header
         // m_metaRecord->global.access<core::GlobalT>().sha512 = sw::sha512::file(m_sampleFileName.toStdString()); // skip takes too long
         // Add new capture
@@ -292,8 +296,9 @@ void SigMFFileRecord::feed(const SampleVector::const_iterator& begin, const Samp
 
     if (begin < end) // if there is something to put out
     {
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
-        m_sampleCount += end - begin;
+        // samples are queued to the writer thread. They are dropped if the disk cannot keep up
+        qint64 written = m_sampleWriter.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        m_sampleCount += written / sizeof(Sample);
     }
 }
 
@@ -29,6 +29,7 @@
 
 #include "dsp/sigmf_forward.h"
 #include "dsp/filerecordinterface.h"
+#include "dsp/filerecordwriter.h"
 #include "export.h"
 
 class Message;
@@ -55,6 +56,8 @@ public:
     unsigned int getNbCaptures() const;
     uint64_t getInitialMsCount() const { return m_initialMsCount; }
     uint64_t getInitialBytesCount() const { return m_initialBytesCount; }
+    virtual void setDirectIO(bool directIO) { m_directIO = directIO; } //!< Bypass page cache on next file opening (Linux only)
+    virtual bool getWriterStats(FileRecordWriter::Stats& stats) { m_sampleWriter.getStats(stats); return true; }
 
 private:
     QString m_hardwareId;
@@ -68,11 +71,12 @@ private:
     bool m_recordStart;
     QDateTime m_captureStartDT;
     std::ofstream m_metaFile;
-    std::ofstream m_sampleFile;
+    FileRecordWriter m_sampleWriter;
     quint64 m_sampleStart;
     quint64 m_sampleCount;
     quint64 m_initialMsCount;
     quint64 m_initialBytesCount;
+    bool m_directIO;
     sigmf::SigMF<sigmf::Global<core::DescrT, sdrangel::DescrT>,
             sigmf::Capture<core::DescrT, sdrangel::DescrT>,
             sigmf::Annotation<core::DescrT> > *m_metaRecord;
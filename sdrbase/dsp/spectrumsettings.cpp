@@ -57,6 +57,7 @@ void SpectrumSettings::resetToDefaults()
 	m_averagingIndex = 0;
     m_averagingValue = 1;
 	m_linear = false;
+    m_fastLog = false;
     m_ssb = false;
     m_usb = true;
 	m_wsSpectrum = false;
@@ -120,6 +121,7 @@ QByteArray SpectrumSettings::serialize() const
     s.writeS32(39, m_measurementHarmonics);
     // 41, 42 used below
     s.writeBool(42, m_measurementHighlight);
+    s.writeBool(43, m_fastLog);
     s.writeS32(100, m_histogramMarkers.size());
 
 	for (int i = 0; i < m_histogramMarkers.size(); i++) {
@@ -227,6 +229,7 @@ bool SpectrumSettings::deserialize(const QByteArray& data)
         d.readS32(38, &m_measurementAdjChBandwidth, 10000);
         d.readS32(39, &m_measurementHarmonics, 5);
         d.readBool(42, &m_measurementHighlight, true);
+        d.readBool(43, &m_fastLog, false);
 
 		int histogramMarkersSize;
 		d.readS32(100, &histogramMarkersSize, 0);
@@ -309,6 +312,7 @@ void SpectrumSettings::formatTo(SWGSDRangel::SWGObject *swgObject) const
 	swgSpectrum->setPowerRange(m_powerRange);
     swgSpectrum->setFpsPeriodMs(m_fpsPeriodMs);
 	swgSpectrum->setLinear(m_linear ? 1 : 0);
+    swgSpectrum->setFastLog(m_fastLog ? 1 : 0);
 	swgSpectrum->setWsSpectrum(m_wsSpectrum ? 1 : 0);
 	swgSpectrum->setWsSpectrumPort(m_wsSpectrumPort);
 
@@ -427,6 +431,9 @@ void SpectrumSettings::updateFrom(const QStringList& keys, const SWGSDRangel::SW
 	if (keys.contains("spectrumConfig.linear")) {
 		m_linear = swgSpectrum->getLinear() != 0;
 	}
+	if (keys.contains("spectrumConfig.fastLog")) {
+		m_fastLog = swgSpectrum->getFastLog() != 0;
+	}
 	if (keys.contains("spectrumConfig.wsSpectrum")) {
 		m_wsSpectrum = swgSpectrum->getWsSpectrum() != 0;
 	}
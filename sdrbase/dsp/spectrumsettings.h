@@ -107,6 +107,7 @@ public:
 	int m_averagingIndex;
 	unsigned int m_averagingValue;
 	bool m_linear; //!< linear else logarithmic scale
+    bool m_fastLog; //!< approximate logarithm (about 1e-4 dB) for faster dB conversion of large FFTs
     bool m_ssb;    //!< SSB display with spectrum center at start of array or display - else spectrum center is on center
     bool m_usb;    //!< USB display with increasing frequencies towads the right - else decreasing frequencies
 	bool m_wsSpectrum;           //!< Start or stop websocket spectrum server
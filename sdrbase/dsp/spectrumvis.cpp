@@ -15,6 +15,10 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
 #include "SWGGLSpectrum.h"
 #include "SWGSpectrumServer.h"
 #include "SWGSuccessResponse.h"
@@ -44,6 +48,7 @@ SpectrumVis::SpectrumVis(Real scalef) :
 	m_fftBuffer(4096),
 	m_powerSpectrum(4096),
     m_psd(4096),
+    m_powerBins(4096),
 	m_fftBufferFill(0),
 	m_needMoreSamples(false),
     m_frequencyZoomFactor(1.0f),
@@ -425,111 +430,66 @@ void SpectrumVis::processFFT(bool positiveOnly)
     // calculate FFT
     m_fft->transform();
 
-    // extract power spectrum and reorder buckets
+    // Extract power spectrum in display order then run each stage on the whole
+    // array so that the loops vectorize. With positive frequencies only each bin
+    // is displayed twice.
     const Complex* fftOut = m_fft->out();
-    Complex c;
-    Real v;
     std::size_t halfSize = m_settings.m_fftSize / 2;
+    std::size_t nbBins = positiveOnly ? halfSize : m_settings.m_fftSize;
+    Real *bins = m_powerBins.data();
 
-    if (m_settings.m_averagingMode == SpectrumSettings::AvgModeNone)
+    if (positiveOnly)
     {
-        m_specMax = 0.0f;
+        magSq(fftOut, bins, halfSize);
+    }
+    else
+    {
+        magSq(&fftOut[halfSize], bins, halfSize);
+        magSq(fftOut, &bins[halfSize], halfSize);
+    }
 
-        if ( positiveOnly )
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i * 2] = v;
-                m_powerSpectrum[i * 2 + 1] = v;
-            }
-        }
-        else
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i] = v;
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                m_psd[i + halfSize] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i + halfSize] = v;
-            }
-        }
+    bool available = true; // a new averaged spectrum is available
 
-        // send new data to visualisation
-        if (m_glSpectrum)
+    if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMoving) {
+        m_movingAverage.storeAndGetAvg(bins, 0, nbBins);
+    } else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeFixed) {
+        available = m_fixedAverage.storeAndGetAvg(bins, 0, nbBins);
+    } else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMax) {
+        available = m_max.storeAndGetMax(bins, 0, nbBins);
+    }
+
+    if (available)
+    {
+        Real specMax = 0.0f;
+        Real psdScale = 1.0f / m_powFFTDiv; // exact as FFT size is a power of two
+
+        for (std::size_t i = 0; i < nbBins; i++)
         {
-            m_glSpectrum->newSpectrum(
-                &m_powerSpectrum.data()[fftMin],
-                fftMax - fftMin,
-                m_settings.m_fftSize
-            );
+            specMax = bins[i] > specMax ? bins[i] : specMax;
+            m_psd[i] = bins[i] * psdScale;
         }
 
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear,
-                m_settings.m_ssb,
-                m_settings.m_usb
-            );
+        m_specMax = specMax;
+
+        if (m_settings.m_linear) {
+            std::copy(m_psd.begin(), m_psd.begin() + nbBins, bins);
+        } else if (m_settings.m_fastLog) {
+            fastPowerDb(bins, nbBins, m_mult, m_ofs);
+        } else {
+            powerDb(bins, nbBins, m_mult, m_ofs);
         }
-    }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMoving)
-    {
-        m_specMax = 0.0f;
 
-        if ( positiveOnly )
+        if (positiveOnly)
         {
             for (std::size_t i = 0; i < halfSize; i++)
             {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                v = m_movingAverage.storeAndGetAvg(v, i);
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i * 2] = v;
-                m_powerSpectrum[i * 2 + 1] = v;
+                m_powerSpectrum[i * 2] = bins[i];
+                m_powerSpectrum[i * 2 + 1] = bins[i];
             }
         }
         else
         {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                v = m_movingAverage.storeAndGetAvg(v, i+halfSize);
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i] = v;
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                v = m_movingAverage.storeAndGetAvg(v, i);
-                m_psd[i + halfSize] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i + halfSize] = v;
-            }
+            std::copy(bins, bins + nbBins, m_powerSpectrum.begin());
         }
 
         // send new data to visualisation
@@ -555,174 +515,49 @@ void SpectrumVis::processFFT(bool positiveOnly)
                 m_settings.m_usb
             );
         }
+    }
 
+    if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMoving) {
         m_movingAverage.nextAverage();
+    } else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeFixed) {
+        m_fixedAverage.nextAverage();
+    } else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMax) {
+        m_max.nextMax();
     }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeFixed)
-    {
-        double avg;
-        Real specMax = 0.0f;
-
-        if ( positiveOnly )
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-                {
-                    m_psd[i] = avg/m_powFFTDiv;
-                    specMax = avg > specMax ? avg : specMax;
-                    avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                    m_powerSpectrum[i * 2] = avg;
-                    m_powerSpectrum[i * 2 + 1] = avg;
-                }
-            }
-        }
-        else
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_fixedAverage.storeAndGetAvg(avg, v, i+halfSize))
-                {
-                    m_psd[i] = avg/m_powFFTDiv;
-                    specMax = avg > specMax ? avg : specMax;
-                    avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                    m_powerSpectrum[i] = avg;
-                }
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-                {
-                    m_psd[i + halfSize] = avg/m_powFFTDiv;
-                    specMax = avg > specMax ? avg : specMax;
-                    avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                    m_powerSpectrum[i + halfSize] = avg;
-                }
-            }
-        }
-
-        // result available
-        if (m_fixedAverage.nextAverage())
-        {
-            m_specMax = specMax;
+}
 
-            // send new data to visualisation
-            if (m_glSpectrum)
-            {
-                m_glSpectrum->newSpectrum(
-                    &m_powerSpectrum.data()[fftMin],
-                    fftMax - fftMin,
-                    m_settings.m_fftSize
-                );
-            }
+void SpectrumVis::magSq(const Complex *in, Real *out, std::size_t size)
+{
+    const Real *iq = reinterpret_cast<const Real*>(in);
 
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear,
-                    m_settings.m_ssb,
-                    m_settings.m_usb
-                );
-            }
-        }
+    for (std::size_t i = 0; i < size; i++) {
+        out[i] = iq[2*i] * iq[2*i] + iq[2*i + 1] * iq[2*i + 1];
     }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMax)
-    {
-        double max;
-        Real specMax = 0.0f;
-
-        if ( positiveOnly )
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_max.storeAndGetMax(max, v, i))
-                {
-                    m_psd[i] = max/m_powFFTDiv;
-                    specMax = max > specMax ? max : specMax;
-                    max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                    m_powerSpectrum[i * 2] = max;
-                    m_powerSpectrum[i * 2 + 1] = max;
-                }
-            }
-        }
-        else
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_max.storeAndGetMax(max, v, i+halfSize))
-                {
-                    m_psd[i] = max/m_powFFTDiv;
-                    specMax = max > specMax ? max : specMax;
-                    max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                    m_powerSpectrum[i] = max;
-                }
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_max.storeAndGetMax(max, v, i))
-                {
-                    m_psd[i + halfSize] = max/m_powFFTDiv;
-                    specMax = max > specMax ? max : specMax;
-                    max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                    m_powerSpectrum[i + halfSize] = max;
-                }
-            }
-        }
-
-        // result available
-        if (m_max.nextMax())
-        {
-            m_specMax = specMax;
+}
 
-            // send new data to visualisation
-            if (m_glSpectrum)
-            {
-                m_glSpectrum->newSpectrum(
-                    &m_powerSpectrum.data()[fftMin],
-                    fftMax - fftMin,
-                    m_settings.m_fftSize
-                );
-            }
+void SpectrumVis::powerDb(Real *values, std::size_t size, Real mult, Real ofs)
+{
+    for (std::size_t i = 0; i < size; i++) {
+        values[i] = mult * log2f(values[i]) + ofs;
+    }
+}
 
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear,
-                    m_settings.m_ssb,
-                    m_settings.m_usb
-                );
-            }
-        }
+void SpectrumVis::fastPowerDb(Real *values, std::size_t size, Real mult, Real ofs)
+{
+    // log2(x) = e + log2(1+t) with x = 2^e * (1+t) and log2(1+t) approximated
+    // by a least squares polynomial on [0,1) with error below 3e-5. Zero gives
+    // about -127 (instead of -inf) which is well below any displayable level.
+    for (std::size_t i = 0; i < size; i++)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &values[i], sizeof(bits));
+        Real e = (Real) (int32_t) ((bits >> 23) & 0xff) - 127.0f;
+        bits = (bits & 0x007fffff) | 0x3f800000;
+        Real m;
+        std::memcpy(&m, &bits, sizeof(m));
+        Real t = m - 1.0f;
+        Real p = t * (1.4418259f + t * (-0.70868292f + t * (0.41542472f + t * (-0.19442637f + t * 0.045887220f))));
+        values[i] = mult * (e + p) + ofs;
     }
 }
 
@@ -854,6 +689,7 @@ void SpectrumVis::applySettings(const SpectrumSettings& settings, bool force)
         << " m_powerRange: " << settings.m_powerRange
         << " m_fpsPeriodMs: " << settings.m_fpsPeriodMs
         << " m_linear: " << settings.m_linear
+        << " m_fastLog: " << settings.m_fastLog
         << " m_ssb: " << settings.m_ssb
         << " m_usb: " << settings.m_usb
         << " m_wsSpectrumAddress: " << settings.m_wsSpectrumAddress
@@ -878,6 +714,7 @@ void SpectrumVis::applySettings(const SpectrumSettings& settings, bool force)
             m_fftBuffer.resize(fftSize);
             m_powerSpectrum.resize(fftSize);
             m_psd.resize(fftSize);
+            m_powerBins.resize(fftSize);
         }
     }
 
@@ -988,9 +825,8 @@ int SpectrumVis::webapiSpectrumServerGet(SWGSDRangel::SWGSpectrumServer& respons
 {
     (void) errorMessage;
     bool serverRunning = m_wsSpectrum.socketOpened();
-    QList<QHostAddress> peerHosts;
-    QList<quint16> peerPorts;
-    m_wsSpectrum.getPeers(peerHosts, peerPorts);
+    QList<WSSpectrum::ClientStats> clientStats;
+    m_wsSpectrum.getClientStats(clientStats);
     response.init();
     response.setRun(serverRunning ? 1 : 0);
 
@@ -1006,15 +842,18 @@ int SpectrumVis::webapiSpectrumServerGet(SWGSDRangel::SWGSpectrumServer& respons
         response.setListeningPort(serverPort);
     }
 
-    if (peerHosts.size() > 0)
+    if (clientStats.size() > 0)
     {
         response.setClients(new QList<SWGSDRangel::SWGSpectrumServer_clients*>);
 
-        for (int i = 0; i < peerHosts.size(); i++)
+        for (const auto& stats : clientStats)
         {
             response.getClients()->push_back(new SWGSDRangel::SWGSpectrumServer_clients);
-            response.getClients()->back()->setAddress(new QString(peerHosts.at(i).toString()));
-            response.getClients()->back()->setPort(peerPorts.at(i));
+            response.getClients()->back()->setAddress(new QString(stats.m_address.toString()));
+            response.getClients()->back()->setPort(stats.m_port);
+            response.getClients()->back()->setBacklogBytes(stats.m_backlogBytes);
+            response.getClients()->back()->setSentFrames(stats.m_sentFrames);
+            response.getClients()->back()->setDroppedFrames(stats.m_droppedFrames);
         }
     }
 
@@ -218,6 +218,7 @@ private:
 	std::vector<Complex> m_fftBuffer;
 	std::vector<Real> m_powerSpectrum; //!< displayable power spectrum
     std::vector<Real> m_psd; //!< real PSD
+    std::vector<Real> m_powerBins; //!< work buffer of power per bin in display order
 
     SpectrumSettings m_settings;
 	int m_overlapSize;
@@ -249,6 +250,9 @@ private:
 	QRecursiveMutex m_mutex;
 
     void processFFT(bool positiveOnly);
+    static void magSq(const Complex *in, Real *out, std::size_t size);
+    static void powerDb(Real *values, std::size_t size, Real mult, Real ofs);     //!< in place mult*log2(x)+ofs
+    static void fastPowerDb(Real *values, std::size_t size, Real mult, Real ofs); //!< same with approximate log2
     void setRunning(bool running) { m_running = running; }
     void applySettings(const SpectrumSettings& settings, bool force = false);
   	bool handleMessage(const Message& message);
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include "splitcomplexvector.h"
+
+SplitComplexVector::SplitComplexVector()
+{
+}
+
+SplitComplexVector::SplitComplexVector(unsigned int size) :
+    m_re(size),
+    m_im(size)
+{
+}
+
+void SplitComplexVector::resize(unsigned int size)
+{
+    m_re.resize(size);
+    m_im.resize(size);
+}
+
+void SplitComplexVector::clear()
+{
+    m_re.clear();
+    m_im.clear();
+}
+
+void SplitComplexVector::fill(const Complex& value)
+{
+    std::fill(m_re.begin(), m_re.end(), value.real());
+    std::fill(m_im.begin(), m_im.end(), value.imag());
+}
+
+void SplitComplexVector::assign(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    unsigned int size = end - begin;
+    resize(size);
+    const Sample *in = size ? &(*begin) : nullptr;
+    Real *re = m_re.data();
+    Real *im = m_im.data();
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        re[i] = in[i].m_real;
+        im[i] = in[i].m_imag;
+    }
+}
+
+void SplitComplexVector::assign(const Complex *begin, const Complex *end)
+{
+    unsigned int size = end - begin;
+    resize(size);
+    const Real *in = reinterpret_cast<const Real*>(begin);
+    Real *re = m_re.data();
+    Real *im = m_im.data();
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        re[i] = in[2*i];
+        im[i] = in[2*i + 1];
+    }
+}
+
+void SplitComplexVector::appendTo(SampleVector& samples) const
+{
+    unsigned int start = samples.size();
+    samples.resize(start + size());
+    Sample *out = samples.data() + start;
+
+    for (unsigned int i = 0; i < size(); i++)
+    {
+        out[i].m_real = std::round(m_re[i]);
+        out[i].m_imag = std::round(m_im[i]);
+    }
+}
+
+void SplitComplexVector::copyTo(Complex *out) const
+{
+    Real *o = reinterpret_cast<Real*>(out);
+
+    for (unsigned int i = 0; i < size(); i++)
+    {
+        o[2*i] = m_re[i];
+        o[2*i + 1] = m_im[i];
+    }
+}
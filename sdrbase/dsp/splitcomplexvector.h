@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Complex samples stored as separate aligned arrays of I and Q (structure of   //
+// arrays) so that float kernels can work on whole vectors without shuffles.    //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPLITCOMPLEXVECTOR_H_
+#define SDRBASE_DSP_SPLITCOMPLEXVECTOR_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "util/alignedallocator.h"
+#include "export.h"
+
+typedef std::vector<Real, AlignedAllocator<Real>> AlignedRealVector;
+
+class SDRBASE_API SplitComplexVector
+{
+public:
+    SplitComplexVector();
+    explicit SplitComplexVector(unsigned int size);
+
+    void resize(unsigned int size);
+    void clear();
+    void fill(const Complex& value);
+    unsigned int size() const { return m_re.size(); }
+
+    Real *re() { return m_re.data(); }
+    Real *im() { return m_im.data(); }
+    const Real *re() const { return m_re.data(); }
+    const Real *im() const { return m_im.data(); }
+
+    Complex get(unsigned int index) const { return Complex{m_re[index], m_im[index]}; }
+    void set(unsigned int index, const Complex& value) { m_re[index] = value.real(); m_im[index] = value.imag(); }
+
+    // Adapters from and to the interleaved types
+    void assign(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end); //!< Resize and convert
+    void assign(const Complex *begin, const Complex *end);                                          //!< Resize and copy
+    void appendTo(SampleVector& samples) const; //!< Append rounded samples
+    void copyTo(Complex *out) const;            //!< Interleave size() samples into out
+
+private:
+    AlignedRealVector m_re;
+    AlignedRealVector m_im;
+};
+
+#endif // SDRBASE_DSP_SPLITCOMPLEXVECTOR_H_
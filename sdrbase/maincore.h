@@ -29,6 +29,7 @@
 #include "export.h"
 #include "settings/mainsettings.h"
 #include "util/message.h"
+#include "util/messagepool.h"
 #include "pipes/messagepipes.h"
 #include "pipes/datapipes.h"
 #include "channel/channelapi.h"
@@ -710,6 +711,7 @@ public:
     // Message to pass received packets between channels and features
     class SDRBASE_API MsgPacket : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_POOL_DECLARATION
 
     public:
         const QObject *getPipeSource() const { return m_pipeSource; }
@@ -882,6 +884,7 @@ public:
     friend class CommandsDialog;
     friend class DeviceSetPresetsDialog;
     friend class ConfigurationsDialog;
+    friend class PipelineBench;
 
 signals:
     void deviceSetAdded(int index, DeviceAPI *device);
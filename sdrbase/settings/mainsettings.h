@@ -190,6 +190,48 @@ public:
         emit preferenceChanged(Preferences::Multisampling);
     }
 
+    int getDSPSchedulerThreads() const { return m_preferences.getDSPSchedulerThreads(); }
+    void setDSPSchedulerThreads(int threads)
+    {
+        m_preferences.setDSPSchedulerThreads(threads);
+        emit preferenceChanged(Preferences::DSPSchedulerThreads);
+    }
+
+    const QString& getDSPSchedulerAffinity() const { return m_preferences.getDSPSchedulerAffinity(); }
+    void setDSPSchedulerAffinity(const QString& affinity)
+    {
+        m_preferences.setDSPSchedulerAffinity(affinity);
+        emit preferenceChanged(Preferences::DSPSchedulerAffinity);
+    }
+
+    int getDSPSchedulerPriority() const { return m_preferences.getDSPSchedulerPriority(); }
+    void setDSPSchedulerPriority(int priority)
+    {
+        m_preferences.setDSPSchedulerPriority(priority);
+        emit preferenceChanged(Preferences::DSPSchedulerPriority);
+    }
+
+    int getFFTWThreads() const { return m_preferences.getFFTWThreads(); }
+    void setFFTWThreads(int threads)
+    {
+        m_preferences.setFFTWThreads(threads);
+        emit preferenceChanged(Preferences::FFTWThreads);
+    }
+
+    int getFFTWMinThreadedSize() const { return m_preferences.getFFTWMinThreadedSize(); }
+    void setFFTWMinThreadedSize(int size)
+    {
+        m_preferences.setFFTWMinThreadedSize(size);
+        emit preferenceChanged(Preferences::FFTWMinThreadedSize);
+    }
+
+    bool getFFTWBackgroundPlanning() const { return m_preferences.getFFTWBackgroundPlanning(); }
+    void setFFTWBackgroundPlanning(bool backgroundPlanning)
+    {
+        m_preferences.setFFTWBackgroundPlanning(backgroundPlanning);
+        emit preferenceChanged(Preferences::FFTWBackgroundPlanning);
+    }
+
 signals:
 	void preferenceChanged(int);
 
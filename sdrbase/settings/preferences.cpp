@@ -1,3 +1,5 @@
+#include <QThread>
+
 #include "settings/preferences.h"
 #include "util/simpleserializer.h"
 
@@ -22,6 +24,12 @@ void Preferences::resetToDefaults()
 	m_consoleMinLogLevel = QtDebugMsg;
     m_fileMinLogLevel = QtDebugMsg;
     m_multisampling = 0;
+    m_dspSchedulerThreads = 0;
+    m_dspSchedulerAffinity = "";
+    m_dspSchedulerPriority = (int) QThread::InheritPriority;
+    m_fftwThreads = 0;
+    m_fftwMinThreadedSize = 65536;
+    m_fftwBackgroundPlanning = true;
 }
 
 QByteArray Preferences::serialize() const
@@ -41,6 +49,12 @@ QByteArray Preferences::serialize() const
     s.writeFloat((int) Altitude, m_altitude);
 	s.writeS32((int) SourceItemIndex, m_sourceItemIndex);
     s.writeS32((int) Multisampling, m_multisampling);
+    s.writeS32((int) DSPSchedulerThreads, m_dspSchedulerThreads);
+    s.writeString((int) DSPSchedulerAffinity, m_dspSchedulerAffinity);
+    s.writeS32((int) DSPSchedulerPriority, m_dspSchedulerPriority);
+    s.writeS32((int) FFTWThreads, m_fftwThreads);
+    s.writeS32((int) FFTWMinThreadedSize, m_fftwMinThreadedSize);
+    s.writeBool((int) FFTWBackgroundPlanning, m_fftwBackgroundPlanning);
 	return s.final();
 }
 
@@ -95,6 +109,15 @@ bool Preferences::deserialize(const QByteArray& data)
         }
 
         d.readS32((int) Multisampling, &m_multisampling, 0);
+        d.readS32((int) DSPSchedulerThreads, &m_dspSchedulerThreads, 0);
+        d.readString((int) DSPSchedulerAffinity, &m_dspSchedulerAffinity, "");
+        d.readS32((int) DSPSchedulerPriority, &tmpInt, (int) QThread::InheritPriority);
+        m_dspSchedulerPriority = (tmpInt >= (int) QThread::IdlePriority) && (tmpInt <= (int) QThread::InheritPriority) ?
+            tmpInt : (int) QThread::InheritPriority;
+        d.readS32((int) FFTWThreads, &tmpInt, 0);
+        m_fftwThreads = tmpInt < 0 ? 0 : tmpInt;
+        d.readS32((int) FFTWMinThreadedSize, &m_fftwMinThreadedSize, 65536);
+        d.readBool((int) FFTWBackgroundPlanning, &m_fftwBackgroundPlanning, true);
 
 		return true;
 	} else
@@ -22,7 +22,13 @@ public:
         StationName,
         Altitude,
         SourceItemIndex,
-        Multisampling
+        Multisampling,
+        DSPSchedulerThreads,
+        DSPSchedulerAffinity,
+        DSPSchedulerPriority,
+        FFTWThreads,
+        FFTWMinThreadedSize,
+        FFTWBackgroundPlanning
     };
 
     Preferences();
@@ -75,6 +81,24 @@ public:
     int getMultisampling() const { return m_multisampling; }
     void setMultisampling(int samples) { m_multisampling = samples; }
 
+    int getDSPSchedulerThreads() const { return m_dspSchedulerThreads; }
+    void setDSPSchedulerThreads(int threads) { m_dspSchedulerThreads = threads; }
+
+    const QString& getDSPSchedulerAffinity() const { return m_dspSchedulerAffinity; }
+    void setDSPSchedulerAffinity(const QString& affinity) { m_dspSchedulerAffinity = affinity; }
+
+    int getDSPSchedulerPriority() const { return m_dspSchedulerPriority; }
+    void setDSPSchedulerPriority(int priority) { m_dspSchedulerPriority = priority; }
+
+    int getFFTWThreads() const { return m_fftwThreads; }
+    void setFFTWThreads(int threads) { m_fftwThreads = threads; }
+
+    int getFFTWMinThreadedSize() const { return m_fftwMinThreadedSize; }
+    void setFFTWMinThreadedSize(int size) { m_fftwMinThreadedSize = size; }
+
+    bool getFFTWBackgroundPlanning() const { return m_fftwBackgroundPlanning; }
+    void setFFTWBackgroundPlanning(bool backgroundPlanning) { m_fftwBackgroundPlanning = backgroundPlanning; }
+
 protected:
 	QString m_sourceDevice; //!< Identification of the source used in R0 tab (GUI flavor) at startup
 	int m_sourceIndex;      //!< Index of the source used in R0 tab (GUI flavor) at startup
@@ -94,6 +118,14 @@ protected:
 	QString m_logFileName;
 
     int m_multisampling;    //!< Number of samples to use for multisampling anti-aliasing (typically 0 or 4)
+
+    int m_dspSchedulerThreads;      //!< Worker threads running the channels data handling. 0 for a thread per channel
+    QString m_dspSchedulerAffinity; //!< CPUs the DSP scheduler workers are pinned to e.g. "2-5" (empty: no pinning)
+    int m_dspSchedulerPriority;     //!< QThread::Priority of the DSP scheduler workers
+
+    int m_fftwThreads;              //!< FFTW planner threads for large sizes. 0 for automatic
+    int m_fftwMinThreadedSize;      //!< Smallest FFT size planned with several threads
+    bool m_fftwBackgroundPlanning;  //!< Start new FFT sizes with an estimated plan optimized in the background
 };
 
 #endif // INCLUDE_PREFERENCES_H
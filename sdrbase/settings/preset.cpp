@@ -34,6 +34,9 @@ Preset::Preset(const Preset& other) :
 	m_spectrumConfig(other.m_spectrumConfig),
 	m_dcOffsetCorrection(other.m_dcOffsetCorrection),
 	m_iqImbalanceCorrection(other.m_iqImbalanceCorrection),
+	m_polyphaseSubbands(other.m_polyphaseSubbands),
+	m_channelSinkFanOut(other.m_channelSinkFanOut),
+	m_sharedBasebandFifo(other.m_sharedBasebandFifo),
 	m_channelConfigs(other.m_channelConfigs),
 	m_deviceConfigs(other.m_deviceConfigs),
 	m_showSpectrum(other.m_showSpectrum),
@@ -51,6 +54,9 @@ void Preset::resetToDefaults()
 	m_channelConfigs.clear();
 	m_dcOffsetCorrection = false;
 	m_iqImbalanceCorrection = false;
+	m_polyphaseSubbands = 0;
+	m_channelSinkFanOut = false;
+	m_sharedBasebandFifo = false;
 	m_showSpectrum = true;
 }
 
@@ -80,6 +86,9 @@ QByteArray Preset::serialize() const
     s.writeString(14, m_selectedDevice.m_deviceSerial);
     s.writeS32(15, m_selectedDevice.m_deviceSequence);
     s.writeS32(16, m_selectedDevice.m_deviceItemIndex);
+    s.writeU32(17, m_polyphaseSubbands);
+    s.writeBool(18, m_channelSinkFanOut);
+    s.writeBool(19, m_sharedBasebandFifo);
 
 	s.writeS32(20, m_deviceConfigs.size());
 
@@ -152,6 +161,9 @@ bool Preset::deserialize(const QByteArray& data)
         d.readString(14, &m_selectedDevice.m_deviceSerial);
         d.readS32(15, &m_selectedDevice.m_deviceSequence);
         d.readS32(16, &m_selectedDevice.m_deviceItemIndex);
+        d.readU32(17, &m_polyphaseSubbands, 0);
+        d.readBool(18, &m_channelSinkFanOut, false);
+        d.readBool(19, &m_sharedBasebandFifo, false);
 
 //		qDebug("Preset::deserialize: m_group: %s mode: %s m_description: %s m_centerFrequency: %llu",
 //				qPrintable(m_group),
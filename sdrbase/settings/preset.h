@@ -118,6 +118,12 @@ public:
     void setDCOffsetCorrection(bool dcOffsetCorrection) { m_dcOffsetCorrection = dcOffsetCorrection; }
 	bool hasIQImbalanceCorrection() const { return m_iqImbalanceCorrection; }
     void setIQImbalanceCorrection(bool iqImbalanceCorrection) { m_iqImbalanceCorrection = iqImbalanceCorrection; }
+    unsigned int getPolyphaseSubbands() const { return m_polyphaseSubbands; }
+    void setPolyphaseSubbands(unsigned int polyphaseSubbands) { m_polyphaseSubbands = polyphaseSubbands; }
+    bool getChannelSinkFanOut() const { return m_channelSinkFanOut; }
+    void setChannelSinkFanOut(bool channelSinkFanOut) { m_channelSinkFanOut = channelSinkFanOut; }
+    bool getSharedBasebandFifo() const { return m_sharedBasebandFifo; }
+    void setSharedBasebandFifo(bool sharedBasebandFifo) { m_sharedBasebandFifo = sharedBasebandFifo; }
 
 	void setShowSpectrum(bool show) { m_showSpectrum = show; }
 	bool getShowSpectrum() const { return m_showSpectrum; }
@@ -187,6 +193,15 @@ protected:
 	bool m_dcOffsetCorrection;
 	bool m_iqImbalanceCorrection;
 
+	// device polyphase channelizer sub-bands (Rx, 0 if disabled)
+	unsigned int m_polyphaseSubbands;
+
+	// feed each channel sink on its own thread (Rx)
+	bool m_channelSinkFanOut;
+
+	// channel sinks may read the baseband from the shared FIFO (Rx)
+	bool m_sharedBasebandFifo;
+
 	// channels and configurations
 	ChannelConfigs m_channelConfigs;
 
@@ -73,6 +73,33 @@ public:
         }
     }
 
+    template<typename U>
+    bool storeAndGetAvg(U *values, unsigned int index, unsigned int count) //!< in place on count consecutive indexes. Values are the averages if true
+    {
+        if (m_size <= 1) {
+            return true;
+        }
+
+        T *sum = &m_sum[index];
+
+        for (unsigned int i = 0; i < count; i++) {
+            sum[i] += values[i];
+        }
+
+        if (m_maxIndex == m_size - 1)
+        {
+            for (unsigned int i = 0; i < count; i++) {
+                values[i] = sum[i] / m_size;
+            }
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     bool storeAndGetSum(T& sum, T v, unsigned int index)
     {
         if (m_size <= 1)
@@ -78,6 +78,42 @@ public:
         }
     }
 
+    template<typename U>
+    bool storeAndGetMax(U *values, unsigned int index, unsigned int count) //!< in place on count consecutive indexes. Values are the maxima if true
+    {
+        if (m_size <= 1) {
+            return true;
+        }
+
+        T *max = &m_max[index];
+
+        if (m_maxIndex == 0)
+        {
+            for (unsigned int i = 0; i < count; i++) {
+                max[i] = values[i];
+            }
+
+            return false;
+        }
+
+        for (unsigned int i = 0; i < count; i++) {
+            max[i] = std::max(max[i], (T) values[i]);
+        }
+
+        if (m_maxIndex == m_size - 1)
+        {
+            for (unsigned int i = 0; i < count; i++) {
+                values[i] = max[i];
+            }
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     bool nextMax()
     {
         if (m_size <= 1) {
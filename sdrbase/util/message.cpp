@@ -24,10 +24,25 @@
 const char* Message::m_identifier = 0;
 
 Message::Message() :
-	m_destination(0)
+	m_destination(0),
+	m_queueNext(nullptr),
+	m_queueTime(0)
 {
 }
 
+Message::Message(const Message& other) :
+	m_destination(other.m_destination),
+	m_queueNext(nullptr),
+	m_queueTime(0)
+{
+}
+
+Message& Message::operator=(const Message& other)
+{
+	m_destination = other.m_destination; // a copy is not queued
+	return *this;
+}
+
 Message::~Message()
 {
 }
@@ -20,11 +20,15 @@
 #define INCLUDE_MESSAGE_H
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <atomic>
 #include "export.h"
 
 class SDRBASE_API Message {
 public:
 	Message();
+	Message(const Message& other);
+	Message& operator=(const Message& other);
 	virtual ~Message();
 
 	virtual const char* getIdentifier() const;
@@ -38,6 +42,13 @@ protected:
 	// addressing
 	static const char* m_identifier;
 	void* m_destination;
+
+private:
+	// MessageQueue
+	std::atomic<Message*> m_queueNext; //!< Next message in the queue (intrusive link)
+	int64_t m_queueTime;               //!< Time of push in nanoseconds for latency statistics
+
+	friend class MessageQueue;
 };
 
 #define MESSAGE_CLASS_DECLARATION \
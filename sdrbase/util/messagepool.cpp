@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <new>
+
+#include <QThread>
+
+#include "messagepool.h"
+
+void *MessagePool::allocate(size_t size)
+{
+    if (size != m_blockSize) {
+        return ::operator new(size);
+    }
+
+    lock();
+    FreeBlock *block = m_freeList;
+
+    if (block)
+    {
+        m_freeList = block->m_next;
+        m_nbFree--;
+    }
+
+    unlock();
+
+    return block ? (void *) block : ::operator new(m_blockSize);
+}
+
+void MessagePool::deallocate(void *p, size_t size)
+{
+    if (!p) {
+        return;
+    }
+
+    if (size != m_blockSize)
+    {
+        ::operator delete(p);
+        return;
+    }
+
+    lock();
+
+    if (m_nbFree < m_maxFree)
+    {
+        FreeBlock *block = (FreeBlock *) p;
+        block->m_next = m_freeList;
+        m_freeList = block;
+        m_nbFree++;
+        p = nullptr;
+    }
+
+    unlock();
+
+    if (p) {
+        ::operator delete(p);
+    }
+}
+
+void MessagePool::lock()
+{
+    while (m_lock.exchange(true, std::memory_order_acquire))
+    {
+        while (m_lock.load(std::memory_order_relaxed)) {
+            QThread::yieldCurrentThread();
+        }
+    }
+}
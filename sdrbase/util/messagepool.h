@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Free list allocator for messages sent at a high rate (decoder reports...).    //
+// A message class uses it with MESSAGE_POOL_DECLARATION in its declaration      //
+// and MESSAGE_POOL_DEFINITION(Name) next to its MESSAGE_CLASS_DEFINITION.       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MESSAGEPOOL_H
+#define INCLUDE_MESSAGEPOOL_H
+
+#include <stddef.h>
+#include <atomic>
+
+#include "export.h"
+
+/**
+ * Keeps up to maxFree blocks of a message class after deletion to serve the next allocations.
+ * Messages are usually created in a DSP thread and deleted in the GUI thread so the free list
+ * is shared and guarded by a spin lock held for a few instructions only.
+ * Blocks of another size (derived classes) go to the heap.
+ * The pool is constant initialized and never destroyed so messages can be deleted at any time.
+ */
+class SDRBASE_API MessagePool
+{
+public:
+    constexpr MessagePool(size_t blockSize, int maxFree = 256) :
+        m_blockSize(blockSize),
+        m_maxFree(maxFree),
+        m_freeList(nullptr),
+        m_nbFree(0),
+        m_lock(false)
+    {}
+
+    void *allocate(size_t size);
+    void deallocate(void *p, size_t size);
+    int getNbFree() const { return m_nbFree; } //!< Blocks available for reuse
+
+private:
+    struct FreeBlock {
+        FreeBlock *m_next;
+    };
+
+    size_t m_blockSize;
+    int m_maxFree;
+    FreeBlock *m_freeList;
+    int m_nbFree;
+    std::atomic<bool> m_lock;
+
+    void lock();
+    void unlock() { m_lock.store(false, std::memory_order_release); }
+};
+
+#define MESSAGE_POOL_DECLARATION \
+	public: \
+		static void* operator new(size_t size); \
+		static void operator delete(void* p, size_t size); \
+	private: \
+		static MessagePool m_messagePool;
+
+#define MESSAGE_POOL_DEFINITION(Name) \
+	MessagePool Name::m_messagePool(sizeof(Name)); \
+	void* Name::operator new(size_t size) { return m_messagePool.allocate(size); } \
+	void Name::operator delete(void* p, size_t size) { m_messagePool.deallocate(p, size); }
+
+#endif // INCLUDE_MESSAGEPOOL_H
@@ -16,14 +16,24 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+
 #include <QDebug>
 #include <QMutexLocker>
+#include <QThread>
 #include "util/messagequeue.h"
 #include "util/message.h"
 
 MessageQueue::MessageQueue(QObject* parent) :
 	QObject(parent),
-	m_queue()
+	m_head(&m_stub),
+	m_tail(&m_stub),
+	m_signalPending(false),
+	m_size(0),
+	m_maxSize(0),
+	m_nbMessages(0),
+	m_totalLatencyNs(0),
+	m_maxLatencyNs(0)
 {
 	setObjectName("MessageQueue");
 }
@@ -43,12 +53,17 @@ void MessageQueue::push(Message* message, bool emitSignal)
 {
 	if (message)
 	{
-		m_lock.lock();
-		m_queue.append(message);
-		m_lock.unlock();
+		message->m_queueTime = nowNs();
+		link(message);
+		int size = m_size.fetch_add(1) + 1;
+		int maxSize = m_maxSize.load(std::memory_order_relaxed);
+
+		while ((size > maxSize) && !m_maxSize.compare_exchange_weak(maxSize, size, std::memory_order_relaxed)) {
+		}
 	}
 
-	if (emitSignal)
+	// The consumer clears the flag before each pop so it either gets this message or gets a new signal
+	if (emitSignal && !m_signalPending.exchange(true))
 	{
 		emit messageEnqueued();
 	}
@@ -56,30 +71,107 @@ void MessageQueue::push(Message* message, bool emitSignal)
 
 Message* MessageQueue::pop()
 {
-	QMutexLocker locker(&m_lock);
+	QMutexLocker locker(&m_popLock);
 
-	if (m_queue.isEmpty())
-	{
+	m_signalPending.store(false);
+	Message *message = unlink();
+
+	if (!message) {
 		return 0;
 	}
-	else
-	{
-		return m_queue.takeFirst();
+
+	m_size.fetch_sub(1);
+	qint64 latency = nowNs() - message->m_queueTime;
+	m_nbMessages.fetch_add(1, std::memory_order_relaxed);
+	m_totalLatencyNs.fetch_add(latency, std::memory_order_relaxed);
+
+	if (latency > m_maxLatencyNs.load(std::memory_order_relaxed)) {
+		m_maxLatencyNs.store(latency, std::memory_order_relaxed);
 	}
+
+	return message;
 }
 
 int MessageQueue::size()
 {
-	QMutexLocker locker(&m_lock);
-
-	return m_queue.size();
+	int size = m_size.load();
+	return size < 0 ? 0 : size; // a message can be popped before its push is counted
 }
 
 void MessageQueue::clear()
 {
-	QMutexLocker locker(&m_lock);
+	Message* message;
+
+	while ((message = pop()) != 0) {
+		delete message;
+	}
+}
+
+qint64 MessageQueue::getMeanLatencyNs() const
+{
+	quint64 nbMessages = m_nbMessages.load(std::memory_order_relaxed);
+	return nbMessages == 0 ? 0 : m_totalLatencyNs.load(std::memory_order_relaxed) / (qint64) nbMessages;
+}
+
+void MessageQueue::resetStats()
+{
+	m_maxSize.store(size(), std::memory_order_relaxed);
+	m_nbMessages.store(0, std::memory_order_relaxed);
+	m_totalLatencyNs.store(0, std::memory_order_relaxed);
+	m_maxLatencyNs.store(0, std::memory_order_relaxed);
+}
+
+// Intrusive MPSC list (D. Vyukov). Producers swap the head then link the previous head to the new message.
+void MessageQueue::link(Message* message)
+{
+	message->m_queueNext.store(nullptr, std::memory_order_relaxed);
+	Message *prev = m_head.exchange(message, std::memory_order_acq_rel);
+	prev->m_queueNext.store(message, std::memory_order_release);
+}
+
+Message* MessageQueue::unlink()
+{
+	Message *tail = m_tail;
+	Message *next = tail->m_queueNext.load(std::memory_order_acquire);
+
+	if (tail == &m_stub)
+	{
+		if (!next) {
+			return nullptr;
+		}
 
-    while (!m_queue.isEmpty()) {
-        delete m_queue.takeFirst();
-    }
+		m_tail = next;
+		tail = next;
+		next = next->m_queueNext.load(std::memory_order_acquire);
+	}
+
+	if (!next)
+	{
+		if (tail != m_head.load(std::memory_order_acquire))
+		{
+			// a producer has swapped the head but not linked yet: it is a few instructions away
+			while (!(next = tail->m_queueNext.load(std::memory_order_acquire))) {
+				QThread::yieldCurrentThread();
+			}
+		}
+		else
+		{
+			link(&m_stub); // tail is the last message: put the stub behind it to detach it
+			next = tail->m_queueNext.load(std::memory_order_acquire);
+
+			while (!next) // another producer came in between
+			{
+				QThread::yieldCurrentThread();
+				next = tail->m_queueNext.load(std::memory_order_acquire);
+			}
+		}
+	}
+
+	m_tail = next;
+	return tail;
+}
+
+qint64 MessageQueue::nowNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
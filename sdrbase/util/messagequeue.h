@@ -19,13 +19,20 @@
 #ifndef INCLUDE_MESSAGEQUEUE_H
 #define INCLUDE_MESSAGEQUEUE_H
 
+#include <atomic>
+
 #include <QObject>
-#include <QQueue>
-#include <QRecursiveMutex>
+#include <QMutex>
+#include "util/message.h"
 #include "export.h"
 
-class Message;
-
+/**
+ * Multiple producers single consumer queue of messages.
+ * Messages are linked through their own m_queueNext member so push() neither locks nor allocates.
+ * pop() calls are serialized by a mutex that is only contended if several threads consume at once.
+ * The messageEnqueued() signal is emitted once per batch of messages pushed while the consumer
+ * has not popped yet.
+ */
 class SDRBASE_API MessageQueue : public QObject {
 	Q_OBJECT
 
@@ -39,12 +46,31 @@ public:
 	int size(); //!< Returns queue size
 	void clear(); //!< Empty queue
 
+	// Statistics since construction or last resetStats()
+	int getMaxSize() const { return m_maxSize.load(std::memory_order_relaxed); } //!< Peak queue depth
+	quint64 getNbMessages() const { return m_nbMessages.load(std::memory_order_relaxed); } //!< Messages popped
+	qint64 getMeanLatencyNs() const; //!< Mean time between push and pop
+	qint64 getMaxLatencyNs() const { return m_maxLatencyNs.load(std::memory_order_relaxed); }
+	void resetStats();
+
 signals:
 	void messageEnqueued();
 
 private:
-	QRecursiveMutex m_lock;
-	QQueue<Message*> m_queue;
+	std::atomic<Message*> m_head; //!< Last pushed message
+	Message* m_tail;              //!< Next message to pop (consumer side)
+	Message m_stub;               //!< Keeps the list non empty
+	QMutex m_popLock;
+	std::atomic<bool> m_signalPending;
+	std::atomic<int> m_size;
+	std::atomic<int> m_maxSize;
+	std::atomic<quint64> m_nbMessages;
+	std::atomic<qint64> m_totalLatencyNs;
+	std::atomic<qint64> m_maxLatencyNs;
+
+	void link(Message* message);
+	Message* unlink();
+	static qint64 nowNs();
 };
 
 #endif // INCLUDE_MESSAGEQUEUE_H
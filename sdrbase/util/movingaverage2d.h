@@ -86,6 +86,25 @@ public:
         }
     }
 
+    template<typename U>
+    void storeAndGetAvg(U *values, unsigned int index, unsigned int count) //!< in place on count consecutive indexes
+    {
+        if (m_depth <= 1) {
+            return;
+        }
+
+        T *data = &m_data[m_avgIndex*m_width+index];
+        T *sum = &m_sum[index];
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            T v = values[i];
+            sum[i] += (v - data[i]);
+            data[i] = v;
+            values[i] = sum[i] / m_depth;
+        }
+    }
+
     T storeAndGetSum(T v, unsigned int index)
     {
         if (m_depth == 1)
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "workerpool.h"
+
+WorkerPool& WorkerPool::instance()
+{
+    static WorkerPool pool(std::min(4, QThread::idealThreadCount() - 1));
+    return pool;
+}
+
+WorkerPool::WorkerPool(int nbThreads) :
+    m_running(true)
+{
+    for (int i = 0; i < nbThreads; i++)
+    {
+        m_workers.push_back(new Worker(this));
+        m_workers.back()->start();
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    m_mutex.lock();
+    m_running = false;
+    m_queueCondition.wakeAll();
+    m_mutex.unlock();
+
+    for (auto worker : m_workers)
+    {
+        worker->wait();
+        delete worker;
+    }
+}
+
+WorkerPool::Ticket WorkerPool::submit(const Task& task)
+{
+    Ticket ticket = std::make_shared<Job>(task);
+
+    if (m_workers.size() == 0)
+    {
+        task();
+        ticket->m_done.store(true, std::memory_order_release);
+        return ticket;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_queue.push_back(ticket);
+    m_queueCondition.wakeOne();
+    return ticket;
+}
+
+void WorkerPool::wait(const Ticket& ticket)
+{
+    if (!ticket || ticket->isDone()) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (!ticket->isDone()) {
+        m_doneCondition.wait(&m_mutex);
+    }
+}
+
+void WorkerPool::runJobs()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (m_running)
+    {
+        if (m_queue.empty())
+        {
+            m_queueCondition.wait(&m_mutex);
+            continue;
+        }
+
+        Ticket ticket = m_queue.front();
+        m_queue.pop_front();
+        mutexLocker.unlock();
+        ticket->m_task();
+        mutexLocker.relock();
+        ticket->m_done.store(true, std::memory_order_release);
+        m_doneCondition.wakeAll();
+    }
+}
+
+void WorkerPool::Worker::run()
+{
+    m_pool->runJobs();
+}
@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Small pool of threads running independent jobs. Callers keep the tickets of   //
+// the jobs they submit and wait on them in the order results are needed.        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_WORKERPOOL_H_
+#define SDRBASE_UTIL_WORKERPOOL_H_
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+#include "export.h"
+
+class SDRBASE_API WorkerPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    class Job
+    {
+    public:
+        Job(const Task& task) : m_task(task), m_done(false) {}
+        bool isDone() const { return m_done.load(std::memory_order_acquire); }
+
+    private:
+        Task m_task;
+        std::atomic<bool> m_done;
+
+        friend class WorkerPool;
+    };
+
+    typedef std::shared_ptr<Job> Ticket;
+
+    WorkerPool(int nbThreads); //!< with no thread jobs run in submit()
+    ~WorkerPool();
+
+    static WorkerPool& instance(); //!< pool shared by the plugins. One thread less than the cores up to 4
+
+    int getNbThreads() const { return m_workers.size(); }
+    Ticket submit(const Task& task);
+    void wait(const Ticket& ticket); //!< return when the job is done. A null ticket is done.
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(WorkerPool *pool) : m_pool(pool) {}
+
+    protected:
+        void run() override;
+
+    private:
+        WorkerPool *m_pool;
+    };
+
+    std::vector<Worker*> m_workers;
+    std::deque<Ticket> m_queue;
+    bool m_running;
+    QMutex m_mutex;
+    QWaitCondition m_queueCondition;
+    QWaitCondition m_doneCondition;
+
+    void runJobs();
+};
+
+#endif // SDRBASE_UTIL_WORKERPOOL_H_
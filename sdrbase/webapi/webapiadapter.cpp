@@ -65,6 +65,7 @@
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGDeviceReport.h"
+#include "SWGSampleSinkReport.h"
 #include "SWGDeviceActions.h"
 #include "SWGWorkspaceInfo.h"
 #include "SWGChannelsDetail.h"
@@ -208,6 +209,11 @@ int WebAPIAdapter::instanceConfigPutPatch(
     Preferences newPreferences = m_mainCore->m_settings.getPreferences();
     webAPIAdapterBase.webapiUpdatePreferences(query.getPreferences(), configKeys.m_preferencesKeys, newPreferences);
     m_mainCore->m_settings.setPreferences(newPreferences);
+    DSPEngine::instance()->configureFFTPlanning(
+        newPreferences.getFFTWThreads(),
+        newPreferences.getFFTWMinThreadedSize(),
+        newPreferences.getFFTWBackgroundPlanning()
+    );
 
     Preset *workingPreset = m_mainCore->m_settings.getWorkingPreset();
     webAPIAdapterBase.webapiUpdatePreset(force, query.getWorkingPreset(), configKeys.m_workingPresetKeys, workingPreset);
@@ -2001,6 +2007,7 @@ int WebAPIAdapter::devicesetDeviceSettingsGet(
         {
             response.setDeviceHwType(new QString(deviceSet->m_deviceAPI->getHardwareId()));
             response.setDirection(0);
+            webapiFormatDeviceSetSettings(response, deviceSet->m_deviceAPI);
             DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
             return source->webapiSettingsGet(response, *error.getMessage());
         }
@@ -2203,8 +2210,15 @@ int WebAPIAdapter::devicesetDeviceSettingsPutPatch(
             }
             else
             {
+                webapiUpdateDeviceSetSettings(deviceSet->m_deviceAPI, deviceSettingsKeys, response);
+                webapiFormatDeviceSetSettings(response, deviceSet->m_deviceAPI);
                 DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
-                return source->webapiSettingsPutPatch(force, deviceSettingsKeys, response, *error.getMessage());
+
+                if (hasDevicePluginSettings(deviceSettingsKeys)) {
+                    return source->webapiSettingsPutPatch(force, deviceSettingsKeys, response, *error.getMessage());
+                } else { // only device set settings were given
+                    return source->webapiSettingsGet(response, *error.getMessage());
+                }
             }
         }
         else if (deviceSet->m_deviceSinkEngine) // Single Tx
@@ -2473,7 +2487,13 @@ int WebAPIAdapter::devicesetDeviceReportGet(
             response.setDeviceHwType(new QString(deviceSet->m_deviceAPI->getHardwareId()));
             response.setDirection(0);
             DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
-            return source->webapiReportGet(response, *error.getMessage());
+            int status = source->webapiReportGet(response, *error.getMessage());
+
+            if (deviceSet->m_deviceSourceEngine->getFanOut()) {
+                getSampleSinksReport(response, deviceSet->m_deviceSourceEngine);
+            }
+
+            return status;
         }
         else if (deviceSet->m_deviceSinkEngine) // Single Tx
         {
@@ -2502,6 +2522,59 @@ int WebAPIAdapter::devicesetDeviceReportGet(
     }
 }
 
+void WebAPIAdapter::getSampleSinksReport(SWGSDRangel::SWGDeviceReport& response, DSPDeviceSourceEngine *deviceSourceEngine)
+{
+    std::vector<BasebandSampleSinkFanOut::SinkStats> stats;
+    deviceSourceEngine->getFanOutStats(stats);
+    response.setSampleSinks(new QList<SWGSDRangel::SWGSampleSinkReport*>);
+
+    for (const auto& sinkStats : stats)
+    {
+        SWGSDRangel::SWGSampleSinkReport *sinkReport = new SWGSDRangel::SWGSampleSinkReport();
+        sinkReport->setSinkName(new QString(sinkStats.m_sinkName));
+        sinkReport->setBlocks(sinkStats.m_blocks);
+        sinkReport->setSamples(sinkStats.m_samples);
+        sinkReport->setDroppedBlocks(sinkStats.m_droppedBlocks);
+        sinkReport->setQueueDepth(sinkStats.m_queueDepth);
+        sinkReport->setMaxQueueDepth(sinkStats.m_maxQueueDepth);
+        response.getSampleSinks()->append(sinkReport);
+    }
+}
+
+void WebAPIAdapter::webapiFormatDeviceSetSettings(SWGSDRangel::SWGDeviceSettings& response, const DeviceAPI *deviceAPI)
+{
+    response.setPolyphaseSubbands(deviceAPI->getPolyphaseSubbands());
+    response.setChannelSinkFanOut(deviceAPI->getChannelSinkFanOut() ? 1 : 0);
+    response.setSharedBasebandFifo(deviceAPI->getSharedBasebandFifo() ? 1 : 0);
+}
+
+void WebAPIAdapter::webapiUpdateDeviceSetSettings(
+        DeviceAPI *deviceAPI,
+        const QStringList& deviceSettingsKeys,
+        SWGSDRangel::SWGDeviceSettings& response)
+{
+    if (deviceSettingsKeys.contains("polyphaseSubbands")) {
+        deviceAPI->configurePolyphaseChannelizer(response.getPolyphaseSubbands());
+    }
+
+    if (deviceSettingsKeys.contains("channelSinkFanOut")) {
+        deviceAPI->setChannelSinkFanOut(response.getChannelSinkFanOut() != 0);
+    }
+
+    if (deviceSettingsKeys.contains("sharedBasebandFifo")) {
+        deviceAPI->setSharedBasebandFifo(response.getSharedBasebandFifo() != 0);
+    }
+}
+
+bool WebAPIAdapter::hasDevicePluginSettings(const QStringList& deviceSettingsKeys)
+{
+    QStringList pluginSettingsKeys = deviceSettingsKeys;
+    pluginSettingsKeys.removeAll("polyphaseSubbands");
+    pluginSettingsKeys.removeAll("channelSinkFanOut");
+    pluginSettingsKeys.removeAll("sharedBasebandFifo");
+    return !pluginSettingsKeys.isEmpty();
+}
+
 int WebAPIAdapter::devicesetChannelsReportGet(
         int deviceSetIndex,
         SWGSDRangel::SWGChannelsDetail& response,
@@ -3975,6 +4048,8 @@ void WebAPIAdapter::getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDe
             channels->back()->setUid(channel->getUID());
             channel->getIdentifier(*channels->back()->getId());
             channel->getTitle(*channels->back()->getTitle());
+            getChannelMessageQueueStats(channels->back(), channel);
+            getChannelInputFifoStats(channels->back(), channel);
 
             channelReport = new SWGSDRangel::SWGChannelReport();
 
@@ -4002,6 +4077,8 @@ void WebAPIAdapter::getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDe
             channels->back()->setUid(channel->getUID());
             channel->getIdentifier(*channels->back()->getId());
             channel->getTitle(*channels->back()->getTitle());
+            getChannelMessageQueueStats(channels->back(), channel);
+            getChannelInputFifoStats(channels->back(), channel);
 
             channelReport = new SWGSDRangel::SWGChannelReport();
 
@@ -4032,6 +4109,8 @@ void WebAPIAdapter::getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDe
             channels->back()->setUid(channel->getUID());
             channel->getIdentifier(*channels->back()->getId());
             channel->getTitle(*channels->back()->getTitle());
+            getChannelMessageQueueStats(channels->back(), channel);
+            getChannelInputFifoStats(channels->back(), channel);
 
             channelReport = new SWGSDRangel::SWGChannelReport();
 
@@ -4053,6 +4132,8 @@ void WebAPIAdapter::getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDe
             channels->back()->setUid(channel->getUID());
             channel->getIdentifier(*channels->back()->getId());
             channel->getTitle(*channels->back()->getTitle());
+            getChannelMessageQueueStats(channels->back(), channel);
+            getChannelInputFifoStats(channels->back(), channel);
 
             channelReport = new SWGSDRangel::SWGChannelReport();
 
@@ -4074,6 +4155,8 @@ void WebAPIAdapter::getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDe
             channels->back()->setUid(channel->getUID());
             channel->getIdentifier(*channels->back()->getId());
             channel->getTitle(*channels->back()->getTitle());
+            getChannelMessageQueueStats(channels->back(), channel);
+            getChannelInputFifoStats(channels->back(), channel);
 
             channelReport = new SWGSDRangel::SWGChannelReport();
 
@@ -4086,6 +4169,27 @@ void WebAPIAdapter::getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDe
     }
 }
 
+void WebAPIAdapter::getChannelMessageQueueStats(SWGSDRangel::SWGChannel *swgChannel, ChannelAPI *channel)
+{
+    MessageQueue *messageQueue = channel->getInputMessageQueue();
+    swgChannel->setMessageQueueMaxSize(messageQueue->getMaxSize());
+    swgChannel->setMessageQueueMeanLatency(messageQueue->getMeanLatencyNs());
+    swgChannel->setMessageQueueMaxLatency(messageQueue->getMaxLatencyNs());
+}
+
+void WebAPIAdapter::getChannelInputFifoStats(SWGSDRangel::SWGChannel *swgChannel, ChannelAPI *channel)
+{
+    ChannelAPI::InputFifoStats stats;
+
+    if (channel->getInputFifoStats(stats))
+    {
+        swgChannel->setInputFifoSize(stats.m_size);
+        swgChannel->setInputFifoFill(stats.m_fill);
+        swgChannel->setInputFifoOverflows(stats.m_overflowCount);
+        swgChannel->setInputFifoDroppedSamples(stats.m_droppedSamples);
+    }
+}
+
 int WebAPIAdapter::featuresetGet(
         int featureSetIndex,
         SWGSDRangel::SWGFeatureSet& response,
@@ -28,6 +28,14 @@
 class MainCore;
 class DeviceSet;
 class FeatureSet;
+class DSPDeviceSourceEngine;
+class DeviceAPI;
+class ChannelAPI;
+
+namespace SWGSDRangel
+{
+    class SWGChannel;
+}
 
 class SDRBASE_API WebAPIAdapter: public WebAPIAdapterInterface
 {
@@ -497,7 +505,16 @@ private:
     void getDeviceSetList(SWGSDRangel::SWGDeviceSetList* deviceSetList);
     void getDeviceSet(SWGSDRangel::SWGDeviceSet *swgDeviceSet, const DeviceSet* deviceSet, int deviceSetIndex);
     void getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDetail, const DeviceSet* deviceSet);
+    static void getChannelMessageQueueStats(SWGSDRangel::SWGChannel *swgChannel, ChannelAPI *channel);
+    static void getChannelInputFifoStats(SWGSDRangel::SWGChannel *swgChannel, ChannelAPI *channel);
     void getFeatureSet(SWGSDRangel::SWGFeatureSet *swgFeatureSet, const FeatureSet* featureSet);
+    void getSampleSinksReport(SWGSDRangel::SWGDeviceReport& response, DSPDeviceSourceEngine *deviceSourceEngine);
+    static void webapiFormatDeviceSetSettings(SWGSDRangel::SWGDeviceSettings& response, const DeviceAPI *deviceAPI);
+    static void webapiUpdateDeviceSetSettings(
+            DeviceAPI *deviceAPI,
+            const QStringList& deviceSettingsKeys,
+            SWGSDRangel::SWGDeviceSettings& response);
+    static bool hasDevicePluginSettings(const QStringList& deviceSettingsKeys);
     static QtMsgType getMsgTypeFromString(const QString& msgTypeString);
     static void getMsgTypeString(const QtMsgType& msgType, QString& level);
 };
@@ -53,6 +53,9 @@ void WebAPIAdapterBase::webapiFormatPreferences(
     apiPreferences->setUseLogFile(preferences.getUseLogFile() ? 1 : 0);
     apiPreferences->setLogFileName(new QString(preferences.getLogFileName()));
     apiPreferences->setFileMinLogLevel((int) preferences.getFileMinLogLevel());
+    apiPreferences->setFftwThreads(preferences.getFFTWThreads());
+    apiPreferences->setFftwMinThreadedSize(preferences.getFFTWMinThreadedSize());
+    apiPreferences->setFftwBackgroundPlanning(preferences.getFFTWBackgroundPlanning() ? 1 : 0);
 }
 
 void WebAPIAdapterBase::webapiInitConfig(
@@ -74,6 +77,15 @@ void WebAPIAdapterBase::webapiUpdatePreferences(
     if (preferenceKeys.contains("fileMinLogLevel")) {
         preferences.setFileMinLogLevel((QtMsgType) apiPreferences->getFileMinLogLevel());
     }
+    if (preferenceKeys.contains("fftwBackgroundPlanning")) {
+        preferences.setFFTWBackgroundPlanning(apiPreferences->getFftwBackgroundPlanning() != 0);
+    }
+    if (preferenceKeys.contains("fftwMinThreadedSize")) {
+        preferences.setFFTWMinThreadedSize(apiPreferences->getFftwMinThreadedSize());
+    }
+    if (preferenceKeys.contains("fftwThreads")) {
+        preferences.setFFTWThreads(apiPreferences->getFftwThreads() < 0 ? 0 : apiPreferences->getFftwThreads());
+    }
     if (preferenceKeys.contains("latitude")) {
         preferences.setLatitude(apiPreferences->getLatitude());
     }
@@ -165,6 +177,7 @@ void WebAPIAdapterBase::webapiFormatPreset(
         swgSpectrumConfig->setAveragingMode((int) m_spectrumSettings.m_averagingMode);
         swgSpectrumConfig->setAveragingValue(SpectrumSettings::getAveragingValue(m_spectrumSettings.m_averagingIndex, m_spectrumSettings.m_averagingMode));
         swgSpectrumConfig->setLinear(m_spectrumSettings.m_linear ? 1 : 0);
+        swgSpectrumConfig->setFastLog(m_spectrumSettings.m_fastLog ? 1 : 0);
         swgSpectrumConfig->setMarkersDisplay((int) m_spectrumSettings.m_markersDisplay);
     }
 
@@ -365,6 +378,9 @@ void WebAPIAdapterBase::webapiUpdatePreset(
         if (spectrumIt->contains("linear")) {
             spectrumSettings.m_linear = apiPreset->getSpectrumConfig()->getLinear() != 0;
         }
+        if (spectrumIt->contains("fastLog")) {
+            spectrumSettings.m_fastLog = apiPreset->getSpectrumConfig()->getFastLog() != 0;
+        }
         if (spectrumIt->contains("powerRange")) {
             spectrumSettings.m_powerRange = apiPreset->getSpectrumConfig()->getPowerRange();
         }
@@ -3717,7 +3717,33 @@ bool WebAPIRequestMapper::validateDeviceSettings(
         return false;
     }
 
-    return getDeviceSettings(deviceSettingsKey, &deviceSettings, jsonObject, deviceSettingsKeys);
+    // Device set level settings not specific to the device plugin
+    bool deviceSetSettings = false;
+
+    if (jsonObject.contains("polyphaseSubbands"))
+    {
+        deviceSettings.setPolyphaseSubbands(jsonObject["polyphaseSubbands"].toInt());
+        deviceSettingsKeys.append("polyphaseSubbands");
+        deviceSetSettings = true;
+    }
+
+    if (jsonObject.contains("channelSinkFanOut"))
+    {
+        deviceSettings.setChannelSinkFanOut(jsonObject["channelSinkFanOut"].toInt());
+        deviceSettingsKeys.append("channelSinkFanOut");
+        deviceSetSettings = true;
+    }
+
+    if (jsonObject.contains("sharedBasebandFifo"))
+    {
+        deviceSettings.setSharedBasebandFifo(jsonObject["sharedBasebandFifo"].toInt());
+        deviceSettingsKeys.append("sharedBasebandFifo");
+        deviceSetSettings = true;
+    }
+
+    bool pluginSettings = getDeviceSettings(deviceSettingsKey, &deviceSettings, jsonObject, deviceSettingsKeys);
+
+    return pluginSettings || deviceSetSettings;
 }
 
 bool WebAPIRequestMapper::validateDeviceActions(
@@ -15,8 +15,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include <QtWebSockets>
-#include <QHostAddress>
+#include <QBuffer>
+#include <QThread>
 #include <QDebug>
 
 #include "util/timeutil.h"
@@ -25,14 +25,18 @@
 WSSpectrum::WSSpectrum(QObject *parent) :
     QObject(parent),
     m_listeningAddress(QHostAddress::LocalHost),
-    m_port(8887),
-    m_webSocketServer(nullptr)
+    m_port(8887)
 {
+    m_thread = new QThread();
+    m_worker = new WSSpectrumWorker();
+    m_worker->moveToThread(m_thread);
+    connect(m_thread, &QThread::finished, m_worker, &QObject::deleteLater);
     connect(this,
             SIGNAL(payloadToSend(const QByteArray&)),
-            this,
+            m_worker,
             SLOT(sendPayload(const QByteArray&)),
             Qt::QueuedConnection);
+    m_thread->start();
     m_timer.start();
 }
 
@@ -40,56 +44,49 @@ WSSpectrum::~WSSpectrum()
 {
     disconnect(this,
             SIGNAL(payloadToSend(const QByteArray&)),
-            this,
+            m_worker,
             SLOT(sendPayload(const QByteArray&)));
     closeSocket();
+    m_thread->quit();
+    m_thread->wait();
+    delete m_thread;
 }
 
 void WSSpectrum::openSocket()
 {
-    m_webSocketServer = new QWebSocketServer(
-        QStringLiteral("Spectrum Server"),
-        QWebSocketServer::NonSecureMode,
-        this);
-
-    if (m_webSocketServer->listen(m_listeningAddress, m_port))
-    {
-        qDebug() << "WSSpectrum::openSocket: spectrum server listening at " << m_listeningAddress.toString() << " on port " << m_port;
-        connect(m_webSocketServer, &QWebSocketServer::newConnection, this, &WSSpectrum::onNewConnection);
-    }
-    else
-    {
-        qInfo("WSSpectrum::openSocket: cannot start spectrum server at %s on port %u", qPrintable(m_listeningAddress.toString()), m_port);
-    }
+    m_worker->setListening(m_listeningAddress, m_port);
+    QMetaObject::invokeMethod(m_worker, "openSocket", Qt::BlockingQueuedConnection);
 }
 
 void WSSpectrum::closeSocket()
 {
-    if (m_webSocketServer)
-    {
-        qDebug() << "WSSpectrum::closeSocket: stopping spectrum server listening at " << m_listeningAddress.toString() << " on port " << m_port;
-        delete m_webSocketServer;
-        m_webSocketServer = nullptr;
-    }
+    QMetaObject::invokeMethod(m_worker, "closeSocket", Qt::BlockingQueuedConnection);
 }
 
 bool WSSpectrum::socketOpened() const
 {
-    return m_webSocketServer && m_webSocketServer->isListening();
+    return m_worker->isOpened();
 }
 
 void WSSpectrum::getPeers(QList<QHostAddress>& hosts, QList<quint16>& ports) const
 {
+    QList<ClientStats> stats;
+    m_worker->getClientStats(stats);
     hosts.clear();
     ports.clear();
 
-    for (auto pSocket : m_clients)
+    for (const auto& clientStats : stats)
     {
-        hosts.push_back(pSocket->peerAddress());
-        ports.push_back(pSocket->peerPort());
+        hosts.push_back(clientStats.m_address);
+        ports.push_back(clientStats.m_port);
     }
 }
 
+void WSSpectrum::getClientStats(QList<ClientStats>& stats) const
+{
+    m_worker->getClientStats(stats);
+}
+
 void WSSpectrum::setListeningAddress(const QString& address)
 {
     if (address == "127.0.0.1") {
@@ -101,56 +98,14 @@ void WSSpectrum::setListeningAddress(const QString& address)
     }
 }
 
-QString WSSpectrum::getWebSocketIdentifier(QWebSocket *peer)
-{
-    return QStringLiteral("%1:%2").arg(peer->peerAddress().toString(), QString::number(peer->peerPort()));
-}
-
-void WSSpectrum::onNewConnection()
-{
-    auto pSocket = m_webSocketServer->nextPendingConnection();
-    qDebug() << "WSSpectrum::onNewConnection: " << getWebSocketIdentifier(pSocket) << " connected";
-    pSocket->setParent(this);
-
-    connect(pSocket, &QWebSocket::textMessageReceived, this, &WSSpectrum::processClientMessage);
-    connect(pSocket, &QWebSocket::disconnected, this, &WSSpectrum::socketDisconnected);
-
-    m_clients << pSocket;
-}
-
-void WSSpectrum::processClientMessage(const QString &message)
-{
-     qDebug() << "WSSpectrum::processClientMessage: " << message;
-}
-
-void WSSpectrum::socketDisconnected()
-{
-    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
-    qDebug() << getWebSocketIdentifier(pClient) << " disconnected";
-
-    if (pClient)
-    {
-        m_clients.removeAll(pClient);
-        pClient->deleteLater();
-    }
-}
-
 QHostAddress WSSpectrum::getListeningAddress() const
 {
-    if (m_webSocketServer) {
-        return m_webSocketServer->serverAddress();
-    } else {
-        return QHostAddress::Null;
-    }
+    return m_worker->getListeningAddress();
 }
 
 uint16_t WSSpectrum::getListeningPort() const
 {
-    if (m_webSocketServer) {
-        return m_webSocketServer->serverPort();
-    } else {
-        return 0;
-    }
+    return m_worker->getListeningPort();
 }
 
 void WSSpectrum::newSpectrum(
@@ -164,6 +119,12 @@ void WSSpectrum::newSpectrum(
 )
 {
     qint64 elapsed = m_timer.restart();
+
+    // drop the frame if the previous one is not sent yet
+    if (!m_worker->acquireFrame()) {
+        return;
+    }
+
     uint64_t nowMs = TimeUtil::nowms();
     QByteArray payload;
 
@@ -183,14 +144,6 @@ void WSSpectrum::newSpectrum(
     emit payloadToSend(payload);
 }
 
-void WSSpectrum::sendPayload(const QByteArray& payload)
-{
-    //qDebug() << "WSSpectrum::sendPayload: " << payload.size() << " bytes";
-    for (QWebSocket *pClient : qAsConst(m_clients)) {
-        pClient->sendBinaryMessage(payload);
-    }
-}
-
 void WSSpectrum::buildPayload(
     QByteArray& bytes,
     const std::vector<Real>& spectrum,
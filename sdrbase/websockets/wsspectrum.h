@@ -26,16 +26,18 @@
 #include <QHostAddress>
 
 #include "dsp/dsptypes.h"
+#include "websockets/wsspectrumworker.h"
 
 #include "export.h"
 
-class QWebSocketServer;
-class QWebSocket;
+class QThread;
 
 class SDRBASE_API WSSpectrum : public QObject
 {
     Q_OBJECT
 public:
+    typedef WSSpectrumWorker::ClientStats ClientStats;
+
     explicit WSSpectrum(QObject *parent = nullptr);
     ~WSSpectrum() override;
 
@@ -43,6 +45,7 @@ public:
     void closeSocket();
     bool socketOpened() const;
     void getPeers(QList<QHostAddress>& hosts, QList<quint16>& ports) const;
+    void getClientStats(QList<ClientStats>& stats) const;
     void setListeningAddress(const QString& address);
     void setPort(quint16 port) { m_port = port; }
     QHostAddress getListeningAddress() const;
@@ -60,20 +63,13 @@ public:
 signals:
     void payloadToSend(const QByteArray& payload);
 
-private slots:
-    void onNewConnection();
-    void processClientMessage(const QString &message);
-    void socketDisconnected();
-    void sendPayload(const QByteArray& payload);
-
 private:
     QHostAddress m_listeningAddress;
     quint16 m_port;
-    QWebSocketServer* m_webSocketServer;
-    QList<QWebSocket*> m_clients;
+    QThread *m_thread;
+    WSSpectrumWorker *m_worker; //!< socket I/O in m_thread
     QElapsedTimer m_timer;
 
-    static QString getWebSocketIdentifier(QWebSocket *peer);
     void buildPayload(
         QByteArray& bytes,
         const std::vector<Real>& spectrum,
@@ -0,0 +1,424 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <QtWebSockets>
+#include <QHostAddress>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QDebug>
+
+#include "wsspectrumworker.h"
+
+const int WSSpectrumWorker::m_keyFrameInterval = 50;
+const qint64 WSSpectrumWorker::m_maxBacklogBytes = 4*1024*1024;
+
+WSSpectrumWorker::WSSpectrumWorker() :
+    m_listeningAddress(QHostAddress::LocalHost),
+    m_port(8887),
+    m_webSocketServer(nullptr),
+    m_opened(false),
+    m_framePending(false)
+{
+    m_clientTimer.start();
+}
+
+WSSpectrumWorker::~WSSpectrumWorker()
+{
+    closeSocket();
+}
+
+void WSSpectrumWorker::setListening(const QHostAddress& address, quint16 port)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_listeningAddress = address;
+    m_port = port;
+}
+
+void WSSpectrumWorker::openSocket()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_webSocketServer = new QWebSocketServer(
+        QStringLiteral("Spectrum Server"),
+        QWebSocketServer::NonSecureMode,
+        this);
+
+    if (m_webSocketServer->listen(m_listeningAddress, m_port))
+    {
+        qDebug() << "WSSpectrumWorker::openSocket: spectrum server listening at " << m_listeningAddress.toString() << " on port " << m_port;
+        connect(m_webSocketServer, &QWebSocketServer::newConnection, this, &WSSpectrumWorker::onNewConnection);
+        m_opened.store(true);
+    }
+    else
+    {
+        qInfo("WSSpectrumWorker::openSocket: cannot start spectrum server at %s on port %u", qPrintable(m_listeningAddress.toString()), m_port);
+    }
+}
+
+void WSSpectrumWorker::closeSocket()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_webSocketServer)
+    {
+        qDebug() << "WSSpectrumWorker::closeSocket: stopping spectrum server listening at " << m_listeningAddress.toString() << " on port " << m_port;
+        m_opened.store(false);
+        delete m_webSocketServer;
+        m_webSocketServer = nullptr;
+    }
+}
+
+QHostAddress WSSpectrumWorker::getListeningAddress() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_webSocketServer) {
+        return m_webSocketServer->serverAddress();
+    } else {
+        return QHostAddress::Null;
+    }
+}
+
+uint16_t WSSpectrumWorker::getListeningPort() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_webSocketServer) {
+        return m_webSocketServer->serverPort();
+    } else {
+        return 0;
+    }
+}
+
+void WSSpectrumWorker::getClientStats(QList<ClientStats>& stats) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    stats.clear();
+
+    for (auto pSocket : m_clients) {
+        stats.push_back(m_clientStats.value(pSocket));
+    }
+}
+
+bool WSSpectrumWorker::acquireFrame()
+{
+    bool expected = false;
+    return m_framePending.compare_exchange_strong(expected, true);
+}
+
+QString WSSpectrumWorker::getWebSocketIdentifier(QWebSocket *peer)
+{
+    return QStringLiteral("%1:%2").arg(peer->peerAddress().toString(), QString::number(peer->peerPort()));
+}
+
+void WSSpectrumWorker::onNewConnection()
+{
+    auto pSocket = m_webSocketServer->nextPendingConnection();
+    qDebug() << "WSSpectrumWorker::onNewConnection: " << getWebSocketIdentifier(pSocket) << " connected";
+    pSocket->setParent(this);
+
+    connect(pSocket, &QWebSocket::textMessageReceived, this, &WSSpectrumWorker::processClientMessage);
+    connect(pSocket, &QWebSocket::disconnected, this, &WSSpectrumWorker::socketDisconnected);
+    connect(pSocket, &QWebSocket::bytesWritten, this, &WSSpectrumWorker::onBytesWritten);
+
+    QMutexLocker mutexLocker(&m_mutex);
+    ClientStats& stats = m_clientStats[pSocket];
+    stats.m_address = pSocket->peerAddress();
+    stats.m_port = pSocket->peerPort();
+    m_clients << pSocket;
+}
+
+void WSSpectrumWorker::processClientMessage(const QString &message)
+{
+    qDebug() << "WSSpectrumWorker::processClientMessage: " << message;
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (!pClient) {
+        return;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if (doc.isNull() || !doc.isObject())
+    {
+        qWarning() << "WSSpectrumWorker::processClientMessage: invalid settings from" << getWebSocketIdentifier(pClient) << ":" << error.errorString();
+        return;
+    }
+
+    QJsonObject object = doc.object();
+    ClientSettings& settings = m_clientSettings[pClient];
+    settings = ClientSettings(); // resets delta encoding
+    settings.m_negotiated = true;
+    QString format = object.value("format").toString("float32");
+    settings.m_format = format == "int16" ?
+        ClientSettings::FormatInt16 : format == "int8" ?
+            ClientSettings::FormatInt8 : ClientSettings::FormatFloat32;
+    settings.m_width = std::max(0, object.value("width").toInt(0));
+    settings.m_decimateMax = object.value("decimation").toString("max") != "avg";
+    settings.m_delta = object.value("delta").toBool(false);
+    settings.m_compress = object.value("compress").toBool(false);
+    settings.m_maxFps = std::max(0, object.value("maxFps").toInt(0));
+    settings.m_minDb = object.value("minDb").toDouble(-160.0);
+    settings.m_maxDb = object.value("maxDb").toDouble(0.0);
+
+    if (settings.m_maxDb <= settings.m_minDb) {
+        settings.m_maxDb = settings.m_minDb + 1.0f;
+    }
+
+    // acknowledge with the settings in use
+    QJsonObject reply;
+    reply.insert("format", settings.m_format == ClientSettings::FormatInt16 ?
+        "int16" : settings.m_format == ClientSettings::FormatInt8 ? "int8" : "float32");
+    reply.insert("width", settings.m_width);
+    reply.insert("decimation", settings.m_decimateMax ? "max" : "avg");
+    reply.insert("delta", settings.m_delta);
+    reply.insert("compress", settings.m_compress);
+    reply.insert("maxFps", settings.m_maxFps);
+    reply.insert("minDb", settings.m_minDb);
+    reply.insert("maxDb", settings.m_maxDb);
+    pClient->sendTextMessage(QString::fromUtf8(QJsonDocument(reply).toJson(QJsonDocument::Compact)));
+}
+
+void WSSpectrumWorker::socketDisconnected()
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (pClient)
+    {
+        qDebug() << getWebSocketIdentifier(pClient) << " disconnected";
+        QMutexLocker mutexLocker(&m_mutex);
+        m_clients.removeAll(pClient);
+        m_clientSettings.remove(pClient);
+        m_clientStats.remove(pClient);
+        pClient->deleteLater();
+    }
+}
+
+void WSSpectrumWorker::onBytesWritten(qint64 bytes)
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+    QMutexLocker mutexLocker(&m_mutex);
+    QHash<QWebSocket*, ClientStats>::iterator it = m_clientStats.find(pClient);
+
+    // written bytes include the websocket framing so the backlog is floored at zero
+    if (it != m_clientStats.end()) {
+        it->m_backlogBytes = std::max((qint64) 0, it->m_backlogBytes - bytes);
+    }
+}
+
+void WSSpectrumWorker::sendPayload(const QByteArray& payload)
+{
+    m_framePending.store(false);
+    QHash<QString, QByteArray> compactPayloads; // frames shared by clients with the same settings
+
+    for (QWebSocket *pClient : qAsConst(m_clients))
+    {
+        {
+            QMutexLocker mutexLocker(&m_mutex);
+            ClientStats& stats = m_clientStats[pClient];
+
+            if (stats.m_backlogBytes > m_maxBacklogBytes)
+            {
+                stats.m_droppedFrames++;
+                continue;
+            }
+        }
+
+        QHash<QWebSocket*, ClientSettings>::iterator it = m_clientSettings.find(pClient);
+        QByteArray bytes;
+
+        if ((it == m_clientSettings.end()) || !it->m_negotiated)
+        {
+            bytes = payload; // shared
+        }
+        else
+        {
+            ClientSettings& settings = *it;
+
+            if (settings.m_maxFps > 0)
+            {
+                qint64 nowMs = m_clientTimer.elapsed();
+
+                if ((settings.m_lastSentMs != 0) && (nowMs - settings.m_lastSentMs < 1000 / settings.m_maxFps)) {
+                    continue;
+                }
+
+                settings.m_lastSentMs = nowMs;
+            }
+
+            if (settings.m_delta)
+            {
+                buildCompactPayload(bytes, payload, settings);
+            }
+            else
+            {
+                QString key = settings.getCacheKey();
+
+                if (!compactPayloads.contains(key)) {
+                    buildCompactPayload(compactPayloads[key], payload, settings);
+                }
+
+                bytes = compactPayloads[key];
+            }
+        }
+
+        {
+            QMutexLocker mutexLocker(&m_mutex);
+            ClientStats& stats = m_clientStats[pClient];
+            stats.m_backlogBytes += bytes.size();
+            stats.m_sentFrames++;
+        }
+
+        pClient->sendBinaryMessage(bytes);
+    }
+}
+
+QString WSSpectrumWorker::ClientSettings::getCacheKey() const
+{
+    return QString("%1:%2:%3:%4:%5:%6")
+        .arg((int) m_format)
+        .arg(m_width)
+        .arg(m_decimateMax ? 1 : 0)
+        .arg(m_compress ? 1 : 0)
+        .arg(m_minDb)
+        .arg(m_maxDb);
+}
+
+void WSSpectrumWorker::buildCompactPayload(QByteArray& bytes, const QByteArray& payload, ClientSettings& settings)
+{
+    // header fields of the original frame (see buildPayload)
+    int fftSize;
+    int indicators;
+    std::memcpy(&fftSize, payload.constData() + 24, sizeof(int));
+    std::memcpy(&indicators, payload.constData() + 32, sizeof(int));
+    const float *spectrum = reinterpret_cast<const float*>(payload.constData() + 36);
+    bool linear = (indicators & 1) != 0;
+
+    // decimation
+    int nbBins = (settings.m_width > 0) && (settings.m_width < fftSize) ? settings.m_width : fftSize;
+    m_bins.resize(nbBins);
+
+    if (nbBins == fftSize)
+    {
+        std::copy(spectrum, spectrum + fftSize, m_bins.begin());
+    }
+    else
+    {
+        for (int i = 0; i < nbBins; i++)
+        {
+            int start = ((qint64) i * fftSize) / nbBins;
+            int end = ((qint64) (i + 1) * fftSize) / nbBins;
+
+            if (settings.m_decimateMax)
+            {
+                m_bins[i] = *std::max_element(spectrum + start, spectrum + end);
+            }
+            else
+            {
+                float sum = 0.0f;
+
+                for (int j = start; j < end; j++) {
+                    sum += spectrum[j];
+                }
+
+                m_bins[i] = sum / (end - start);
+            }
+        }
+    }
+
+    // quantization applies to dB values only
+    ClientSettings::Format format = linear ? ClientSettings::FormatFloat32 : settings.m_format;
+    float offset = format == ClientSettings::FormatInt8 ? settings.m_minDb : 0.0f;
+    float scale = format == ClientSettings::FormatInt8 ? (settings.m_maxDb - settings.m_minDb) / 255.0f : 0.01f;
+    bool delta = settings.m_delta && (format != ClientSettings::FormatFloat32);
+    bool keyFrame = !delta
+        || (settings.m_previousFormat != format)
+        || ((int) settings.m_previous.size() != nbBins)
+        || (settings.m_framesSinceKey >= m_keyFrameInterval);
+    QByteArray data;
+
+    if (format == ClientSettings::FormatFloat32)
+    {
+        data = QByteArray((const char*) m_bins.data(), nbBins * sizeof(float));
+    }
+    else
+    {
+        int qMin = format == ClientSettings::FormatInt8 ? 0 : -32768;
+        int qMax = format == ClientSettings::FormatInt8 ? 255 : 32767;
+        int sampleSize = format == ClientSettings::FormatInt8 ? 1 : 2;
+        data.resize(nbBins * sampleSize);
+
+        if (delta) {
+            settings.m_previous.resize(nbBins);
+        }
+
+        for (int i = 0; i < nbBins; i++)
+        {
+            float x = (m_bins[i] - offset) / scale;
+            x = !(x > qMin) ? qMin : x > qMax ? qMax : x; // clamps -inf and NaN to minimum
+            int q = (int) std::round(x);
+            int v = q;
+
+            if (delta)
+            {
+                v = keyFrame ? q : q - settings.m_previous[i]; // wraps around in the sample size
+                settings.m_previous[i] = q;
+            }
+
+            if (sampleSize == 1)
+            {
+                data[i] = (char) (uint8_t) v;
+            }
+            else
+            {
+                int16_t v16 = (int16_t) v;
+                std::memcpy(data.data() + 2*i, &v16, sizeof(int16_t));
+            }
+        }
+
+        if (delta)
+        {
+            settings.m_framesSinceKey = keyFrame ? 0 : settings.m_framesSinceKey + 1;
+            settings.m_previousFormat = format;
+        }
+    }
+
+    if (settings.m_compress) {
+        data = qCompress(data, 3);
+    }
+
+    int compactIndicators = indicators | 8;
+    uint8_t formatByte = (uint8_t) format;
+    uint8_t flags = (delta ? 1 : 0) + (settings.m_compress ? 2 : 0) + (keyFrame ? 4 : 0);
+    uint16_t reserved = 0;
+
+    bytes.reserve(52 + data.size());
+    bytes.append(payload.constData(), 32);                 // 0: same as original frame
+    bytes.append((char*) &compactIndicators, sizeof(int)); // 32
+    bytes.append((char*) &formatByte, 1);                  // 36
+    bytes.append((char*) &flags, 1);                       // 37
+    bytes.append((char*) &reserved, sizeof(uint16_t));     // 38
+    bytes.append((char*) &nbBins, sizeof(int));            // 40
+    bytes.append((char*) &offset, sizeof(float));          // 44
+    bytes.append((char*) &scale, sizeof(float));           // 48
+    bytes.append(data);                                    // 52
+}
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Websocket spectrum server socket I/O. Lives in its own thread so that slow    //
+// clients do not hold the spectrum processing. Frames are dropped for clients   //
+// whose backlog of unsent bytes is too large.                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBSOCKETS_WSSPECTRUMWORKER_H_
+#define SDRBASE_WEBSOCKETS_WSSPECTRUMWORKER_H_
+
+#include <atomic>
+#include <vector>
+
+#include <QObject>
+#include <QList>
+#include <QHash>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QHostAddress>
+
+#include "export.h"
+
+class QWebSocketServer;
+class QWebSocket;
+
+class SDRBASE_API WSSpectrumWorker : public QObject
+{
+    Q_OBJECT
+public:
+    struct ClientStats
+    {
+        QHostAddress m_address;
+        quint16 m_port;
+        qint64 m_backlogBytes;  //!< bytes queued in the socket not yet written
+        quint64 m_sentFrames;
+        quint64 m_droppedFrames; //!< frames not sent because the backlog was too large
+
+        ClientStats() :
+            m_port(0),
+            m_backlogBytes(0),
+            m_sentFrames(0),
+            m_droppedFrames(0)
+        {}
+    };
+
+    WSSpectrumWorker();
+    ~WSSpectrumWorker() override;
+
+    void setListening(const QHostAddress& address, quint16 port);
+    bool isOpened() const { return m_opened.load(); }
+    QHostAddress getListeningAddress() const;
+    uint16_t getListeningPort() const;
+    void getClientStats(QList<ClientStats>& stats) const;
+    bool acquireFrame(); //!< false if a frame is already waiting to be sent so that the new one should be dropped
+
+public slots:
+    void openSocket();
+    void closeSocket();
+    void sendPayload(const QByteArray& payload);
+
+private slots:
+    void onNewConnection();
+    void processClientMessage(const QString &message);
+    void socketDisconnected();
+    void onBytesWritten(qint64 bytes);
+
+private:
+    // Frame options a client can request by sending a JSON text message. Clients
+    // that never do receive the original uncompressed float frames.
+    struct ClientSettings
+    {
+        enum Format
+        {
+            FormatFloat32,
+            FormatInt16, //!< dB in 0.01 dB steps
+            FormatInt8   //!< dB between m_minDb and m_maxDb in 255 steps
+        };
+
+        bool m_negotiated;
+        Format m_format;
+        int m_width;          //!< maximum number of bins sent (decimation) or 0 for all
+        bool m_decimateMax;   //!< maximum else average of the bins merged in one
+        bool m_delta;         //!< difference with the previous frame (quantized formats only)
+        bool m_compress;      //!< zlib compressed data
+        int m_maxFps;         //!< frame rate limit or 0 for none
+        float m_minDb;
+        float m_maxDb;
+        qint64 m_lastSentMs;
+        int m_framesSinceKey;
+        Format m_previousFormat;
+        std::vector<int> m_previous; //!< last quantized frame sent for delta encoding
+
+        ClientSettings() :
+            m_negotiated(false),
+            m_format(FormatFloat32),
+            m_width(0),
+            m_decimateMax(true),
+            m_delta(false),
+            m_compress(false),
+            m_maxFps(0),
+            m_minDb(-160.0f),
+            m_maxDb(0.0f),
+            m_lastSentMs(0),
+            m_framesSinceKey(0),
+            m_previousFormat(FormatFloat32)
+        {}
+
+        QString getCacheKey() const; //!< identical for clients receiving identical frames when not delta encoded
+    };
+
+    QHostAddress m_listeningAddress;
+    quint16 m_port;
+    QWebSocketServer* m_webSocketServer;
+    std::atomic<bool> m_opened;
+    std::atomic<bool> m_framePending;
+    QList<QWebSocket*> m_clients;
+    QHash<QWebSocket*, ClientSettings> m_clientSettings;
+    QHash<QWebSocket*, ClientStats> m_clientStats; //!< protected by m_mutex
+    QElapsedTimer m_clientTimer;
+    std::vector<float> m_bins; //!< decimated spectrum work buffer
+    mutable QMutex m_mutex;
+
+    static const int m_keyFrameInterval;  //!< full frame every so many delta frames
+    static const qint64 m_maxBacklogBytes; //!< frames are dropped above this backlog
+
+    static QString getWebSocketIdentifier(QWebSocket *peer);
+    void buildCompactPayload(QByteArray& bytes, const QByteArray& payload, ClientSettings& settings);
+};
+
+#endif // SDRBASE_WEBSOCKETS_WSSPECTRUMWORKER_H_
@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Heap allocation counters for benchmarks. The benchmark executable replaces   //
+// the global operator new and reports each allocation here. When it is not     //
+// replaced the counters stay at zero.                                           //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_BENCHALLOCATIONS_H_
+#define SDRBENCH_BENCHALLOCATIONS_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include <QtGlobal>
+
+#include "export.h"
+
+class SDRBENCH_API BenchAllocations
+{
+public:
+    static void count(std::size_t size)
+    {
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    static quint64 getCount() { return m_count.load(std::memory_order_relaxed); }
+    static quint64 getBytes() { return m_bytes.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled) { m_enabled = enabled; } //!< Set by the executable that replaces operator new
+    static bool isEnabled() { return m_enabled; }
+
+private:
+    static std::atomic<quint64> m_count;
+    static std::atomic<quint64> m_bytes;
+    static bool m_enabled;
+};
+
+#endif // SDRBENCH_BENCHALLOCATIONS_H_
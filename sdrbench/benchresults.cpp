@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStringList>
+#include <QSysInfo>
+
+#include "dsp/dsptypes.h"
+#include "dsp/halfbandkernels.h"
+#include "dsp/ncokernels.h"
+#include "benchallocations.h"
+#include "benchresults.h"
+
+BenchMeasure::BenchMeasure() :
+    m_nsecs(0),
+    m_allocations(0),
+    m_allocatedBytes(0),
+    m_startAllocations(0),
+    m_startAllocatedBytes(0)
+{
+}
+
+void BenchMeasure::start()
+{
+    m_startAllocations = BenchAllocations::getCount();
+    m_startAllocatedBytes = BenchAllocations::getBytes();
+    m_timer.start();
+}
+
+void BenchMeasure::stop()
+{
+    m_nsecs += m_timer.nsecsElapsed();
+    m_allocations += BenchAllocations::getCount() - m_startAllocations;
+    m_allocatedBytes += BenchAllocations::getBytes() - m_startAllocatedBytes;
+}
+
+void BenchResults::add(const QString& test, const QString& parameters, quint64 nbSamples, const BenchMeasure& measure)
+{
+    add(test, parameters, nbSamples, measure, Metrics());
+}
+
+void BenchResults::add(const QString& test, const QString& parameters, quint64 nbSamples, const BenchMeasure& measure, const Metrics& metrics)
+{
+    m_results.push_back(Result());
+    Result& result = m_results.back();
+    result.m_test = test;
+    result.m_parameters = parameters;
+    result.m_nbSamples = nbSamples;
+    result.m_nsecs = measure.getNsecs();
+    result.m_allocations = measure.getAllocations();
+    result.m_allocatedBytes = measure.getAllocatedBytes();
+    result.m_metrics = metrics;
+
+    QDebug info = qInfo();
+    info.noquote();
+    info << formatText(result);
+}
+
+QString BenchResults::formatText(const Result& result)
+{
+    QString text = QString("%1 (%2): ran test in %L3 ns - sample rate: %4 MS/s - %5 ns/S")
+        .arg(result.m_test)
+        .arg(result.m_parameters)
+        .arg(result.m_nsecs)
+        .arg(result.getMSps(), 0, 'f', 3)
+        .arg(result.getNsPerSample(), 0, 'f', 3);
+
+    if (BenchAllocations::isEnabled()) {
+        text += QString(" - allocations: %1 (%2 bytes)").arg(result.m_allocations).arg(result.m_allocatedBytes);
+    }
+
+    for (const auto& metric : result.m_metrics) {
+        text += QString(" - %1: %2").arg(metric.first).arg(metric.second);
+    }
+
+    return text;
+}
+
+bool BenchResults::write(Format format, const QString& fileName) const
+{
+    QByteArray data;
+
+    if (format == FormatJSON)
+    {
+        data = toJSON();
+    }
+    else if (format == FormatCSV)
+    {
+        data = toCSV();
+    }
+    else
+    {
+        for (const auto& result : m_results) {
+            data += formatText(result).toUtf8() + "\n";
+        }
+    }
+
+    if (fileName.isEmpty())
+    {
+        fwrite(data.constData(), 1, data.size(), stdout);
+        fflush(stdout);
+        return true;
+    }
+
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "BenchResults::write: cannot open" << fileName << ":" << file.errorString();
+        return false;
+    }
+
+    file.write(data);
+    file.close();
+    qDebug() << "BenchResults::write: results written to" << fileName;
+    return true;
+}
+
+QByteArray BenchResults::toJSON() const
+{
+    QJsonObject environment;
+    environment.insert("application", QCoreApplication::applicationName());
+    environment.insert("version", QCoreApplication::applicationVersion());
+    environment.insert("qtVersion", QString(QT_VERSION_STR));
+    environment.insert("cpuArchitecture", QSysInfo::currentCpuArchitecture());
+    environment.insert("os", QSysInfo::prettyProductName());
+    environment.insert("rxSampleSize", SDR_RX_SAMP_SZ);
+    environment.insert("txSampleSize", SDR_TX_SAMP_SZ);
+    environment.insert("halfbandKernels", QString(HalfbandKernels::getInstructionSetName(HalfbandKernels::getInstructionSet())));
+    environment.insert("ncoKernels", QString(HalfbandKernels::getInstructionSetName(NCOKernels::getInstructionSet())));
+    environment.insert("allocationsCounted", BenchAllocations::isEnabled());
+    environment.insert("date", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+
+    QJsonArray results;
+
+    for (const auto& result : m_results)
+    {
+        QJsonObject jsonResult;
+        jsonResult.insert("test", result.m_test);
+        jsonResult.insert("parameters", result.m_parameters);
+        jsonResult.insert("samples", (double) result.m_nbSamples);
+        jsonResult.insert("nsecs", (double) result.m_nsecs);
+        jsonResult.insert("msps", result.getMSps());
+        jsonResult.insert("nsPerSample", result.getNsPerSample());
+        jsonResult.insert("allocations", (double) result.m_allocations);
+        jsonResult.insert("allocatedBytes", (double) result.m_allocatedBytes);
+
+        if (result.m_metrics.size() != 0)
+        {
+            QJsonObject metrics;
+
+            for (const auto& metric : result.m_metrics) {
+                metrics.insert(metric.first, metric.second);
+            }
+
+            jsonResult.insert("metrics", metrics);
+        }
+
+        results.append(jsonResult);
+    }
+
+    QJsonObject root;
+    root.insert("environment", environment);
+    root.insert("results", results);
+
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+QByteArray BenchResults::toCSV() const
+{
+    QByteArray csv("test,parameters,samples,nsecs,msps,ns_per_sample,allocations,allocated_bytes,metrics\n");
+
+    for (const auto& result : m_results)
+    {
+        QStringList metrics;
+
+        for (const auto& metric : result.m_metrics) {
+            metrics.append(QString("%1=%2").arg(metric.first).arg(metric.second));
+        }
+
+        csv += QString("%1,\"%2\",%3,%4,%5,%6,%7,%8,\"%9\"\n")
+            .arg(result.m_test)
+            .arg(result.m_parameters)
+            .arg(result.m_nbSamples)
+            .arg(result.m_nsecs)
+            .arg(result.getMSps(), 0, 'f', 6)
+            .arg(result.getNsPerSample(), 0, 'f', 6)
+            .arg(result.m_allocations)
+            .arg(result.m_allocatedBytes)
+            .arg(metrics.join(";"))
+            .toUtf8();
+    }
+
+    return csv;
+}
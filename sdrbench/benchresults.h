@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Benchmark measurements and their output as text, JSON or CSV                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_BENCHRESULTS_H_
+#define SDRBENCH_BENCHRESULTS_H_
+
+#include <utility>
+#include <vector>
+
+#include <QString>
+#include <QElapsedTimer>
+
+#include "export.h"
+
+class SDRBENCH_API BenchMeasure
+{
+public:
+    BenchMeasure();
+    void start();     //!< Start timing and allocation counting
+    void stop();      //!< Accumulate elapsed time and allocations since last start
+    qint64 getNsecs() const { return m_nsecs; }
+    quint64 getAllocations() const { return m_allocations; }
+    quint64 getAllocatedBytes() const { return m_allocatedBytes; }
+
+private:
+    QElapsedTimer m_timer;
+    qint64 m_nsecs;
+    quint64 m_allocations;
+    quint64 m_allocatedBytes;
+    quint64 m_startAllocations;
+    quint64 m_startAllocatedBytes;
+};
+
+class SDRBENCH_API BenchResults
+{
+public:
+    enum Format
+    {
+        FormatText,
+        FormatJSON,
+        FormatCSV
+    };
+
+    typedef std::vector<std::pair<QString, double>> Metrics; //!< Test specific named values e.g. overflow counts
+
+    struct Result
+    {
+        QString m_test;
+        QString m_parameters;     //!< Test specific parameters e.g. "log2=4"
+        quint64 m_nbSamples;      //!< Total number of samples processed
+        qint64 m_nsecs;
+        quint64 m_allocations;
+        quint64 m_allocatedBytes;
+        Metrics m_metrics;
+
+        double getMSps() const { return m_nsecs == 0 ? 0.0 : (m_nbSamples * 1e3) / m_nsecs; }
+        double getNsPerSample() const { return m_nbSamples == 0 ? 0.0 : m_nsecs / (double) m_nbSamples; }
+    };
+
+    void add(const QString& test, const QString& parameters, quint64 nbSamples, const BenchMeasure& measure);
+    void add(const QString& test, const QString& parameters, quint64 nbSamples, const BenchMeasure& measure, const Metrics& metrics);
+    const std::vector<Result>& getResults() const { return m_results; }
+    bool write(Format format, const QString& fileName) const; //!< Write all results to file or stdout if file name is empty
+
+    static QString formatText(const Result& result);
+
+private:
+    std::vector<Result> m_results;
+
+    QByteArray toJSON() const;
+    QByteArray toCSV() const;
+};
+
+#endif // SDRBENCH_BENCHRESULTS_H_
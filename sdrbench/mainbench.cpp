@@ -18,8 +18,8 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QDebug>
-#include <QElapsedTimer>
 
+#include "pipelinebench.h"
 #include "mainbench.h"
 
 MainBench *MainBench::m_instance = 0;
@@ -48,31 +48,106 @@ void MainBench::run()
         << " repet: " << m_parser.getRepetition()
         << " log2f: " << m_parser.getLog2Factor();
 
-    if (m_parser.getTestType() == ParserBench::TestDecimatorsII) {
+    if (m_parser.getTestType() == ParserBench::TestAll) {
+        runAll();
+    } else {
+        runTest(m_parser.getTestType());
+    }
+
+    // text results are already logged as tests complete
+    if ((m_parser.getFormat() != BenchResults::FormatText) || !m_parser.getOutputFileName().isEmpty()) {
+        m_results.write(m_parser.getFormat(), m_parser.getOutputFileName());
+    }
+
+    emit finished();
+}
+
+void MainBench::runTest(ParserBench::TestType testType)
+{
+    if (testType == ParserBench::TestDecimatorsII) {
         testDecimateII();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsInfII) {
+    } else if (testType == ParserBench::TestDecimatorsInfII) {
         testDecimateII(ParserBench::TestDecimatorsInfII);
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsSupII) {
+    } else if (testType == ParserBench::TestDecimatorsSupII) {
         testDecimateII(ParserBench::TestDecimatorsSupII);
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsIF) {
+    } else if (testType == ParserBench::TestDecimatorsIF) {
         testDecimateIF();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFI) {
+    } else if (testType == ParserBench::TestDecimatorsFI) {
         testDecimateFI();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFF) {
+    } else if (testType == ParserBench::TestDecimatorsFF) {
         testDecimateFF();
-    } else if (m_parser.getTestType() == ParserBench::TestGolay2312) {
+    } else if (testType == ParserBench::TestGolay2312) {
         testGolay2312();
+    } else if (testType == ParserBench::TestDownChannelizer) {
+        testDownChannelizer();
+    } else if (testType == ParserBench::TestUpChannelizer) {
+        testUpChannelizer();
+    } else if (testType == ParserBench::TestFFTFiltSSB) {
+        testFFTFilt(true);
+    } else if (testType == ParserBench::TestFFTFilt) {
+        testFFTFilt(false);
+    } else if (testType == ParserBench::TestNCO) {
+        testNCO();
+    } else if (testType == ParserBench::TestNCOF) {
+        testNCOF();
+    } else if (testType == ParserBench::TestInterpolator) {
+        testInterpolator();
+    } else if (testType == ParserBench::TestSpectrumVis) {
+        testSpectrumVis();
+    } else if (testType == ParserBench::TestScopeVis) {
+        testScopeVis();
+    } else if (testType == ParserBench::TestAudioResampler) {
+        testAudioResampler();
+    } else if (testType == ParserBench::TestPhaseDiscriminators) {
+        testPhaseDiscriminators();
+    } else if (testType == ParserBench::TestFFT) {
+        testFFT();
+    } else if (testType == ParserBench::TestMessageQueue) {
+        testMessageQueue();
+    } else if (testType == ParserBench::TestLDPC) {
+        testLDPC();
+    } else if (testType == ParserBench::TestPipeline) {
+        PipelineBench pipelineBench(m_parser, m_results);
+        pipelineBench.run();
     } else {
-        qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
+        qDebug() << "MainBench::runTest: unknown test type: " << testType;
     }
+}
 
-    emit finished();
+void MainBench::runAll()
+{
+    // all throughput tests (Golay is a functional test)
+    ParserBench::TestType testTypes[] = {
+        ParserBench::TestDecimatorsII,
+        ParserBench::TestDecimatorsInfII,
+        ParserBench::TestDecimatorsSupII,
+        ParserBench::TestDecimatorsIF,
+        ParserBench::TestDecimatorsFI,
+        ParserBench::TestDecimatorsFF,
+        ParserBench::TestDownChannelizer,
+        ParserBench::TestUpChannelizer,
+        ParserBench::TestFFTFiltSSB,
+        ParserBench::TestFFTFilt,
+        ParserBench::TestNCO,
+        ParserBench::TestNCOF,
+        ParserBench::TestInterpolator,
+        ParserBench::TestSpectrumVis,
+        ParserBench::TestScopeVis,
+        ParserBench::TestAudioResampler,
+        ParserBench::TestPhaseDiscriminators,
+        ParserBench::TestFFT,
+        ParserBench::TestMessageQueue,
+        ParserBench::TestLDPC
+    };
+
+    for (auto testType : testTypes) {
+        runTest(testType);
+    }
 }
 
 void MainBench::testDecimateII(ParserBench::TestType testType)
 {
-    QElapsedTimer timer;
-    qint64 nsecs = 0;
+    BenchMeasure measure;
 
     qDebug() << "MainBench::testDecimateII: create test data";
 
@@ -88,25 +163,27 @@ void MainBench::testDecimateII(ParserBench::TestType testType)
         switch (testType)
         {
         case ParserBench::TestDecimatorsInfII:
-            timer.start();
+            measure.start();
             decimateInfII(buf, m_parser.getNbSamples()*2);
-            nsecs += timer.nsecsElapsed();
+            measure.stop();
             break;
         case ParserBench::TestDecimatorsSupII:
-            timer.start();
+            measure.start();
             decimateSupII(buf, m_parser.getNbSamples()*2);
-            nsecs += timer.nsecsElapsed();
+            measure.stop();
             break;
         case ParserBench::TestDecimatorsII:
         default:
-            timer.start();
+            measure.start();
             decimateII(buf, m_parser.getNbSamples()*2);
-            nsecs += timer.nsecsElapsed();
+            measure.stop();
             break;
         }
     }
 
-    printResults("MainBench::testDecimateII", nsecs);
+    printResults(testType == ParserBench::TestDecimatorsInfII ?
+        "decimateinfii" : testType == ParserBench::TestDecimatorsSupII ?
+        "decimatesupii" : "decimateii", measure);
 
     qDebug() << "MainBench::testDecimateII: cleanup test data";
     delete[] buf;
@@ -114,8 +191,7 @@ void MainBench::testDecimateII(ParserBench::TestType testType)
 
 void MainBench::testDecimateIF()
 {
-    QElapsedTimer timer;
-    qint64 nsecs = 0;
+    BenchMeasure measure;
 
     qDebug() << "MainBench::testDecimateIF: create test data";
 
@@ -128,12 +204,12 @@ void MainBench::testDecimateIF()
 
     for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
     {
-        timer.start();
+        measure.start();
         decimateIF(buf, m_parser.getNbSamples()*2);
-        nsecs += timer.nsecsElapsed();
+        measure.stop();
     }
 
-    printResults("MainBench::testDecimateIF", nsecs);
+    printResults("decimateif", measure);
 
     qDebug() << "MainBench::testDecimateIF: cleanup test data";
     delete[] buf;
@@ -141,8 +217,7 @@ void MainBench::testDecimateIF()
 
 void MainBench::testDecimateFI()
 {
-    QElapsedTimer timer;
-    qint64 nsecs = 0;
+    BenchMeasure measure;
 
     qDebug() << "MainBench::testDecimateFI: create test data";
 
@@ -155,12 +230,12 @@ void MainBench::testDecimateFI()
 
     for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
     {
-        timer.start();
+        measure.start();
         decimateFI(buf, m_parser.getNbSamples()*2);
-        nsecs += timer.nsecsElapsed();
+        measure.stop();
     }
 
-    printResults("MainBench::testDecimateFI", nsecs);
+    printResults("decimatefi", measure);
 
     qDebug() << "MainBench::testDecimateFI: cleanup test data";
     delete[] buf;
@@ -168,8 +243,7 @@ void MainBench::testDecimateFI()
 
 void MainBench::testDecimateFF()
 {
-    QElapsedTimer timer;
-    qint64 nsecs = 0;
+    BenchMeasure measure;
 
     qDebug() << "MainBench::testDecimateFF: create test data";
 
@@ -182,12 +256,12 @@ void MainBench::testDecimateFF()
 
     for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
     {
-        timer.start();
+        measure.start();
         decimateFF(buf, m_parser.getNbSamples()*2);
-        nsecs += timer.nsecsElapsed();
+        measure.stop();
     }
 
-    printResults("MainBench::testDecimateFF", nsecs);
+    printResults("decimateff", measure);
 
     qDebug() << "MainBench::testDecimateFF: cleanup test data";
     delete[] buf;
@@ -385,10 +459,34 @@ void MainBench::decimateFF(const float *buf, int len)
     }
 }
 
-void MainBench::printResults(const QString& prefix, qint64 nsecs)
+void MainBench::generateSamples(SampleVector& samples, unsigned int nbSamples)
+{
+    samples.resize(nbSamples);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (auto& sample : samples)
+    {
+        sample.setReal(my_rand() << (SDR_RX_SAMP_SZ - 12)); // 12 bit ADC full scale
+        sample.setImag(my_rand() << (SDR_RX_SAMP_SZ - 12));
+    }
+}
+
+void MainBench::generateComplex(std::vector<Complex>& samples, unsigned int nbSamples)
+{
+    samples.resize(nbSamples);
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& sample : samples) {
+        sample = Complex{my_rand(), my_rand()}; // make sure data is in [-1.0..1.0] range
+    }
+}
+
+void MainBench::printResults(const QString& test, const BenchMeasure& measure)
+{
+    printResults(test, QString("log2=%1").arg(m_parser.getLog2Factor()), measure, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
+
+void MainBench::printResults(const QString& test, const QString& parameters, const BenchMeasure& measure, quint64 nbSamples)
 {
-    double ratekSs = (m_parser.getNbSamples()*m_parser.getRepetition() / (double) nsecs) * 1e6;
-    QDebug info = qInfo();
-    info.noquote();
-    info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s").arg(prefix).arg(nsecs).arg(ratekSs);
+    m_results.add(test, parameters, nbSamples, measure);
 }
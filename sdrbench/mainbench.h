@@ -29,6 +29,7 @@
 #include "dsp/decimatorsfi.h"
 #include "dsp/decimatorsff.h"
 #include "parserbench.h"
+#include "benchresults.h"
 #include "export.h"
 
 namespace qtwebapp {
@@ -49,18 +50,36 @@ signals:
     void finished();
 
 private:
+    void runTest(ParserBench::TestType testType);
+    void runAll();
     void testDecimateII(ParserBench::TestType testType = ParserBench::TestDecimatorsII);
     void testDecimateIF();
     void testDecimateFI();
     void testDecimateFF();
     void testGolay2312();
+    void testDownChannelizer();
+    void testUpChannelizer();
+    void testFFTFilt(bool ssb);
+    void testNCO();
+    void testNCOF();
+    void testInterpolator();
+    void testSpectrumVis();
+    void testScopeVis();
+    void testAudioResampler();
+    void testPhaseDiscriminators();
+    void testFFT();
+    void testMessageQueue();
+    void testLDPC();
     void decimateII(const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
     void decimateSupII(const qint16 *buf, int len);
     void decimateIF(const qint16 *buf, int len);
     void decimateFI(const float *buf, int len);
     void decimateFF(const float *buf, int len);
-    void printResults(const QString& prefix, qint64 nsecs);
+    void printResults(const QString& test, const BenchMeasure& measure);
+    void printResults(const QString& test, const QString& parameters, const BenchMeasure& measure, quint64 nbSamples);
+    void generateSamples(SampleVector& samples, unsigned int nbSamples);
+    void generateComplex(std::vector<Complex>& samples, unsigned int nbSamples);
 
     static MainBench *m_instance;
     qtwebapp::LoggerWithFile *m_logger;
@@ -76,6 +95,7 @@ private:
 
     SampleVector m_convertBuffer;
     FSampleVector m_convertBufferF;
+    BenchResults m_results;
 };
 
 #endif // SDRBENCH_MAINBENCH_H_
@@ -24,7 +24,9 @@
 
 ParserBench::ParserBench() :
     m_testOption(QStringList() << "t" << "test",
-        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe, golay2312",
+        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe, golay2312, "
+        "downchannelizer, upchannelizer, fftfiltssb, fftfilt, nco, ncof, interpolator, spectrumvis, scopevis, "
+        "audioresampler, phasediscri, fft, messagequeue, ldpc, all, pipeline",
         "test",
         "decimateii"),
     m_nbSamplesOption(QStringList() << "n" << "nb-samples",
@@ -38,12 +40,48 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_fftSizeOption(QStringList() << "s" << "fft-size",
+        "FFT size for FFT based tests (power of two).",
+        "size",
+        "1024"),
+    m_formatOption(QStringList() << "f" << "format",
+        "Results format: text, json, csv.",
+        "format",
+        "text"),
+    m_outputOption(QStringList() << "o" << "output",
+        "Results output file. Results are printed on standard output if not specified.",
+        "file",
+        ""),
+    m_sampleRateOption(QStringList() << "sample-rate",
+        "Pipeline test: device sample rate (S/s).",
+        "rate",
+        "2000000"),
+    m_channelsOption(QStringList() << "channels",
+        "Pipeline test: comma separated channels with their number of instances e.g. nfm:4,ssb:2,adsb:1,filesink:1. "
+        "Other channels are given by their type ID e.g. AMDemod:2.",
+        "channels",
+        "nfm:1"),
+    m_durationOption(QStringList() << "duration",
+        "Pipeline test: run duration (s).",
+        "seconds",
+        "10"),
+    m_fanOutOption(QStringList() << "fan-out",
+        "Pipeline test: feed each channel on its own thread."),
+    m_sharedFifoOption(QStringList() << "shared-fifo",
+        "Pipeline test: channels that support it read the baseband from the shared FIFO.")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
     m_repetition = 1;
     m_log2Factor = 4;
+    m_fftSize = 1024;
+    m_format = BenchResults::FormatText;
+    m_sampleRate = 2000000;
+    m_channels = "nfm:1";
+    m_duration = 10;
+    m_fanOut = false;
+    m_sharedFifo = false;
 
     m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
     m_parser.addHelpOption();
@@ -53,6 +91,14 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_fftSizeOption);
+    m_parser.addOption(m_formatOption);
+    m_parser.addOption(m_outputOption);
+    m_parser.addOption(m_sampleRateOption);
+    m_parser.addOption(m_channelsOption);
+    m_parser.addOption(m_durationOption);
+    m_parser.addOption(m_fanOutOption);
+    m_parser.addOption(m_sharedFifoOption);
 }
 
 ParserBench::~ParserBench()
@@ -111,6 +157,69 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // FFT size
+
+    QString fftSizeStr = m_parser.value(m_fftSizeOption);
+    int fftSize = fftSizeStr.toInt(&ok);
+
+    if (ok && (fftSize >= 16) && (fftSize <= 65536) && ((fftSize & (fftSize - 1)) == 0)) {
+        m_fftSize = fftSize;
+    } else {
+        qWarning() << "ParserBench::parse: FFT size invalid. Defaulting to " << m_fftSize;
+    }
+
+    // results format
+
+    QString format = m_parser.value(m_formatOption);
+
+    if (format == "json") {
+        m_format = BenchResults::FormatJSON;
+    } else if (format == "csv") {
+        m_format = BenchResults::FormatCSV;
+    } else if (format == "text") {
+        m_format = BenchResults::FormatText;
+    } else {
+        qWarning() << "ParserBench::parse: format invalid. Defaulting to text";
+    }
+
+    // results output file
+
+    m_outputFileName = m_parser.value(m_outputOption);
+
+    // pipeline sample rate
+
+    QString sampleRateStr = m_parser.value(m_sampleRateOption);
+    int sampleRate = sampleRateStr.toInt(&ok);
+
+    if (ok && (sampleRate >= 48000) && (sampleRate <= 100000000)) {
+        m_sampleRate = sampleRate;
+    } else {
+        qWarning() << "ParserBench::parse: sample rate invalid. Defaulting to " << m_sampleRate;
+    }
+
+    // pipeline channels
+
+    m_channels = m_parser.value(m_channelsOption);
+
+    // pipeline duration
+
+    QString durationStr = m_parser.value(m_durationOption);
+    int duration = durationStr.toInt(&ok);
+
+    if (ok && (duration > 0) && (duration <= 3600)) {
+        m_duration = duration;
+    } else {
+        qWarning() << "ParserBench::parse: duration invalid. Defaulting to " << m_duration;
+    }
+
+    // pipeline channels fan out
+
+    m_fanOut = m_parser.isSet(m_fanOutOption);
+
+    // pipeline channels shared baseband FIFO
+
+    m_sharedFifo = m_parser.isSet(m_sharedFifoOption);
 }
 
 ParserBench::TestType ParserBench::getTestType() const
@@ -127,6 +236,38 @@ ParserBench::TestType ParserBench::getTestType() const
         return TestDecimatorsSupII;
     } else if (m_testStr == "golay2312") {
         return TestGolay2312;
+    } else if (m_testStr == "downchannelizer") {
+        return TestDownChannelizer;
+    } else if (m_testStr == "upchannelizer") {
+        return TestUpChannelizer;
+    } else if (m_testStr == "fftfiltssb") {
+        return TestFFTFiltSSB;
+    } else if (m_testStr == "fftfilt") {
+        return TestFFTFilt;
+    } else if (m_testStr == "nco") {
+        return TestNCO;
+    } else if (m_testStr == "ncof") {
+        return TestNCOF;
+    } else if (m_testStr == "interpolator") {
+        return TestInterpolator;
+    } else if (m_testStr == "spectrumvis") {
+        return TestSpectrumVis;
+    } else if (m_testStr == "scopevis") {
+        return TestScopeVis;
+    } else if (m_testStr == "audioresampler") {
+        return TestAudioResampler;
+    } else if (m_testStr == "phasediscri") {
+        return TestPhaseDiscriminators;
+    } else if (m_testStr == "fft") {
+        return TestFFT;
+    } else if (m_testStr == "messagequeue") {
+        return TestMessageQueue;
+    } else if (m_testStr == "ldpc") {
+        return TestLDPC;
+    } else if (m_testStr == "all") {
+        return TestAll;
+    } else if (m_testStr == "pipeline") {
+        return TestPipeline;
     } else {
         return TestDecimatorsII;
     }
@@ -22,6 +22,7 @@
 #include <QCommandLineParser>
 #include <stdint.h>
 
+#include "benchresults.h"
 #include "export.h"
 
 class SDRBENCH_API ParserBench
@@ -35,7 +36,23 @@ public:
         TestDecimatorsFF,
         TestDecimatorsInfII,
         TestDecimatorsSupII,
-        TestGolay2312
+        TestGolay2312,
+        TestDownChannelizer,
+        TestUpChannelizer,
+        TestFFTFiltSSB,
+        TestFFTFilt,
+        TestNCO,
+        TestNCOF,
+        TestInterpolator,
+        TestSpectrumVis,
+        TestScopeVis,
+        TestAudioResampler,
+        TestPhaseDiscriminators,
+        TestFFT,
+        TestMessageQueue,
+        TestLDPC,
+        TestAll,
+        TestPipeline
     } TestType;
 
     ParserBench();
@@ -48,18 +65,42 @@ public:
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    uint32_t getFFTSize() const { return m_fftSize; }
+    BenchResults::Format getFormat() const { return m_format; }
+    const QString& getOutputFileName() const { return m_outputFileName; }
+    int getSampleRate() const { return m_sampleRate; }
+    const QString& getChannels() const { return m_channels; }
+    int getDuration() const { return m_duration; }
+    bool getFanOut() const { return m_fanOut; }
+    bool getSharedFifo() const { return m_sharedFifo; }
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    uint32_t m_fftSize;
+    BenchResults::Format m_format;
+    QString  m_outputFileName;
+    int      m_sampleRate; //!< pipeline test device sample rate
+    QString  m_channels;   //!< pipeline test channels specification
+    int      m_duration;   //!< pipeline test duration in seconds
+    bool     m_fanOut;     //!< pipeline test channel sink fan out
+    bool     m_sharedFifo; //!< pipeline test channels read the shared baseband FIFO
 
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_fftSizeOption;
+    QCommandLineOption m_formatOption;
+    QCommandLineOption m_outputOption;
+    QCommandLineOption m_sampleRateOption;
+    QCommandLineOption m_channelsOption;
+    QCommandLineOption m_durationOption;
+    QCommandLineOption m_fanOutOption;
+    QCommandLineOption m_sharedFifoOption;
 };
 
 
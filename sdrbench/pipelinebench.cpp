@@ -0,0 +1,592 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include "SWGDeviceSettings.h"
+#include "SWGTestSourceSettings.h"
+#include "SWGChannelSettings.h"
+#include "SWGNFMDemodSettings.h"
+#include "SWGSSBDemodSettings.h"
+#include "SWGADSBDemodSettings.h"
+#include "SWGFileSinkSettings.h"
+
+#include "maincore.h"
+#include "device/deviceapi.h"
+#include "device/deviceset.h"
+#include "device/deviceenumerator.h"
+#include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkmultireaderfifo.h"
+#include "channel/channelapi.h"
+#include "plugin/pluginmanager.h"
+#include "pipelinebench.h"
+
+PipelineBench::PipelineBench(const ParserBench& parser, BenchResults& results, QObject *parent) :
+    QObject(parent),
+    m_parser(parser),
+    m_results(results),
+    m_mainCore(MainCore::instance()),
+    m_dspEngine(DSPEngine::instance()),
+    m_deviceSet(nullptr),
+    m_writtenSamples(0),
+    m_deviceFifoFillSum(0),
+    m_deviceFifoFillMax(0),
+    m_deviceFifoFillCount(0),
+    m_sourceSamples(0),
+    m_latencySumNs(0.0),
+    m_latencyMaxNs(0),
+    m_latencyCount(0)
+{
+    m_mainCore->m_mainMessageQueue = &m_inputMessageQueue;
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleMessages()), Qt::QueuedConnection);
+    connect(&m_latencyTimer, SIGNAL(timeout()), this, SLOT(sampleLatency()));
+
+    if (!m_dspEngine->getFFTFactory()) {
+        m_dspEngine->createFFTFactory("");
+    }
+
+    if (!m_mainCore->m_pluginManager)
+    {
+        qDebug() << "PipelineBench::PipelineBench: load plugins...";
+        m_mainCore->m_pluginManager = new PluginManager(this);
+        m_mainCore->m_pluginManager->loadPlugins(QString("pluginssrv"));
+    }
+}
+
+PipelineBench::~PipelineBench()
+{
+    if (m_deviceSet) {
+        removeDeviceSet();
+    }
+
+    if (m_mainCore->m_pluginManager && (m_mainCore->m_pluginManager->parent() == this))
+    {
+        delete m_mainCore->m_pluginManager;
+        m_mainCore->m_pluginManager = nullptr;
+    }
+
+    m_mainCore->m_mainMessageQueue = nullptr;
+}
+
+void PipelineBench::run()
+{
+    int sampleRate = m_parser.getSampleRate();
+    std::vector<ChannelSpec> channelSpecs;
+
+    if (!parseChannels(m_parser.getChannels(), channelSpecs)) {
+        return;
+    }
+
+    if (!addDeviceSet()) {
+        return;
+    }
+
+    configureDevice(sampleRate);
+
+    if (!addChannels(channelSpecs, sampleRate))
+    {
+        removeDeviceSet();
+        return;
+    }
+
+    m_deviceSet->m_deviceAPI->setChannelSinkFanOut(m_parser.getFanOut());
+    m_deviceSet->m_deviceAPI->setSharedBasebandFifo(m_parser.getSharedFifo());
+    QCoreApplication::processEvents(); // let the device and channels apply their settings
+
+    DeviceSampleSource *source = m_deviceSet->m_deviceAPI->getSampleSource();
+    SampleSinkFifo *deviceFifo = source->getSampleFifo();
+    connect(deviceFifo, SIGNAL(written(int, qint64)), this, SLOT(handleWritten(int, qint64)), Qt::DirectConnection);
+
+    std::map<int, ThreadTimes> threadTimesStart;
+    getThreadTimes(threadTimesStart);
+    quint64 processTimeStart = getProcessTimeUs();
+    quint64 deviceOverflowsStart = deviceFifo->getOverflowSamples();
+    m_writtenSamples = 0;
+    m_sourceSamples = 0;
+    m_sourceTimestamps.clear();
+
+    BenchMeasure measure;
+    measure.start();
+
+    if (!m_deviceSet->m_deviceAPI->startDeviceEngine())
+    {
+        qWarning() << "PipelineBench::run: cannot start device engine:" << m_deviceSet->m_deviceAPI->errorMessage();
+        disconnect(deviceFifo, SIGNAL(written(int, qint64)), this, SLOT(handleWritten(int, qint64)));
+        removeDeviceSet();
+        return;
+    }
+
+    m_latencyTimer.start(10);
+    QEventLoop loop;
+    QTimer::singleShot(m_parser.getDuration() * 1000, &loop, SLOT(quit()));
+    loop.exec();
+    m_latencyTimer.stop();
+
+    // channel FIFOs of basebands created on channel start are gone once stopped
+    quint64 channelOverflows = 0;
+    quint64 channelOverflowSamples = 0;
+
+    for (int i = 0; i < m_deviceSet->getNumberOfChannels(); i++)
+    {
+        ChannelAPI::InputFifoStats channelFifoStats;
+
+        if (m_deviceSet->getChannelAt(i)->getInputFifoStats(channelFifoStats))
+        {
+            channelOverflows += channelFifoStats.m_overflowCount;
+            channelOverflowSamples += channelFifoStats.m_droppedSamples;
+        }
+    }
+
+    m_deviceSet->m_deviceAPI->stopDeviceEngine();
+    measure.stop();
+
+    disconnect(deviceFifo, SIGNAL(written(int, qint64)), this, SLOT(handleWritten(int, qint64)));
+    quint64 processTime = getProcessTimeUs() - processTimeStart;
+    std::map<int, ThreadTimes> threadTimesEnd;
+    getThreadTimes(threadTimesEnd);
+
+    // samples that made it through the device FIFO into the engine
+    quint64 writtenSamples = m_writtenSamples.load();
+    quint64 residue = deviceFifo->fill();
+    quint64 processedSamples = writtenSamples > residue ? writtenSamples - residue : 0;
+    double elapsedSec = measure.getNsecs() / 1e9;
+
+    BenchResults::Metrics metrics;
+    metrics.push_back({"inputRate", (double) sampleRate});
+    metrics.push_back({"deviceFifoOverflowSamples", (double) (deviceFifo->getOverflowSamples() - deviceOverflowsStart)});
+    metrics.push_back({"channelFifoOverflows", (double) channelOverflows});
+    metrics.push_back({"channelFifoOverflowSamples", (double) channelOverflowSamples});
+
+    SampleSinkMultiReaderFifo *basebandFifo = m_deviceSet->m_deviceAPI->getBasebandFifo();
+
+    if (basebandFifo)
+    {
+        quint64 basebandOverflows = 0;
+
+        for (int reader = 0; reader < SampleSinkMultiReaderFifo::m_maxReaders; reader++) {
+            basebandOverflows += basebandFifo->getOverflowCount(reader);
+        }
+
+        metrics.push_back({"basebandFifoOverflows", (double) basebandOverflows});
+        metrics.push_back({"basebandFifoDroppedSamples", (double) basebandFifo->getDroppedCount()});
+    }
+
+    if (m_parser.getFanOut())
+    {
+        std::vector<BasebandSampleSinkFanOut::SinkStats> stats;
+        m_deviceSet->m_deviceSourceEngine->getFanOutStats(stats);
+
+        for (const auto& sinkStats : stats)
+        {
+            metrics.push_back({QString("fanOutDroppedBlocks:%1").arg(sinkStats.m_sinkName), (double) sinkStats.m_droppedBlocks});
+            metrics.push_back({QString("fanOutMaxQueueDepth:%1").arg(sinkStats.m_sinkName), (double) sinkStats.m_maxQueueDepth});
+        }
+    }
+
+    // time samples wait in the device FIFO before the engine picks them up
+    if (m_deviceFifoFillCount > 0)
+    {
+        metrics.push_back({"deviceFifoDelayAvgMs", (m_deviceFifoFillSum * 1e3) / ((double) m_deviceFifoFillCount * sampleRate)});
+        metrics.push_back({"deviceFifoDelayMaxMs", (m_deviceFifoFillMax * 1e3) / (double) sampleRate});
+    }
+
+    // end to end latency: time the next sample to be read by a channel has been waiting since the device FIFO write
+    if (m_latencyCount > 0)
+    {
+        metrics.push_back({"latencyAvgMs", m_latencySumNs / (m_latencyCount * 1e6)});
+        metrics.push_back({"latencyMaxMs", m_latencyMaxNs / 1e6});
+    }
+
+    metrics.push_back({"processCpuPercent", elapsedSec > 0 ? (processTime / 1e4) / elapsedSec : 0.0});
+
+#ifndef _WIN32
+    double ticksPerSec = sysconf(_SC_CLK_TCK);
+
+    for (const auto& threadTimes : threadTimesEnd)
+    {
+        auto it = threadTimesStart.find(threadTimes.first);
+        quint64 ticks = it == threadTimesStart.end() ? threadTimes.second.m_ticks : threadTimes.second.m_ticks - it->second.m_ticks;
+
+        if (ticks == 0) {
+            continue;
+        }
+
+        metrics.push_back({
+            QString("threadCpuPercent:%1:%2").arg(threadTimes.second.m_name).arg(threadTimes.first),
+            elapsedSec > 0 ? ((ticks / ticksPerSec) * 100.0) / elapsedSec : 0.0
+        });
+    }
+#endif
+
+    QString parameters = QString("rate=%1 channels=%2 duration=%3s fanout=%4 sharedfifo=%5")
+        .arg(sampleRate)
+        .arg(m_parser.getChannels())
+        .arg(m_parser.getDuration())
+        .arg(m_parser.getFanOut() ? 1 : 0)
+        .arg(m_parser.getSharedFifo() ? 1 : 0);
+    m_results.add("pipeline", parameters, processedSamples, measure, metrics);
+
+    removeDeviceSet();
+}
+
+bool PipelineBench::parseChannels(const QString& channelsStr, std::vector<ChannelSpec>& channelSpecs)
+{
+    // Short names for the usual suspects. Any other channel is given by its channel type ID e.g. "AMDemod:2"
+    static const std::map<QString, QString> shortNames = {
+        {"nfm", "NFMDemod"},
+        {"ssb", "SSBDemod"},
+        {"adsb", "ADSBDemod"},
+        {"filesink", "FileSink"}
+    };
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    QStringList items = channelsStr.split(",", Qt::SkipEmptyParts);
+#else
+    QStringList items = channelsStr.split(",", QString::SkipEmptyParts);
+#endif
+
+    for (const auto& item : items)
+    {
+        QStringList parts = item.split(":");
+        ChannelSpec channelSpec;
+        bool ok = true;
+        auto it = shortNames.find(parts[0].toLower());
+        channelSpec.m_channelId = it == shortNames.end() ? parts[0] : it->second;
+        channelSpec.m_count = parts.size() > 1 ? parts[1].toInt(&ok) : 1;
+
+        if (!ok || (channelSpec.m_count <= 0))
+        {
+            qWarning() << "PipelineBench::parseChannels: invalid channel specification:" << item;
+            return false;
+        }
+
+        channelSpecs.push_back(channelSpec);
+    }
+
+    if (channelSpecs.size() == 0)
+    {
+        qWarning() << "PipelineBench::parseChannels: no channels specified";
+        return false;
+    }
+
+    return true;
+}
+
+bool PipelineBench::addDeviceSet()
+{
+    int testSourceIndex = DeviceEnumerator::instance()->getRxSamplingDeviceIndex("sdrangel.samplesource.testsource", 0, 0);
+
+    if (testSourceIndex < 0)
+    {
+        qWarning() << "PipelineBench::addDeviceSet: test source plugin not found";
+        return false;
+    }
+
+    DSPDeviceSourceEngine *dspDeviceSourceEngine = m_dspEngine->addDeviceSourceEngine();
+    dspDeviceSourceEngine->start();
+
+    int deviceTabIndex = m_mainCore->m_deviceSets.size();
+    m_deviceSet = new DeviceSet(deviceTabIndex, 0);
+    m_mainCore->m_deviceSets.push_back(m_deviceSet);
+    m_deviceSet->m_deviceSourceEngine = dspDeviceSourceEngine;
+    m_deviceSet->m_deviceSinkEngine = nullptr;
+    m_deviceSet->m_deviceMIMOEngine = nullptr;
+    dspDeviceSourceEngine->addSink(m_deviceSet->m_spectrumVis);
+
+    DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamSingleRx, deviceTabIndex, dspDeviceSourceEngine, nullptr, nullptr);
+    m_deviceSet->m_deviceAPI = deviceAPI;
+
+    const PluginInterface::SamplingDevice *samplingDevice = DeviceEnumerator::instance()->getRxSamplingDevice(testSourceIndex);
+    deviceAPI->setSamplingDeviceSequence(samplingDevice->sequence);
+    deviceAPI->setDeviceNbItems(samplingDevice->deviceNbItems);
+    deviceAPI->setDeviceItemIndex(samplingDevice->deviceItemIndex);
+    deviceAPI->setHardwareId(samplingDevice->hardwareId);
+    deviceAPI->setSamplingDeviceId(samplingDevice->id);
+    deviceAPI->setSamplingDeviceSerial(samplingDevice->serial);
+    deviceAPI->setSamplingDeviceDisplayName(samplingDevice->displayedName);
+    deviceAPI->setSamplingDevicePluginInterface(DeviceEnumerator::instance()->getRxPluginInterface(testSourceIndex));
+
+    DeviceSampleSource *source = deviceAPI->getPluginInterface()->createSampleSourcePluginInstance(
+            deviceAPI->getSamplingDeviceId(), deviceAPI);
+    deviceAPI->setSampleSource(source);
+
+    return true;
+}
+
+void PipelineBench::removeDeviceSet()
+{
+    DSPDeviceSourceEngine *lastDeviceEngine = m_deviceSet->m_deviceSourceEngine;
+    lastDeviceEngine->stopAcquistion();
+
+    m_deviceSet->freeChannels();
+    m_deviceSet->m_deviceAPI->resetSamplingDeviceId();
+    m_deviceSet->m_deviceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceInput(
+            m_deviceSet->m_deviceAPI->getSampleSource());
+    m_deviceSet->m_deviceAPI->clearBuddiesLists();
+
+    DeviceAPI *sourceAPI = m_deviceSet->m_deviceAPI;
+    delete m_deviceSet;
+    m_deviceSet = nullptr;
+
+    lastDeviceEngine->stop();
+    m_dspEngine->removeLastDeviceSourceEngine();
+
+    delete sourceAPI;
+    m_mainCore->m_deviceSets.pop_back();
+}
+
+void PipelineBench::configureDevice(int sampleRate)
+{
+    SWGSDRangel::SWGDeviceSettings deviceSettings;
+    deviceSettings.setDirection(0);
+    deviceSettings.setDeviceHwType(new QString("TestSource"));
+    deviceSettings.setTestSourceSettings(new SWGSDRangel::SWGTestSourceSettings());
+    deviceSettings.getTestSourceSettings()->setSampleRate(sampleRate);
+    deviceSettings.getTestSourceSettings()->setLog2Decim(0);
+    QStringList deviceSettingsKeys = QStringList() << "sampleRate" << "log2Decim";
+    QString errorMessage;
+
+    m_deviceSet->m_deviceAPI->getSampleSource()->webapiSettingsPutPatch(false, deviceSettingsKeys, deviceSettings, errorMessage);
+}
+
+bool PipelineBench::addChannels(const std::vector<ChannelSpec>& channelSpecs, int sampleRate)
+{
+    PluginAPI::ChannelRegistrations *channelRegistrations = m_mainCore->m_pluginManager->getPluginAPI()->getRxChannelRegistrations();
+    int nbChannels = 0;
+
+    for (const auto& channelSpec : channelSpecs) {
+        nbChannels += channelSpec.m_count;
+    }
+
+    int channelIndex = 0;
+
+    for (const auto& channelSpec : channelSpecs)
+    {
+        int registrationIndex = 0;
+
+        for (; registrationIndex < channelRegistrations->size(); registrationIndex++)
+        {
+            if ((*channelRegistrations)[registrationIndex].m_channelId == channelSpec.m_channelId) {
+                break;
+            }
+        }
+
+        if (registrationIndex == channelRegistrations->size())
+        {
+            qWarning() << "PipelineBench::addChannels: channel plugin not found:" << channelSpec.m_channelId;
+            return false;
+        }
+
+        for (int i = 0; i < channelSpec.m_count; i++, channelIndex++)
+        {
+            ChannelAPI *channel = m_deviceSet->addRxChannel(registrationIndex, m_mainCore->m_pluginManager->getPluginAPI());
+            // spread channels evenly over the baseband
+            qint64 offset = ((channelIndex + 1) * (qint64) sampleRate) / (nbChannels + 1) - sampleRate / 2;
+            configureChannel(channel, offset);
+        }
+    }
+
+    return true;
+}
+
+void PipelineBench::configureChannel(ChannelAPI *channel, qint64 offset)
+{
+    SWGSDRangel::SWGChannelSettings channelSettings;
+    channelSettings.setDirection(0);
+    QStringList channelSettingsKeys = QStringList() << "inputFrequencyOffset";
+    QString errorMessage;
+
+    if (channel->getURI() == "sdrangel.channel.nfmdemod")
+    {
+        channelSettings.setNfmDemodSettings(new SWGSDRangel::SWGNFMDemodSettings());
+        channelSettings.getNfmDemodSettings()->setInputFrequencyOffset(offset);
+    }
+    else if (channel->getURI() == "sdrangel.channel.ssbdemod")
+    {
+        channelSettings.setSsbDemodSettings(new SWGSDRangel::SWGSSBDemodSettings());
+        channelSettings.getSsbDemodSettings()->setInputFrequencyOffset(offset);
+    }
+    else if (channel->getURI() == "sdrangel.channel.adsbdemod")
+    {
+        channelSettings.setAdsbDemodSettings(new SWGSDRangel::SWGADSBDemodSettings());
+        channelSettings.getAdsbDemodSettings()->setInputFrequencyOffset(offset);
+    }
+    else if (channel->getURI() == "sdrangel.channel.filesink")
+    {
+        channelSettings.setFileSinkSettings(new SWGSDRangel::SWGFileSinkSettings());
+        channelSettings.getFileSinkSettings()->setInputFrequencyOffset(offset);
+    }
+    else
+    {
+        return; // other channels stay at their default offset
+    }
+
+    channel->webapiSettingsPutPatch(false, channelSettingsKeys, channelSettings, errorMessage);
+}
+
+void PipelineBench::getThreadTimes(std::map<int, ThreadTimes>& threadTimes)
+{
+    threadTimes.clear();
+#ifdef __linux__
+    QDir taskDir("/proc/self/task");
+
+    for (const auto& tidStr : taskDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        QFile statFile(taskDir.filePath(tidStr + "/stat"));
+        QFile commFile(taskDir.filePath(tidStr + "/comm"));
+
+        if (!statFile.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+
+        // fields after the command name in parentheses start with the state (field 3)
+        QByteArray stat = statFile.readAll();
+        QList<QByteArray> fields = stat.mid(stat.lastIndexOf(')') + 2).split(' ');
+
+        if (fields.size() < 13) {
+            continue;
+        }
+
+        ThreadTimes& times = threadTimes[tidStr.toInt()];
+        times.m_ticks = fields[11].toULongLong() + fields[12].toULongLong(); // utime + stime
+
+        if (commFile.open(QIODevice::ReadOnly)) {
+            times.m_name = QString(commFile.readAll()).trimmed();
+        }
+    }
+#endif
+}
+
+quint64 PipelineBench::getProcessTimeUs()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ULL + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#else
+    return 0;
+#endif
+}
+
+// Runs in the device thread
+void PipelineBench::handleWritten(int nsamples, qint64 timestamp)
+{
+    m_writtenSamples.fetch_add(nsamples, std::memory_order_relaxed);
+    QMutexLocker mutexLocker(&m_sourceTimestampsMutex);
+    m_sourceSamples += nsamples;
+    m_sourceTimestamps.push_back({m_sourceSamples, timestamp});
+
+    if (m_sourceTimestamps.size() > 65536) { // no channel reads the baseband e.g. all on polyphase sub-bands
+        m_sourceTimestamps.pop_front();
+    }
+}
+
+// Time at which the sample at the given index was written to the device FIFO. False if not written yet
+bool PipelineBench::getSourceTimestamp(quint64 position, qint64& timestamp)
+{
+    QMutexLocker mutexLocker(&m_sourceTimestampsMutex);
+    auto it = std::upper_bound(
+        m_sourceTimestamps.begin(),
+        m_sourceTimestamps.end(),
+        position,
+        [](quint64 value, const std::pair<quint64, qint64>& entry) { return value < entry.first; }
+    );
+
+    if (it == m_sourceTimestamps.end()) {
+        return false;
+    }
+
+    timestamp = it->second;
+    return true;
+}
+
+void PipelineBench::sampleLatency()
+{
+    if (!m_deviceSet) {
+        return;
+    }
+
+    quint64 fill = m_deviceSet->m_deviceAPI->getSampleSource()->getSampleFifo()->fill();
+    m_deviceFifoFillSum += fill;
+    m_deviceFifoFillMax = std::max(m_deviceFifoFillMax, fill);
+    m_deviceFifoFillCount++;
+
+    // Channels reading the baseband (own FIFO or shared FIFO reader) see every sample at the device rate
+    // so their read position (including the samples they did not get) is an index in the device FIFO
+    // input stream. Channels fed by a polyphase channelizer sub-band run at a lower rate and are skipped.
+    // The latency is sampled here: it is the time the next sample a channel has to read has been
+    // waiting since it was written to the device FIFO (zero when the channel has read everything).
+    // Blocks dropped by the fan out are not accounted for and show as extra latency.
+    qint64 now = MainCore::instance()->getElapsedNsecs();
+    quint64 minPosition = std::numeric_limits<quint64>::max();
+
+    for (int i = 0; i < m_deviceSet->getNumberOfChannels(); i++)
+    {
+        ChannelAPI::InputFifoStats channelFifoStats;
+
+        if (!m_deviceSet->getChannelAt(i)->getInputFifoStats(channelFifoStats) || channelFifoStats.m_subband) {
+            continue;
+        }
+
+        quint64 position = channelFifoStats.m_readPosition;
+        qint64 sourceTimestamp;
+        qint64 latency = 0;
+        minPosition = std::min(minPosition, position);
+
+        if (getSourceTimestamp(position, sourceTimestamp) && (now > sourceTimestamp)) {
+            latency = now - sourceTimestamp;
+        }
+
+        m_latencySumNs += latency;
+        m_latencyMaxNs = std::max(m_latencyMaxNs, latency);
+        m_latencyCount++;
+    }
+
+    if (minPosition != std::numeric_limits<quint64>::max())
+    {
+        QMutexLocker mutexLocker(&m_sourceTimestampsMutex);
+
+        // writes read by all channels are not needed anymore
+        while (!m_sourceTimestamps.empty() && (m_sourceTimestamps.front().first <= minPosition)) {
+            m_sourceTimestamps.pop_front();
+        }
+    }
+}
+
+void PipelineBench::handleMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != 0) {
+        delete message; // no main window or server to act on them
+    }
+}
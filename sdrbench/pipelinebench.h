@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// End to end Rx pipeline benchmark: a test source device set feeding several    //
+// channel plugins in real time                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_PIPELINEBENCH_H_
+#define SDRBENCH_PIPELINEBENCH_H_
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <QObject>
+#include <QMutex>
+#include <QString>
+#include <QTimer>
+
+#include "util/messagequeue.h"
+#include "parserbench.h"
+#include "benchresults.h"
+#include "export.h"
+
+class MainCore;
+class DSPEngine;
+class DeviceSet;
+class ChannelAPI;
+
+class SDRBENCH_API PipelineBench : public QObject
+{
+    Q_OBJECT
+public:
+    PipelineBench(const ParserBench& parser, BenchResults& results, QObject *parent = nullptr);
+    ~PipelineBench();
+
+    void run();
+
+private:
+    struct ChannelSpec
+    {
+        QString m_channelId; //!< Channel type ID in short form e.g. "NFMDemod"
+        int m_count;
+    };
+
+    struct ThreadTimes
+    {
+        QString m_name;
+        quint64 m_ticks;     //!< user + system time in clock ticks
+    };
+
+    const ParserBench& m_parser;
+    BenchResults& m_results;
+    MainCore *m_mainCore;
+    DSPEngine *m_dspEngine;
+    DeviceSet *m_deviceSet;
+    MessageQueue m_inputMessageQueue; //!< Stands for the main message queue. Messages are discarded.
+    QTimer m_latencyTimer;
+
+    std::atomic<quint64> m_writtenSamples;
+    quint64 m_deviceFifoFillSum;      //!< sum of device FIFO fill samples
+    quint64 m_deviceFifoFillMax;
+    quint64 m_deviceFifoFillCount;
+
+    QMutex m_sourceTimestampsMutex;
+    quint64 m_sourceSamples;          //!< samples written to the device FIFO
+    std::deque<std::pair<quint64, qint64>> m_sourceTimestamps; //!< end sample index and time of each device FIFO write
+    double m_latencySumNs;            //!< sum of sampled source to channel input latencies
+    qint64 m_latencyMaxNs;
+    quint64 m_latencyCount;
+
+    bool parseChannels(const QString& channelsStr, std::vector<ChannelSpec>& channelSpecs);
+    bool addDeviceSet();
+    void removeDeviceSet();
+    void configureDevice(int sampleRate);
+    bool addChannels(const std::vector<ChannelSpec>& channelSpecs, int sampleRate);
+    void configureChannel(ChannelAPI *channel, qint64 offset);
+    static void getThreadTimes(std::map<int, ThreadTimes>& threadTimes);
+    static quint64 getProcessTimeUs();
+    bool getSourceTimestamp(quint64 position, qint64& timestamp);
+
+private slots:
+    void handleWritten(int nsamples, qint64 timestamp);
+    void sampleLatency();
+    void handleMessages();
+};
+
+#endif // SDRBENCH_PIPELINEBENCH_H_
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/downchannelizer.h"
+#include "dsp/upchannelizer.h"
+#include "mainbench.h"
+
+namespace {
+
+class BenchChannelSink : public ChannelSampleSink
+{
+public:
+    BenchChannelSink() : m_nbSamples(0) {}
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) {
+        m_nbSamples += end - begin;
+    }
+    quint64 m_nbSamples;
+};
+
+class BenchChannelSource : public ChannelSampleSource
+{
+public:
+    BenchChannelSource(const SampleVector& samples) : m_samples(samples), m_index(0) {}
+    virtual void pull(SampleVector::iterator begin, unsigned int nbSamples)
+    {
+        for (unsigned int i = 0; i < nbSamples; i++) {
+            pullOne(*begin++);
+        }
+    }
+    virtual void pullOne(Sample& sample)
+    {
+        sample = m_samples[m_index];
+        m_index = m_index + 1 < m_samples.size() ? m_index + 1 : 0;
+    }
+    virtual void prefetch(unsigned int nbSamples) { (void) nbSamples; }
+private:
+    const SampleVector& m_samples;
+    unsigned int m_index;
+};
+
+const int benchBasebandSampleRate = 3072000;
+
+}
+
+void MainBench::testDownChannelizer()
+{
+    BenchMeasure measure;
+    SampleVector samples;
+    BenchChannelSink sink;
+    DownChannelizer channelizer(&sink);
+    int channelSampleRate = benchBasebandSampleRate / (1<<m_parser.getLog2Factor());
+
+    qDebug() << "MainBench::testDownChannelizer: create test data";
+
+    generateSamples(samples, m_parser.getNbSamples());
+    channelizer.setBasebandSampleRate(benchBasebandSampleRate);
+    channelizer.setChannelization(channelSampleRate, channelSampleRate / 4); // off center to exercise the side band filters
+
+    qDebug() << "MainBench::testDownChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+        channelizer.feed(samples.begin(), samples.end());
+        measure.stop();
+    }
+
+    printResults("downchannelizer", measure);
+}
+
+void MainBench::testUpChannelizer()
+{
+    BenchMeasure measure;
+    SampleVector samples;
+    SampleVector baseband(m_parser.getNbSamples());
+    int channelSampleRate = benchBasebandSampleRate / (1<<m_parser.getLog2Factor());
+
+    qDebug() << "MainBench::testUpChannelizer: create test data";
+
+    generateSamples(samples, channelSampleRate / 10); // 100 ms of channel samples played in loop
+    BenchChannelSource source(samples);
+    UpChannelizer channelizer(&source);
+    channelizer.setBasebandSampleRate(benchBasebandSampleRate);
+    channelizer.setChannelization(channelSampleRate, channelSampleRate / 4);
+
+    qDebug() << "MainBench::testUpChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+        channelizer.pull(baseband.begin(), baseband.size());
+        measure.stop();
+    }
+
+    printResults("upchannelizer", measure);
+}
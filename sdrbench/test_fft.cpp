@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/gfft.h"
+#include "mainbench.h"
+
+void MainBench::testFFT()
+{
+    unsigned int fftSize = m_parser.getFFTSize();
+    unsigned int nbFFTs = m_parser.getNbSamples() / fftSize;
+    quint64 nbSamples = (quint64) nbFFTs * fftSize * m_parser.getRepetition();
+    std::vector<Complex> samples;
+    Complex sum{0, 0};
+
+    if (!DSPEngine::instance()->getFFTFactory()) {
+        DSPEngine::instance()->createFFTFactory("");
+    }
+
+    qDebug() << "MainBench::testFFT: create test data";
+
+    generateComplex(samples, nbFFTs * fftSize);
+
+    qDebug() << "MainBench::testFFT: run test";
+
+    // FFT engine of the build (FFTW or KissFFT) used by the spectrum and the FFT factory
+    for (int inverse = 0; inverse < 2; inverse++)
+    {
+        BenchMeasure measure;
+        FFTEngine *fft = FFTEngine::create("");
+
+        if (!fft)
+        {
+            qWarning() << "MainBench::testFFT: no FFT engine";
+            return;
+        }
+
+        fft->configure(fftSize, inverse != 0);
+        DSPEngine::instance()->getFFTFactory()->waitForBackgroundPlanning(); // measure the optimized plan
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            measure.start(); // includes loading the input buffer as in actual use
+
+            for (unsigned int j = 0; j < nbFFTs; j++)
+            {
+                std::copy(samples.begin() + j*fftSize, samples.begin() + (j+1)*fftSize, fft->in());
+                fft->transform();
+                sum += fft->out()[j % fftSize];
+            }
+
+            measure.stop();
+        }
+
+        delete fft;
+        printResults("fft",
+            QString("engine=default %1 size=%2").arg(inverse ? "inverse" : "forward").arg(fftSize),
+            measure,
+            nbSamples);
+    }
+
+    // in place FFT used by fftfilt
+    {
+        BenchMeasure measure;
+        g_fft<float> fft(fftSize);
+        std::vector<std::complex<float>> buf(fftSize);
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            measure.start();
+
+            for (unsigned int j = 0; j < nbFFTs; j++)
+            {
+                std::copy(samples.begin() + j*fftSize, samples.begin() + (j+1)*fftSize, buf.begin());
+                fft.ComplexFFT(buf.data());
+                sum += buf[j % fftSize];
+            }
+
+            measure.stop();
+        }
+
+        printResults("fft",
+            QString("engine=gfft forward size=%1").arg(fftSize),
+            measure,
+            nbSamples);
+    }
+
+    qDebug() << "MainBench::testFFT: checksum:" << sum.real() << sum.imag();
+}
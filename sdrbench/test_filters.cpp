@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "dsp/fftfilt.h"
+#include "dsp/interpolator.h"
+#include "audio/audioresampler.h"
+#include "mainbench.h"
+
+void MainBench::testFFTFilt(bool ssb)
+{
+    BenchMeasure measure;
+    std::vector<Complex> samples;
+    fftfilt filter(300.0f / 48000.0f, 3000.0f / 48000.0f, m_parser.getFFTSize()); // SSB demodulator like filter
+    fftfilt::cmplx *out;
+    Complex sum{0, 0};
+
+    qDebug() << "MainBench::testFFTFilt: create test data";
+
+    generateComplex(samples, m_parser.getNbSamples());
+
+    qDebug() << "MainBench::testFFTFilt: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+
+        for (const auto& sample : samples)
+        {
+            int n = ssb ? filter.runSSB(sample, &out, true) : filter.runFilt(sample, &out);
+
+            for (int j = 0; j < n; j++) {
+                sum += out[j];
+            }
+        }
+
+        measure.stop();
+    }
+
+    qDebug() << "MainBench::testFFTFilt: checksum:" << sum.real() << sum.imag();
+    printResults(ssb ? "fftfiltssb" : "fftfilt",
+        QString("fftsize=%1").arg(m_parser.getFFTSize()),
+        measure,
+        (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
+
+void MainBench::testInterpolator()
+{
+    BenchMeasure measure;
+    std::vector<Complex> samples;
+    Interpolator interpolator;
+    Real interpolatorDistance = 72000.0f / 48000.0f; // NFM channel to audio
+    Real interpolatorDistanceRemain = 0.0f;
+    Complex ci;
+    Complex sum{0, 0};
+
+    qDebug() << "MainBench::testInterpolator: create test data";
+
+    generateComplex(samples, m_parser.getNbSamples());
+    interpolator.create(16, 72000, 12500 / 2.2);
+
+    qDebug() << "MainBench::testInterpolator: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+
+        for (const auto& sample : samples)
+        {
+            if (interpolator.decimate(&interpolatorDistanceRemain, sample, &ci))
+            {
+                sum += ci;
+                interpolatorDistanceRemain += interpolatorDistance;
+            }
+        }
+
+        measure.stop();
+    }
+
+    qDebug() << "MainBench::testInterpolator: checksum:" << sum.real() << sum.imag();
+    printResults("interpolator",
+        QString("ratio=%1").arg(interpolatorDistance),
+        measure,
+        (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
+
+void MainBench::testAudioResampler()
+{
+    BenchMeasure measure;
+    AudioResampler audioResampler;
+    std::vector<qint16> samples(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+    qint16 sampleOut;
+    qint64 sum = 0;
+
+    qDebug() << "MainBench::testAudioResampler: create test data";
+
+    std::generate(samples.begin(), samples.end(), my_rand);
+    audioResampler.setDecimation(6);
+    audioResampler.setAudioFilters(48000, 8000, 300, 3500); // codec 8 kS/s audio from 48 kS/s
+
+    qDebug() << "MainBench::testAudioResampler: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+
+        for (auto sample : samples)
+        {
+            if (audioResampler.downSample(sample, sampleOut)) {
+                sum += sampleOut;
+            }
+        }
+
+        measure.stop();
+    }
+
+    qDebug() << "MainBench::testAudioResampler: checksum:" << sum;
+    printResults("audioresampler",
+        QString("decimation=%1").arg(audioResampler.getDecimation()),
+        measure,
+        (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
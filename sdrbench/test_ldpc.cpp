@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <QDebug>
+
+#include "testbench.h"
+#include "algorithms.h"
+#include "ldpc.h"
+#include "encoder.h"
+#include "layered_decoder.h"
+#include "mainbench.h"
+
+// Same decoder configuration as the DATV demodulator LDPCDecoderPool
+void MainBench::testLDPC()
+{
+    typedef ldpctool::NormalUpdate<ldpctool::simd_type> update_type;
+    typedef ldpctool::MinSumCAlgorithm<ldpctool::simd_type, update_type, ldpctool::FACTOR> algorithm_type;
+
+    static const char *tabnames[] = {"B4", "B7", "C4"}; // QPSK 1/2 normal, QPSK 3/4 normal, QPSK 1/2 short
+    const int maxTrials = 25;
+    const float sigmaNoise = 0.5f;  // 3 dB Es/N0 per coded bit
+    const float precision = 2.0f * ldpctool::FACTOR / (sigmaNoise * sigmaNoise);
+    const int nbDistinctBatches = 4;
+
+    qDebug() << "MainBench::testLDPC: run test SIMD width:" << ldpctool::SIMD_WIDTH;
+
+    for (auto tabname : tabnames)
+    {
+        ldpctool::LDPCInterface *ldpc = ldpctool::create_ldpc((char *) "S2", tabname[0], atoi(tabname + 1));
+
+        if (!ldpc)
+        {
+            qCritical() << "MainBench::testLDPC: no such table:" << tabname;
+            continue;
+        }
+
+        const int codeLen = ldpc->code_len();
+        const int dataLen = ldpc->data_len();
+        const int batchLen = ldpctool::SIMD_WIDTH * codeLen;
+        int nbBatches = std::max(1, (int) (m_parser.getNbSamples() / batchLen));
+
+        ldpctool::LDPCEncoder<ldpctool::code_type> encode;
+        ldpctool::LDPCDecoder<ldpctool::simd_type, algorithm_type> decode;
+        encode.init(ldpc);
+        decode.init(ldpc);
+        delete ldpc;
+
+        // Noisy soft bits of a few batches of random code words, cycled during the test
+        std::vector<ldpctool::code_type> orig(nbDistinctBatches * batchLen);
+        std::vector<ldpctool::code_type> noisy(nbDistinctBatches * batchLen);
+        std::uniform_int_distribution<int> bitDistribution(0, 1);
+        std::normal_distribution<float> noiseDistribution(0.0f, sigmaNoise);
+
+        for (int j = 0; j < nbDistinctBatches * ldpctool::SIMD_WIDTH; j++)
+        {
+            ldpctool::code_type *code = orig.data() + j * codeLen;
+
+            for (int i = 0; i < dataLen; i++) {
+                code[i] = 1 - 2 * bitDistribution(m_generator);
+            }
+
+            encode(code, code + dataLen);
+
+            for (int i = 0; i < codeLen; i++)
+            {
+                float llr = std::nearbyint((code[i] + noiseDistribution(m_generator)) * precision);
+                noisy[j * codeLen + i] = std::min(std::max(llr, -128.0f), 127.0f);
+            }
+        }
+
+        void *alignedBuffer = ldpctool::LDPCUtil::aligned_malloc(sizeof(ldpctool::simd_type), sizeof(ldpctool::simd_type) * codeLen);
+        ldpctool::simd_type *simd = reinterpret_cast<ldpctool::simd_type *>(alignedBuffer);
+        BenchMeasure measure;
+        quint64 nbFrames = 0;
+        quint64 iterations = 0;
+        quint64 unconverged = 0;
+        quint64 bitErrors = 0;
+
+        for (uint32_t k = 0; k < m_parser.getRepetition(); k++)
+        {
+            for (int b = 0; b < nbBatches; b++)
+            {
+                int batch = b % nbDistinctBatches;
+                const ldpctool::code_type *code = noisy.data() + batch * batchLen;
+
+                measure.start();
+
+                for (int n = 0; n < ldpctool::SIMD_WIDTH; ++n)
+                    for (int i = 0; i < codeLen; ++i)
+                        reinterpret_cast<ldpctool::code_type *>(simd + i)[n] = code[n * codeLen + i];
+
+                int count = decode(simd, simd + dataLen, maxTrials, ldpctool::SIMD_WIDTH);
+
+                measure.stop();
+
+                if (count < 0)
+                {
+                    unconverged++;
+                    iterations += maxTrials;
+                }
+                else
+                {
+                    iterations += maxTrials - count;
+                }
+
+                // hard decisions on the data part only
+                for (int n = 0; n < ldpctool::SIMD_WIDTH; ++n)
+                {
+                    const ldpctool::code_type *ref = orig.data() + batch * batchLen + n * codeLen;
+
+                    for (int i = 0; i < dataLen; ++i) {
+                        bitErrors += reinterpret_cast<ldpctool::code_type *>(simd + i)[n] * ref[i] <= 0;
+                    }
+                }
+
+                nbFrames += ldpctool::SIMD_WIDTH;
+            }
+        }
+
+        ldpctool::LDPCUtil::aligned_free(alignedBuffer);
+
+        BenchResults::Metrics metrics;
+        metrics.push_back({"framesPerSecond", measure.getNsecs() > 0 ? nbFrames * 1e9 / measure.getNsecs() : 0.0});
+        metrics.push_back({"avgIterations", (double) iterations / (nbFrames / ldpctool::SIMD_WIDTH)});
+        metrics.push_back({"unconvergedBatches", (double) unconverged});
+        metrics.push_back({"bitErrors", (double) bitErrors});
+        m_results.add("ldpc",
+            QString("table=%1 simd=%2 trials=%3").arg(tabname).arg(ldpctool::SIMD_WIDTH).arg(maxTrials),
+            nbFrames * codeLen,
+            measure,
+            metrics);
+    }
+}
@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <thread>
+#include <vector>
+
+#include <QDebug>
+
+#include "dsp/dspcommands.h"
+#include "util/messagequeue.h"
+#include "mainbench.h"
+
+void MainBench::testMessageQueue()
+{
+    const int nbProducers = 4;
+    unsigned int nbMessages = m_parser.getNbSamples() / nbProducers;
+    quint64 nbTotal = (quint64) nbMessages * nbProducers * m_parser.getRepetition();
+
+    qDebug() << "MainBench::testMessageQueue: run test";
+
+    // DSPSignalNotification is pooled, DSPConfigureCorrection comes from the heap
+    for (int pooled = 1; pooled >= 0; pooled--)
+    {
+        BenchMeasure measure;
+        MessageQueue queue;
+        quint64 nbPopped = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            std::vector<std::thread> producers;
+            quint64 nbExpected = nbPopped + (quint64) nbMessages * nbProducers;
+
+            measure.start();
+
+            for (int p = 0; p < nbProducers; p++)
+            {
+                producers.emplace_back([&queue, nbMessages, pooled]() {
+                    for (unsigned int j = 0; j < nbMessages; j++)
+                    {
+                        if (pooled) {
+                            queue.push(new DSPSignalNotification(j, j), false);
+                        } else {
+                            queue.push(new DSPConfigureCorrection(true, false), false);
+                        }
+                    }
+                });
+            }
+
+            while (nbPopped < nbExpected)
+            {
+                Message *message = queue.pop();
+
+                if (message)
+                {
+                    delete message;
+                    nbPopped++;
+                }
+            }
+
+            measure.stop();
+
+            for (auto& producer : producers) {
+                producer.join();
+            }
+        }
+
+        BenchResults::Metrics metrics;
+        metrics.push_back({"maxQueueDepth", (double) queue.getMaxSize()});
+        metrics.push_back({"latencyAvgUs", queue.getMeanLatencyNs() / 1e3});
+        metrics.push_back({"latencyMaxUs", queue.getMaxLatencyNs() / 1e3});
+        m_results.add("messagequeue",
+            QString("producers=%1 %2").arg(nbProducers).arg(pooled ? "pooled" : "heap"),
+            nbTotal,
+            measure,
+            metrics);
+    }
+}
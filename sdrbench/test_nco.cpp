@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+#include "mainbench.h"
+
+void MainBench::testNCO()
+{
+    BenchMeasure measure;
+    NCO nco;
+    Complex sum{0, 0};
+
+    nco.setFreq(-12345.0f, 48000.0f);
+
+    qDebug() << "MainBench::testNCO: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+
+        for (uint32_t j = 0; j < m_parser.getNbSamples(); j++) {
+            sum += nco.nextIQ();
+        }
+
+        measure.stop();
+    }
+
+    qDebug() << "MainBench::testNCO: checksum:" << sum.real() << sum.imag();
+    printResults("nco", "", measure, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+
+    // block generation and mixing
+    BenchMeasure measureBlock;
+    BenchMeasure measureMix;
+    std::vector<Complex> block(m_parser.getNbSamples());
+    SampleVector samples;
+    generateSamples(samples, m_parser.getNbSamples());
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measureBlock.start();
+        nco.nextIQ(block.data(), block.size());
+        measureBlock.stop();
+        sum += block.back();
+        measureMix.start();
+        nco.mix(samples.begin(), samples.end(), block.data());
+        measureMix.stop();
+        sum += block.back();
+    }
+
+    qDebug() << "MainBench::testNCO: block checksum:" << sum.real() << sum.imag();
+    printResults("nco", "block", measureBlock, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+    printResults("nco", "mix", measureMix, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
+
+void MainBench::testNCOF()
+{
+    BenchMeasure measure;
+    NCOF ncof;
+    Complex sum{0, 0};
+
+    ncof.setFreq(-12345.0f, 48000.0f);
+
+    qDebug() << "MainBench::testNCOF: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+
+        for (uint32_t j = 0; j < m_parser.getNbSamples(); j++) {
+            sum += ncof.nextIQ();
+        }
+
+        measure.stop();
+    }
+
+    qDebug() << "MainBench::testNCOF: checksum:" << sum.real() << sum.imag();
+    printResults("ncof", "", measure, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+
+    // block generation and mixing
+    BenchMeasure measureBlock;
+    BenchMeasure measureMix;
+    std::vector<Complex> block(m_parser.getNbSamples());
+    SampleVector samples;
+    generateSamples(samples, m_parser.getNbSamples());
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measureBlock.start();
+        ncof.nextIQ(block.data(), block.size());
+        measureBlock.stop();
+        sum += block.back();
+        measureMix.start();
+        ncof.mix(samples.begin(), samples.end(), block.data());
+        measureMix.stop();
+        sum += block.back();
+    }
+
+    qDebug() << "MainBench::testNCOF: block checksum:" << sum.real() << sum.imag();
+    printResults("ncof", "block", measureBlock, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+    printResults("ncof", "mix", measureMix, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/phasediscri.h"
+#include "mainbench.h"
+
+void MainBench::testPhaseDiscriminators()
+{
+    BenchMeasure measureAtan2;
+    BenchMeasure measureDelta;
+    std::vector<Complex> samples;
+    PhaseDiscriminators phaseDiscri;
+    double magsq;
+    Real fmDev;
+    Real sum = 0.0f;
+
+    qDebug() << "MainBench::testPhaseDiscriminators: create test data";
+
+    generateComplex(samples, m_parser.getNbSamples());
+    phaseDiscri.setFMScaling(1.0f);
+
+    qDebug() << "MainBench::testPhaseDiscriminators: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measureAtan2.start();
+
+        for (const auto& sample : samples) {
+            sum += phaseDiscri.phaseDiscriminator(sample);
+        }
+
+        measureAtan2.stop();
+        measureDelta.start();
+
+        for (const auto& sample : samples)
+        {
+            sum += phaseDiscri.phaseDiscriminatorDelta(sample, magsq, fmDev);
+            sum += fmDev;
+        }
+
+        measureDelta.stop();
+    }
+
+    qDebug() << "MainBench::testPhaseDiscriminators: checksum:" << sum;
+    printResults("phasediscri", "method=atan2", measureAtan2, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+    printResults("phasediscri", "method=delta", measureDelta, (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
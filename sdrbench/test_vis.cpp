@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/scopevis.h"
+#include "dsp/glspectruminterface.h"
+#include "dsp/glscopeinterface.h"
+#include "mainbench.h"
+
+namespace {
+
+// Counts spectrum updates instead of displaying them
+class BenchGLSpectrum : public GLSpectrumInterface
+{
+public:
+    BenchGLSpectrum() : m_nbSpectrums(0) {}
+    virtual void newSpectrum(const Real* spectrum, int nbBins, int fftSize)
+    {
+        (void) spectrum;
+        (void) nbBins;
+        (void) fftSize;
+        m_nbSpectrums++;
+    }
+    int m_nbSpectrums;
+};
+
+// Counts traces updates instead of displaying them
+class BenchGLScope : public GLScopeInterface
+{
+public:
+    BenchGLScope() : m_processingTraceIndex(-1), m_nbTraces(0) {}
+    virtual void setTraces(std::vector<GLScopeSettings::TraceData>* tracesData, std::vector<float *>* traces) {
+        (void) tracesData;
+        (void) traces;
+    }
+    virtual void newTraces(std::vector<float *>* traces, int traceIndex, std::vector<Projector::ProjectionType>* projectionTypes)
+    {
+        (void) traces;
+        (void) traceIndex;
+        (void) projectionTypes;
+        m_nbTraces++;
+    }
+    virtual void setSampleRate(int sampleRate) { (void) sampleRate; }
+    virtual void setTraceSize(int trceSize, bool emitSignal = false) { (void) trceSize; (void) emitSignal; }
+    virtual void setTriggerPre(uint32_t triggerPre, bool emitSignal = false) { (void) triggerPre; (void) emitSignal; }
+    virtual const QAtomicInt& getProcessingTraceIndex() const { return m_processingTraceIndex; }
+    virtual void setTimeBase(int timeBase) { (void) timeBase; }
+    virtual void setTimeOfsProMill(int timeOfsProMill) { (void) timeOfsProMill; }
+    virtual void setFocusedTriggerData(GLScopeSettings::TriggerData& triggerData) { (void) triggerData; }
+    virtual void setFocusedTraceIndex(uint32_t traceIndex) { (void) traceIndex; }
+    virtual void setConfigChanged() {}
+    virtual void updateDisplay() {}
+    QAtomicInt m_processingTraceIndex;
+    int m_nbTraces;
+};
+
+}
+
+void MainBench::testSpectrumVis()
+{
+    BenchMeasure measure;
+    SampleVector samples;
+    BenchGLSpectrum glSpectrum;
+
+    if (!DSPEngine::instance()->getFFTFactory()) {
+        DSPEngine::instance()->createFFTFactory("");
+    }
+
+    SpectrumVis spectrumVis(SDR_RX_SCALEF);
+    SpectrumSettings spectrumSettings;
+    spectrumSettings.m_fftSize = m_parser.getFFTSize();
+    spectrumSettings.m_fftOverlap = 0;
+    spectrumSettings.m_fpsPeriodMs = 0; // no FPS capping so that every FFT is processed to the end
+    spectrumVis.setGLSpectrum(&glSpectrum);
+    spectrumVis.getInputMessageQueue()->push(SpectrumVis::MsgConfigureSpectrumVis::create(spectrumSettings, true));
+    spectrumVis.start();
+
+    qDebug() << "MainBench::testSpectrumVis: create test data";
+
+    generateSamples(samples, m_parser.getNbSamples());
+
+    qDebug() << "MainBench::testSpectrumVis: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+        spectrumVis.feed(samples.begin(), samples.end(), false);
+        measure.stop();
+    }
+
+    spectrumVis.stop();
+    qDebug() << "MainBench::testSpectrumVis: spectrums:" << glSpectrum.m_nbSpectrums;
+    printResults("spectrumvis",
+        QString("fftsize=%1").arg(m_parser.getFFTSize()),
+        measure,
+        (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
+
+void MainBench::testScopeVis()
+{
+    BenchMeasure measure;
+    SampleVector samples;
+    BenchGLScope glScope;
+    ScopeVis scopeVis;
+
+    scopeVis.setGLScope(&glScope);
+    scopeVis.setLiveRate(48000);
+    scopeVis.configure(GLScopeSettings::m_traceChunkDefaultSize, 1, 0, 0, true);
+
+    // two traces with different projections
+    GLScopeSettings::TraceData traceData;
+    ScopeVis::MsgScopeVisAddTrace *msg = ScopeVis::MsgScopeVisAddTrace::create(traceData);
+    scopeVis.handleMessage(*msg);
+    delete msg;
+    traceData.m_projectionType = Projector::ProjectionMagDB;
+    msg = ScopeVis::MsgScopeVisAddTrace::create(traceData);
+    scopeVis.handleMessage(*msg);
+    delete msg;
+
+    qDebug() << "MainBench::testScopeVis: create test data";
+
+    generateSamples(samples, m_parser.getNbSamples());
+    std::vector<SampleVector::const_iterator> vbegin;
+    vbegin.push_back(samples.begin());
+
+    qDebug() << "MainBench::testScopeVis: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        measure.start();
+        scopeVis.feed(vbegin, samples.size());
+        measure.stop();
+    }
+
+    qDebug() << "MainBench::testScopeVis: traces:" << glScope.m_nbTraces;
+    printResults("scopevis",
+        QString("traces=2 tracesize=%1").arg(GLScopeSettings::m_traceChunkDefaultSize),
+        measure,
+        (quint64) m_parser.getNbSamples()*m_parser.getRepetition());
+}
@@ -25,6 +25,8 @@
 #include <QTextEdit>
 #include <QObjectCleanupHandler>
 #include <QDesktopServices>
+#include <QMenu>
+#include <QActionGroup>
 
 #include "mainwindow.h"
 #include "gui/workspaceselectiondialog.h"
@@ -86,6 +88,12 @@ DeviceGUI::DeviceGUI(QWidget *parent) :
     m_deviceSetPresetsButton->setIcon(deviceSetPresetsIcon);
     m_deviceSetPresetsButton->setToolTip("Device set presets");
 
+    m_deviceDSPSettingsButton = new QPushButton();
+    m_deviceDSPSettingsButton->setFixedSize(20, 20);
+    QIcon deviceDSPSettingsIcon(":/filter_bandpass.png");
+    m_deviceDSPSettingsButton->setIcon(deviceDSPSettingsIcon);
+    m_deviceDSPSettingsButton->setToolTip("Device set DSP settings");
+
     m_titleLabel = new QLabel();
     m_titleLabel->setText("Device");
     m_titleLabel->setToolTip("Device identification");
@@ -148,6 +156,7 @@ DeviceGUI::DeviceGUI(QWidget *parent) :
     m_topLayout->addWidget(m_reloadDeviceButton);
     m_topLayout->addWidget(m_deviceSetPresetsButton);
     m_topLayout->addWidget(m_addChannelsButton);
+    m_topLayout->addWidget(m_deviceDSPSettingsButton);
     m_topLayout->addWidget(m_titleLabel);
     // m_topLayout->addStretch(1);
     m_topLayout->addWidget(m_helpButton);
@@ -183,6 +192,7 @@ DeviceGUI::DeviceGUI(QWidget *parent) :
     connect(m_reloadDeviceButton, SIGNAL(clicked()), this, SLOT(deviceReload()));
     connect(m_addChannelsButton, SIGNAL(clicked()), this, SLOT(openAddChannelsDialog()));
     connect(m_deviceSetPresetsButton, SIGNAL(clicked()), this, SLOT(deviceSetPresetsDialog()));
+    connect(m_deviceDSPSettingsButton, SIGNAL(clicked()), this, SLOT(openDeviceDSPSettingsMenu()));
     connect(m_helpButton, SIGNAL(clicked()), this, SLOT(showHelp()));
     connect(m_moveButton, SIGNAL(clicked()), this, SLOT(openMoveToWorkspaceDialog()));
     connect(m_shrinkButton, SIGNAL(clicked()), this, SLOT(shrinkWindow()));
@@ -218,6 +228,7 @@ DeviceGUI::~DeviceGUI()
     delete m_helpButton;
     delete m_titleLabel;
     delete m_deviceSetPresetsButton;
+    delete m_deviceDSPSettingsButton;
     delete m_addChannelsButton;
     delete m_reloadDeviceButton;
     delete m_changeDeviceButton;
@@ -361,6 +372,50 @@ void DeviceGUI::deviceSetPresetsDialog()
     emit deviceSetPresetsDialogRequested(p, this);
 }
 
+void DeviceGUI::openDeviceDSPSettingsMenu()
+{
+    if (!m_deviceUISet || (m_deviceType != DeviceRx)) {
+        return;
+    }
+
+    DeviceAPI *deviceAPI = m_deviceUISet->m_deviceAPI;
+    QMenu menu(this);
+    QMenu *polyphaseMenu = menu.addMenu("Polyphase channelizer");
+    polyphaseMenu->setToolTip("Split the device baseband in equal sub-bands shared by the channels");
+    QActionGroup polyphaseGroup(polyphaseMenu);
+    polyphaseGroup.setExclusive(true);
+    const unsigned int subbandChoices[] = {0, 4, 8, 16, 32, 64};
+
+    for (unsigned int subbands : subbandChoices)
+    {
+        QAction *action = polyphaseMenu->addAction(subbands == 0 ? QString("Off") : QString("%1 sub-bands").arg(subbands));
+        action->setCheckable(true);
+        action->setChecked(deviceAPI->getPolyphaseSubbands() == subbands);
+        action->setData(subbands);
+        polyphaseGroup.addAction(action);
+    }
+
+    QAction *fanOutAction = menu.addAction("Channels on own thread");
+    fanOutAction->setToolTip("Feed each channel from its own thread instead of the device thread");
+    fanOutAction->setCheckable(true);
+    fanOutAction->setChecked(deviceAPI->getChannelSinkFanOut());
+
+    QAction *sharedFifoAction = menu.addAction("Channels read shared baseband");
+    sharedFifoAction->setToolTip("Channels that support it read the device baseband in place from a FIFO shared by all channels");
+    sharedFifoAction->setCheckable(true);
+    sharedFifoAction->setChecked(deviceAPI->getSharedBasebandFifo());
+
+    QAction *selected = menu.exec(QCursor::pos());
+
+    if (selected == fanOutAction) {
+        deviceAPI->setChannelSinkFanOut(fanOutAction->isChecked());
+    } else if (selected == sharedFifoAction) {
+        deviceAPI->setSharedBasebandFifo(sharedFifoAction->isChecked());
+    } else if (selected && polyphaseGroup.actions().contains(selected)) {
+        deviceAPI->configurePolyphaseChannelizer(selected->data().toUInt());
+    }
+}
+
 void DeviceGUI::setTitle(const QString& title)
 {
     m_titleLabel->setText(title);
@@ -386,6 +441,7 @@ void DeviceGUI::setDeviceType(DeviceType type)
 {
     m_deviceType = type;
     m_indexLabel->setStyleSheet(tr("QLabel { background-color: %1; qproperty-alignment: AlignCenter; }").arg(getDeviceTypeColor()));
+    m_deviceDSPSettingsButton->setVisible(type == DeviceRx); // device set DSP settings apply to Rx only
 }
 
 void DeviceGUI::setToolTip(const QString& tooltip)
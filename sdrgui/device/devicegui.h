@@ -109,6 +109,7 @@ private:
     QPushButton *m_reloadDeviceButton;
     QPushButton *m_addChannelsButton;
     QPushButton *m_deviceSetPresetsButton;
+    QPushButton *m_deviceDSPSettingsButton;
     QLabel *m_titleLabel;
     QPushButton *m_helpButton;
     QPushButton *m_moveButton;
@@ -138,6 +139,7 @@ private slots:
     void showSpectrumHandler();
     void showAllChannelsHandler();
     void deviceSetPresetsDialog();
+    void openDeviceDSPSettingsMenu();
 
 signals:
     void closing();
@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2022 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QThread>
+
+#include "dspschedulerdialog.h"
+#include "ui_dspschedulerdialog.h"
+
+DSPSchedulerDialog::DSPSchedulerDialog(MainSettings& mainSettings, QWidget* parent) :
+    QDialog(parent),
+    ui(new Ui::DSPSchedulerDialog),
+    m_mainSettings(mainSettings)
+{
+    ui->setupUi(this);
+    ui->threads->setMaximum(QThread::idealThreadCount());
+    ui->threads->setValue(m_mainSettings.getDSPSchedulerThreads());
+    ui->affinity->setText(m_mainSettings.getDSPSchedulerAffinity());
+    ui->priority->setCurrentIndex(m_mainSettings.getDSPSchedulerPriority()); // items follow QThread::Priority
+}
+
+DSPSchedulerDialog::~DSPSchedulerDialog()
+{
+    delete ui;
+}
+
+void DSPSchedulerDialog::accept()
+{
+    m_mainSettings.setDSPSchedulerThreads(ui->threads->value());
+    m_mainSettings.setDSPSchedulerAffinity(ui->affinity->text().trimmed());
+    m_mainSettings.setDSPSchedulerPriority(ui->priority->currentIndex());
+    QDialog::accept();
+}
@@ -194,6 +194,7 @@ void GLSpectrumGUI::displaySettings()
     ui->averaging->blockSignals(true);
     ui->averagingMode->blockSignals(true);
     ui->linscale->blockSignals(true);
+    ui->fastLog->blockSignals(true);
 
     ui->fftWindow->setCurrentIndex(m_settings.m_fftWindow);
 
@@ -223,6 +224,8 @@ void GLSpectrumGUI::displaySettings()
     ui->averaging->setCurrentIndex(m_settings.m_averagingIndex);
     ui->averagingMode->setCurrentIndex((int) m_settings.m_averagingMode);
     ui->linscale->setChecked(m_settings.m_linear);
+    ui->fastLog->setChecked(m_settings.m_fastLog);
+    ui->fastLog->setEnabled(!m_settings.m_linear);
     setAveragingToolitp();
     ui->calibration->setChecked(m_settings.m_useCalibration);
     displayGotoMarkers();
@@ -238,6 +241,7 @@ void GLSpectrumGUI::displaySettings()
     ui->averaging->blockSignals(false);
     ui->averagingMode->blockSignals(false);
     ui->linscale->blockSignals(false);
+    ui->fastLog->blockSignals(false);
     blockApplySettings(false);
 }
 
@@ -442,6 +446,13 @@ void GLSpectrumGUI::on_linscale_toggled(bool checked)
 {
     qDebug("GLSpectrumGUI::on_averaging_currentIndexChanged: %s", checked ? "lin" : "log");
     m_settings.m_linear = checked;
+    ui->fastLog->setEnabled(!checked);
+    applySettings();
+}
+
+void GLSpectrumGUI::on_fastLog_toggled(bool checked)
+{
+    m_settings.m_fastLog = checked;
     applySettings();
 }
 
@@ -105,6 +105,7 @@ private slots:
 	void on_averagingMode_currentIndexChanged(int index);
     void on_averaging_currentIndexChanged(int index);
     void on_linscale_toggled(bool checked);
+    void on_fastLog_toggled(bool checked);
     void on_wsSpectrum_toggled(bool checked);
 	void on_markers_clicked(bool checked);
 
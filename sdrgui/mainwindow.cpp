@@ -58,6 +58,7 @@
 #include "gui/rollupwidget.h"
 #include "gui/audiodialog.h"
 #include "gui/graphicsdialog.h"
+#include "gui/dspschedulerdialog.h"
 #include "gui/loggingdialog.h"
 #include "gui/deviceuserargsdialog.h"
 #include "gui/sdrangelsplash.h"
@@ -169,13 +170,25 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
         }
     }
 
-    m_dspEngine->preAllocateFFTs();
-
     splash->showStatusMessage("load settings...", Qt::white);
     qDebug() << "MainWindow::MainWindow: load settings...";
 
     loadSettings();
 
+    m_dspEngine->configureFFTPlanning(
+        m_mainCore->m_settings.getFFTWThreads(),
+        m_mainCore->m_settings.getFFTWMinThreadedSize(),
+        m_mainCore->m_settings.getFFTWBackgroundPlanning()
+    );
+    m_dspEngine->preAllocateFFTs();
+
+    // channels created from now on use the DSP scheduler if it is enabled
+    m_dspEngine->createDSPScheduler(
+        m_mainCore->m_settings.getDSPSchedulerThreads(),
+        m_mainCore->m_settings.getDSPSchedulerAffinity(),
+        m_mainCore->m_settings.getDSPSchedulerPriority()
+    );
+
     splash->showStatusMessage("load plugins...", Qt::white);
     qDebug() << "MainWindow::MainWindow: load plugins...";
 
@@ -1506,6 +1519,9 @@ void MainWindow::createMenuBar()
     QAction *fftAction = preferencesMenu->addAction("&FFT...");
     fftAction->setToolTip("Set FFT cache");
     QObject::connect(fftAction, &QAction::triggered, this, &MainWindow::on_action_FFT_triggered);
+    QAction *dspSchedulerAction = preferencesMenu->addAction("DSP &scheduler...");
+    dspSchedulerAction->setToolTip("Channels data processing threads");
+    QObject::connect(dspSchedulerAction, &QAction::triggered, this, &MainWindow::on_action_DSP_Scheduler_triggered);
     QMenu *devicesMenu = preferencesMenu->addMenu("&Devices");
     QAction *userArgumentsAction = devicesMenu->addAction("&User arguments...");
     userArgumentsAction->setToolTip("Device custom user arguments");
@@ -2091,6 +2107,12 @@ void MainWindow::on_action_Graphics_triggered()
     graphicsDialog.exec();
 }
 
+void MainWindow::on_action_DSP_Scheduler_triggered()
+{
+    DSPSchedulerDialog dspSchedulerDialog(m_mainCore->m_settings, this);
+    dspSchedulerDialog.exec();
+}
+
 void MainWindow::on_action_Logging_triggered()
 {
     LoggingDialog loggingDialog(m_mainCore->m_settings, this);
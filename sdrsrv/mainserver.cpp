@@ -68,6 +68,19 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     qDebug() << "MainServer::MainServer: load setings...";
 	loadSettings();
 
+    m_dspEngine->configureFFTPlanning(
+        m_mainCore->m_settings.getFFTWThreads(),
+        m_mainCore->m_settings.getFFTWMinThreadedSize(),
+        m_mainCore->m_settings.getFFTWBackgroundPlanning()
+    );
+
+    // channels created from now on use the DSP scheduler if it is enabled
+    m_dspEngine->createDSPScheduler(
+        m_mainCore->m_settings.getDSPSchedulerThreads(),
+        m_mainCore->m_settings.getDSPSchedulerAffinity(),
+        m_mainCore->m_settings.getDSPSchedulerPriority()
+    );
+
     qDebug() << "MainServer::MainServer: finishing...";
     QString applicationDirPath = QCoreApplication::instance()->applicationDirPath();
 
@@ -40,6 +40,10 @@ SWGADSBDemodReport::SWGADSBDemodReport() {
     m_target_elevation_isSet = false;
     target_range = 0.0f;
     m_target_range_isSet = false;
+    aircraft_count = 0;
+    m_aircraft_count_isSet = false;
+    aircraft = nullptr;
+    m_aircraft_isSet = false;
 }
 
 SWGADSBDemodReport::~SWGADSBDemodReport() {
@@ -60,6 +64,10 @@ SWGADSBDemodReport::init() {
     m_target_elevation_isSet = false;
     target_range = 0.0f;
     m_target_range_isSet = false;
+    aircraft_count = 0;
+    m_aircraft_count_isSet = false;
+    aircraft = new QList<SWGADSBDemodAircraftState*>();
+    m_aircraft_isSet = false;
 }
 
 void
@@ -72,6 +80,14 @@ SWGADSBDemodReport::cleanup() {
 
 
 
+
+    if(aircraft != nullptr) { 
+        auto arr = aircraft;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete aircraft;
+    }
 }
 
 SWGADSBDemodReport*
@@ -97,6 +113,10 @@ SWGADSBDemodReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&target_range, pJson["targetRange"], "float", "");
     
+    ::SWGSDRangel::setValue(&aircraft_count, pJson["aircraftCount"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&aircraft, pJson["aircraft"], "QList", "SWGADSBDemodAircraftState");
 }
 
 QString
@@ -131,6 +151,12 @@ SWGADSBDemodReport::asJsonObject() {
     if(m_target_range_isSet){
         obj->insert("targetRange", QJsonValue(target_range));
     }
+    if(m_aircraft_count_isSet){
+        obj->insert("aircraftCount", QJsonValue(aircraft_count));
+    }
+    if(aircraft && aircraft->size() > 0){
+        toJsonArray((QList<void*>*)aircraft, obj, "aircraft", "SWGADSBDemodAircraftState");
+    }
 
     return obj;
 }
@@ -195,6 +221,26 @@ SWGADSBDemodReport::setTargetRange(float target_range) {
     this->m_target_range_isSet = true;
 }
 
+qint32
+SWGADSBDemodReport::getAircraftCount() {
+    return aircraft_count;
+}
+void
+SWGADSBDemodReport::setAircraftCount(qint32 aircraft_count) {
+    this->aircraft_count = aircraft_count;
+    this->m_aircraft_count_isSet = true;
+}
+
+QList<SWGADSBDemodAircraftState*>*
+SWGADSBDemodReport::getAircraft() {
+    return aircraft;
+}
+void
+SWGADSBDemodReport::setAircraft(QList<SWGADSBDemodAircraftState*>* aircraft) {
+    this->aircraft = aircraft;
+    this->m_aircraft_isSet = true;
+}
+
 
 bool
 SWGADSBDemodReport::isSet(){
@@ -218,6 +264,12 @@ SWGADSBDemodReport::isSet(){
         if(m_target_range_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_aircraft_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(aircraft && (aircraft->size() > 0)){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -22,6 +22,8 @@
 #include <QJsonObject>
 
 
+#include "SWGADSBDemodAircraftState.h"
+#include <QList>
 #include <QString>
 
 #include "SWGObject.h"
@@ -60,6 +62,12 @@ public:
     float getTargetRange();
     void setTargetRange(float target_range);
 
+    qint32 getAircraftCount();
+    void setAircraftCount(qint32 aircraft_count);
+
+    QList<SWGADSBDemodAircraftState*>* getAircraft();
+    void setAircraft(QList<SWGADSBDemodAircraftState*>* aircraft);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +90,12 @@ private:
     float target_range;
     bool m_target_range_isSet;
 
+    qint32 aircraft_count;
+    bool m_aircraft_count_isSet;
+
+    QList<SWGADSBDemodAircraftState*>* aircraft;
+    bool m_aircraft_isSet;
+
 };
 
 }
@@ -40,6 +40,20 @@ SWGChannel::SWGChannel() {
     m_title_isSet = false;
     delta_frequency = 0;
     m_delta_frequency_isSet = false;
+    message_queue_max_size = 0;
+    m_message_queue_max_size_isSet = false;
+    message_queue_mean_latency = 0L;
+    m_message_queue_mean_latency_isSet = false;
+    message_queue_max_latency = 0L;
+    m_message_queue_max_latency_isSet = false;
+    input_fifo_size = 0;
+    m_input_fifo_size_isSet = false;
+    input_fifo_fill = 0;
+    m_input_fifo_fill_isSet = false;
+    input_fifo_overflows = 0L;
+    m_input_fifo_overflows_isSet = false;
+    input_fifo_dropped_samples = 0L;
+    m_input_fifo_dropped_samples_isSet = false;
     report = nullptr;
     m_report_isSet = false;
 }
@@ -62,6 +76,20 @@ SWGChannel::init() {
     m_title_isSet = false;
     delta_frequency = 0;
     m_delta_frequency_isSet = false;
+    message_queue_max_size = 0;
+    m_message_queue_max_size_isSet = false;
+    message_queue_mean_latency = 0L;
+    m_message_queue_mean_latency_isSet = false;
+    message_queue_max_latency = 0L;
+    m_message_queue_max_latency_isSet = false;
+    input_fifo_size = 0;
+    m_input_fifo_size_isSet = false;
+    input_fifo_fill = 0;
+    m_input_fifo_fill_isSet = false;
+    input_fifo_overflows = 0L;
+    m_input_fifo_overflows_isSet = false;
+    input_fifo_dropped_samples = 0L;
+    m_input_fifo_dropped_samples_isSet = false;
     report = new SWGChannelReport();
     m_report_isSet = false;
 }
@@ -106,6 +134,20 @@ SWGChannel::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&delta_frequency, pJson["deltaFrequency"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&message_queue_max_size, pJson["messageQueueMaxSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&message_queue_mean_latency, pJson["messageQueueMeanLatency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&message_queue_max_latency, pJson["messageQueueMaxLatency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&input_fifo_size, pJson["inputFifoSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&input_fifo_fill, pJson["inputFifoFill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&input_fifo_overflows, pJson["inputFifoOverflows"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&input_fifo_dropped_samples, pJson["inputFifoDroppedSamples"], "qint64", "");
+    
     ::SWGSDRangel::setValue(&report, pJson["report"], "SWGChannelReport", "SWGChannelReport");
     
 }
@@ -142,6 +184,27 @@ SWGChannel::asJsonObject() {
     if(m_delta_frequency_isSet){
         obj->insert("deltaFrequency", QJsonValue(delta_frequency));
     }
+    if(m_message_queue_max_size_isSet){
+        obj->insert("messageQueueMaxSize", QJsonValue(message_queue_max_size));
+    }
+    if(m_message_queue_mean_latency_isSet){
+        obj->insert("messageQueueMeanLatency", QJsonValue(message_queue_mean_latency));
+    }
+    if(m_message_queue_max_latency_isSet){
+        obj->insert("messageQueueMaxLatency", QJsonValue(message_queue_max_latency));
+    }
+    if(m_input_fifo_size_isSet){
+        obj->insert("inputFifoSize", QJsonValue(input_fifo_size));
+    }
+    if(m_input_fifo_fill_isSet){
+        obj->insert("inputFifoFill", QJsonValue(input_fifo_fill));
+    }
+    if(m_input_fifo_overflows_isSet){
+        obj->insert("inputFifoOverflows", QJsonValue(input_fifo_overflows));
+    }
+    if(m_input_fifo_dropped_samples_isSet){
+        obj->insert("inputFifoDroppedSamples", QJsonValue(input_fifo_dropped_samples));
+    }
     if((report != nullptr) && (report->isSet())){
         toJsonValue(QString("report"), report, obj, QString("SWGChannelReport"));
     }
@@ -209,6 +272,76 @@ SWGChannel::setDeltaFrequency(qint32 delta_frequency) {
     this->m_delta_frequency_isSet = true;
 }
 
+qint32
+SWGChannel::getMessageQueueMaxSize() {
+    return message_queue_max_size;
+}
+void
+SWGChannel::setMessageQueueMaxSize(qint32 message_queue_max_size) {
+    this->message_queue_max_size = message_queue_max_size;
+    this->m_message_queue_max_size_isSet = true;
+}
+
+qint64
+SWGChannel::getMessageQueueMeanLatency() {
+    return message_queue_mean_latency;
+}
+void
+SWGChannel::setMessageQueueMeanLatency(qint64 message_queue_mean_latency) {
+    this->message_queue_mean_latency = message_queue_mean_latency;
+    this->m_message_queue_mean_latency_isSet = true;
+}
+
+qint64
+SWGChannel::getMessageQueueMaxLatency() {
+    return message_queue_max_latency;
+}
+void
+SWGChannel::setMessageQueueMaxLatency(qint64 message_queue_max_latency) {
+    this->message_queue_max_latency = message_queue_max_latency;
+    this->m_message_queue_max_latency_isSet = true;
+}
+
+qint32
+SWGChannel::getInputFifoSize() {
+    return input_fifo_size;
+}
+void
+SWGChannel::setInputFifoSize(qint32 input_fifo_size) {
+    this->input_fifo_size = input_fifo_size;
+    this->m_input_fifo_size_isSet = true;
+}
+
+qint32
+SWGChannel::getInputFifoFill() {
+    return input_fifo_fill;
+}
+void
+SWGChannel::setInputFifoFill(qint32 input_fifo_fill) {
+    this->input_fifo_fill = input_fifo_fill;
+    this->m_input_fifo_fill_isSet = true;
+}
+
+qint64
+SWGChannel::getInputFifoOverflows() {
+    return input_fifo_overflows;
+}
+void
+SWGChannel::setInputFifoOverflows(qint64 input_fifo_overflows) {
+    this->input_fifo_overflows = input_fifo_overflows;
+    this->m_input_fifo_overflows_isSet = true;
+}
+
+qint64
+SWGChannel::getInputFifoDroppedSamples() {
+    return input_fifo_dropped_samples;
+}
+void
+SWGChannel::setInputFifoDroppedSamples(qint64 input_fifo_dropped_samples) {
+    this->input_fifo_dropped_samples = input_fifo_dropped_samples;
+    this->m_input_fifo_dropped_samples_isSet = true;
+}
+
 SWGChannelReport*
 SWGChannel::getReport() {
     return report;
@@ -242,6 +375,27 @@ SWGChannel::isSet(){
         if(m_delta_frequency_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_message_queue_max_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_message_queue_mean_latency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_message_queue_max_latency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_input_fifo_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_input_fifo_fill_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_input_fifo_overflows_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_input_fifo_dropped_samples_isSet){
+            isObjectUpdated = true; break;
+        }
         if(report && report->isSet()){
             isObjectUpdated = true; break;
         }
@@ -61,6 +61,27 @@ public:
     qint32 getDeltaFrequency();
     void setDeltaFrequency(qint32 delta_frequency);
 
+    qint32 getMessageQueueMaxSize();
+    void setMessageQueueMaxSize(qint32 message_queue_max_size);
+
+    qint64 getMessageQueueMeanLatency();
+    void setMessageQueueMeanLatency(qint64 message_queue_mean_latency);
+
+    qint64 getMessageQueueMaxLatency();
+    void setMessageQueueMaxLatency(qint64 message_queue_max_latency);
+
+    qint32 getInputFifoSize();
+    void setInputFifoSize(qint32 input_fifo_size);
+
+    qint32 getInputFifoFill();
+    void setInputFifoFill(qint32 input_fifo_fill);
+
+    qint64 getInputFifoOverflows();
+    void setInputFifoOverflows(qint64 input_fifo_overflows);
+
+    qint64 getInputFifoDroppedSamples();
+    void setInputFifoDroppedSamples(qint64 input_fifo_dropped_samples);
+
     SWGChannelReport* getReport();
     void setReport(SWGChannelReport* report);
 
@@ -86,6 +107,27 @@ private:
     qint32 delta_frequency;
     bool m_delta_frequency_isSet;
 
+    qint32 message_queue_max_size;
+    bool m_message_queue_max_size_isSet;
+
+    qint64 message_queue_mean_latency;
+    bool m_message_queue_mean_latency_isSet;
+
+    qint64 message_queue_max_latency;
+    bool m_message_queue_max_latency_isSet;
+
+    qint32 input_fifo_size;
+    bool m_input_fifo_size_isSet;
+
+    qint32 input_fifo_fill;
+    bool m_input_fifo_fill_isSet;
+
+    qint64 input_fifo_overflows;
+    bool m_input_fifo_overflows_isSet;
+
+    qint64 input_fifo_dropped_samples;
+    bool m_input_fifo_dropped_samples_isSet;
+
     SWGChannelReport* report;
     bool m_report_isSet;
 
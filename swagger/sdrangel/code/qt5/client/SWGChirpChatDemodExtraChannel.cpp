@@ -0,0 +1,154 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 7.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChirpChatDemodExtraChannel.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChirpChatDemodExtraChannel::SWGChirpChatDemodExtraChannel(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChirpChatDemodExtraChannel::SWGChirpChatDemodExtraChannel() {
+    bandwidth_index = 0;
+    m_bandwidth_index_isSet = false;
+    spread_factor = 0;
+    m_spread_factor_isSet = false;
+    de_bits = 0;
+    m_de_bits_isSet = false;
+}
+
+SWGChirpChatDemodExtraChannel::~SWGChirpChatDemodExtraChannel() {
+    this->cleanup();
+}
+
+void
+SWGChirpChatDemodExtraChannel::init() {
+    bandwidth_index = 0;
+    m_bandwidth_index_isSet = false;
+    spread_factor = 0;
+    m_spread_factor_isSet = false;
+    de_bits = 0;
+    m_de_bits_isSet = false;
+}
+
+void
+SWGChirpChatDemodExtraChannel::cleanup() {
+
+
+
+}
+
+SWGChirpChatDemodExtraChannel*
+SWGChirpChatDemodExtraChannel::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChirpChatDemodExtraChannel::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&bandwidth_index, pJson["bandwidthIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&spread_factor, pJson["spreadFactor"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&de_bits, pJson["deBits"], "qint32", "");
+    
+}
+
+QString
+SWGChirpChatDemodExtraChannel::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChirpChatDemodExtraChannel::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_bandwidth_index_isSet){
+        obj->insert("bandwidthIndex", QJsonValue(bandwidth_index));
+    }
+    if(m_spread_factor_isSet){
+        obj->insert("spreadFactor", QJsonValue(spread_factor));
+    }
+    if(m_de_bits_isSet){
+        obj->insert("deBits", QJsonValue(de_bits));
+    }
+
+    return obj;
+}
+
+qint32
+SWGChirpChatDemodExtraChannel::getBandwidthIndex() {
+    return bandwidth_index;
+}
+void
+SWGChirpChatDemodExtraChannel::setBandwidthIndex(qint32 bandwidth_index) {
+    this->bandwidth_index = bandwidth_index;
+    this->m_bandwidth_index_isSet = true;
+}
+
+qint32
+SWGChirpChatDemodExtraChannel::getSpreadFactor() {
+    return spread_factor;
+}
+void
+SWGChirpChatDemodExtraChannel::setSpreadFactor(qint32 spread_factor) {
+    this->spread_factor = spread_factor;
+    this->m_spread_factor_isSet = true;
+}
+
+qint32
+SWGChirpChatDemodExtraChannel::getDeBits() {
+    return de_bits;
+}
+void
+SWGChirpChatDemodExtraChannel::setDeBits(qint32 de_bits) {
+    this->de_bits = de_bits;
+    this->m_de_bits_isSet = true;
+}
+
+
+bool
+SWGChirpChatDemodExtraChannel::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_bandwidth_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_spread_factor_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_de_bits_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -66,6 +66,8 @@ SWGChirpChatDemodSettings::SWGChirpChatDemodSettings() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    extra_channels = nullptr;
+    m_extra_channels_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = nullptr;
@@ -134,6 +136,8 @@ SWGChirpChatDemodSettings::init() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    extra_channels = new QList<SWGChirpChatDemodExtraChannel*>();
+    m_extra_channels_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = new QString("");
@@ -182,6 +186,14 @@ SWGChirpChatDemodSettings::cleanup() {
     }
 
 
+    if(extra_channels != nullptr) { 
+        auto arr = extra_channels;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete extra_channels;
+    }
+
     if(title != nullptr) { 
         delete title;
     }
@@ -253,6 +265,8 @@ SWGChirpChatDemodSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&udp_port, pJson["udpPort"], "qint32", "");
     
+    
+    ::SWGSDRangel::setValue(&extra_channels, pJson["extraChannels"], "QList", "SWGChirpChatDemodExtraChannel");
     ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
     
     ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
@@ -348,6 +362,9 @@ SWGChirpChatDemodSettings::asJsonObject() {
     if(m_udp_port_isSet){
         obj->insert("udpPort", QJsonValue(udp_port));
     }
+    if(extra_channels && extra_channels->size() > 0){
+        toJsonArray((QList<void*>*)extra_channels, obj, "extraChannels", "SWGChirpChatDemodExtraChannel");
+    }
     if(m_rgb_color_isSet){
         obj->insert("rgbColor", QJsonValue(rgb_color));
     }
@@ -575,6 +592,16 @@ SWGChirpChatDemodSettings::setUdpPort(qint32 udp_port) {
     this->m_udp_port_isSet = true;
 }
 
+QList<SWGChirpChatDemodExtraChannel*>*
+SWGChirpChatDemodSettings::getExtraChannels() {
+    return extra_channels;
+}
+void
+SWGChirpChatDemodSettings::setExtraChannels(QList<SWGChirpChatDemodExtraChannel*>* extra_channels) {
+    this->extra_channels = extra_channels;
+    this->m_extra_channels_isSet = true;
+}
+
 qint32
 SWGChirpChatDemodSettings::getRgbColor() {
     return rgb_color;
@@ -747,6 +774,9 @@ SWGChirpChatDemodSettings::isSet(){
         if(m_udp_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(extra_channels && (extra_channels->size() > 0)){
+            isObjectUpdated = true; break;
+        }
         if(m_rgb_color_isSet){
             isObjectUpdated = true; break;
         }
@@ -23,8 +23,10 @@
 
 
 #include "SWGChannelMarker.h"
+#include "SWGChirpChatDemodExtraChannel.h"
 #include "SWGGLSpectrum.h"
 #include "SWGRollupState.h"
+#include <QList>
 #include <QString>
 
 #include "SWGObject.h"
@@ -102,6 +104,9 @@ public:
     qint32 getUdpPort();
     void setUdpPort(qint32 udp_port);
 
+    QList<SWGChirpChatDemodExtraChannel*>* getExtraChannels();
+    void setExtraChannels(QList<SWGChirpChatDemodExtraChannel*>* extra_channels);
+
     qint32 getRgbColor();
     void setRgbColor(qint32 rgb_color);
 
@@ -196,6 +201,9 @@ private:
     qint32 udp_port;
     bool m_udp_port_isSet;
 
+    QList<SWGChirpChatDemodExtraChannel*>* extra_channels;
+    bool m_extra_channels_isSet;
+
     qint32 rgb_color;
     bool m_rgb_color_isSet;
 
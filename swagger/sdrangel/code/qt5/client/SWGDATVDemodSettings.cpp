@@ -50,6 +50,8 @@ SWGDATVDemodSettings::SWGDATVDemodSettings() {
     m_soft_ldpc_max_trials_isSet = false;
     max_bitflips = 0;
     m_max_bitflips_isSet = false;
+    pipelined = 0;
+    m_pipelined_isSet = false;
     audio_mute = 0;
     m_audio_mute_isSet = false;
     audio_device_name = nullptr;
@@ -130,6 +132,8 @@ SWGDATVDemodSettings::init() {
     m_soft_ldpc_max_trials_isSet = false;
     max_bitflips = 0;
     m_max_bitflips_isSet = false;
+    pipelined = 0;
+    m_pipelined_isSet = false;
     audio_mute = 0;
     m_audio_mute_isSet = false;
     audio_device_name = new QString("");
@@ -269,6 +273,8 @@ SWGDATVDemodSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&max_bitflips, pJson["maxBitflips"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&pipelined, pJson["pipelined"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&audio_mute, pJson["audioMute"], "qint32", "");
     
     ::SWGSDRangel::setValue(&audio_device_name, pJson["audioDeviceName"], "QString", "QString");
@@ -368,6 +374,9 @@ SWGDATVDemodSettings::asJsonObject() {
     if(m_max_bitflips_isSet){
         obj->insert("maxBitflips", QJsonValue(max_bitflips));
     }
+    if(m_pipelined_isSet){
+        obj->insert("pipelined", QJsonValue(pipelined));
+    }
     if(m_audio_mute_isSet){
         obj->insert("audioMute", QJsonValue(audio_mute));
     }
@@ -557,6 +566,16 @@ SWGDATVDemodSettings::setMaxBitflips(qint32 max_bitflips) {
     this->m_max_bitflips_isSet = true;
 }
 
+qint32
+SWGDATVDemodSettings::getPipelined() {
+    return pipelined;
+}
+void
+SWGDATVDemodSettings::setPipelined(qint32 pipelined) {
+    this->pipelined = pipelined;
+    this->m_pipelined_isSet = true;
+}
+
 qint32
 SWGDATVDemodSettings::getAudioMute() {
     return audio_mute;
@@ -845,6 +864,9 @@ SWGDATVDemodSettings::isSet(){
         if(m_max_bitflips_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_pipelined_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_audio_mute_isSet){
             isObjectUpdated = true; break;
         }
@@ -77,6 +77,9 @@ public:
     qint32 getMaxBitflips();
     void setMaxBitflips(qint32 max_bitflips);
 
+    qint32 getPipelined();
+    void setPipelined(qint32 pipelined);
+
     qint32 getAudioMute();
     void setAudioMute(qint32 audio_mute);
 
@@ -189,6 +192,9 @@ private:
     qint32 max_bitflips;
     bool m_max_bitflips_isSet;
 
+    qint32 pipelined;
+    bool m_pipelined_isSet;
+
     qint32 audio_mute;
     bool m_audio_mute_isSet;
 
@@ -92,6 +92,8 @@ SWGDeviceReport::SWGDeviceReport() {
     m_xtrx_output_report_isSet = false;
     xtrx_mimo_report = nullptr;
     m_xtrx_mimo_report_isSet = false;
+    sample_sinks = nullptr;
+    m_sample_sinks_isSet = false;
 }
 
 SWGDeviceReport::~SWGDeviceReport() {
@@ -164,6 +166,8 @@ SWGDeviceReport::init() {
     m_xtrx_output_report_isSet = false;
     xtrx_mimo_report = new SWGXtrxMIMOReport();
     m_xtrx_mimo_report_isSet = false;
+    sample_sinks = new QList<SWGSampleSinkReport*>();
+    m_sample_sinks_isSet = false;
 }
 
 void
@@ -262,6 +266,13 @@ SWGDeviceReport::cleanup() {
     if(xtrx_mimo_report != nullptr) { 
         delete xtrx_mimo_report;
     }
+    if(sample_sinks != nullptr) { 
+        auto arr = sample_sinks;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete sample_sinks;
+    }
 }
 
 SWGDeviceReport*
@@ -339,6 +350,8 @@ SWGDeviceReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&xtrx_mimo_report, pJson["xtrxMIMOReport"], "SWGXtrxMIMOReport", "SWGXtrxMIMOReport");
     
+    
+    ::SWGSDRangel::setValue(&sample_sinks, pJson["sampleSinks"], "QList", "SWGSampleSinkReport");
 }
 
 QString
@@ -451,6 +464,9 @@ SWGDeviceReport::asJsonObject() {
     if((xtrx_mimo_report != nullptr) && (xtrx_mimo_report->isSet())){
         toJsonValue(QString("xtrxMIMOReport"), xtrx_mimo_report, obj, QString("SWGXtrxMIMOReport"));
     }
+    if(sample_sinks && sample_sinks->size() > 0){
+        toJsonArray((QList<void*>*)sample_sinks, obj, "sampleSinks", "SWGSampleSinkReport");
+    }
 
     return obj;
 }
@@ -775,6 +791,16 @@ SWGDeviceReport::setXtrxMimoReport(SWGXtrxMIMOReport* xtrx_mimo_report) {
     this->m_xtrx_mimo_report_isSet = true;
 }
 
+QList<SWGSampleSinkReport*>*
+SWGDeviceReport::getSampleSinks() {
+    return sample_sinks;
+}
+void
+SWGDeviceReport::setSampleSinks(QList<SWGSampleSinkReport*>* sample_sinks) {
+    this->sample_sinks = sample_sinks;
+    this->m_sample_sinks_isSet = true;
+}
+
 
 bool
 SWGDeviceReport::isSet(){
@@ -876,6 +902,9 @@ SWGDeviceReport::isSet(){
         if(xtrx_mimo_report && xtrx_mimo_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(sample_sinks && (sample_sinks->size() > 0)){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
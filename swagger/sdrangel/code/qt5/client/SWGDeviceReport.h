@@ -44,6 +44,7 @@
 #include "SWGRtlSdrReport.h"
 #include "SWGSDRPlayReport.h"
 #include "SWGSDRPlayV3Report.h"
+#include "SWGSampleSinkReport.h"
 #include "SWGSigMFFileInputReport.h"
 #include "SWGSoapySDRReport.h"
 #include "SWGUSRPInputReport.h"
@@ -51,6 +52,7 @@
 #include "SWGXtrxInputReport.h"
 #include "SWGXtrxMIMOReport.h"
 #include "SWGXtrxOutputReport.h"
+#include <QList>
 #include <QString>
 
 #include "SWGObject.h"
@@ -167,6 +169,9 @@ public:
     SWGXtrxMIMOReport* getXtrxMimoReport();
     void setXtrxMimoReport(SWGXtrxMIMOReport* xtrx_mimo_report);
 
+    QList<SWGSampleSinkReport*>* getSampleSinks();
+    void setSampleSinks(QList<SWGSampleSinkReport*>* sample_sinks);
+
 
     virtual bool isSet() override;
 
@@ -267,6 +272,9 @@ private:
     SWGXtrxMIMOReport* xtrx_mimo_report;
     bool m_xtrx_mimo_report_isSet;
 
+    QList<SWGSampleSinkReport*>* sample_sinks;
+    bool m_sample_sinks_isSet;
+
 };
 
 }
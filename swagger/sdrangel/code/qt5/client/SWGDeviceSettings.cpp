@@ -34,6 +34,12 @@ SWGDeviceSettings::SWGDeviceSettings() {
     m_direction_isSet = false;
     originator_index = 0;
     m_originator_index_isSet = false;
+    polyphase_subbands = 0;
+    m_polyphase_subbands_isSet = false;
+    channel_sink_fan_out = 0;
+    m_channel_sink_fan_out_isSet = false;
+    shared_baseband_fifo = 0;
+    m_shared_baseband_fifo_isSet = false;
     airspy_settings = nullptr;
     m_airspy_settings_isSet = false;
     airspy_hf_settings = nullptr;
@@ -134,6 +140,12 @@ SWGDeviceSettings::init() {
     m_direction_isSet = false;
     originator_index = 0;
     m_originator_index_isSet = false;
+    polyphase_subbands = 0;
+    m_polyphase_subbands_isSet = false;
+    channel_sink_fan_out = 0;
+    m_channel_sink_fan_out_isSet = false;
+    shared_baseband_fifo = 0;
+    m_shared_baseband_fifo_isSet = false;
     airspy_settings = new SWGAirspySettings();
     m_airspy_settings_isSet = false;
     airspy_hf_settings = new SWGAirspyHFSettings();
@@ -377,6 +389,12 @@ SWGDeviceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&originator_index, pJson["originatorIndex"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&polyphase_subbands, pJson["polyphaseSubbands"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&channel_sink_fan_out, pJson["channelSinkFanOut"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&shared_baseband_fifo, pJson["sharedBasebandFifo"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&airspy_settings, pJson["airspySettings"], "SWGAirspySettings", "SWGAirspySettings");
     
     ::SWGSDRangel::setValue(&airspy_hf_settings, pJson["airspyHFSettings"], "SWGAirspyHFSettings", "SWGAirspyHFSettings");
@@ -488,6 +506,15 @@ SWGDeviceSettings::asJsonObject() {
     if(m_originator_index_isSet){
         obj->insert("originatorIndex", QJsonValue(originator_index));
     }
+    if(m_polyphase_subbands_isSet){
+        obj->insert("polyphaseSubbands", QJsonValue(polyphase_subbands));
+    }
+    if(m_channel_sink_fan_out_isSet){
+        obj->insert("channelSinkFanOut", QJsonValue(channel_sink_fan_out));
+    }
+    if(m_shared_baseband_fifo_isSet){
+        obj->insert("sharedBasebandFifo", QJsonValue(shared_baseband_fifo));
+    }
     if((airspy_settings != nullptr) && (airspy_settings->isSet())){
         toJsonValue(QString("airspySettings"), airspy_settings, obj, QString("SWGAirspySettings"));
     }
@@ -651,6 +678,36 @@ SWGDeviceSettings::setOriginatorIndex(qint32 originator_index) {
     this->m_originator_index_isSet = true;
 }
 
+qint32
+SWGDeviceSettings::getPolyphaseSubbands() {
+    return polyphase_subbands;
+}
+void
+SWGDeviceSettings::setPolyphaseSubbands(qint32 polyphase_subbands) {
+    this->polyphase_subbands = polyphase_subbands;
+    this->m_polyphase_subbands_isSet = true;
+}
+
+qint32
+SWGDeviceSettings::getChannelSinkFanOut() {
+    return channel_sink_fan_out;
+}
+void
+SWGDeviceSettings::setChannelSinkFanOut(qint32 channel_sink_fan_out) {
+    this->channel_sink_fan_out = channel_sink_fan_out;
+    this->m_channel_sink_fan_out_isSet = true;
+}
+
+qint32
+SWGDeviceSettings::getSharedBasebandFifo() {
+    return shared_baseband_fifo;
+}
+void
+SWGDeviceSettings::setSharedBasebandFifo(qint32 shared_baseband_fifo) {
+    this->shared_baseband_fifo = shared_baseband_fifo;
+    this->m_shared_baseband_fifo_isSet = true;
+}
+
 SWGAirspySettings*
 SWGDeviceSettings::getAirspySettings() {
     return airspy_settings;
@@ -1095,6 +1152,15 @@ SWGDeviceSettings::isSet(){
         if(m_originator_index_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_polyphase_subbands_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_channel_sink_fan_out_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_shared_baseband_fifo_isSet){
+            isObjectUpdated = true; break;
+        }
         if(airspy_settings && airspy_settings->isSet()){
             isObjectUpdated = true; break;
         }
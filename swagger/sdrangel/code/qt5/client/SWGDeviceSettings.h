@@ -94,6 +94,15 @@ public:
     qint32 getOriginatorIndex();
     void setOriginatorIndex(qint32 originator_index);
 
+    qint32 getPolyphaseSubbands();
+    void setPolyphaseSubbands(qint32 polyphase_subbands);
+
+    qint32 getChannelSinkFanOut();
+    void setChannelSinkFanOut(qint32 channel_sink_fan_out);
+
+    qint32 getSharedBasebandFifo();
+    void setSharedBasebandFifo(qint32 shared_baseband_fifo);
+
     SWGAirspySettings* getAirspySettings();
     void setAirspySettings(SWGAirspySettings* airspy_settings);
 
@@ -236,6 +245,15 @@ private:
     qint32 originator_index;
     bool m_originator_index_isSet;
 
+    qint32 polyphase_subbands;
+    bool m_polyphase_subbands_isSet;
+
+    qint32 channel_sink_fan_out;
+    bool m_channel_sink_fan_out_isSet;
+
+    qint32 shared_baseband_fifo;
+    bool m_shared_baseband_fifo_isSet;
+
     SWGAirspySettings* airspy_settings;
     bool m_airspy_settings_isSet;
 
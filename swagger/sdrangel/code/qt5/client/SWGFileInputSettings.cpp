@@ -34,6 +34,10 @@ SWGFileInputSettings::SWGFileInputSettings() {
     m_acceleration_factor_isSet = false;
     loop = 0;
     m_loop_isSet = false;
+    as_fast_as_possible = 0;
+    m_as_fast_as_possible_isSet = false;
+    playlist = nullptr;
+    m_playlist_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -56,6 +60,10 @@ SWGFileInputSettings::init() {
     m_acceleration_factor_isSet = false;
     loop = 0;
     m_loop_isSet = false;
+    as_fast_as_possible = 0;
+    m_as_fast_as_possible_isSet = false;
+    playlist = new QList<QString*>();
+    m_playlist_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -74,6 +82,14 @@ SWGFileInputSettings::cleanup() {
 
 
 
+    if(playlist != nullptr) { 
+        auto arr = playlist;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete playlist;
+    }
+
     if(reverse_api_address != nullptr) { 
         delete reverse_api_address;
     }
@@ -98,6 +114,10 @@ SWGFileInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&loop, pJson["loop"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&as_fast_as_possible, pJson["asFastAsPossible"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&playlist, pJson["playlist"], "QList", "QString");
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -131,6 +151,12 @@ SWGFileInputSettings::asJsonObject() {
     if(m_loop_isSet){
         obj->insert("loop", QJsonValue(loop));
     }
+    if(m_as_fast_as_possible_isSet){
+        obj->insert("asFastAsPossible", QJsonValue(as_fast_as_possible));
+    }
+    if(playlist && playlist->size() > 0){
+        toJsonArray((QList<void*>*)playlist, obj, "playlist", "QString");
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -177,6 +203,26 @@ SWGFileInputSettings::setLoop(qint32 loop) {
     this->m_loop_isSet = true;
 }
 
+qint32
+SWGFileInputSettings::getAsFastAsPossible() {
+    return as_fast_as_possible;
+}
+void
+SWGFileInputSettings::setAsFastAsPossible(qint32 as_fast_as_possible) {
+    this->as_fast_as_possible = as_fast_as_possible;
+    this->m_as_fast_as_possible_isSet = true;
+}
+
+QList<QString*>*
+SWGFileInputSettings::getPlaylist() {
+    return playlist;
+}
+void
+SWGFileInputSettings::setPlaylist(QList<QString*>* playlist) {
+    this->playlist = playlist;
+    this->m_playlist_isSet = true;
+}
+
 qint32
 SWGFileInputSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -231,6 +277,12 @@ SWGFileInputSettings::isSet(){
         if(m_loop_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_as_fast_as_possible_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(playlist && (playlist->size() > 0)){
+            isObjectUpdated = true; break;
+        }
         if(m_use_reverse_api_isSet){
             isObjectUpdated = true; break;
         }
@@ -22,6 +22,7 @@
 #include <QJsonObject>
 
 
+#include <QList>
 #include <QString>
 
 #include "SWGObject.h"
@@ -51,6 +52,12 @@ public:
     qint32 getLoop();
     void setLoop(qint32 loop);
 
+    qint32 getAsFastAsPossible();
+    void setAsFastAsPossible(qint32 as_fast_as_possible);
+
+    QList<QString*>* getPlaylist();
+    void setPlaylist(QList<QString*>* playlist);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -76,6 +83,12 @@ private:
     qint32 loop;
     bool m_loop_isSet;
 
+    qint32 as_fast_as_possible;
+    bool m_as_fast_as_possible_isSet;
+
+    QList<QString*>* playlist;
+    bool m_playlist_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
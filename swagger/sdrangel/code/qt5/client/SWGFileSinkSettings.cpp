@@ -48,6 +48,8 @@ SWGFileSinkSettings::SWGFileSinkSettings() {
     m_squelch_post_record_time_isSet = false;
     squelch_recording_enable = 0;
     m_squelch_recording_enable_isSet = false;
+    direct_io = 0;
+    m_direct_io_isSet = false;
     stream_index = 0;
     m_stream_index_isSet = false;
     use_reverse_api = 0;
@@ -94,6 +96,8 @@ SWGFileSinkSettings::init() {
     m_squelch_post_record_time_isSet = false;
     squelch_recording_enable = 0;
     m_squelch_recording_enable_isSet = false;
+    direct_io = 0;
+    m_direct_io_isSet = false;
     stream_index = 0;
     m_stream_index_isSet = false;
     use_reverse_api = 0;
@@ -180,6 +184,8 @@ SWGFileSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&squelch_recording_enable, pJson["squelchRecordingEnable"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&direct_io, pJson["directIO"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&stream_index, pJson["streamIndex"], "qint32", "");
     
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
@@ -244,6 +250,9 @@ SWGFileSinkSettings::asJsonObject() {
     if(m_squelch_recording_enable_isSet){
         obj->insert("squelchRecordingEnable", QJsonValue(squelch_recording_enable));
     }
+    if(m_direct_io_isSet){
+        obj->insert("directIO", QJsonValue(direct_io));
+    }
     if(m_stream_index_isSet){
         obj->insert("streamIndex", QJsonValue(stream_index));
     }
@@ -375,6 +384,16 @@ SWGFileSinkSettings::setSquelchRecordingEnable(qint32 squelch_recording_enable)
     this->m_squelch_recording_enable_isSet = true;
 }
 
+qint32
+SWGFileSinkSettings::getDirectIo() {
+    return direct_io;
+}
+void
+SWGFileSinkSettings::setDirectIo(qint32 direct_io) {
+    this->direct_io = direct_io;
+    this->m_direct_io_isSet = true;
+}
+
 qint32
 SWGFileSinkSettings::getStreamIndex() {
     return stream_index;
@@ -500,6 +519,9 @@ SWGFileSinkSettings::isSet(){
         if(m_squelch_recording_enable_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_direct_io_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_stream_index_isSet){
             isObjectUpdated = true; break;
         }
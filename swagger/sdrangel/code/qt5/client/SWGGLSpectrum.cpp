@@ -70,6 +70,8 @@ SWGGLSpectrum::SWGGLSpectrum() {
     m_averaging_value_isSet = false;
     linear = 0;
     m_linear_isSet = false;
+    fast_log = 0;
+    m_fast_log_isSet = false;
     ssb = 0;
     m_ssb_isSet = false;
     usb = 0;
@@ -144,6 +146,8 @@ SWGGLSpectrum::init() {
     m_averaging_value_isSet = false;
     linear = 0;
     m_linear_isSet = false;
+    fast_log = 0;
+    m_fast_log_isSet = false;
     ssb = 0;
     m_ssb_isSet = false;
     usb = 0;
@@ -286,6 +290,8 @@ SWGGLSpectrum::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&linear, pJson["linear"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&fast_log, pJson["fastLog"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&ssb, pJson["ssb"], "qint32", "");
     
     ::SWGSDRangel::setValue(&usb, pJson["usb"], "qint32", "");
@@ -389,6 +395,9 @@ SWGGLSpectrum::asJsonObject() {
     if(m_linear_isSet){
         obj->insert("linear", QJsonValue(linear));
     }
+    if(m_fast_log_isSet){
+        obj->insert("fastLog", QJsonValue(fast_log));
+    }
     if(m_ssb_isSet){
         obj->insert("ssb", QJsonValue(ssb));
     }
@@ -639,6 +648,16 @@ SWGGLSpectrum::setLinear(qint32 linear) {
     this->m_linear_isSet = true;
 }
 
+qint32
+SWGGLSpectrum::getFastLog() {
+    return fast_log;
+}
+void
+SWGGLSpectrum::setFastLog(qint32 fast_log) {
+    this->fast_log = fast_log;
+    this->m_fast_log_isSet = true;
+}
+
 qint32
 SWGGLSpectrum::getSsb() {
     return ssb;
@@ -827,6 +846,9 @@ SWGGLSpectrum::isSet(){
         if(m_linear_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_fast_log_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_ssb_isSet){
             isObjectUpdated = true; break;
         }
@@ -110,6 +110,9 @@ public:
     qint32 getLinear();
     void setLinear(qint32 linear);
 
+    qint32 getFastLog();
+    void setFastLog(qint32 fast_log);
+
     qint32 getSsb();
     void setSsb(qint32 ssb);
 
@@ -213,6 +216,9 @@ private:
     qint32 linear;
     bool m_linear_isSet;
 
+    qint32 fast_log;
+    bool m_fast_log_isSet;
+
     qint32 ssb;
     bool m_ssb_isSet;
 
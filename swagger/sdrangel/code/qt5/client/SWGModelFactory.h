@@ -14,6 +14,7 @@
 #define ModelFactory_H_
 
 
+#include "SWGADSBDemodAircraftState.h"
 #include "SWGADSBDemodReport.h"
 #include "SWGADSBDemodSettings.h"
 #include "SWGAFCActions.h"
@@ -79,6 +80,7 @@
 #include "SWGChannelReport.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelsDetail.h"
+#include "SWGChirpChatDemodExtraChannel.h"
 #include "SWGChirpChatDemodReport.h"
 #include "SWGChirpChatDemodSettings.h"
 #include "SWGChirpChatModReport.h"
@@ -269,6 +271,7 @@
 #include "SWGSSBModReport.h"
 #include "SWGSSBModSettings.h"
 #include "SWGSampleRate.h"
+#include "SWGSampleSinkReport.h"
 #include "SWGSamplingDevice.h"
 #include "SWGSatelliteDeviceSettings.h"
 #include "SWGSatelliteDeviceSettingsList.h"
@@ -342,6 +345,11 @@
 namespace SWGSDRangel {
 
   inline void* create(QString type) {
+    if(QString("SWGADSBDemodAircraftState").compare(type) == 0) {
+      SWGADSBDemodAircraftState *obj = new SWGADSBDemodAircraftState();
+      obj->init();
+      return obj;
+    }
     if(QString("SWGADSBDemodReport").compare(type) == 0) {
       SWGADSBDemodReport *obj = new SWGADSBDemodReport();
       obj->init();
@@ -667,6 +675,11 @@ namespace SWGSDRangel {
       obj->init();
       return obj;
     }
+    if(QString("SWGChirpChatDemodExtraChannel").compare(type) == 0) {
+      SWGChirpChatDemodExtraChannel *obj = new SWGChirpChatDemodExtraChannel();
+      obj->init();
+      return obj;
+    }
     if(QString("SWGChirpChatDemodReport").compare(type) == 0) {
       SWGChirpChatDemodReport *obj = new SWGChirpChatDemodReport();
       obj->init();
@@ -1617,6 +1630,11 @@ namespace SWGSDRangel {
       obj->init();
       return obj;
     }
+    if(QString("SWGSampleSinkReport").compare(type) == 0) {
+      SWGSampleSinkReport *obj = new SWGSampleSinkReport();
+      obj->init();
+      return obj;
+    }
     if(QString("SWGSamplingDevice").compare(type) == 0) {
       SWGSamplingDevice *obj = new SWGSamplingDevice();
       obj->init();
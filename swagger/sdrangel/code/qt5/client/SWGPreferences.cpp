@@ -48,6 +48,12 @@ SWGPreferences::SWGPreferences() {
     m_log_file_name_isSet = false;
     file_min_log_level = 0;
     m_file_min_log_level_isSet = false;
+    fftw_threads = 0;
+    m_fftw_threads_isSet = false;
+    fftw_min_threaded_size = 0;
+    m_fftw_min_threaded_size_isSet = false;
+    fftw_background_planning = 0;
+    m_fftw_background_planning_isSet = false;
 }
 
 SWGPreferences::~SWGPreferences() {
@@ -76,6 +82,12 @@ SWGPreferences::init() {
     m_log_file_name_isSet = false;
     file_min_log_level = 0;
     m_file_min_log_level_isSet = false;
+    fftw_threads = 0;
+    m_fftw_threads_isSet = false;
+    fftw_min_threaded_size = 0;
+    m_fftw_min_threaded_size_isSet = false;
+    fftw_background_planning = 0;
+    m_fftw_background_planning_isSet = false;
 }
 
 void
@@ -131,6 +143,12 @@ SWGPreferences::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&file_min_log_level, pJson["fileMinLogLevel"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&fftw_threads, pJson["fftwThreads"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fftw_min_threaded_size, pJson["fftwMinThreadedSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fftw_background_planning, pJson["fftwBackgroundPlanning"], "qint32", "");
+    
 }
 
 QString
@@ -177,6 +195,15 @@ SWGPreferences::asJsonObject() {
     if(m_file_min_log_level_isSet){
         obj->insert("fileMinLogLevel", QJsonValue(file_min_log_level));
     }
+    if(m_fftw_threads_isSet){
+        obj->insert("fftwThreads", QJsonValue(fftw_threads));
+    }
+    if(m_fftw_min_threaded_size_isSet){
+        obj->insert("fftwMinThreadedSize", QJsonValue(fftw_min_threaded_size));
+    }
+    if(m_fftw_background_planning_isSet){
+        obj->insert("fftwBackgroundPlanning", QJsonValue(fftw_background_planning));
+    }
 
     return obj;
 }
@@ -281,6 +308,36 @@ SWGPreferences::setFileMinLogLevel(qint32 file_min_log_level) {
     this->m_file_min_log_level_isSet = true;
 }
 
+qint32
+SWGPreferences::getFftwThreads() {
+    return fftw_threads;
+}
+void
+SWGPreferences::setFftwThreads(qint32 fftw_threads) {
+    this->fftw_threads = fftw_threads;
+    this->m_fftw_threads_isSet = true;
+}
+
+qint32
+SWGPreferences::getFftwMinThreadedSize() {
+    return fftw_min_threaded_size;
+}
+void
+SWGPreferences::setFftwMinThreadedSize(qint32 fftw_min_threaded_size) {
+    this->fftw_min_threaded_size = fftw_min_threaded_size;
+    this->m_fftw_min_threaded_size_isSet = true;
+}
+
+qint32
+SWGPreferences::getFftwBackgroundPlanning() {
+    return fftw_background_planning;
+}
+void
+SWGPreferences::setFftwBackgroundPlanning(qint32 fftw_background_planning) {
+    this->fftw_background_planning = fftw_background_planning;
+    this->m_fftw_background_planning_isSet = true;
+}
+
 
 bool
 SWGPreferences::isSet(){
@@ -316,6 +373,15 @@ SWGPreferences::isSet(){
         if(m_file_min_log_level_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_fftw_threads_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fftw_min_threaded_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fftw_background_planning_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -72,6 +72,15 @@ public:
     qint32 getFileMinLogLevel();
     void setFileMinLogLevel(qint32 file_min_log_level);
 
+    qint32 getFftwThreads();
+    void setFftwThreads(qint32 fftw_threads);
+
+    qint32 getFftwMinThreadedSize();
+    void setFftwMinThreadedSize(qint32 fftw_min_threaded_size);
+
+    qint32 getFftwBackgroundPlanning();
+    void setFftwBackgroundPlanning(qint32 fftw_background_planning);
+
 
     virtual bool isSet() override;
 
@@ -106,6 +115,15 @@ private:
     qint32 file_min_log_level;
     bool m_file_min_log_level_isSet;
 
+    qint32 fftw_threads;
+    bool m_fftw_threads_isSet;
+
+    qint32 fftw_min_threaded_size;
+    bool m_fftw_min_threaded_size_isSet;
+
+    qint32 fftw_background_planning;
+    bool m_fftw_background_planning_isSet;
+
 };
 
 }
@@ -44,6 +44,8 @@ SWGRemoteInputSettings::SWGRemoteInputSettings() {
     m_dc_block_isSet = false;
     iq_correction = 0;
     m_iq_correction_isSet = false;
+    adaptive_fec = 0;
+    m_adaptive_fec_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -76,6 +78,8 @@ SWGRemoteInputSettings::init() {
     m_dc_block_isSet = false;
     iq_correction = 0;
     m_iq_correction_isSet = false;
+    adaptive_fec = 0;
+    m_adaptive_fec_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -137,6 +141,8 @@ SWGRemoteInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&iq_correction, pJson["iqCorrection"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&adaptive_fec, pJson["adaptiveFEC"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -185,6 +191,9 @@ SWGRemoteInputSettings::asJsonObject() {
     if(m_iq_correction_isSet){
         obj->insert("iqCorrection", QJsonValue(iq_correction));
     }
+    if(m_adaptive_fec_isSet){
+        obj->insert("adaptiveFEC", QJsonValue(adaptive_fec));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -281,6 +290,16 @@ SWGRemoteInputSettings::setIqCorrection(qint32 iq_correction) {
     this->m_iq_correction_isSet = true;
 }
 
+qint32
+SWGRemoteInputSettings::getAdaptiveFec() {
+    return adaptive_fec;
+}
+void
+SWGRemoteInputSettings::setAdaptiveFec(qint32 adaptive_fec) {
+    this->adaptive_fec = adaptive_fec;
+    this->m_adaptive_fec_isSet = true;
+}
+
 qint32
 SWGRemoteInputSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -350,6 +369,9 @@ SWGRemoteInputSettings::isSet(){
         if(m_iq_correction_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_adaptive_fec_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_use_reverse_api_isSet){
             isObjectUpdated = true; break;
         }
@@ -66,6 +66,9 @@ public:
     qint32 getIqCorrection();
     void setIqCorrection(qint32 iq_correction);
 
+    qint32 getAdaptiveFec();
+    void setAdaptiveFec(qint32 adaptive_fec);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -106,6 +109,9 @@ private:
     qint32 iq_correction;
     bool m_iq_correction_isSet;
 
+    qint32 adaptive_fec;
+    bool m_adaptive_fec_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
@@ -60,6 +60,8 @@ SWGRemoteTCPInputSettings::SWGRemoteTCPInputSettings() {
     m_channel_decimation_isSet = false;
     sample_bits = 0;
     m_sample_bits_isSet = false;
+    compression = 0;
+    m_compression_isSet = false;
     data_address = nullptr;
     m_data_address_isSet = false;
     data_port = 0;
@@ -116,6 +118,8 @@ SWGRemoteTCPInputSettings::init() {
     m_channel_decimation_isSet = false;
     sample_bits = 0;
     m_sample_bits_isSet = false;
+    compression = 0;
+    m_compression_isSet = false;
     data_address = new QString("");
     m_data_address_isSet = false;
     data_port = 0;
@@ -209,6 +213,8 @@ SWGRemoteTCPInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&sample_bits, pJson["sampleBits"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&compression, pJson["compression"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&data_address, pJson["dataAddress"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&data_port, pJson["dataPort"], "qint32", "");
@@ -289,6 +295,9 @@ SWGRemoteTCPInputSettings::asJsonObject() {
     if(m_sample_bits_isSet){
         obj->insert("sampleBits", QJsonValue(sample_bits));
     }
+    if(m_compression_isSet){
+        obj->insert("compression", QJsonValue(compression));
+    }
     if(data_address != nullptr && *data_address != QString("")){
         toJsonValue(QString("dataAddress"), data_address, obj, QString("QString"));
     }
@@ -477,6 +486,16 @@ SWGRemoteTCPInputSettings::setSampleBits(qint32 sample_bits) {
     this->m_sample_bits_isSet = true;
 }
 
+qint32
+SWGRemoteTCPInputSettings::getCompression() {
+    return compression;
+}
+void
+SWGRemoteTCPInputSettings::setCompression(qint32 compression) {
+    this->compression = compression;
+    this->m_compression_isSet = true;
+}
+
 QString*
 SWGRemoteTCPInputSettings::getDataAddress() {
     return data_address;
@@ -610,6 +629,9 @@ SWGRemoteTCPInputSettings::isSet(){
         if(m_sample_bits_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_compression_isSet){
+            isObjectUpdated = true; break;
+        }
         if(data_address && *data_address != QString("")){
             isObjectUpdated = true; break;
         }
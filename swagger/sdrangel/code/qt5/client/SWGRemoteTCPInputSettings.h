@@ -90,6 +90,9 @@ public:
     qint32 getSampleBits();
     void setSampleBits(qint32 sample_bits);
 
+    qint32 getCompression();
+    void setCompression(qint32 compression);
+
     QString* getDataAddress();
     void setDataAddress(QString* data_address);
 
@@ -166,6 +169,9 @@ private:
     qint32 sample_bits;
     bool m_sample_bits_isSet;
 
+    qint32 compression;
+    bool m_compression_isSet;
+
     QString* data_address;
     bool m_data_address_isSet;
 
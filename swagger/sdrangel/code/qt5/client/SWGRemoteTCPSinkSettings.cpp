@@ -36,6 +36,8 @@ SWGRemoteTCPSinkSettings::SWGRemoteTCPSinkSettings() {
     m_gain_isSet = false;
     sample_bits = 0;
     m_sample_bits_isSet = false;
+    compression = 0;
+    m_compression_isSet = false;
     data_address = nullptr;
     m_data_address_isSet = false;
     data_port = 0;
@@ -78,6 +80,8 @@ SWGRemoteTCPSinkSettings::init() {
     m_gain_isSet = false;
     sample_bits = 0;
     m_sample_bits_isSet = false;
+    compression = 0;
+    m_compression_isSet = false;
     data_address = new QString("");
     m_data_address_isSet = false;
     data_port = 0;
@@ -156,6 +160,8 @@ SWGRemoteTCPSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&sample_bits, pJson["sampleBits"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&compression, pJson["compression"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&data_address, pJson["dataAddress"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&data_port, pJson["dataPort"], "qint32", "");
@@ -210,6 +216,9 @@ SWGRemoteTCPSinkSettings::asJsonObject() {
     if(m_sample_bits_isSet){
         obj->insert("sampleBits", QJsonValue(sample_bits));
     }
+    if(m_compression_isSet){
+        obj->insert("compression", QJsonValue(compression));
+    }
     if(data_address != nullptr && *data_address != QString("")){
         toJsonValue(QString("dataAddress"), data_address, obj, QString("QString"));
     }
@@ -293,6 +302,16 @@ SWGRemoteTCPSinkSettings::setSampleBits(qint32 sample_bits) {
     this->m_sample_bits_isSet = true;
 }
 
+qint32
+SWGRemoteTCPSinkSettings::getCompression() {
+    return compression;
+}
+void
+SWGRemoteTCPSinkSettings::setCompression(qint32 compression) {
+    this->compression = compression;
+    this->m_compression_isSet = true;
+}
+
 QString*
 SWGRemoteTCPSinkSettings::getDataAddress() {
     return data_address;
@@ -440,6 +459,9 @@ SWGRemoteTCPSinkSettings::isSet(){
         if(m_sample_bits_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_compression_isSet){
+            isObjectUpdated = true; break;
+        }
         if(data_address && *data_address != QString("")){
             isObjectUpdated = true; break;
         }
@@ -0,0 +1,225 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 7.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSampleSinkReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSampleSinkReport::SWGSampleSinkReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSampleSinkReport::SWGSampleSinkReport() {
+    sink_name = nullptr;
+    m_sink_name_isSet = false;
+    blocks = 0L;
+    m_blocks_isSet = false;
+    samples = 0L;
+    m_samples_isSet = false;
+    dropped_blocks = 0L;
+    m_dropped_blocks_isSet = false;
+    queue_depth = 0;
+    m_queue_depth_isSet = false;
+    max_queue_depth = 0;
+    m_max_queue_depth_isSet = false;
+}
+
+SWGSampleSinkReport::~SWGSampleSinkReport() {
+    this->cleanup();
+}
+
+void
+SWGSampleSinkReport::init() {
+    sink_name = new QString("");
+    m_sink_name_isSet = false;
+    blocks = 0L;
+    m_blocks_isSet = false;
+    samples = 0L;
+    m_samples_isSet = false;
+    dropped_blocks = 0L;
+    m_dropped_blocks_isSet = false;
+    queue_depth = 0;
+    m_queue_depth_isSet = false;
+    max_queue_depth = 0;
+    m_max_queue_depth_isSet = false;
+}
+
+void
+SWGSampleSinkReport::cleanup() {
+    if(sink_name != nullptr) { 
+        delete sink_name;
+    }
+
+
+
+
+
+}
+
+SWGSampleSinkReport*
+SWGSampleSinkReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSampleSinkReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&sink_name, pJson["sinkName"], "QString", "");
+    
+    ::SWGSDRangel::setValue(&blocks, pJson["blocks"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&samples, pJson["samples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dropped_blocks, pJson["droppedBlocks"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&queue_depth, pJson["queueDepth"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&max_queue_depth, pJson["maxQueueDepth"], "qint32", "");
+    
+}
+
+QString
+SWGSampleSinkReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSampleSinkReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(sink_name != nullptr && *sink_name != QString("")){
+        toJsonValue(QString("sinkName"), sink_name, obj, QString("QString"));
+    }
+    if(m_blocks_isSet){
+        obj->insert("blocks", QJsonValue(blocks));
+    }
+    if(m_samples_isSet){
+        obj->insert("samples", QJsonValue(samples));
+    }
+    if(m_dropped_blocks_isSet){
+        obj->insert("droppedBlocks", QJsonValue(dropped_blocks));
+    }
+    if(m_queue_depth_isSet){
+        obj->insert("queueDepth", QJsonValue(queue_depth));
+    }
+    if(m_max_queue_depth_isSet){
+        obj->insert("maxQueueDepth", QJsonValue(max_queue_depth));
+    }
+
+    return obj;
+}
+
+QString*
+SWGSampleSinkReport::getSinkName() {
+    return sink_name;
+}
+void
+SWGSampleSinkReport::setSinkName(QString* sink_name) {
+    this->sink_name = sink_name;
+    this->m_sink_name_isSet = true;
+}
+
+qint64
+SWGSampleSinkReport::getBlocks() {
+    return blocks;
+}
+void
+SWGSampleSinkReport::setBlocks(qint64 blocks) {
+    this->blocks = blocks;
+    this->m_blocks_isSet = true;
+}
+
+qint64
+SWGSampleSinkReport::getSamples() {
+    return samples;
+}
+void
+SWGSampleSinkReport::setSamples(qint64 samples) {
+    this->samples = samples;
+    this->m_samples_isSet = true;
+}
+
+qint64
+SWGSampleSinkReport::getDroppedBlocks() {
+    return dropped_blocks;
+}
+void
+SWGSampleSinkReport::setDroppedBlocks(qint64 dropped_blocks) {
+    this->dropped_blocks = dropped_blocks;
+    this->m_dropped_blocks_isSet = true;
+}
+
+qint32
+SWGSampleSinkReport::getQueueDepth() {
+    return queue_depth;
+}
+void
+SWGSampleSinkReport::setQueueDepth(qint32 queue_depth) {
+    this->queue_depth = queue_depth;
+    this->m_queue_depth_isSet = true;
+}
+
+qint32
+SWGSampleSinkReport::getMaxQueueDepth() {
+    return max_queue_depth;
+}
+void
+SWGSampleSinkReport::setMaxQueueDepth(qint32 max_queue_depth) {
+    this->max_queue_depth = max_queue_depth;
+    this->m_max_queue_depth_isSet = true;
+}
+
+
+bool
+SWGSampleSinkReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(sink_name && *sink_name != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dropped_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_queue_depth_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_queue_depth_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
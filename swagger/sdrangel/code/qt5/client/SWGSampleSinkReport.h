@@ -0,0 +1,89 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 7.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSampleSinkReport.h
+ *
+ * Baseband sample sink fan out statistics
+ */
+
+#ifndef SWGSampleSinkReport_H_
+#define SWGSampleSinkReport_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSampleSinkReport: public SWGObject {
+public:
+    SWGSampleSinkReport();
+    SWGSampleSinkReport(QString* json);
+    virtual ~SWGSampleSinkReport();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSampleSinkReport* fromJson(QString &jsonString) override;
+
+    QString* getSinkName();
+    void setSinkName(QString* sink_name);
+
+    qint64 getBlocks();
+    void setBlocks(qint64 blocks);
+
+    qint64 getSamples();
+    void setSamples(qint64 samples);
+
+    qint64 getDroppedBlocks();
+    void setDroppedBlocks(qint64 dropped_blocks);
+
+    qint32 getQueueDepth();
+    void setQueueDepth(qint32 queue_depth);
+
+    qint32 getMaxQueueDepth();
+    void setMaxQueueDepth(qint32 max_queue_depth);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* sink_name;
+    bool m_sink_name_isSet;
+
+    qint64 blocks;
+    bool m_blocks_isSet;
+
+    qint64 samples;
+    bool m_samples_isSet;
+
+    qint64 dropped_blocks;
+    bool m_dropped_blocks_isSet;
+
+    qint32 queue_depth;
+    bool m_queue_depth_isSet;
+
+    qint32 max_queue_depth;
+    bool m_max_queue_depth_isSet;
+
+};
+
+}
+
+#endif /* SWGSampleSinkReport_H_ */
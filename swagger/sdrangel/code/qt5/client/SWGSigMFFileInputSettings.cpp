@@ -36,6 +36,8 @@ SWGSigMFFileInputSettings::SWGSigMFFileInputSettings() {
     m_track_loop_isSet = false;
     full_loop = 0;
     m_full_loop_isSet = false;
+    as_fast_as_possible = 0;
+    m_as_fast_as_possible_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -60,6 +62,8 @@ SWGSigMFFileInputSettings::init() {
     m_track_loop_isSet = false;
     full_loop = 0;
     m_full_loop_isSet = false;
+    as_fast_as_possible = 0;
+    m_as_fast_as_possible_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -105,6 +109,8 @@ SWGSigMFFileInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&full_loop, pJson["fullLoop"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&as_fast_as_possible, pJson["asFastAsPossible"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -141,6 +147,9 @@ SWGSigMFFileInputSettings::asJsonObject() {
     if(m_full_loop_isSet){
         obj->insert("fullLoop", QJsonValue(full_loop));
     }
+    if(m_as_fast_as_possible_isSet){
+        obj->insert("asFastAsPossible", QJsonValue(as_fast_as_possible));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -197,6 +206,16 @@ SWGSigMFFileInputSettings::setFullLoop(qint32 full_loop) {
     this->m_full_loop_isSet = true;
 }
 
+qint32
+SWGSigMFFileInputSettings::getAsFastAsPossible() {
+    return as_fast_as_possible;
+}
+void
+SWGSigMFFileInputSettings::setAsFastAsPossible(qint32 as_fast_as_possible) {
+    this->as_fast_as_possible = as_fast_as_possible;
+    this->m_as_fast_as_possible_isSet = true;
+}
+
 qint32
 SWGSigMFFileInputSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -254,6 +273,9 @@ SWGSigMFFileInputSettings::isSet(){
         if(m_full_loop_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_as_fast_as_possible_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_use_reverse_api_isSet){
             isObjectUpdated = true; break;
         }
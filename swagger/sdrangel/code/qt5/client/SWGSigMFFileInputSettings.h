@@ -54,6 +54,9 @@ public:
     qint32 getFullLoop();
     void setFullLoop(qint32 full_loop);
 
+    qint32 getAsFastAsPossible();
+    void setAsFastAsPossible(qint32 as_fast_as_possible);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -82,6 +85,9 @@ private:
     qint32 full_loop;
     bool m_full_loop_isSet;
 
+    qint32 as_fast_as_possible;
+    bool m_as_fast_as_possible_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
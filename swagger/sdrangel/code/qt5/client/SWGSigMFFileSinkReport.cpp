@@ -44,6 +44,12 @@ SWGSigMFFileSinkReport::SWGSigMFFileSinkReport() {
     m_record_size_isSet = false;
     record_captures = 0;
     m_record_captures_isSet = false;
+    record_dropped_bytes = 0L;
+    m_record_dropped_bytes_isSet = false;
+    record_write_stalls = 0;
+    m_record_write_stalls_isSet = false;
+    record_max_pending_buffers = 0;
+    m_record_max_pending_buffers_isSet = false;
 }
 
 SWGSigMFFileSinkReport::~SWGSigMFFileSinkReport() {
@@ -68,6 +74,12 @@ SWGSigMFFileSinkReport::init() {
     m_record_size_isSet = false;
     record_captures = 0;
     m_record_captures_isSet = false;
+    record_dropped_bytes = 0L;
+    m_record_dropped_bytes_isSet = false;
+    record_write_stalls = 0;
+    m_record_write_stalls_isSet = false;
+    record_max_pending_buffers = 0;
+    m_record_max_pending_buffers_isSet = false;
 }
 
 void
@@ -109,6 +121,12 @@ SWGSigMFFileSinkReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&record_captures, pJson["recordCaptures"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&record_dropped_bytes, pJson["recordDroppedBytes"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&record_write_stalls, pJson["recordWriteStalls"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&record_max_pending_buffers, pJson["recordMaxPendingBuffers"], "qint32", "");
+    
 }
 
 QString
@@ -149,6 +167,15 @@ SWGSigMFFileSinkReport::asJsonObject() {
     if(m_record_captures_isSet){
         obj->insert("recordCaptures", QJsonValue(record_captures));
     }
+    if(m_record_dropped_bytes_isSet){
+        obj->insert("recordDroppedBytes", QJsonValue(record_dropped_bytes));
+    }
+    if(m_record_write_stalls_isSet){
+        obj->insert("recordWriteStalls", QJsonValue(record_write_stalls));
+    }
+    if(m_record_max_pending_buffers_isSet){
+        obj->insert("recordMaxPendingBuffers", QJsonValue(record_max_pending_buffers));
+    }
 
     return obj;
 }
@@ -233,6 +260,36 @@ SWGSigMFFileSinkReport::setRecordCaptures(qint32 record_captures) {
     this->m_record_captures_isSet = true;
 }
 
+qint64
+SWGSigMFFileSinkReport::getRecordDroppedBytes() {
+    return record_dropped_bytes;
+}
+void
+SWGSigMFFileSinkReport::setRecordDroppedBytes(qint64 record_dropped_bytes) {
+    this->record_dropped_bytes = record_dropped_bytes;
+    this->m_record_dropped_bytes_isSet = true;
+}
+
+qint32
+SWGSigMFFileSinkReport::getRecordWriteStalls() {
+    return record_write_stalls;
+}
+void
+SWGSigMFFileSinkReport::setRecordWriteStalls(qint32 record_write_stalls) {
+    this->record_write_stalls = record_write_stalls;
+    this->m_record_write_stalls_isSet = true;
+}
+
+qint32
+SWGSigMFFileSinkReport::getRecordMaxPendingBuffers() {
+    return record_max_pending_buffers;
+}
+void
+SWGSigMFFileSinkReport::setRecordMaxPendingBuffers(qint32 record_max_pending_buffers) {
+    this->record_max_pending_buffers = record_max_pending_buffers;
+    this->m_record_max_pending_buffers_isSet = true;
+}
+
 
 bool
 SWGSigMFFileSinkReport::isSet(){
@@ -262,6 +319,15 @@ SWGSigMFFileSinkReport::isSet(){
         if(m_record_captures_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_record_dropped_bytes_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_record_write_stalls_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_record_max_pending_buffers_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -65,6 +65,15 @@ public:
     qint32 getRecordCaptures();
     void setRecordCaptures(qint32 record_captures);
 
+    qint64 getRecordDroppedBytes();
+    void setRecordDroppedBytes(qint64 record_dropped_bytes);
+
+    qint32 getRecordWriteStalls();
+    void setRecordWriteStalls(qint32 record_write_stalls);
+
+    qint32 getRecordMaxPendingBuffers();
+    void setRecordMaxPendingBuffers(qint32 record_max_pending_buffers);
+
 
     virtual bool isSet() override;
 
@@ -93,6 +102,15 @@ private:
     qint32 record_captures;
     bool m_record_captures_isSet;
 
+    qint64 record_dropped_bytes;
+    bool m_record_dropped_bytes_isSet;
+
+    qint32 record_write_stalls;
+    bool m_record_write_stalls_isSet;
+
+    qint32 record_max_pending_buffers;
+    bool m_record_max_pending_buffers_isSet;
+
 };
 
 }
@@ -32,6 +32,12 @@ SWGSpectrumServer_clients::SWGSpectrumServer_clients() {
     m_address_isSet = false;
     port = 0;
     m_port_isSet = false;
+    backlog_bytes = 0;
+    m_backlog_bytes_isSet = false;
+    sent_frames = 0;
+    m_sent_frames_isSet = false;
+    dropped_frames = 0;
+    m_dropped_frames_isSet = false;
 }
 
 SWGSpectrumServer_clients::~SWGSpectrumServer_clients() {
@@ -44,6 +50,12 @@ SWGSpectrumServer_clients::init() {
     m_address_isSet = false;
     port = 0;
     m_port_isSet = false;
+    backlog_bytes = 0;
+    m_backlog_bytes_isSet = false;
+    sent_frames = 0;
+    m_sent_frames_isSet = false;
+    dropped_frames = 0;
+    m_dropped_frames_isSet = false;
 }
 
 void
@@ -69,6 +81,12 @@ SWGSpectrumServer_clients::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&port, pJson["port"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&backlog_bytes, pJson["backlogBytes"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sent_frames, pJson["sentFrames"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&dropped_frames, pJson["droppedFrames"], "qint32", "");
+    
 }
 
 QString
@@ -91,6 +109,15 @@ SWGSpectrumServer_clients::asJsonObject() {
     if(m_port_isSet){
         obj->insert("port", QJsonValue(port));
     }
+    if(m_backlog_bytes_isSet){
+        obj->insert("backlogBytes", QJsonValue(backlog_bytes));
+    }
+    if(m_sent_frames_isSet){
+        obj->insert("sentFrames", QJsonValue(sent_frames));
+    }
+    if(m_dropped_frames_isSet){
+        obj->insert("droppedFrames", QJsonValue(dropped_frames));
+    }
 
     return obj;
 }
@@ -115,6 +142,36 @@ SWGSpectrumServer_clients::setPort(qint32 port) {
     this->m_port_isSet = true;
 }
 
+qint32
+SWGSpectrumServer_clients::getBacklogBytes() {
+    return backlog_bytes;
+}
+void
+SWGSpectrumServer_clients::setBacklogBytes(qint32 backlog_bytes) {
+    this->backlog_bytes = backlog_bytes;
+    this->m_backlog_bytes_isSet = true;
+}
+
+qint32
+SWGSpectrumServer_clients::getSentFrames() {
+    return sent_frames;
+}
+void
+SWGSpectrumServer_clients::setSentFrames(qint32 sent_frames) {
+    this->sent_frames = sent_frames;
+    this->m_sent_frames_isSet = true;
+}
+
+qint32
+SWGSpectrumServer_clients::getDroppedFrames() {
+    return dropped_frames;
+}
+void
+SWGSpectrumServer_clients::setDroppedFrames(qint32 dropped_frames) {
+    this->dropped_frames = dropped_frames;
+    this->m_dropped_frames_isSet = true;
+}
+
 
 bool
 SWGSpectrumServer_clients::isSet(){
@@ -126,6 +183,15 @@ SWGSpectrumServer_clients::isSet(){
         if(m_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_backlog_bytes_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sent_frames_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dropped_frames_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -48,6 +48,15 @@ public:
     qint32 getPort();
     void setPort(qint32 port);
 
+    qint32 getBacklogBytes();
+    void setBacklogBytes(qint32 backlog_bytes);
+
+    qint32 getSentFrames();
+    void setSentFrames(qint32 sent_frames);
+
+    qint32 getDroppedFrames();
+    void setDroppedFrames(qint32 dropped_frames);
+
 
     virtual bool isSet() override;
 
@@ -58,6 +67,15 @@ private:
     qint32 port;
     bool m_port_isSet;
 
+    qint32 backlog_bytes;
+    bool m_backlog_bytes_isSet;
+
+    qint32 sent_frames;
+    bool m_sent_frames_isSet;
+
+    qint32 dropped_frames;
+    bool m_dropped_frames_isSet;
+
 };
 
 }